@@ -0,0 +1,770 @@
+#include "BTBenchmark.h"
+#include "../Core/BTBlackboard.h"
+#include "../Core/BTCompiledTree.h"
+#include "../Core/BTLeafNode.h"
+#include "../Core/BTNodeRegistry.h"
+#include "../Core/BTStaticTree.h"
+#include "../Core/BTTreeCooker.h"
+#include "../Core/BTTreeInstance.h"
+#include "../Core/BTTreeLoader.h"
+#include "../Composites/BTSelector.h"
+#include "../Composites/BTSequence.h"
+#include "../Composites/BTRandomSelector.h"
+#include "Vector3.h"
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <memory_resource>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+    /// <summary>
+    /// 比較用の旧ブラックボード実装（unordered_map&lt;string, any&gt; + any_cast）
+    /// </summary>
+    class LegacyBlackboard {
+    public:
+        template<typename T>
+        std::optional<T> GetValue(const std::string& key) const {
+            auto it = data_.find(key);
+            if (it != data_.end()) {
+                try {
+                    return std::any_cast<T>(it->second);
+                }
+                catch (const std::bad_any_cast&) {
+                    return std::nullopt;
+                }
+            }
+            return std::nullopt;
+        }
+
+        void SetInt(const std::string& key, int value) { data_[key] = value; }
+        int GetInt(const std::string& key, int defaultValue = 0) const {
+            return GetValue<int>(key).value_or(defaultValue);
+        }
+
+        void SetFloat(const std::string& key, float value) { data_[key] = value; }
+        float GetFloat(const std::string& key, float defaultValue = 0.0f) const {
+            return GetValue<float>(key).value_or(defaultValue);
+        }
+
+        void SetVector3(const std::string& key, const Vector3& value) { data_[key] = value; }
+        Vector3 GetVector3(const std::string& key, const Vector3& defaultValue = Vector3()) const {
+            return GetValue<Vector3>(key).value_or(defaultValue);
+        }
+
+    private:
+        std::unordered_map<std::string, std::any> data_;
+    };
+
+    // 実際のツリーに近い状態にするためのダミーキー数
+    constexpr int kFillerKeyCount = 16;
+
+    // ツリーベンチマークで同時に実行するエージェント数
+    constexpr size_t kAgentCount = 256;
+
+    /// <summary>
+    /// 両実装に同じキー集合を登録する
+    /// </summary>
+    void Populate(LegacyBlackboard& legacy, BTBlackboard& blackboard) {
+        for (int i = 0; i < kFillerKeyCount; ++i) {
+            std::string key = "Filler" + std::to_string(i);
+            legacy.SetFloat(key, static_cast<float>(i));
+            blackboard.SetFloat(key, static_cast<float>(i));
+        }
+        legacy.SetInt("ActionCounter", 0);
+        blackboard.SetInt("ActionCounter", 0);
+        legacy.SetFloat("TargetDistance", 12.5f);
+        blackboard.SetFloat("TargetDistance", 12.5f);
+        legacy.SetVector3("LastPlayerPosition", Vector3(1.0f, 2.0f, 3.0f));
+        blackboard.SetVector3("LastPlayerPosition", Vector3(1.0f, 2.0f, 3.0f));
+    }
+
+    /// <summary>
+    /// 比較結果として基準値を設定して追加
+    /// </summary>
+    void PushCompared(std::vector<Benchmark::Result>& results, Benchmark::Result result, const Benchmark::Result& baseline) {
+        result.baselineNsPerOp = baseline.nsPerOp;
+        results.push_back(std::move(result));
+    }
+
+    /// <summary>
+    /// ツリー走査計測用のダミーリーフ
+    /// 条件は成功・失敗を、アクションは数フレームのRunningを決定的に繰り返す
+    /// </summary>
+    struct BenchmarkLeafState {
+        uint32_t tickCount = 0;
+    };
+
+    class BenchmarkLeaf : public BTLeafNode<BenchmarkLeafState> {
+    public:
+        BenchmarkLeaf(uint32_t seed, bool isCondition)
+            : seed_(seed), isCondition_(isCondition) {
+            name_ = isCondition ? "BenchmarkCondition" : "BenchmarkAction";
+        }
+
+        BTNodeStatus Tick(BTBlackboard* blackboard, BenchmarkLeafState& state) const override {
+            (void)blackboard;
+            ++state.tickCount;
+            if (isCondition_) {
+                return ((state.tickCount + seed_) % 3 != 0) ? BTNodeStatus::Success : BTNodeStatus::Failure;
+            }
+            return (state.tickCount % (seed_ % 4 + 1) == 0) ? BTNodeStatus::Success : BTNodeStatus::Running;
+        }
+
+    private:
+        uint32_t seed_ = 0;
+        bool isCondition_ = false;
+    };
+
+    /// <summary>
+    /// 固定の行動ツリー（BossBehaviorTree::BuildActionTreeと同じ形）のダミーリーフ版
+    /// </summary>
+    namespace StaticBenchmark {
+
+        using Idle = BTStatic::Leaf<BenchmarkLeaf, 1u, false>;
+        using IsDash = BTStatic::Leaf<BenchmarkLeaf, 0u, true>;
+        using Dash = BTStatic::Leaf<BenchmarkLeaf, 2u, false>;
+        using IsShoot = BTStatic::Leaf<BenchmarkLeaf, 1u, true>;
+        using Shoot = BTStatic::Leaf<BenchmarkLeaf, 3u, false>;
+
+        using Tree = BTStatic::Tree<BTStatic::Sequence<
+            Idle,
+            BTStatic::Selector<
+                BTStatic::Sequence<IsDash, Dash>,
+                BTStatic::Sequence<IsShoot, Shoot>>>>;
+
+    }
+
+    /// <summary>
+    /// StaticBenchmark::Treeと同じ形・同じリーフのポインタツリーを構築
+    /// </summary>
+    BTNodePtr BuildFixedActionTree() {
+        auto makeSequence = [](std::initializer_list<BTNodePtr> children) {
+            auto sequence = std::make_shared<BTSequence>();
+            for (const BTNodePtr& child : children) {
+                sequence->AddChild(child);
+            }
+            return sequence;
+        };
+
+        auto selector = std::make_shared<BTSelector>();
+        selector->AddChild(makeSequence({ std::make_shared<BenchmarkLeaf>(0u, true), std::make_shared<BenchmarkLeaf>(2u, false) }));
+        selector->AddChild(makeSequence({ std::make_shared<BenchmarkLeaf>(1u, true), std::make_shared<BenchmarkLeaf>(3u, false) }));
+        return makeSequence({ std::make_shared<BenchmarkLeaf>(1u, false), selector });
+    }
+
+    /// <summary>
+    /// ツリーJSONからダミーリーフのツリーを再帰的に構築
+    /// </summary>
+    BTNodePtr BuildBenchmarkNode(int nodeId,
+                                 const std::unordered_map<int, const nlohmann::json*>& nodeMap,
+                                 const std::unordered_map<int, std::vector<int>>& childMap,
+                                 std::unordered_set<int>& visitedNodes) {
+        auto nodeIt = nodeMap.find(nodeId);
+        if (nodeIt == nodeMap.end() || !visitedNodes.insert(nodeId).second) {
+            return nullptr;
+        }
+
+        const std::string type = (*nodeIt->second)["type"].get<std::string>();
+        std::shared_ptr<BTComposite> composite;
+        if (type == "BTSelector") {
+            composite = std::make_shared<BTSelector>();
+        }
+        else if (type == "BTSequence") {
+            composite = std::make_shared<BTSequence>();
+        }
+        else if (type == "BTRandomSelector") {
+            composite = std::make_shared<BTRandomSelector>();
+        }
+        else {
+            bool isCondition = type.find("Condition") != std::string::npos || type == "BTActionSelector";
+            return std::make_shared<BenchmarkLeaf>(static_cast<uint32_t>(nodeId), isCondition);
+        }
+
+        auto childIt = childMap.find(nodeId);
+        if (childIt != childMap.end()) {
+            for (int childId : childIt->second) {
+                if (BTNodePtr child = BuildBenchmarkNode(childId, nodeMap, childMap, visitedNodes)) {
+                    composite->AddChild(child);
+                }
+            }
+        }
+        return composite;
+    }
+
+    /// <summary>
+    /// ツリーJSONを読み込み、ダミーリーフのツリーを構築
+    /// </summary>
+    BTNodePtr BuildBenchmarkTree(const nlohmann::json& json) {
+        std::unordered_map<int, const nlohmann::json*> nodeMap;
+        std::vector<int> nodeOrder;
+        for (const auto& nodeJson : json["nodes"]) {
+            int nodeId = nodeJson["id"].get<int>();
+            nodeMap[nodeId] = &nodeJson;
+            nodeOrder.push_back(nodeId);
+        }
+
+        std::unordered_map<int, std::vector<int>> childMap;
+        std::unordered_set<int> childNodeIds;
+        for (const auto& link : json["links"]) {
+            int sourceId = link["sourceNodeId"].get<int>();
+            int targetId = link["targetNodeId"].get<int>();
+            childMap[sourceId].push_back(targetId);
+            childNodeIds.insert(targetId);
+        }
+
+        // 親リンクを持たないノードをルートとする
+        for (int nodeId : nodeOrder) {
+            if (childNodeIds.find(nodeId) == childNodeIds.end()) {
+                std::unordered_set<int> visitedNodes;
+                return BuildBenchmarkNode(nodeId, nodeMap, childMap, visitedNodes);
+            }
+        }
+        return nullptr;
+    }
+
+    /// <summary>
+    /// 読み込みベンチマーク用のノード生成（リーフはダミー）
+    /// </summary>
+    BTNodePtr CreateBenchmarkNode(const std::string& type, std::pmr::memory_resource* arena) {
+        if (const BTNodeRegistry::Entry* entry = BTNodeRegistry::GetInstance().Find(type); entry && entry->isComposite) {
+            return entry->create(arena);
+        }
+        bool isCondition = type.find("Condition") != std::string::npos || type == "BTActionSelector";
+        if (arena) {
+            return std::allocate_shared<BenchmarkLeaf>(std::pmr::polymorphic_allocator<BenchmarkLeaf>(arena), 0u, isCondition);
+        }
+        return std::make_shared<BenchmarkLeaf>(0u, isCondition);
+    }
+
+    /// <summary>
+    /// 旧BossNodeFactory::CreateNodeの比較順に並べたタイプ名
+    /// </summary>
+    constexpr std::array<const char*, 14> kLegacyNodeTypes = {
+        "BTSelector", "BTSequence", "BTRandomSelector",
+        "BTBossIdle", "BTBossDash", "BTBossShoot", "BTBossRapidFire",
+        "BTBossMeleeAttack", "BTBossApproach", "BTBossRetreat",
+        "BTActionSelector", "BTBossPhaseCondition", "BTBossHPCondition", "BTBossDistanceCondition"
+    };
+
+    /// <summary>
+    /// 旧実装のタイプ検索（std::stringの==を順に比較）
+    /// </summary>
+    size_t LegacyFindNodeType(const std::string& type) {
+        for (size_t i = 0; i < kLegacyNodeTypes.size(); ++i) {
+            if (type == kLegacyNodeTypes[i]) {
+                return i;
+            }
+        }
+        return kLegacyNodeTypes.size();
+    }
+
+    /// <summary>
+    /// 旧実装のJSON読み込み（ノードごとにlinks全体を走査して子を集める）
+    /// </summary>
+    BTNodePtr LegacyBuildNode(const nlohmann::json& nodeJson,
+                              const std::unordered_map<int, nlohmann::json>& nodeMap,
+                              const std::vector<nlohmann::json>& links,
+                              std::unordered_set<int>& visitedNodes) {
+        int nodeId = nodeJson["id"];
+        if (!visitedNodes.insert(nodeId).second) {
+            return nullptr;
+        }
+
+        BTNodePtr node = CreateBenchmarkNode(nodeJson["type"].get<std::string>(), nullptr);
+        if (nodeJson.contains("parameters") && !nodeJson["parameters"].is_null()) {
+            node->ApplyParameters(nodeJson["parameters"]);
+        }
+        if (nodeJson.contains("displayName")) {
+            node->SetName(nodeJson["displayName"]);
+        }
+
+        if (auto composite = std::dynamic_pointer_cast<BTComposite>(node)) {
+            std::vector<int> childIds;
+            for (const auto& link : links) {
+                if (link["sourceNodeId"] == nodeId) {
+                    childIds.push_back(link["targetNodeId"]);
+                }
+            }
+            for (int childId : childIds) {
+                auto childIt = nodeMap.find(childId);
+                if (childIt != nodeMap.end()) {
+                    if (BTNodePtr child = LegacyBuildNode(childIt->second, nodeMap, links, visitedNodes)) {
+                        composite->AddChild(child);
+                    }
+                }
+            }
+        }
+        return node;
+    }
+
+    /// <summary>
+    /// 旧実装のJSON読み込み（ルート探索を含む）
+    /// </summary>
+    BTNodePtr LegacyLoadFromJSON(const nlohmann::json& json) {
+        std::unordered_map<int, nlohmann::json> nodeMap;
+        for (const auto& nodeJson : json["nodes"]) {
+            nodeMap[nodeJson["id"].get<int>()] = nodeJson;
+        }
+        std::vector<nlohmann::json> links = json["links"].get<std::vector<nlohmann::json>>();
+
+        std::unordered_set<int> childNodeIds;
+        for (const auto& link : links) {
+            childNodeIds.insert(link["targetNodeId"].get<int>());
+        }
+        for (const auto& [nodeId, nodeJson] : nodeMap) {
+            if (childNodeIds.find(nodeId) == childNodeIds.end()) {
+                std::unordered_set<int> visitedNodes;
+                return LegacyBuildNode(nodeJson, nodeMap, links, visitedNodes);
+            }
+        }
+        return nullptr;
+    }
+
+    /// <summary>
+    /// 合成ツリーJSONの生成（ルートSelectorの下に 条件 → アクション のSequenceを並べる）
+    /// </summary>
+    nlohmann::json MakeSyntheticTreeJson(int branchCount) {
+        nlohmann::json json;
+        json["version"] = "1.0";
+        json["nodes"] = nlohmann::json::array();
+        json["links"] = nlohmann::json::array();
+
+        int nextId = 10000;
+        int nextLinkId = 30000;
+        auto addNode = [&](const char* type, nlohmann::json params) {
+            int id = nextId++;
+            json["nodes"].push_back({ {"id", id}, {"type", type}, {"displayName", type}, {"parameters", std::move(params)} });
+            return id;
+        };
+        auto addLink = [&](int source, int target) {
+            json["links"].push_back({ {"id", nextLinkId++}, {"sourceNodeId", source}, {"targetNodeId", target} });
+        };
+
+        int root = addNode("BTSelector", nlohmann::json::object());
+        for (int i = 0; i < branchCount; ++i) {
+            int sequence = addNode("BTSequence", nlohmann::json::object());
+            int condition = addNode("BTBossDistanceCondition", { {"minDistance", 0.0f}, {"maxDistance", static_cast<float>(i)} });
+            int action = addNode("BTBossShoot", { {"chargeTime", 0.5f}, {"bulletSpeed", 10.0f}, {"spreadAngle", static_cast<float>(i % 30)}, {"recoveryTime", 1.0f} });
+            addLink(root, sequence);
+            addLink(sequence, condition);
+            addLink(sequence, action);
+        }
+        return json;
+    }
+
+    /// <summary>
+    /// 1つのツリーJSONについて読み込み方式ごとの計測を追加
+    /// </summary>
+    void MeasureTreeLoad(std::vector<Benchmark::Result>& results, const std::string& label,
+                         const nlohmann::json& json, uint64_t iterations) {
+        const std::string text = json.dump();
+        std::vector<uint8_t> blob;
+        if (!BTTreeCooker::Cook(json, 0, blob)) {
+            return;
+        }
+        const std::string suffix = " [" + label + ", " + std::to_string(json["nodes"].size()) + " nodes]";
+        const BTNodeCreator heapCreator = [](const std::string& type) { return CreateBenchmarkNode(type, nullptr); };
+
+        Benchmark::Result legacy = Benchmark::Measure("Legacy JSON parse + links rescan" + suffix, iterations,
+            [&](uint64_t) {
+                nlohmann::json parsed = nlohmann::json::parse(text);
+                Benchmark::Consume(reinterpret_cast<uintptr_t>(LegacyLoadFromJSON(parsed).get()));
+            });
+        results.push_back(legacy);
+
+        PushCompared(results, Benchmark::Measure("JSON parse + adjacency" + suffix, iterations,
+            [&](uint64_t) {
+                nlohmann::json parsed = nlohmann::json::parse(text);
+                Benchmark::Consume(reinterpret_cast<uintptr_t>(BTTreeLoader::LoadFromJSON(parsed, heapCreator).get()));
+            }), legacy);
+
+        PushCompared(results, Benchmark::Measure("Cooked binary" + suffix, iterations,
+            [&](uint64_t) {
+                Benchmark::Consume(reinterpret_cast<uintptr_t>(BTTreeLoader::Load(blob.data(), blob.size(), heapCreator).get()));
+            }), legacy);
+
+        // ノードと制御ブロックを1つのバッファへ連続確保（ツリーを先に破棄してからアリーナを破棄）
+        std::vector<std::byte> arenaBuffer(json["nodes"].size() * 512);
+        PushCompared(results, Benchmark::Measure("Cooked binary + arena" + suffix, iterations,
+            [&](uint64_t) {
+                std::pmr::monotonic_buffer_resource arena(arenaBuffer.data(), arenaBuffer.size());
+                BTNodeCreator arenaCreator = [&arena](const std::string& type) { return CreateBenchmarkNode(type, &arena); };
+                BTNodePtr root = BTTreeLoader::Load(blob.data(), blob.size(), arenaCreator);
+                Benchmark::Consume(reinterpret_cast<uintptr_t>(root.get()));
+            }), legacy);
+    }
+
+    /// <summary>
+    /// 実行中の最深ノードを検索（BossBehaviorTreeの従来の追跡処理と同等）
+    /// </summary>
+    BTNode* FindRunningNode(const BTNodePtr& node) {
+        BTNode* running = nullptr;
+        BTNodePtr current = node;
+        while (current && current->IsRunning()) {
+            running = current.get();
+            auto composite = std::dynamic_pointer_cast<BTComposite>(current);
+            if (!composite) {
+                break;
+            }
+            BTNodePtr next;
+            for (const auto& child : composite->GetChildren()) {
+                if (child && child->IsRunning()) {
+                    next = child;
+                    break;
+                }
+            }
+            current = next;
+        }
+        return running;
+    }
+
+#ifdef _DEBUG
+    // 最後に実行したブラックボードベンチマークの結果
+    std::vector<Benchmark::Result> sBlackboardResults;
+
+    // ベンチマークの反復回数
+    int sBlackboardIterations = 1000000;
+
+    // 最後に実行したツリーベンチマークの結果
+    std::vector<Benchmark::Result> sTreeResults;
+
+    // ツリーベンチマークの実行回数
+    int sTreeTicks = 1000000;
+
+    // ツリーベンチマークの読み込みに失敗したか
+    bool sTreeLoadFailed = false;
+
+    // 最後に実行した静的ツリーベンチマークの結果
+    std::vector<Benchmark::Result> sStaticResults;
+
+    // 最後に実行した読み込みベンチマークの結果
+    std::vector<Benchmark::Result> sLoadResults;
+
+    // 読み込みベンチマークの反復回数
+    int sLoadIterations = 200;
+#endif
+
+}
+
+std::vector<Benchmark::Result> BTBenchmark::RunBlackboardBenchmark(uint64_t iterations) {
+    LegacyBlackboard legacy;
+    BTBlackboard blackboard;
+    Populate(legacy, blackboard);
+
+    // ツリー構築時に解決されるハンドル
+    BTBlackboardKey<int> counterKey = blackboard.RegisterKey<int>("ActionCounter");
+    BTBlackboardKey<float> distanceKey = blackboard.RegisterKey<float>("TargetDistance");
+    BTBlackboardKey<Vector3> positionKey = blackboard.RegisterKey<Vector3>("LastPlayerPosition");
+
+    std::vector<Benchmark::Result> results;
+
+    // 条件ノードの典型的な読み取り（BTActionSelector）
+    Benchmark::Result legacyGetInt = Benchmark::Measure("Legacy GetInt(\"ActionCounter\")", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(legacy.GetInt("ActionCounter", 0))); });
+    results.push_back(legacyGetInt);
+    PushCompared(results, Benchmark::Measure("Slot GetInt(string_view)", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(blackboard.GetInt("ActionCounter", 0))); }), legacyGetInt);
+    PushCompared(results, Benchmark::Measure("Slot GetInt(handle)", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(blackboard.GetInt(counterKey, 0))); }), legacyGetInt);
+
+    // 読み取り + 書き込み（BTBossIdleのカウンター加算）
+    Benchmark::Result legacyIncrement = Benchmark::Measure("Legacy Get+SetInt", iterations,
+        [&](uint64_t) { legacy.SetInt("ActionCounter", legacy.GetInt("ActionCounter", 0) + 1); });
+    results.push_back(legacyIncrement);
+    PushCompared(results, Benchmark::Measure("Slot Get+SetInt(handle)", iterations,
+        [&](uint64_t) { blackboard.SetInt(counterKey, blackboard.GetInt(counterKey, 0) + 1); }), legacyIncrement);
+
+    // 浮動小数点・ベクトルの読み取り
+    Benchmark::Result legacyGetFloat = Benchmark::Measure("Legacy GetFloat", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(legacy.GetFloat("TargetDistance"))); });
+    results.push_back(legacyGetFloat);
+    PushCompared(results, Benchmark::Measure("Slot GetFloat(handle)", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(blackboard.GetFloat(distanceKey))); }), legacyGetFloat);
+
+    Benchmark::Result legacyGetVector = Benchmark::Measure("Legacy GetVector3", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(legacy.GetVector3("LastPlayerPosition").x)); });
+    results.push_back(legacyGetVector);
+    PushCompared(results, Benchmark::Measure("Slot GetVector3(handle)", iterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(blackboard.GetVector3(positionKey).x)); }), legacyGetVector);
+
+    // 型不一致（旧実装は例外経由、スロット方式は分岐のみ）
+    uint64_t mismatchIterations = iterations / 10;
+    Benchmark::Result legacyMismatch = Benchmark::Measure("Legacy type mismatch (throw)", mismatchIterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(legacy.GetFloat("ActionCounter", 1.0f))); });
+    results.push_back(legacyMismatch);
+    PushCompared(results, Benchmark::Measure("Slot type mismatch", mismatchIterations,
+        [&](uint64_t) { Benchmark::Consume(static_cast<uint64_t>(blackboard.GetFloat("ActionCounter", 1.0f))); }), legacyMismatch);
+
+    return results;
+}
+
+std::vector<Benchmark::Result> BTBenchmark::RunTreeTickBenchmark(const std::string& filepath, uint64_t ticks) {
+    nlohmann::json json;
+    try {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return {};
+        }
+        file >> json;
+    }
+    catch (const std::exception&) {
+        return {};
+    }
+    if (!json.contains("nodes") || !json.contains("links")) {
+        return {};
+    }
+
+    // 状態が干渉しないよう、計測ごとに別のツリーを構築する
+    BTNodePtr trackedRoot = BuildBenchmarkTree(json);
+    BTNodePtr pointerRoot = BuildBenchmarkTree(json);
+    BTNodePtr compiledRoot = BuildBenchmarkTree(json);
+    if (!trackedRoot || !pointerRoot || !compiledRoot) {
+        return {};
+    }
+
+    auto definition = std::make_shared<BTCompiledTree>();
+    if (!definition->Compile(compiledRoot)) {
+        return {};
+    }
+    BTTreeInstance compiledTree(definition);
+
+    BTBlackboard blackboard;
+    blackboard.SetDeltaTime(1.0f / 60.0f);
+
+    std::vector<Benchmark::Result> results;
+
+    // 従来のUpdate相当（仮想呼び出し + shared_ptrの子リスト + 実行中ノードの追跡）
+    Benchmark::Result pointerUpdate = Benchmark::Measure("Pointer tree Execute + running search", ticks,
+        [&](uint64_t) {
+            if (trackedRoot->Execute(&blackboard) != BTNodeStatus::Running) {
+                trackedRoot->Reset();
+            }
+            Benchmark::Consume(reinterpret_cast<uintptr_t>(FindRunningNode(trackedRoot)));
+        });
+    results.push_back(pointerUpdate);
+
+    // 走査のみ（参考値）
+    PushCompared(results, Benchmark::Measure("Pointer tree Execute only", ticks,
+        [&](uint64_t) {
+            if (pointerRoot->Execute(&blackboard) != BTNodeStatus::Running) {
+                pointerRoot->Reset();
+            }
+        }), pointerUpdate);
+
+    // コンパイル済みツリー（実行中ノードはTick中に記録される）
+    auto tickCompiled = [&](uint64_t) {
+        if (compiledTree.Tick(&blackboard) != BTNodeStatus::Running) {
+            compiledTree.Reset();
+        }
+        Benchmark::Consume(compiledTree.GetRunningIndex());
+    };
+    PushCompared(results, Benchmark::Measure("Compiled tree Tick", ticks, tickCompiled), pointerUpdate);
+
+#if BT_PROFILE_ENABLED
+    // ノード単位のプロファイリング有効時（計測のオーバーヘッド確認用）
+    compiledTree.EnableProfiling(true);
+    PushCompared(results, Benchmark::Measure("Compiled tree Tick + profiler", ticks, tickCompiled), pointerUpdate);
+    compiledTree.EnableProfiling(false);
+#endif
+
+    // 複数エージェントを順に実行（ツリー全体がキャッシュに載らない状況）
+    // コンパイル済みツリーは1つの定義を共有し、エージェントごとには状態ブロックだけを持つ
+    std::vector<BTNodePtr> pointerAgents;
+    std::vector<BTTreeInstance> compiledAgents;
+    compiledAgents.reserve(kAgentCount);
+    for (size_t i = 0; i < kAgentCount; ++i) {
+        pointerAgents.push_back(BuildBenchmarkTree(json));
+        compiledAgents.emplace_back(definition);
+    }
+
+    uint64_t agentTicks = (ticks / kAgentCount) * kAgentCount;
+    Benchmark::Result pointerAgentsUpdate = Benchmark::Measure("Pointer tree x" + std::to_string(kAgentCount) + " agents", agentTicks,
+        [&](uint64_t i) {
+            const BTNodePtr& root = pointerAgents[i % kAgentCount];
+            if (root->Execute(&blackboard) != BTNodeStatus::Running) {
+                root->Reset();
+            }
+            Benchmark::Consume(reinterpret_cast<uintptr_t>(FindRunningNode(root)));
+        });
+    results.push_back(pointerAgentsUpdate);
+
+    PushCompared(results, Benchmark::Measure("Shared compiled tree x" + std::to_string(kAgentCount) + " agents", agentTicks,
+        [&](uint64_t i) {
+            BTTreeInstance& tree = compiledAgents[i % kAgentCount];
+            if (tree.Tick(&blackboard) != BTNodeStatus::Running) {
+                tree.Reset();
+            }
+            Benchmark::Consume(tree.GetRunningIndex());
+        }), pointerAgentsUpdate);
+
+    return results;
+}
+
+std::vector<Benchmark::Result> BTBenchmark::RunStaticTreeBenchmark(uint64_t ticks) {
+    BTNodePtr pointerRoot = BuildFixedActionTree();
+    auto definition = std::make_shared<BTCompiledTree>();
+    if (!definition->Compile(BuildFixedActionTree())) {
+        return {};
+    }
+    BTTreeInstance compiledTree(definition);
+
+    StaticBenchmark::Tree staticTree;
+    StaticBenchmark::Tree::State staticState{};
+
+    BTBlackboard blackboard;
+    blackboard.SetDeltaTime(1.0f / 60.0f);
+    staticTree.ResolveBlackboardKeys(blackboard);
+
+    std::vector<Benchmark::Result> results;
+
+    Benchmark::Result pointerTick = Benchmark::Measure("Pointer tree Execute", ticks,
+        [&](uint64_t) {
+            if (pointerRoot->Execute(&blackboard) != BTNodeStatus::Running) {
+                pointerRoot->Reset();
+            }
+        });
+    results.push_back(pointerTick);
+
+    PushCompared(results, Benchmark::Measure("Compiled tree Tick", ticks,
+        [&](uint64_t) {
+            if (compiledTree.Tick(&blackboard) != BTNodeStatus::Running) {
+                compiledTree.Reset();
+            }
+            Benchmark::Consume(compiledTree.GetRunningIndex());
+        }), pointerTick);
+
+    PushCompared(results, Benchmark::Measure("Static tree Tick", ticks,
+        [&](uint64_t) {
+            if (staticTree.Tick(&blackboard, staticState) != BTNodeStatus::Running) {
+                StaticBenchmark::Tree::Reset(staticState);
+            }
+            Benchmark::Consume(staticState.current);
+        }), pointerTick);
+
+    // 複数エージェント（静的ツリーは定義を共有し、状態は構造体の配列）
+    std::vector<BTNodePtr> pointerAgents;
+    std::vector<BTTreeInstance> compiledAgents;
+    std::vector<StaticBenchmark::Tree::State> staticAgents(kAgentCount);
+    compiledAgents.reserve(kAgentCount);
+    for (size_t i = 0; i < kAgentCount; ++i) {
+        pointerAgents.push_back(BuildFixedActionTree());
+        compiledAgents.emplace_back(definition);
+    }
+
+    uint64_t agentTicks = (ticks / kAgentCount) * kAgentCount;
+    Benchmark::Result pointerAgentsTick = Benchmark::Measure("Pointer tree x" + std::to_string(kAgentCount) + " agents", agentTicks,
+        [&](uint64_t i) {
+            const BTNodePtr& root = pointerAgents[i % kAgentCount];
+            if (root->Execute(&blackboard) != BTNodeStatus::Running) {
+                root->Reset();
+            }
+        });
+    results.push_back(pointerAgentsTick);
+
+    PushCompared(results, Benchmark::Measure("Shared compiled tree x" + std::to_string(kAgentCount) + " agents", agentTicks,
+        [&](uint64_t i) {
+            BTTreeInstance& tree = compiledAgents[i % kAgentCount];
+            if (tree.Tick(&blackboard) != BTNodeStatus::Running) {
+                tree.Reset();
+            }
+            Benchmark::Consume(tree.GetRunningIndex());
+        }), pointerAgentsTick);
+
+    PushCompared(results, Benchmark::Measure("Static tree x" + std::to_string(kAgentCount) + " agents", agentTicks,
+        [&](uint64_t i) {
+            StaticBenchmark::Tree::State& state = staticAgents[i % kAgentCount];
+            if (staticTree.Tick(&blackboard, state) != BTNodeStatus::Running) {
+                StaticBenchmark::Tree::Reset(state);
+            }
+            Benchmark::Consume(state.current);
+        }), pointerAgentsTick);
+
+    return results;
+}
+
+std::vector<Benchmark::Result> BTBenchmark::RunTreeLoadBenchmark(const std::string& filepath, uint64_t iterations) {
+    nlohmann::json json;
+    try {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return {};
+        }
+        file >> json;
+    }
+    catch (const std::exception&) {
+        return {};
+    }
+    if (!json.contains("nodes") || !json.contains("links")) {
+        return {};
+    }
+
+    std::vector<Benchmark::Result> results;
+
+    // タイプ名の検索（旧実装の文字列比較チェーンとレジストリのハッシュ検索）
+    std::vector<std::string> typeNames;
+    for (const auto& nodeJson : json["nodes"]) {
+        typeNames.push_back(nodeJson["type"].get<std::string>());
+    }
+    uint64_t lookupIterations = iterations * 10000;
+    Benchmark::Result legacyLookup = Benchmark::Measure("Legacy string compare chain", lookupIterations,
+        [&](uint64_t i) { Benchmark::Consume(LegacyFindNodeType(typeNames[i % typeNames.size()])); });
+    results.push_back(legacyLookup);
+    PushCompared(results, Benchmark::Measure("Registry hash lookup", lookupIterations,
+        [&](uint64_t i) {
+            Benchmark::Consume(reinterpret_cast<uintptr_t>(BTNodeRegistry::GetInstance().Find(typeNames[i % typeNames.size()])));
+        }), legacyLookup);
+
+    MeasureTreeLoad(results, "BossTree", json, iterations);
+
+    // ノード数が増えた場合の伸び方（旧実装はノード数 × リンク数）
+    MeasureTreeLoad(results, "Synthetic", MakeSyntheticTreeJson(340), (std::max)(iterations / 20, uint64_t{ 1 }));
+    return results;
+}
+
+#ifdef _DEBUG
+void BTBenchmark::DrawImGui() {
+    if (ImGui::CollapsingHeader("Blackboard", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::DragInt("Iterations##bb", &sBlackboardIterations, 10000.0f, 10000, 10000000);
+        if (ImGui::Button("Run Blackboard Benchmark")) {
+            sBlackboardResults = RunBlackboardBenchmark(static_cast<uint64_t>(sBlackboardIterations));
+        }
+        ImGui::TextDisabled("Debug build timings are not representative; compare in Release.");
+        Benchmark::DrawResultsTable("##BlackboardBenchmark", sBlackboardResults);
+    }
+
+    if (ImGui::CollapsingHeader("Tree Tick", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::DragInt("Ticks##tree", &sTreeTicks, 10000.0f, 10000, 10000000);
+        if (ImGui::Button("Run Tree Tick Benchmark")) {
+            sTreeResults = RunTreeTickBenchmark("resources/Json/BossTree.json", static_cast<uint64_t>(sTreeTicks));
+            sTreeLoadFailed = sTreeResults.empty();
+        }
+        if (sTreeLoadFailed) {
+            ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "Failed to load BossTree.json");
+        }
+        Benchmark::DrawResultsTable("##TreeTickBenchmark", sTreeResults);
+    }
+
+    if (ImGui::CollapsingHeader("Static Tree", ImGuiTreeNodeFlags_DefaultOpen)) {
+        if (ImGui::Button("Run Static Tree Benchmark")) {
+            sStaticResults = RunStaticTreeBenchmark(static_cast<uint64_t>(sTreeTicks));
+        }
+        ImGui::TextDisabled("Fixed MainLoop shape; uses the Tree Tick count.");
+        Benchmark::DrawResultsTable("##StaticTreeBenchmark", sStaticResults);
+    }
+
+    if (ImGui::CollapsingHeader("Tree Load", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::DragInt("Iterations##load", &sLoadIterations, 10.0f, 20, 10000);
+        if (ImGui::Button("Run Tree Load Benchmark")) {
+            sLoadResults = RunTreeLoadBenchmark("resources/Json/BossTree.json", static_cast<uint64_t>(sLoadIterations));
+        }
+        Benchmark::DrawResultsTable("##TreeLoadBenchmark", sLoadResults);
+    }
+}
+#endif
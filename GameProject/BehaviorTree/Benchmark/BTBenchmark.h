@@ -0,0 +1,57 @@
+#pragma once
+#include "../../Common/Benchmark.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// ビヘイビアツリー関連のマイクロベンチマーク
+/// デバッグUIから実行し、旧実装との比較結果を表示する
+/// </summary>
+namespace BTBenchmark {
+
+    /// <summary>
+    /// ブラックボードのベンチマーク
+    /// 旧実装（unordered_map&lt;string, any&gt;）とスロット方式を比較する
+    /// </summary>
+    /// <param name="iterations">各ケースの反復回数</param>
+    /// <returns>計測結果</returns>
+    std::vector<Benchmark::Result> RunBlackboardBenchmark(uint64_t iterations = 1000000);
+
+    /// <summary>
+    /// ツリー実行のベンチマーク
+    /// ツリーJSONの構造をそのまま使い、リーフを軽量なダミーに置き換えて
+    /// ポインタツリーとコンパイル済みツリーの走査コストを比較する
+    /// </summary>
+    /// <param name="filepath">ツリーJSONのパス</param>
+    /// <param name="ticks">実行回数</param>
+    /// <returns>計測結果（読み込み失敗時は空）</returns>
+    std::vector<Benchmark::Result> RunTreeTickBenchmark(const std::string& filepath, uint64_t ticks = 1000000);
+
+    /// <summary>
+    /// 静的ツリーのベンチマーク
+    /// 固定の行動ツリー（Idle → Dash/Shoot の選択）を同じダミーリーフで構築し、
+    /// ポインタツリー・コンパイル済みツリー・型で展開した静的ツリー（BTStatic）を比較する
+    /// </summary>
+    /// <param name="ticks">実行回数</param>
+    /// <returns>計測結果</returns>
+    std::vector<Benchmark::Result> RunStaticTreeBenchmark(uint64_t ticks = 1000000);
+
+    /// <summary>
+    /// ツリー読み込みのベンチマーク
+    /// 旧実装（ノードごとにlinks全体を走査）、隣接リストによるJSON読み込み、クッキング済みバイナリを比較する
+    /// ツリーJSONに加えて、ノード数を増やした合成ツリーでも計測する
+    /// </summary>
+    /// <param name="filepath">ツリーJSONのパス</param>
+    /// <param name="iterations">各ケースの反復回数</param>
+    /// <returns>計測結果（読み込み失敗時は空）</returns>
+    std::vector<Benchmark::Result> RunTreeLoadBenchmark(const std::string& filepath, uint64_t iterations = 200);
+
+#ifdef _DEBUG
+    /// <summary>
+    /// ベンチマークUIの描画
+    /// </summary>
+    void DrawImGui();
+#endif
+
+}
@@ -1,7 +1,14 @@
 #include "BTRandomSelector.h"
-#include "RandomEngine.h"
+#include "../Core/BTNodeRegistry.h"
 #include <algorithm>
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTRandomSelector> kRegistrar("BTRandomSelector", { "Random Selector", BTNodeCategory::Composite, { 0.9f, 0.6f, 0.2f, 1.0f } });
+
+}
+
 BTRandomSelector::BTRandomSelector() {
     name_ = "RandomSelector";
 }
@@ -13,7 +20,7 @@ BTNodeStatus BTRandomSelector::Execute(BTBlackboard* blackboard) {
 
     // 新しい選択サイクルの開始時のみシャッフル
     if (needsShuffle_) {
-        ShuffleIndices();
+        ShuffleIndices(blackboard);
         needsShuffle_ = false;
         currentShuffledIdx_ = 0;
     }
@@ -48,16 +55,16 @@ void BTRandomSelector::Reset() {
     needsShuffle_ = true;
 }
 
-void BTRandomSelector::ShuffleIndices() {
+void BTRandomSelector::ShuffleIndices(BTBlackboard* blackboard) {
     shuffledIndices_.resize(children_.size());
     for (size_t i = 0; i < children_.size(); ++i) {
         shuffledIndices_[i] = i;
     }
 
-    // Fisher-Yatesシャッフル（RandomEngine使用）
-    RandomEngine* rng = RandomEngine::GetInstance();
+    // Fisher-Yatesシャッフル（エージェントの乱数列を使用）
+    BTRandomStream& rng = blackboard->GetRandom();
     for (size_t i = shuffledIndices_.size() - 1; i > 0; --i) {
-        size_t j = static_cast<size_t>(rng->GetInt(0, static_cast<int>(i)));
+        size_t j = static_cast<size_t>(rng.GetInt(0, static_cast<int>(i)));
         std::swap(shuffledIndices_[i], shuffledIndices_[j]);
     }
 }
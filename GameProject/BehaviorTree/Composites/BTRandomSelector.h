@@ -35,7 +35,8 @@ private: // プライベートメンバー関数
     /// <summary>
     /// 子ノードのインデックスをシャッフル
     /// </summary>
-    void ShuffleIndices();
+    /// <param name="blackboard">乱数列を持つブラックボード</param>
+    void ShuffleIndices(BTBlackboard* blackboard);
 
 private:
     // シャッフルされたインデックス
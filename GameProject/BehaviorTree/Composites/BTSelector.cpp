@@ -1,4 +1,12 @@
 #include "BTSelector.h"
+#include "../Core/BTNodeRegistry.h"
+
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTSelector> kRegistrar("BTSelector", { "Selector", BTNodeCategory::Composite, { 0.8f, 0.4f, 0.2f, 1.0f } });
+
+}
 
 BTSelector::BTSelector() {
     name_ = "Selector";
@@ -1,4 +1,12 @@
 #include "BTSequence.h"
+#include "../Core/BTNodeRegistry.h"
+
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTSequence> kRegistrar("BTSequence", { "Sequence", BTNodeCategory::Composite, { 0.2f, 0.6f, 0.8f, 1.0f } });
+
+}
 
 BTSequence::BTSequence() {
     name_ = "Sequence";
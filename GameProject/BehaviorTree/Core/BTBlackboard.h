@@ -1,18 +1,79 @@
 #pragma once
-#include <unordered_map>
-#include <any>
-#include <string>
+#include <cstdint>
+#include <functional>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 #include "Vector3.h"
+#include "BTRandomStream.h"
 
-class Boss;
+class BossAgent;
 class Player;
 
+/// <summary>
+/// ブラックボードに格納できる値の型
+/// </summary>
+enum class BTValueType : uint8_t {
+    None,
+    Int,
+    Float,
+    Bool,
+    Vector3
+};
+
+/// <summary>
+/// ブラックボードのキーハンドル
+/// 文字列キーを登録時に一度だけスロット番号へ解決し、以降は整数インデックスでアクセスする
+/// </summary>
+/// <template name="T">値の型（int, float, bool, Vector3）</template>
+template<typename T>
+struct BTBlackboardKey {
+    static constexpr uint16_t kInvalidSlot = 0xFFFF;
+
+    // スロット番号
+    uint16_t slot = kInvalidSlot;
+
+    /// <summary>
+    /// 有効なキーかどうか
+    /// </summary>
+    /// <returns>登録済みのスロットを指している場合true</returns>
+    bool IsValid() const { return slot != kInvalidSlot; }
+};
+
 /// <summary>
 /// ビヘイビアツリーのブラックボード
 /// ノード間でデータを共有するための仕組み
+/// キーは登録時に型付きスロットへ割り当てられ、値はフラットな配列に格納される
+/// 値が変化したスロットは記録され、ツリーの条件ノードの再評価に使われる
 /// </summary>
 class BTBlackboard {
+private:
+    /// <summary>
+    /// 値スロット（16バイト、型タグ + ペイロード）
+    /// </summary>
+    struct Slot {
+        BTValueType type = BTValueType::None;   // 登録された型
+        bool hasValue = false;                  // 値が設定済みかどうか
+        bool changed = false;                   // 前回のClearChanges以降に値が変化したか
+        union {
+            int32_t i;
+            float f;
+            bool b;
+            float v[3];
+        } value{};
+    };
+
+    /// <summary>
+    /// 文字列キー検索用の透過ハッシュ（string_viewで一時文字列を作らずに検索する）
+    /// </summary>
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+    };
+
 public:
     /// <summary>
     /// コンストラクタ
@@ -27,14 +88,14 @@ public:
     /// <summary>
     /// ボスの設定
     /// </summary>
-    /// <param name="boss">ボスのポインタ</param>
-    void SetBoss(Boss* boss) { boss_ = boss; }
+    /// <param name="boss">ツリーから操作するボス（副作用はコマンドとして記録される）</param>
+    void SetBoss(BossAgent* boss) { boss_ = boss; }
 
     /// <summary>
     /// ボスの取得
     /// </summary>
-    /// <returns>ボスのポインタ</returns>
-    Boss* GetBoss() const { return boss_; }
+    /// <returns>ツリーから操作するボス</returns>
+    BossAgent* GetBoss() const { return boss_; }
 
     /// <summary>
     /// プレイヤーの設定
@@ -61,34 +122,275 @@ public:
     float GetDeltaTime() const { return deltaTime_; }
 
     /// <summary>
-    /// 汎用データの設定
+    /// このエージェントの乱数列を取得
+    /// ツリーの実行中はRandomEngineではなくこちらを使う（並列実行でも結果が変わらないように）
     /// </summary>
-    /// <template name="T">データ型</template>
+    /// <returns>乱数列</returns>
+    BTRandomStream& GetRandom() { return random_; }
+
+    //-----------------------------キー登録------------------------------//
+
+    /// <summary>
+    /// キーの登録（既に同じ型で登録済みなら既存のハンドルを返す）
+    /// </summary>
+    /// <template name="T">値の型</template>
+    /// <param name="name">キー名</param>
+    /// <returns>キーハンドル（別の型で登録済みの場合は無効ハンドル）</returns>
+    template<typename T>
+    BTBlackboardKey<T> RegisterKey(std::string_view name) {
+        constexpr BTValueType type = TypeOf<T>();
+        auto it = keyToSlot_.find(name);
+        if (it != keyToSlot_.end()) {
+            if (slots_[it->second].type != type) {
+                return {};
+            }
+            return { it->second };
+        }
+
+        if (slots_.size() >= BTBlackboardKey<T>::kInvalidSlot) {
+            return {};
+        }
+
+        uint16_t slot = static_cast<uint16_t>(slots_.size());
+        Slot newSlot;
+        newSlot.type = type;
+        slots_.push_back(newSlot);
+        keyToSlot_.emplace(std::string(name), slot);
+        return { slot };
+    }
+
+    /// <summary>
+    /// 登録済みキーの検索
+    /// </summary>
+    /// <template name="T">値の型</template>
+    /// <param name="name">キー名</param>
+    /// <returns>キーハンドル（未登録または型不一致の場合は無効ハンドル）</returns>
+    template<typename T>
+    BTBlackboardKey<T> FindKey(std::string_view name) const {
+        auto it = keyToSlot_.find(name);
+        if (it == keyToSlot_.end() || slots_[it->second].type != TypeOf<T>()) {
+            return {};
+        }
+        return { it->second };
+    }
+
+    /// <summary>
+    /// 登録済みキー数の取得
+    /// </summary>
+    /// <returns>スロット数</returns>
+    size_t GetKeyCount() const { return slots_.size(); }
+
+    /// <summary>
+    /// 他のブラックボードと同じキー構成にする（値は複製しない）
+    /// 登録済みのキーは同じスロット・同じ型である必要があり、残りのキーを同じ順で登録する
+    /// 解決済みのキーハンドルを持つツリー定義を複数のブラックボードで共有するために使う
+    /// </summary>
+    /// <param name="source">キー構成の複製元</param>
+    /// <returns>同じ構成にできた場合true</returns>
+    bool CopyKeyLayout(const BTBlackboard& source) {
+        if (slots_.size() > source.slots_.size()) {
+            return false;
+        }
+
+        std::vector<const std::string*> names(source.slots_.size(), nullptr);
+        for (const auto& [name, slot] : source.keyToSlot_) {
+            names[slot] = &name;
+        }
+
+        for (uint16_t slot = 0; slot < source.slots_.size(); ++slot) {
+            BTValueType type = source.slots_[slot].type;
+            if (slot < slots_.size()) {
+                auto it = keyToSlot_.find(*names[slot]);
+                if (it == keyToSlot_.end() || it->second != slot || slots_[slot].type != type) {
+                    return false;
+                }
+                continue;
+            }
+            if (keyToSlot_.contains(*names[slot])) {
+                return false;
+            }
+
+            Slot newSlot;
+            newSlot.type = type;
+            slots_.push_back(newSlot);
+            keyToSlot_.emplace(*names[slot], slot);
+        }
+        return true;
+    }
+
+    //-----------------------------ハンドルによるアクセス------------------------------//
+
+    /// <summary>
+    /// 整数値の設定
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="value">値</param>
+    void SetInt(BTBlackboardKey<int> key, int value) {
+        if (Slot* slot = GetSlot(key.slot, BTValueType::Int)) {
+            if (!slot->hasValue || slot->value.i != value) {
+                MarkChanged(key.slot);
+            }
+            slot->value.i = value;
+            slot->hasValue = true;
+        }
+    }
+
+    /// <summary>
+    /// 整数値の取得
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
+    int GetInt(BTBlackboardKey<int> key, int defaultValue = 0) const {
+        const Slot* slot = GetSlot(key.slot, BTValueType::Int);
+        return (slot && slot->hasValue) ? slot->value.i : defaultValue;
+    }
+
+    /// <summary>
+    /// 浮動小数点値の設定
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="value">値</param>
+    void SetFloat(BTBlackboardKey<float> key, float value) {
+        if (Slot* slot = GetSlot(key.slot, BTValueType::Float)) {
+            if (!slot->hasValue || slot->value.f != value) {
+                MarkChanged(key.slot);
+            }
+            slot->value.f = value;
+            slot->hasValue = true;
+        }
+    }
+
+    /// <summary>
+    /// 浮動小数点値の取得
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
+    float GetFloat(BTBlackboardKey<float> key, float defaultValue = 0.0f) const {
+        const Slot* slot = GetSlot(key.slot, BTValueType::Float);
+        return (slot && slot->hasValue) ? slot->value.f : defaultValue;
+    }
+
+    /// <summary>
+    /// 真偽値の設定
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="value">値</param>
+    void SetBool(BTBlackboardKey<bool> key, bool value) {
+        if (Slot* slot = GetSlot(key.slot, BTValueType::Bool)) {
+            if (!slot->hasValue || slot->value.b != value) {
+                MarkChanged(key.slot);
+            }
+            slot->value.b = value;
+            slot->hasValue = true;
+        }
+    }
+
+    /// <summary>
+    /// 真偽値の取得
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
+    bool GetBool(BTBlackboardKey<bool> key, bool defaultValue = false) const {
+        const Slot* slot = GetSlot(key.slot, BTValueType::Bool);
+        return (slot && slot->hasValue) ? slot->value.b : defaultValue;
+    }
+
+    /// <summary>
+    /// ベクトル値の設定
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="value">値</param>
+    void SetVector3(BTBlackboardKey<Vector3> key, const Vector3& value) {
+        if (Slot* slot = GetSlot(key.slot, BTValueType::Vector3)) {
+            if (!slot->hasValue || slot->value.v[0] != value.x || slot->value.v[1] != value.y || slot->value.v[2] != value.z) {
+                MarkChanged(key.slot);
+            }
+            slot->value.v[0] = value.x;
+            slot->value.v[1] = value.y;
+            slot->value.v[2] = value.z;
+            slot->hasValue = true;
+        }
+    }
+
+    /// <summary>
+    /// ベクトル値の取得
+    /// </summary>
+    /// <param name="key">キーハンドル</param>
+    /// <param name="defaultValue">デフォルト値</param>
+    /// <returns>値</returns>
+    Vector3 GetVector3(BTBlackboardKey<Vector3> key, const Vector3& defaultValue = Vector3()) const {
+        const Slot* slot = GetSlot(key.slot, BTValueType::Vector3);
+        if (!slot || !slot->hasValue) {
+            return defaultValue;
+        }
+        return Vector3(slot->value.v[0], slot->value.v[1], slot->value.v[2]);
+    }
+
+    /// <summary>
+    /// 値が設定されているか
+    /// </summary>
+    /// <template name="T">値の型</template>
+    /// <param name="key">キーハンドル</param>
+    /// <returns>設定されている場合true</returns>
+    template<typename T>
+    bool HasValue(BTBlackboardKey<T> key) const {
+        const Slot* slot = GetSlot(key.slot, TypeOf<T>());
+        return slot && slot->hasValue;
+    }
+
+    //-----------------------------文字列キーによるアクセス（互換用）------------------------------//
+
+    /// <summary>
+    /// 汎用データの設定（未登録のキーは自動登録）
+    /// </summary>
+    /// <template name="T">データ型（int, float, bool, Vector3）</template>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
     template<typename T>
-    void SetValue(const std::string& key, const T& value) {
-        data_[key] = value;
+    void SetValue(std::string_view key, const T& value) {
+        BTBlackboardKey<T> handle = RegisterKey<T>(key);
+        if constexpr (std::is_same_v<T, int>) {
+            SetInt(handle, value);
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            SetFloat(handle, value);
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            SetBool(handle, value);
+        }
+        else {
+            SetVector3(handle, value);
+        }
     }
 
     /// <summary>
     /// 汎用データの取得
     /// </summary>
-    /// <template name="T">データ型</template>
+    /// <template name="T">データ型（int, float, bool, Vector3）</template>
     /// <param name="key">キー</param>
-    /// <returns>値（存在しない場合はnullopt）</returns>
+    /// <returns>値（存在しない、または型が異なる場合はnullopt）</returns>
     template<typename T>
-    std::optional<T> GetValue(const std::string& key) const {
-        auto it = data_.find(key);
-        if (it != data_.end()) {
-            try {
-                return std::any_cast<T>(it->second);
-            }
-            catch (const std::bad_any_cast&) {
-                return std::nullopt;
-            }
+    std::optional<T> GetValue(std::string_view key) const {
+        BTBlackboardKey<T> handle = FindKey<T>(key);
+        const Slot* slot = GetSlot(handle.slot, TypeOf<T>());
+        if (!slot || !slot->hasValue) {
+            return std::nullopt;
+        }
+        if constexpr (std::is_same_v<T, int>) {
+            return slot->value.i;
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            return slot->value.f;
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            return slot->value.b;
+        }
+        else {
+            return Vector3(slot->value.v[0], slot->value.v[1], slot->value.v[2]);
         }
-        return std::nullopt;
     }
 
     /// <summary>
@@ -96,8 +398,8 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
-    void SetInt(const std::string& key, int value) {
-        data_[key] = value;
+    void SetInt(std::string_view key, int value) {
+        SetInt(RegisterKey<int>(key), value);
     }
 
     /// <summary>
@@ -106,9 +408,8 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
-    int GetInt(const std::string& key, int defaultValue = 0) const {
-        auto value = GetValue<int>(key);
-        return value.value_or(defaultValue);
+    int GetInt(std::string_view key, int defaultValue = 0) const {
+        return GetInt(FindKey<int>(key), defaultValue);
     }
 
     /// <summary>
@@ -116,8 +417,8 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
-    void SetFloat(const std::string& key, float value) {
-        data_[key] = value;
+    void SetFloat(std::string_view key, float value) {
+        SetFloat(RegisterKey<float>(key), value);
     }
 
     /// <summary>
@@ -126,9 +427,8 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
-    float GetFloat(const std::string& key, float defaultValue = 0.0f) const {
-        auto value = GetValue<float>(key);
-        return value.value_or(defaultValue);
+    float GetFloat(std::string_view key, float defaultValue = 0.0f) const {
+        return GetFloat(FindKey<float>(key), defaultValue);
     }
 
     /// <summary>
@@ -136,8 +436,8 @@ public:
     /// </summary>
     /// <param name="key">キー</param>
     /// <param name="value">値</param>
-    void SetVector3(const std::string& key, const Vector3& value) {
-        data_[key] = value;
+    void SetVector3(std::string_view key, const Vector3& value) {
+        SetVector3(RegisterKey<Vector3>(key), value);
     }
 
     /// <summary>
@@ -146,38 +446,114 @@ public:
     /// <param name="key">キー</param>
     /// <param name="defaultValue">デフォルト値</param>
     /// <returns>値</returns>
-    Vector3 GetVector3(const std::string& key, const Vector3& defaultValue = Vector3()) const {
-        auto value = GetValue<Vector3>(key);
-        return value.value_or(defaultValue);
+    Vector3 GetVector3(std::string_view key, const Vector3& defaultValue = Vector3()) const {
+        return GetVector3(FindKey<Vector3>(key), defaultValue);
     }
 
     /// <summary>
-    /// キーが存在するかチェック
+    /// キーに値が設定されているかチェック
     /// </summary>
     /// <param name="key">キー</param>
     /// <returns>存在する場合true</returns>
-    bool HasKey(const std::string& key) const {
-        return data_.find(key) != data_.end();
+    bool HasKey(std::string_view key) const {
+        auto it = keyToSlot_.find(key);
+        return it != keyToSlot_.end() && slots_[it->second].hasValue;
     }
 
     /// <summary>
-    /// キーの削除
+    /// キーの値を削除（スロットとハンドルは有効なまま残る）
     /// </summary>
     /// <param name="key">キー</param>
-    void RemoveKey(const std::string& key) {
-        data_.erase(key);
+    void RemoveKey(std::string_view key) {
+        auto it = keyToSlot_.find(key);
+        if (it != keyToSlot_.end() && slots_[it->second].hasValue) {
+            slots_[it->second].hasValue = false;
+            MarkChanged(it->second);
+        }
     }
 
     /// <summary>
-    /// 全データのクリア
+    /// 全データのクリア（登録済みキーのハンドルは有効なまま残る）
     /// </summary>
     void Clear() {
-        data_.clear();
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            if (slots_[i].hasValue) {
+                slots_[i].hasValue = false;
+                MarkChanged(static_cast<uint16_t>(i));
+            }
+        }
+    }
+
+    //-----------------------------変更通知------------------------------//
+
+    /// <summary>
+    /// 前回のClearChanges以降に値が変化したスロットの取得
+    /// </summary>
+    /// <returns>スロット番号のリスト（変化した順）</returns>
+    const std::vector<uint16_t>& GetChangedSlots() const { return changedSlots_; }
+
+    /// <summary>
+    /// 変更記録のクリア（変更を処理した側が呼ぶ）
+    /// </summary>
+    void ClearChanges() {
+        for (uint16_t slot : changedSlots_) {
+            slots_[slot].changed = false;
+        }
+        changedSlots_.clear();
     }
 
 private:
-    // ボスのポインタ
-    Boss* boss_ = nullptr;
+    /// <summary>
+    /// C++型から値型タグへの変換
+    /// </summary>
+    template<typename T>
+    static constexpr BTValueType TypeOf() {
+        static_assert(std::is_same_v<T, int> || std::is_same_v<T, float> ||
+                      std::is_same_v<T, bool> || std::is_same_v<T, Vector3>,
+                      "BTBlackboard supports int, float, bool and Vector3 only");
+        if constexpr (std::is_same_v<T, int>) {
+            return BTValueType::Int;
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            return BTValueType::Float;
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            return BTValueType::Bool;
+        }
+        else {
+            return BTValueType::Vector3;
+        }
+    }
+
+    /// <summary>
+    /// スロットの取得（範囲外・型不一致ならnullptr）
+    /// </summary>
+    Slot* GetSlot(uint16_t slot, BTValueType type) {
+        if (slot >= slots_.size() || slots_[slot].type != type) {
+            return nullptr;
+        }
+        return &slots_[slot];
+    }
+
+    const Slot* GetSlot(uint16_t slot, BTValueType type) const {
+        if (slot >= slots_.size() || slots_[slot].type != type) {
+            return nullptr;
+        }
+        return &slots_[slot];
+    }
+
+    /// <summary>
+    /// スロットを変化ありとして記録（同じスロットは1回だけ記録）
+    /// </summary>
+    void MarkChanged(uint16_t slot) {
+        if (!slots_[slot].changed) {
+            slots_[slot].changed = true;
+            changedSlots_.push_back(slot);
+        }
+    }
+
+    // ツリーから操作するボス
+    BossAgent* boss_ = nullptr;
 
     // プレイヤーのポインタ
     Player* player_ = nullptr;
@@ -185,6 +561,15 @@ private:
     // フレームの経過時間
     float deltaTime_ = 0.0f;
 
-    // 汎用データストレージ
-    std::unordered_map<std::string, std::any> data_;
-};
\ No newline at end of file
+    // このエージェントの乱数列
+    BTRandomStream random_;
+
+    // 値スロット（キーハンドルのslotでインデックスする）
+    std::vector<Slot> slots_;
+
+    // 値が変化したスロット番号
+    std::vector<uint16_t> changedSlots_;
+
+    // キー名 → スロット番号（登録・文字列アクセス時のみ使用）
+    std::unordered_map<std::string, uint16_t, KeyHash, std::equal_to<>> keyToSlot_;
+};
@@ -0,0 +1,234 @@
+#include "BTCompiledTree.h"
+#include "BTComposite.h"
+#include "../Composites/BTSelector.h"
+#include "../Composites/BTSequence.h"
+#include "../Composites/BTRandomSelector.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace {
+
+    /// <summary>
+    /// ノードの種類を判定
+    /// </summary>
+    BTCompiledNodeKind ClassifyNode(BTNode* node) {
+        // RandomSelectorを先に判定（将来の派生関係に備える）
+        if (dynamic_cast<BTRandomSelector*>(node)) {
+            return BTCompiledNodeKind::RandomSelector;
+        }
+        if (dynamic_cast<BTSelector*>(node)) {
+            return BTCompiledNodeKind::Selector;
+        }
+        if (dynamic_cast<BTSequence*>(node)) {
+            return BTCompiledNodeKind::Sequence;
+        }
+        return BTCompiledNodeKind::Leaf;
+    }
+
+}
+
+bool BTCompiledTree::Compile(const BTNodePtr& root) {
+    Clear();
+
+    if (!root) {
+        return false;
+    }
+
+    if (Flatten(root, 0) == kInvalidIndex) {
+        // ノード数が上限を超えた、またはエージェントごとの状態に対応していないリーフがある
+        Clear();
+        return false;
+    }
+
+    BuildGuards();
+
+    if (!BuildInstanceLayout()) {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+void BTCompiledTree::Clear() {
+    nodes_.clear();
+    childIndices_.clear();
+    leaves_.clear();
+    sourceNodes_.clear();
+    guards_.clear();
+    guardConditions_.clear();
+    observers_.clear();
+    maxDepth_ = 0;
+    shuffleOffset_ = 0;
+    stackOffset_ = 0;
+    touchedOffset_ = 0;
+    instanceSize_ = 0;
+}
+
+uint16_t BTCompiledTree::Flatten(const BTNodePtr& node, size_t depth) {
+    if (nodes_.size() >= kInvalidIndex) {
+        return kInvalidIndex;
+    }
+
+    uint16_t index = static_cast<uint16_t>(nodes_.size());
+    nodes_.emplace_back();
+    sourceNodes_.push_back(node);
+
+    BTCompiledNodeKind kind = ClassifyNode(node.get());
+    nodes_[index].kind = kind;
+
+    if (kind == BTCompiledNodeKind::Leaf) {
+        // リーフは共有されるため、状態をノード外に持てるものに限る
+        if (!node->SupportsInstanceExecution()) {
+            return kInvalidIndex;
+        }
+        nodes_[index].leafIndex = static_cast<uint16_t>(leaves_.size());
+        leaves_.push_back(node.get());
+        nodes_[index].subtreeEnd = static_cast<uint16_t>(index + 1);
+        return index;
+    }
+
+    // 走査スタックにはルートからのコンポジット数だけ積まれる
+    maxDepth_ = (std::max)(maxDepth_, depth + 1);
+
+    // 子の範囲を先に確保してから各子を平坦化（子孫は後ろに追加される）
+    const auto& children = static_cast<BTComposite*>(node.get())->GetChildren();
+    if (childIndices_.size() + children.size() >= kInvalidIndex) {
+        return kInvalidIndex;
+    }
+    uint16_t childBegin = static_cast<uint16_t>(childIndices_.size());
+    nodes_[index].childBegin = childBegin;
+    nodes_[index].childCount = static_cast<uint16_t>(children.size());
+    childIndices_.resize(childIndices_.size() + children.size());
+
+    for (size_t i = 0; i < children.size(); ++i) {
+        uint16_t childIndex = Flatten(children[i], depth + 1);
+        if (childIndex == kInvalidIndex) {
+            return kInvalidIndex;
+        }
+        childIndices_[childBegin + i] = childIndex;
+    }
+
+    nodes_[index].subtreeEnd = static_cast<uint16_t>(nodes_.size());
+    return index;
+}
+
+void BTCompiledTree::BuildGuards() {
+    std::vector<uint16_t> conditions;
+
+    // 監視キーを持つリーフを条件ノードとして扱う
+    auto isObserver = [this](uint16_t index) {
+        if (nodes_[index].kind != BTCompiledNodeKind::Leaf) {
+            return false;
+        }
+        std::vector<uint16_t> slots;
+        leaves_[nodes_[index].leafIndex]->GetObservedKeys(slots);
+        return !slots.empty();
+    };
+    auto abortMode = [this](uint16_t index) {
+        return leaves_[nodes_[index].leafIndex]->GetAbortMode();
+    };
+
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        const Node& owner = nodes_[i];
+        // RandomSelectorは実行順が毎回変わるため優先度による中断を行わない
+        if (owner.kind != BTCompiledNodeKind::Sequence && owner.kind != BTCompiledNodeKind::Selector) {
+            continue;
+        }
+
+        for (uint16_t position = 0; position < owner.childCount; ++position) {
+            uint16_t child = childIndices_[owner.childBegin + position];
+            conditions.clear();
+
+            if (isObserver(child)) {
+                // Sequence：Selfなら条件が不成立になったら中断 / Selector：LowerPriorityなら条件が成立したら中断
+                bool isSelector = owner.kind == BTCompiledNodeKind::Selector;
+                if (abortMode(child) == (isSelector ? BTAbortMode::LowerPriority : BTAbortMode::Self)) {
+                    conditions.push_back(child);
+                    AddGuard(static_cast<uint16_t>(i), position, conditions, isSelector);
+                }
+            }
+            else if (owner.kind == BTCompiledNodeKind::Selector && nodes_[child].kind == BTCompiledNodeKind::Sequence) {
+                // Selectorの子のSequenceは、先頭に並ぶ条件がすべて成立したら中断
+                // （先頭の条件のいずれかがLowerPriorityを指定している場合のみ）
+                const Node& sequence = nodes_[child];
+                bool abortsLowerPriority = false;
+                for (uint16_t j = 0; j < sequence.childCount; ++j) {
+                    uint16_t grandChild = childIndices_[sequence.childBegin + j];
+                    if (!isObserver(grandChild)) {
+                        break;
+                    }
+                    conditions.push_back(grandChild);
+                    abortsLowerPriority = abortsLowerPriority || abortMode(grandChild) == BTAbortMode::LowerPriority;
+                }
+                if (abortsLowerPriority) {
+                    AddGuard(static_cast<uint16_t>(i), position, conditions, true);
+                }
+            }
+        }
+    }
+
+    std::sort(observers_.begin(), observers_.end());
+}
+
+void BTCompiledTree::AddGuard(uint16_t owner, uint16_t position, const std::vector<uint16_t>& conditions, bool abortOnSuccess) {
+    uint16_t guardIndex = static_cast<uint16_t>(guards_.size());
+
+    Guard guard;
+    guard.owner = owner;
+    guard.position = position;
+    guard.conditionBegin = static_cast<uint16_t>(guardConditions_.size());
+    guard.conditionCount = static_cast<uint16_t>(conditions.size());
+    guard.abortOnSuccess = abortOnSuccess;
+    guards_.push_back(guard);
+
+    // 条件が監視するキーをテーブルへ登録（同じガードへの重複は除く）
+    std::vector<uint16_t> slots;
+    for (uint16_t condition : conditions) {
+        guardConditions_.push_back(condition);
+        leaves_[nodes_[condition].leafIndex]->GetObservedKeys(slots);
+    }
+    std::sort(slots.begin(), slots.end());
+    slots.erase(std::unique(slots.begin(), slots.end()), slots.end());
+    for (uint16_t slot : slots) {
+        observers_.emplace_back(slot, guardIndex);
+    }
+}
+
+bool BTCompiledTree::BuildInstanceLayout() {
+    // 先頭から順に詰め、各領域は要素のアラインメントに揃える
+    auto alignUp = [](size_t offset, size_t alignment) {
+        return (offset + alignment - 1) & ~(alignment - 1);
+    };
+
+    size_t offset = sizeof(NodeState) * nodes_.size();
+    shuffleOffset_ = alignUp(offset, alignof(uint16_t));
+    offset = shuffleOffset_ + sizeof(uint16_t) * childIndices_.size();
+    stackOffset_ = offset;
+    offset += sizeof(uint16_t) * maxDepth_;
+    touchedOffset_ = offset;
+    offset += sizeof(uint16_t) * leaves_.size();
+
+    // リーフの状態（状態を持たないリーフは領域を使わない）
+    for (Node& node : nodes_) {
+        if (node.kind != BTCompiledNodeKind::Leaf) {
+            continue;
+        }
+        const BTNode* leaf = leaves_[node.leafIndex];
+        size_t size = leaf->GetInstanceStateSize();
+        if (size == 0) {
+            node.stateOffset = 0;
+            continue;
+        }
+        offset = alignUp(offset, leaf->GetInstanceStateAlignment());
+        if (offset + size > UINT32_MAX) {
+            return false;
+        }
+        node.stateOffset = static_cast<uint32_t>(offset);
+        offset += size;
+    }
+
+    instanceSize_ = alignUp(offset, alignof(std::max_align_t));
+    return true;
+}
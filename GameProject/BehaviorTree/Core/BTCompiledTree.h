@@ -0,0 +1,207 @@
+#pragma once
+#include "BTNode.h"
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class BTBlackboard;
+
+/// <summary>
+/// コンパイル済みノードの種類
+/// </summary>
+enum class BTCompiledNodeKind : uint8_t {
+    /// <summary>
+    /// リーフ（既存のBTNodeをそのまま実行）
+    /// </summary>
+    Leaf,
+
+    /// <summary>
+    /// セレクター
+    /// </summary>
+    Selector,
+
+    /// <summary>
+    /// シーケンス
+    /// </summary>
+    Sequence,
+
+    /// <summary>
+    /// ランダムセレクター
+    /// </summary>
+    RandomSelector
+};
+
+/// <summary>
+/// コンパイル済みビヘイビアツリー（共有する読み取り専用の定義）
+/// ポインタで連結されたノードツリーを深さ優先順の連続配列へ平坦化し、
+/// コンポジットは子インデックス範囲で表す
+/// アクション・条件ノードは既存のBTNodeをリーフとしてそのまま実行する
+///
+/// コンパイル後は変更されないため、1つの定義を複数のエージェントで共有できる
+/// 実行中の状態（コンポジットの継続位置・リーフの経過時間など）はBTTreeInstanceが
+/// エージェントごとに1つの連続したブロックとして持つ
+/// </summary>
+class BTCompiledTree {
+public:
+    /// <summary>
+    /// 無効なノードインデックス
+    /// </summary>
+    static constexpr uint16_t kInvalidIndex = 0xFFFF;
+
+    /// <summary>
+    /// ノードツリーをコンパイル
+    /// Selector/Sequence/RandomSelector以外のコンポジットは、子を含めて1つのリーフとして扱う
+    /// ブラックボードキーは事前にResolveBlackboardKeysで解決しておくこと
+    /// （共有するエージェントのブラックボードは同じ順でキーを登録している必要がある）
+    /// </summary>
+    /// <param name="root">ルートノード</param>
+    /// <returns>成功したらtrue（エージェントごとの状態に対応していないリーフを含む場合は失敗）</returns>
+    bool Compile(const BTNodePtr& root);
+
+    /// <summary>
+    /// コンパイル結果の破棄
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// コンパイル済みかどうか
+    /// </summary>
+    /// <returns>コンパイル済みの場合true</returns>
+    bool IsValid() const { return !nodes_.empty(); }
+
+    /// <summary>
+    /// ノード数の取得
+    /// </summary>
+    /// <returns>ノード数</returns>
+    size_t GetNodeCount() const { return nodes_.size(); }
+
+    /// <summary>
+    /// リーフ数の取得
+    /// </summary>
+    /// <returns>リーフ数</returns>
+    size_t GetLeafCount() const { return leaves_.size(); }
+
+    /// <summary>
+    /// 監視対象の条件（ガード）数の取得
+    /// </summary>
+    /// <returns>ガード数</returns>
+    size_t GetGuardCount() const { return guards_.size(); }
+
+    /// <summary>
+    /// コンポジットの最大ネスト数の取得
+    /// </summary>
+    /// <returns>最大ネスト数</returns>
+    size_t GetMaxDepth() const { return maxDepth_; }
+
+    /// <summary>
+    /// エージェント1体分の状態ブロックのサイズ（バイト）
+    /// </summary>
+    /// <returns>サイズ</returns>
+    size_t GetInstanceStateSize() const { return instanceSize_; }
+
+    /// <summary>
+    /// 指定インデックスのコンパイル元ノードを取得
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <returns>コンパイル元ノード</returns>
+    const BTNodePtr& GetSourceNode(uint16_t index) const { return sourceNodes_[index]; }
+
+private:
+    friend class BTTreeInstance;
+
+    /// <summary>
+    /// ノード定義
+    /// </summary>
+    struct Node {
+        BTCompiledNodeKind kind = BTCompiledNodeKind::Leaf; // ノードの種類
+        uint16_t childBegin = 0;                            // childIndices_内の子範囲の先頭
+        uint16_t childCount = 0;                            // 子の数
+        uint16_t leafIndex = kInvalidIndex;                 // leaves_内のインデックス（リーフのみ）
+        uint16_t subtreeEnd = 0;                            // 部分木の終端（深さ優先順で子孫はindex+1～subtreeEnd-1）
+        uint32_t stateOffset = 0;                           // 状態ブロック内のリーフ状態の位置（リーフのみ）
+    };
+
+    /// <summary>
+    /// 条件による中断の定義
+    /// </summary>
+    struct Guard {
+        uint16_t owner = 0;          // 中断時に再実行するコンポジット
+        uint16_t position = 0;       // ownerの子のうち再実行を開始する位置
+        uint16_t conditionBegin = 0; // guardConditions_内の評価する条件の範囲の先頭
+        uint16_t conditionCount = 0; // 評価する条件の数
+        bool abortOnSuccess = false; // true: 全条件の成立で中断（Selector）/ false: 不成立で中断（Sequence）
+    };
+
+    /// <summary>
+    /// 状態ブロック内のノードごとの可変状態
+    /// </summary>
+    struct NodeState {
+        BTNodeStatus status = BTNodeStatus::Failure; // 直前の実行結果
+        uint16_t cursor = 0;                         // 実行中の子の位置（実行順）
+        bool needsShuffle = true;                    // シャッフルが必要か（RandomSelectorのみ）
+        bool touched = false;                        // 前回のリセット以降に実行したか（リーフのみ）
+    };
+
+    /// <summary>
+    /// ノードを深さ優先で再帰的に平坦化
+    /// </summary>
+    /// <param name="node">平坦化するノード</param>
+    /// <param name="depth">ルートからの深さ</param>
+    /// <returns>割り当てたインデックス（失敗時はkInvalidIndex）</returns>
+    uint16_t Flatten(const BTNodePtr& node, size_t depth);
+
+    /// <summary>
+    /// 監視キーを持ち、中断の種類（BTAbortMode）を指定した条件ノードからガードと監視テーブルを構築
+    /// </summary>
+    void BuildGuards();
+
+    /// <summary>
+    /// ガードの追加
+    /// </summary>
+    /// <param name="owner">再実行するコンポジット</param>
+    /// <param name="position">再実行を開始する位置</param>
+    /// <param name="conditions">評価する条件ノード</param>
+    /// <param name="abortOnSuccess">成立で中断する場合true</param>
+    void AddGuard(uint16_t owner, uint16_t position, const std::vector<uint16_t>& conditions, bool abortOnSuccess);
+
+    /// <summary>
+    /// 状態ブロックの配置を決定
+    /// [NodeState × ノード数][シャッフル順][走査スタック][実行済みリーフ][リーフ状態...]
+    /// </summary>
+    /// <returns>ブロックがサイズ上限に収まればtrue</returns>
+    bool BuildInstanceLayout();
+
+private:
+    // ノード定義（深さ優先順、先頭がルート）
+    std::vector<Node> nodes_;
+
+    // コンポジットの子インデックス（各ノードのchildBegin～childBegin+childCount）
+    std::vector<uint16_t> childIndices_;
+
+    // リーフとして実行するノード（Tick中は生ポインタのみ参照）
+    std::vector<const BTNode*> leaves_;
+
+    // コンパイル元ノード（所有権の保持とエディタ連携用）
+    std::vector<BTNodePtr> sourceNodes_;
+
+    // コンポジットの最大ネスト数
+    size_t maxDepth_ = 0;
+
+    // 条件による中断の定義
+    std::vector<Guard> guards_;
+
+    // ガードが評価する条件ノードのインデックス
+    std::vector<uint16_t> guardConditions_;
+
+    // 監視テーブル（スロット番号, ガード番号）をスロット番号順に格納
+    std::vector<std::pair<uint16_t, uint16_t>> observers_;
+
+    // 状態ブロック内の各領域の位置（バイト）
+    size_t shuffleOffset_ = 0;
+    size_t stackOffset_ = 0;
+    size_t touchedOffset_ = 0;
+
+    // 状態ブロック全体のサイズ（バイト）
+    size_t instanceSize_ = 0;
+};
@@ -24,4 +24,10 @@ void BTComposite::Reset() {
     for (auto& child : children_) {
         child->Reset();
     }
+}
+
+void BTComposite::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    for (auto& child : children_) {
+        child->ResolveBlackboardKeys(blackboard);
+    }
 }
\ No newline at end of file
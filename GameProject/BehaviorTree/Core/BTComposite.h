@@ -58,10 +58,17 @@ public:
     /// </summary>
     void Reset() override;
 
+    /// <summary>
+    /// 子ノードのブラックボードキーを再帰的に解決
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    void ResolveBlackboardKeys(BTBlackboard& blackboard) override;
+
 protected:
     // 子ノードのリスト
     std::vector<BTNodePtr> children_;
 
-    // 現在実行中の子ノードのインデックス
+    // 現在実行中の子ノードのインデックス（ポインタツリーを直接実行する場合のみ使用）
+    // コンパイル済みツリーでは継続位置をBTTreeInstanceの状態ブロックに持つ
     size_t currentChildIndex_ = 0;
 };
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+#include "BTNode.h"
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/// <summary>
+/// 実行中の状態を持たないリーフ用の空の状態
+/// </summary>
+struct BTNoState {};
+
+/// <summary>
+/// リーフノード（アクション・条件）の基底クラス
+/// 実行中に変化する値（経過時間・発射数・フェーズなど）はノードのメンバーではなくTStateに置き、
+/// ノード自身はパラメータだけを持つ読み取り専用の定義として扱う
+///   ・コンパイル済みツリー：TStateはエージェントごとの状態ブロック内に置かれ、ノードは共有される
+///   ・ポインタツリーの直接実行：ノードが持つ1エージェント分のTStateを使う
+/// </summary>
+/// <template name="TState">エージェントごとの状態（トリビアルに破棄できる型）</template>
+template<typename TState>
+class BTLeafNode : public BTNode {
+    static_assert(std::is_trivially_destructible_v<TState>, "BTLeafNode state must be trivially destructible");
+    static_assert(alignof(TState) <= alignof(std::max_align_t), "BTLeafNode state must not be over-aligned");
+
+public:
+    /// <summary>
+    /// 1フレーム分の処理
+    /// 変化する値はstateにのみ書き込み、ノードのメンバーは読み取りのみとする
+    /// </summary>
+    /// <param name="blackboard">エージェントのブラックボード</param>
+    /// <param name="state">エージェントの状態</param>
+    /// <returns>実行結果</returns>
+    virtual BTNodeStatus Tick(BTBlackboard* blackboard, TState& state) const = 0;
+
+    /// <summary>
+    /// ノードの実行（ポインタツリー用）
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus Execute(BTBlackboard* blackboard) override {
+        status_ = Tick(blackboard, ownState_);
+        return status_;
+    }
+
+    /// <summary>
+    /// ノードのリセット（ポインタツリー用）
+    /// </summary>
+    void Reset() override {
+        BTNode::Reset();
+        ownState_ = TState{};
+    }
+
+    /// <summary>
+    /// エージェントごとの状態を使った実行に対応しているか
+    /// </summary>
+    /// <returns>常にtrue</returns>
+    bool SupportsInstanceExecution() const override { return true; }
+
+    /// <summary>
+    /// エージェントごとの状態のサイズ
+    /// </summary>
+    /// <returns>sizeof(TState)（空の状態なら0）</returns>
+    size_t GetInstanceStateSize() const override {
+        return std::is_empty_v<TState> ? 0 : sizeof(TState);
+    }
+
+    /// <summary>
+    /// エージェントごとの状態のアラインメント
+    /// </summary>
+    /// <returns>alignof(TState)</returns>
+    size_t GetInstanceStateAlignment() const override { return alignof(TState); }
+
+    /// <summary>
+    /// エージェントごとの状態を初期値で構築
+    /// </summary>
+    /// <param name="state">状態の領域</param>
+    void InitializeInstanceState(void* state) const override {
+        if constexpr (!std::is_empty_v<TState>) {
+            ::new (state) TState{};
+        }
+        else {
+            (void)state;
+        }
+    }
+
+    /// <summary>
+    /// エージェントごとの状態を使ってノードを実行
+    /// </summary>
+    /// <param name="blackboard">エージェントのブラックボード</param>
+    /// <param name="state">エージェントの状態</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus ExecuteInstance(BTBlackboard* blackboard, void* state) const override {
+        if constexpr (std::is_empty_v<TState>) {
+            (void)state;
+            TState empty{};
+            return Tick(blackboard, empty);
+        }
+        else {
+            return Tick(blackboard, *std::launder(static_cast<TState*>(state)));
+        }
+    }
+
+protected:
+    /// <summary>
+    /// ポインタツリーを直接実行した場合の状態の取得（デバッグ表示用）
+    /// </summary>
+    /// <returns>ノードが持つ状態</returns>
+    const TState& GetOwnState() const { return ownState_; }
+
+private:
+    // ポインタツリーを直接実行する場合の状態（1エージェント分）
+    TState ownState_{};
+};
@@ -0,0 +1,31 @@
+#include "BTNode.h"
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+void BTNode::ApplyAbortMode(const nlohmann::json& params) {
+    if (params.contains("abortMode")) {
+        int mode = params["abortMode"].get<int>();
+        if (mode < static_cast<int>(BTAbortMode::None) || mode > static_cast<int>(BTAbortMode::LowerPriority)) {
+            mode = static_cast<int>(BTAbortMode::None);
+        }
+        abortMode_ = static_cast<BTAbortMode>(mode);
+    }
+}
+
+void BTNode::ExtractAbortMode(nlohmann::json& params) const {
+    params["abortMode"] = static_cast<int>(abortMode_);
+}
+
+#ifdef _DEBUG
+bool BTNode::DrawAbortModeImGui() {
+    int mode = static_cast<int>(abortMode_);
+    const char* modeItems[] = { "None", "Self", "Lower Priority" };
+    if (ImGui::Combo("Observer Aborts", &mode, modeItems, IM_ARRAYSIZE(modeItems))) {
+        abortMode_ = static_cast<BTAbortMode>(mode);
+        return true;
+    }
+    return false;
+}
+#endif
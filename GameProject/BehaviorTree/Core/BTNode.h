@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
@@ -26,6 +28,26 @@ enum class BTNodeStatus {
     Running
 };
 
+/// <summary>
+/// 条件ノードの値が変化したときの中断の種類（リアクティブ実行時のみ有効）
+/// </summary>
+enum class BTAbortMode : uint8_t {
+    /// <summary>
+    /// 中断しない（次に評価される順番まで待つ）
+    /// </summary>
+    None,
+
+    /// <summary>
+    /// 不成立になったら、同じSequence内で後ろに続く実行中の枝を中断
+    /// </summary>
+    Self,
+
+    /// <summary>
+    /// 成立したら、親のSelector内で優先度の低い実行中の枝を中断して自分の枝を再実行
+    /// </summary>
+    LowerPriority
+};
+
 /// <summary>
 /// ビヘイビアツリーノードの基底クラス
 /// </summary>
@@ -98,6 +120,80 @@ public:
         return {};
     }
 
+    /// <summary>
+    /// ブラックボードキーをハンドルへ解決（ツリー構築後に一度だけ呼ばれる）
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    virtual void ResolveBlackboardKeys(BTBlackboard& blackboard) {
+        // デフォルトは何もしない（ブラックボードを参照しないノード用）
+        (void)blackboard;
+    }
+
+    /// <summary>
+    /// 監視するブラックボードキーの取得
+    /// キーを返すノードは副作用のない条件ノードとして扱われ、
+    /// リアクティブ実行時、GetAbortMode()がNone以外なら値の変化で再評価される
+    /// </summary>
+    /// <param name="outSlots">監視するキーのスロット番号の追加先</param>
+    virtual void GetObservedKeys(std::vector<uint16_t>& outSlots) const {
+        // デフォルトは何も監視しない
+        (void)outSlots;
+    }
+
+    /// <summary>
+    /// 監視キーの変化による中断の種類を取得
+    /// </summary>
+    /// <returns>中断の種類（既定はNone）</returns>
+    BTAbortMode GetAbortMode() const { return abortMode_; }
+
+    /// <summary>
+    /// 監視キーの変化による中断の種類を設定
+    /// </summary>
+    /// <param name="mode">中断の種類</param>
+    void SetAbortMode(BTAbortMode mode) { abortMode_ = mode; }
+
+    //-----------------------------共有実行（コンパイル済みツリー）------------------------------//
+
+    /// <summary>
+    /// エージェントごとの状態を使った実行に対応しているか
+    /// 対応していないリーフを含むツリーはコンパイルできない
+    /// </summary>
+    /// <returns>対応している場合true</returns>
+    virtual bool SupportsInstanceExecution() const { return false; }
+
+    /// <summary>
+    /// エージェントごとに必要な状態のサイズ（バイト）
+    /// </summary>
+    /// <returns>サイズ（状態を持たない場合0）</returns>
+    virtual size_t GetInstanceStateSize() const { return 0; }
+
+    /// <summary>
+    /// エージェントごとの状態のアラインメント
+    /// </summary>
+    /// <returns>アラインメント</returns>
+    virtual size_t GetInstanceStateAlignment() const { return 1; }
+
+    /// <summary>
+    /// エージェントごとの状態を初期状態にする（確保時とリセット時に呼ばれる）
+    /// </summary>
+    /// <param name="state">GetInstanceStateSize()分の領域</param>
+    virtual void InitializeInstanceState(void* state) const {
+        (void)state;
+    }
+
+    /// <summary>
+    /// エージェントごとの状態を使ってノードを実行
+    /// ノード自身（定義）は変更しないため、1つのツリーを複数のエージェントで共有できる
+    /// </summary>
+    /// <param name="blackboard">エージェントのブラックボード</param>
+    /// <param name="state">エージェントの状態（InitializeInstanceState済み）</param>
+    /// <returns>実行結果</returns>
+    virtual BTNodeStatus ExecuteInstance(BTBlackboard* blackboard, void* state) const {
+        (void)blackboard;
+        (void)state;
+        return BTNodeStatus::Failure;
+    }
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGuiでパラメータ編集UIを描画
@@ -107,11 +203,34 @@ public:
 #endif
 
 protected:
+    /// <summary>
+    /// パラメータJSONから中断の種類（"abortMode"）を読み込む（条件ノードのApplyParameters用）
+    /// </summary>
+    /// <param name="params">パラメータJSON</param>
+    void ApplyAbortMode(const nlohmann::json& params);
+
+    /// <summary>
+    /// 中断の種類をパラメータJSONへ書き込む（条件ノードのExtractParameters用）
+    /// </summary>
+    /// <param name="params">書き込み先のパラメータJSON</param>
+    void ExtractAbortMode(nlohmann::json& params) const;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// 中断の種類の選択UIを描画（条件ノードのDrawImGui用）
+    /// </summary>
+    /// <returns>変更があればtrue</returns>
+    bool DrawAbortModeImGui();
+#endif
+
     // 現在の状態
     BTNodeStatus status_ = BTNodeStatus::Failure;
 
     // ノード名
     std::string name_ = "BTNode";
+
+    // 監視キーの変化による中断の種類
+    BTAbortMode abortMode_ = BTAbortMode::None;
 };
 
 /// <summary>
@@ -0,0 +1,100 @@
+#include "BTNodeRegistry.h"
+#include <algorithm>
+#include <cstring>
+
+BTNodeRegistry& BTNodeRegistry::GetInstance() {
+    // 関数内静的変数にすることで、他の翻訳単位の静的初期化から呼ばれても構築済みになる
+    static BTNodeRegistry instance;
+    return instance;
+}
+
+bool BTNodeRegistry::Register(Entry entry) {
+    if (!entry.create || entries_.size() >= kEmptySlot - 1) {
+        return false;
+    }
+
+    // 同名の登録、またはIDの衝突は拒否（タイプ名を変えて解消する）
+    for (const Entry& existing : entries_) {
+        if (existing.typeId == entry.typeId || existing.typeName == entry.typeName) {
+            return false;
+        }
+    }
+
+    entries_.push_back(std::move(entry));
+
+    // エディタの一覧表示順（カテゴリ → 表示名）に整列
+    std::sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+        if (a.metadata.category != b.metadata.category) {
+            return a.metadata.category < b.metadata.category;
+        }
+        return std::strcmp(a.metadata.displayName, b.metadata.displayName) < 0;
+    });
+
+    RebuildTable();
+    return true;
+}
+
+void BTNodeRegistry::RebuildTable() {
+    // 負荷率50%以下になる2のべき乗サイズ
+    size_t capacity = 16;
+    while (capacity < entries_.size() * 2) {
+        capacity *= 2;
+    }
+
+    table_.assign(capacity, kEmptySlot);
+    typeToEntry_.clear();
+
+    const size_t mask = capacity - 1;
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        size_t slot = entries_[i].typeId & mask;
+        while (table_[slot] != kEmptySlot) {
+            slot = (slot + 1) & mask;
+        }
+        table_[slot] = static_cast<uint16_t>(i);
+        typeToEntry_.emplace(entries_[i].type, static_cast<uint16_t>(i));
+    }
+}
+
+const BTNodeRegistry::Entry* BTNodeRegistry::Find(BTNodeTypeId typeId) const {
+    if (table_.empty()) {
+        return nullptr;
+    }
+
+    // 線形探索法（空きスロットに当たったら未登録）
+    const size_t mask = table_.size() - 1;
+    for (size_t slot = typeId & mask; table_[slot] != kEmptySlot; slot = (slot + 1) & mask) {
+        const Entry& entry = entries_[table_[slot]];
+        if (entry.typeId == typeId) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+const BTNodeRegistry::Entry* BTNodeRegistry::Find(std::string_view typeName) const {
+    const Entry* entry = Find(BTHashNodeType(typeName));
+
+    // 未登録の名前がIDだけ一致した場合に備えて一度だけ名前を確認
+    if (entry && entry->typeName != typeName) {
+        return nullptr;
+    }
+    return entry;
+}
+
+const BTNodeRegistry::Entry* BTNodeRegistry::FindByNode(const BTNode& node) const {
+    auto it = typeToEntry_.find(std::type_index(typeid(node)));
+    if (it == typeToEntry_.end()) {
+        return nullptr;
+    }
+    return &entries_[it->second];
+}
+
+BTNodePtr BTNodeRegistry::Create(std::string_view typeName, std::pmr::memory_resource* arena) const {
+    const Entry* entry = Find(typeName);
+    return entry ? entry->create(arena) : nullptr;
+}
+
+BTNodePtr BTNodeRegistry::Create(BTNodeTypeId typeId, std::pmr::memory_resource* arena) const {
+    const Entry* entry = Find(typeId);
+    return entry ? entry->create(arena) : nullptr;
+}
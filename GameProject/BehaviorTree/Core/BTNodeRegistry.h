@@ -0,0 +1,192 @@
+#pragma once
+#include "BTNode.h"
+#include "BTComposite.h"
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/// <summary>
+/// ノードタイプID（タイプ名のFNV-1aハッシュ）
+/// </summary>
+using BTNodeTypeId = uint32_t;
+
+/// <summary>
+/// タイプ名からノードタイプIDを計算（コンパイル時にも使用可能）
+/// </summary>
+/// <param name="typeName">ノードタイプ名（"BTSelector"等）</param>
+/// <returns>ノードタイプID</returns>
+constexpr BTNodeTypeId BTHashNodeType(std::string_view typeName) {
+    uint32_t hash = 0x811C9DC5u;
+    for (char c : typeName) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+/// <summary>
+/// ノードカテゴリ
+/// </summary>
+enum class BTNodeCategory {
+    Composite,      // 複合ノード（Selector, Sequence）
+    Action,         // アクションノード（Idle, Dash, Shoot）
+    Condition,      // 条件ノード（ActionSelector）
+    Decorator       // デコレータノード（将来の拡張用）
+};
+
+/// <summary>
+/// ノードタイプのメタデータ（エディタ表示用）
+/// </summary>
+struct BTNodeMetadata {
+    const char* displayName = "";                       // 表示名
+    BTNodeCategory category = BTNodeCategory::Action;   // カテゴリ
+    float color[4] = { 0.6f, 0.6f, 0.6f, 1.0f };        // ノードカラー（RGBA）
+};
+
+/// <summary>
+/// ノードの生成関数（arenaがnullptrの場合は通常のヒープに確保）
+/// </summary>
+using BTNodeCreateFunc = BTNodePtr(*)(std::pmr::memory_resource* arena);
+
+/// <summary>
+/// ビヘイビアツリーノードのレジストリ
+/// 各ノードクラスは自身の.cppでBTNodeRegistrarを定義して一度だけ登録する
+/// 検索はタイプIDのオープンアドレス法ハッシュ表で行い、文字列比較は一致確認の1回のみ
+/// ランタイムの生成とエディタのメタデータはここを唯一の情報源とする
+/// </summary>
+class BTNodeRegistry {
+public:
+    /// <summary>
+    /// 登録エントリ
+    /// </summary>
+    struct Entry {
+        std::string typeName;                   // ノードタイプ名
+        BTNodeTypeId typeId = 0;                // ノードタイプID
+        BTNodeCreateFunc create = nullptr;      // 生成関数
+        BTNodeMetadata metadata;                // メタデータ
+        bool isComposite = false;               // 子ノードを持てるか
+        std::type_index type = typeid(void);    // C++の型（逆引き用）
+    };
+
+    /// <summary>
+    /// インスタンスの取得（静的初期化中の登録にも対応）
+    /// </summary>
+    /// <returns>レジストリ</returns>
+    static BTNodeRegistry& GetInstance();
+
+    /// <summary>
+    /// ノードタイプの登録
+    /// </summary>
+    /// <param name="entry">登録エントリ</param>
+    /// <returns>成功したらtrue（同名・ID衝突時はfalse）</returns>
+    bool Register(Entry entry);
+
+    /// <summary>
+    /// タイプIDから検索
+    /// </summary>
+    /// <param name="typeId">ノードタイプID</param>
+    /// <returns>エントリ（未登録ならnullptr）</returns>
+    const Entry* Find(BTNodeTypeId typeId) const;
+
+    /// <summary>
+    /// タイプ名から検索
+    /// </summary>
+    /// <param name="typeName">ノードタイプ名</param>
+    /// <returns>エントリ（未登録ならnullptr）</returns>
+    const Entry* Find(std::string_view typeName) const;
+
+    /// <summary>
+    /// ノードインスタンスから検索（逆引き）
+    /// </summary>
+    /// <param name="node">ノード</param>
+    /// <returns>エントリ（未登録ならnullptr）</returns>
+    const Entry* FindByNode(const BTNode& node) const;
+
+    /// <summary>
+    /// ノードの生成
+    /// </summary>
+    /// <param name="typeName">ノードタイプ名</param>
+    /// <param name="arena">確保先（nullptrなら通常のヒープ）</param>
+    /// <returns>生成されたノード（未登録ならnullptr）</returns>
+    BTNodePtr Create(std::string_view typeName, std::pmr::memory_resource* arena = nullptr) const;
+
+    /// <summary>
+    /// ノードの生成
+    /// </summary>
+    /// <param name="typeId">ノードタイプID</param>
+    /// <param name="arena">確保先（nullptrなら通常のヒープ）</param>
+    /// <returns>生成されたノード（未登録ならnullptr）</returns>
+    BTNodePtr Create(BTNodeTypeId typeId, std::pmr::memory_resource* arena = nullptr) const;
+
+    /// <summary>
+    /// 登録済みエントリの取得（カテゴリ順・表示名順）
+    /// </summary>
+    /// <returns>エントリ一覧</returns>
+    const std::vector<Entry>& GetEntries() const { return entries_; }
+
+private:
+    BTNodeRegistry() = default;
+
+    /// <summary>
+    /// ハッシュ表の再構築
+    /// </summary>
+    void RebuildTable();
+
+    // 空きスロットを表す値
+    static constexpr uint16_t kEmptySlot = 0xFFFF;
+
+    // 登録エントリ（カテゴリ順・表示名順に整列）
+    std::vector<Entry> entries_;
+
+    // タイプIDのハッシュ表（値はentries_のインデックス、サイズは2のべき乗）
+    std::vector<uint16_t> table_;
+
+    // C++の型 → entries_のインデックス
+    std::unordered_map<std::type_index, uint16_t> typeToEntry_;
+};
+
+/// <summary>
+/// ノードの生成（登録用の既定の生成関数）
+/// アリーナ指定時は制御ブロックごとアリーナに確保する（アリーナはノードより長く生存させること）
+/// </summary>
+/// <template name="T">ノードの型</template>
+template<typename T>
+BTNodePtr BTCreateNode(std::pmr::memory_resource* arena) {
+    if (arena) {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(arena));
+    }
+    return std::make_shared<T>();
+}
+
+/// <summary>
+/// ノードタイプの自己登録用オブジェクト
+/// ノードの.cppの無名名前空間に定義すると、静的初期化時にレジストリへ登録される
+/// </summary>
+/// <template name="T">ノードの型（デフォルト構築可能であること）</template>
+template<typename T>
+class BTNodeRegistrar {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="typeName">ノードタイプ名（JSONの"type"）</param>
+    /// <param name="metadata">メタデータ</param>
+    BTNodeRegistrar(std::string_view typeName, const BTNodeMetadata& metadata) {
+        static_assert(std::is_base_of_v<BTNode, T>, "T must derive from BTNode");
+
+        BTNodeRegistry::Entry entry;
+        entry.typeName = std::string(typeName);
+        entry.typeId = BTHashNodeType(typeName);
+        entry.create = &BTCreateNode<T>;
+        entry.metadata = metadata;
+        entry.isComposite = std::is_base_of_v<BTComposite, T>;
+        entry.type = typeid(T);
+        BTNodeRegistry::GetInstance().Register(std::move(entry));
+    }
+};
@@ -0,0 +1,217 @@
+#include "BTProfiler.h"
+#include <algorithm>
+#include <fstream>
+#include <json.hpp>
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+namespace {
+
+    /// <summary>
+    /// 実行結果の表示名
+    /// </summary>
+    const char* StatusName(BTNodeStatus status) {
+        switch (status) {
+        case BTNodeStatus::Success: return "Success";
+        case BTNodeStatus::Failure: return "Failure";
+        case BTNodeStatus::Running: return "Running";
+        }
+        return "Unknown";
+    }
+
+}
+
+BTProfiler::BTProfiler(size_t eventCapacity) {
+    size_t capacity = 1;
+    while (capacity < eventCapacity) {
+        capacity *= 2;
+    }
+    events_.resize(capacity);
+    eventMask_ = capacity - 1;
+    nsPerTick_ = CalibrateNanosecondsPerTick();
+}
+
+void BTProfiler::Initialize(std::vector<std::string> nodeNames, size_t maxDepth) {
+    nodeNames_ = std::move(nodeNames);
+    stats_.assign(nodeNames_.size(), NodeStats{});
+    frames_.resize(maxDepth);
+    frameCount_ = 0;
+    head_.store(0, std::memory_order_release);
+}
+
+void BTProfiler::Reset() {
+    std::fill(stats_.begin(), stats_.end(), NodeStats{});
+    frameCount_ = 0;
+    head_.store(0, std::memory_order_release);
+}
+
+void BTProfiler::CopyEvents(std::vector<Event>& outEvents) const {
+    const uint64_t capacity = events_.size();
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    const uint64_t first = (head > capacity) ? head - capacity : 0;
+
+    outEvents.resize(static_cast<size_t>(head - first));
+    for (uint64_t i = first; i < head; ++i) {
+        outEvents[static_cast<size_t>(i - first)] = events_[i & eventMask_];
+    }
+
+    // 複製中に書き込み側が追い越した要素は壊れている可能性があるため捨てる
+    // （書き込み中の1要素を含め、通し番号がafter-capacity以下の要素が対象）
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t after = head_.load(std::memory_order_relaxed);
+    if (after < head) {
+        // 複製中にResetされた
+        outEvents.clear();
+        return;
+    }
+    const uint64_t valid = (after + 1 > capacity) ? after + 1 - capacity : 0;
+    if (valid > first) {
+        size_t drop = static_cast<size_t>((std::min)(valid - first, head - first));
+        outEvents.erase(outEvents.begin(), outEvents.begin() + drop);
+    }
+}
+
+std::vector<BTProfiler::SummaryRow> BTProfiler::BuildSummary() const {
+    std::vector<SummaryRow> rows;
+    rows.reserve(stats_.size());
+
+    for (size_t i = 0; i < stats_.size(); ++i) {
+        const NodeStats& stats = stats_[i];
+        if (stats.callCount == 0) {
+            continue;
+        }
+
+        SummaryRow row;
+        row.node = static_cast<uint16_t>(i);
+        row.name = nodeNames_[i].c_str();
+        row.callCount = stats.callCount;
+        row.inclusiveUs = TicksToNanoseconds(stats.inclusiveTicks) * 1.0e-3;
+        row.exclusiveUs = TicksToNanoseconds(stats.exclusiveTicks) * 1.0e-3;
+        row.averageNs = TicksToNanoseconds(stats.inclusiveTicks) / static_cast<double>(stats.callCount);
+        row.successRate = static_cast<double>(stats.successCount) / static_cast<double>(stats.callCount);
+        row.transitions = stats.transitionCount;
+        rows.push_back(row);
+    }
+
+    std::sort(rows.begin(), rows.end(), [](const SummaryRow& a, const SummaryRow& b) {
+        return a.exclusiveUs > b.exclusiveUs;
+    });
+    return rows;
+}
+
+bool BTProfiler::ExportChromeTrace(const std::string& filepath) const {
+    std::vector<Event> events;
+    CopyEvents(events);
+
+    nlohmann::json traceEvents = nlohmann::json::array();
+    traceEvents.push_back({
+        { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", 1 },
+        { "args", { { "name", "BehaviorTree" } } }
+    });
+
+    // 時刻は最古のイベントを0としたマイクロ秒
+    const uint64_t origin = events.empty() ? 0 : events.front().start;
+    for (const Event& event : events) {
+        traceEvents.push_back({
+            { "name", nodeNames_[event.node] },
+            { "cat", "BT" },
+            { "ph", "X" },
+            { "ts", TicksToNanoseconds(event.start - origin) * 1.0e-3 },
+            { "dur", TicksToNanoseconds(event.duration) * 1.0e-3 },
+            { "pid", 1 },
+            { "tid", 1 },
+            { "args", { { "node", event.node }, { "depth", event.depth }, { "status", StatusName(event.status) } } }
+        });
+    }
+
+    nlohmann::json root;
+    root["traceEvents"] = std::move(traceEvents);
+    root["displayTimeUnit"] = "ns";
+
+    std::ofstream file(filepath, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << root.dump();
+    return file.good();
+}
+
+bool BTProfiler::ExportSummaryCSV(const std::string& filepath) const {
+    std::ofstream file(filepath, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "node,name,calls,inclusive_us,exclusive_us,avg_ns,success_rate,transitions\n";
+    for (const SummaryRow& row : BuildSummary()) {
+        file << row.node << ',' << row.name << ',' << row.callCount << ','
+            << row.inclusiveUs << ',' << row.exclusiveUs << ',' << row.averageNs << ','
+            << row.successRate << ',' << row.transitions << '\n';
+    }
+    return file.good();
+}
+
+#ifdef _DEBUG
+void BTProfiler::DrawImGui() const {
+    std::vector<SummaryRow> rows = BuildSummary();
+    ImGui::Text("Events: %llu (ring %zu)", static_cast<unsigned long long>(GetEventCount()), GetEventCapacity());
+
+    if (rows.empty()) {
+        ImGui::TextDisabled("No samples");
+        return;
+    }
+
+    if (ImGui::BeginTable("BTProfilerSummary", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY,
+        ImVec2(0.0f, 240.0f))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Node");
+        ImGui::TableSetupColumn("calls");
+        ImGui::TableSetupColumn("excl us");
+        ImGui::TableSetupColumn("incl us");
+        ImGui::TableSetupColumn("avg ns");
+        ImGui::TableSetupColumn("success");
+        ImGui::TableHeadersRow();
+
+        for (const SummaryRow& row : rows) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0);
+            ImGui::Text("[%u] %s", row.node, row.name);
+            ImGui::TableSetColumnIndex(1);
+            ImGui::Text("%llu", static_cast<unsigned long long>(row.callCount));
+            ImGui::TableSetColumnIndex(2);
+            ImGui::Text("%.1f", row.exclusiveUs);
+            ImGui::TableSetColumnIndex(3);
+            ImGui::Text("%.1f", row.inclusiveUs);
+            ImGui::TableSetColumnIndex(4);
+            ImGui::Text("%.0f", row.averageNs);
+            ImGui::TableSetColumnIndex(5);
+            ImGui::Text("%.0f%%", row.successRate * 100.0);
+        }
+        ImGui::EndTable();
+    }
+}
+#endif
+
+double BTProfiler::CalibrateNanosecondsPerTick() {
+#ifdef BT_PROFILE_USE_RDTSC
+    // TSCの周波数は一定なので、起動時に一度だけsteady_clockと比較する（約2ms）
+    static const double nsPerTick = [] {
+        using Clock = std::chrono::steady_clock;
+        const auto clockStart = Clock::now();
+        const uint64_t tickStart = __rdtsc();
+        auto clockEnd = clockStart;
+        while (clockEnd - clockStart < std::chrono::milliseconds(2)) {
+            clockEnd = Clock::now();
+        }
+        const uint64_t tickEnd = __rdtsc();
+        const double ns = std::chrono::duration<double, std::nano>(clockEnd - clockStart).count();
+        return (tickEnd > tickStart) ? ns / static_cast<double>(tickEnd - tickStart) : 1.0;
+    }();
+    return nsPerTick;
+#else
+    using Period = std::chrono::steady_clock::period;
+    return 1.0e9 * static_cast<double>(Period::num) / static_cast<double>(Period::den);
+#endif
+}
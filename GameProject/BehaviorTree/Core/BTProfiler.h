@@ -0,0 +1,281 @@
+#pragma once
+#include "BTNode.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define BT_PROFILE_USE_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BT_PROFILE_USE_RDTSC 1
+#endif
+
+// ノード単位のプロファイラを組み込むか（0を定義するとBTTreeInstanceの計測コードごと除外される）
+#ifndef BT_PROFILE_ENABLED
+#define BT_PROFILE_ENABLED 1
+#endif
+
+/// <summary>
+/// ビヘイビアツリーのノード単位プロファイラ
+/// 実行ごとの呼び出し回数・包括時間・排他時間・結果の遷移を集計し、
+/// 直近の実行イベントを固定長のリングバッファへ記録する
+/// 計測中は文字列やヒープ確保を行わず、時刻の読み取りと数回の加算のみを行う
+/// コンポジットは時刻を読まず、前後のリーフの時刻を共有する（コンポジットの排他時間＝リーフ間の走査時間）
+/// （書き込みはTickを実行する1スレッドのみ、読み出しは任意のスレッドから可能）
+/// </summary>
+class BTProfiler {
+public:
+    /// <summary>
+    /// ノードごとの集計
+    /// </summary>
+    struct NodeStats {
+        uint64_t callCount = 0;                          // 実行回数
+        uint64_t inclusiveTicks = 0;                     // 包括時間（子を含む）
+        uint64_t exclusiveTicks = 0;                     // 排他時間（子を除く）
+        uint32_t successCount = 0;                       // 成功回数
+        uint32_t failureCount = 0;                       // 失敗回数
+        uint32_t runningCount = 0;                       // 実行中回数
+        uint32_t transitionCount = 0;                    // 結果が前回と変わった回数
+        BTNodeStatus lastStatus = BTNodeStatus::Failure; // 直前の結果
+    };
+
+    /// <summary>
+    /// リングバッファに記録する実行イベント
+    /// </summary>
+    struct Event {
+        uint64_t start = 0;                          // 開始時刻（ティック）
+        uint64_t duration = 0;                       // 包括時間（ティック）
+        uint16_t node = 0;                           // ノードインデックス
+        uint8_t depth = 0;                           // 呼び出しの深さ
+        BTNodeStatus status = BTNodeStatus::Failure; // 結果
+    };
+
+    /// <summary>
+    /// 集計表の1行
+    /// </summary>
+    struct SummaryRow {
+        uint16_t node = 0;         // ノードインデックス
+        const char* name = "";     // ノード名
+        uint64_t callCount = 0;    // 実行回数
+        double inclusiveUs = 0.0;  // 包括時間の合計（マイクロ秒）
+        double exclusiveUs = 0.0;  // 排他時間の合計（マイクロ秒）
+        double averageNs = 0.0;    // 1回あたりの包括時間（ナノ秒）
+        double successRate = 0.0;  // 成功率（0～1）
+        uint32_t transitions = 0;  // 結果の遷移回数
+    };
+
+    /// <summary>
+    /// リングバッファの既定の容量（2のべき乗）
+    /// </summary>
+    static constexpr size_t kDefaultEventCapacity = 1 << 14;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="eventCapacity">リングバッファの容量（2のべき乗に切り上げ）</param>
+    explicit BTProfiler(size_t eventCapacity = kDefaultEventCapacity);
+
+    /// <summary>
+    /// 計測対象のツリーに合わせて初期化
+    /// </summary>
+    /// <param name="nodeNames">ノードインデックス順のノード名</param>
+    /// <param name="maxDepth">Enterの最大ネスト数</param>
+    void Initialize(std::vector<std::string> nodeNames, size_t maxDepth);
+
+    /// <summary>
+    /// 集計とイベントの破棄
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// ノードの実行開始
+    /// </summary>
+    /// <param name="node">ノードインデックス</param>
+    /// <param name="readClock">falseなら直前に読んだ時刻を開始時刻とする（コンポジット用）</param>
+    void Enter(uint16_t node, bool readClock = true) {
+        if (readClock) {
+            lastStamp_ = Now();
+        }
+        if (frameCount_ < frames_.size()) {
+            frames_[frameCount_] = { node, lastStamp_, 0 };
+        }
+        ++frameCount_;
+    }
+
+    /// <summary>
+    /// 直前にEnterしたノードの実行終了
+    /// </summary>
+    /// <param name="status">実行結果</param>
+    /// <param name="readClock">falseなら直前に読んだ時刻を終了時刻とする（コンポジット用）</param>
+    void Exit(BTNodeStatus status, bool readClock = true) {
+        if (readClock) {
+            lastStamp_ = Now();
+        }
+        if (frameCount_ == 0) {
+            return;
+        }
+        if (--frameCount_ >= frames_.size()) {
+            // 想定より深い呼び出しは計測しない
+            return;
+        }
+
+        const Frame& frame = frames_[frameCount_];
+        uint64_t inclusive = lastStamp_ - frame.start;
+        if (frameCount_ > 0) {
+            frames_[frameCount_ - 1].childTicks += inclusive;
+        }
+
+        NodeStats& stats = stats_[frame.node];
+        ++stats.callCount;
+        stats.inclusiveTicks += inclusive;
+        stats.exclusiveTicks += inclusive - frame.childTicks;
+        switch (status) {
+        case BTNodeStatus::Success: ++stats.successCount; break;
+        case BTNodeStatus::Failure: ++stats.failureCount; break;
+        case BTNodeStatus::Running: ++stats.runningCount; break;
+        }
+        if (stats.callCount > 1 && stats.lastStatus != status) {
+            ++stats.transitionCount;
+        }
+        stats.lastStatus = status;
+
+        // 単一の書き込み側なので、要素を書いてから先頭位置をreleaseで公開するだけでよい
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        Event& event = events_[head & eventMask_];
+        event.start = frame.start;
+        event.duration = inclusive;
+        event.node = frame.node;
+        event.depth = static_cast<uint8_t>(frameCount_);
+        event.status = status;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /// <summary>
+    /// ノード数の取得
+    /// </summary>
+    /// <returns>ノード数</returns>
+    size_t GetNodeCount() const { return stats_.size(); }
+
+    /// <summary>
+    /// ノードの集計を取得
+    /// </summary>
+    /// <param name="node">ノードインデックス</param>
+    /// <returns>集計</returns>
+    const NodeStats& GetStats(uint16_t node) const { return stats_[node]; }
+
+    /// <summary>
+    /// ノード名の取得
+    /// </summary>
+    /// <param name="node">ノードインデックス</param>
+    /// <returns>ノード名</returns>
+    const std::string& GetNodeName(uint16_t node) const { return nodeNames_[node]; }
+
+    /// <summary>
+    /// これまでに記録したイベントの総数（リングバッファから溢れた分を含む）
+    /// </summary>
+    /// <returns>イベント数</returns>
+    uint64_t GetEventCount() const { return head_.load(std::memory_order_acquire); }
+
+    /// <summary>
+    /// リングバッファの容量
+    /// </summary>
+    /// <returns>容量</returns>
+    size_t GetEventCapacity() const { return events_.size(); }
+
+    /// <summary>
+    /// リングバッファ内の直近のイベントを古い順に複製
+    /// 読み出し中に上書きされた可能性のある要素は除外する
+    /// </summary>
+    /// <param name="outEvents">出力先</param>
+    void CopyEvents(std::vector<Event>& outEvents) const;
+
+    /// <summary>
+    /// 集計表を作成（排他時間の降順）
+    /// </summary>
+    /// <returns>実行されたノードの集計表</returns>
+    std::vector<SummaryRow> BuildSummary() const;
+
+    /// <summary>
+    /// ティックをナノ秒に変換
+    /// </summary>
+    /// <param name="ticks">ティック数</param>
+    /// <returns>ナノ秒</returns>
+    double TicksToNanoseconds(uint64_t ticks) const { return static_cast<double>(ticks) * nsPerTick_; }
+
+    /// <summary>
+    /// リングバッファの内容をChrome Trace Event形式で出力
+    /// chrome://tracing や Perfetto で読み込める
+    /// </summary>
+    /// <param name="filepath">出力先のパス</param>
+    /// <returns>成功したらtrue</returns>
+    bool ExportChromeTrace(const std::string& filepath) const;
+
+    /// <summary>
+    /// 集計表をCSV形式で出力
+    /// </summary>
+    /// <param name="filepath">出力先のパス</param>
+    /// <returns>成功したらtrue</returns>
+    bool ExportSummaryCSV(const std::string& filepath) const;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// 集計表をImGuiで表示
+    /// </summary>
+    void DrawImGui() const;
+#endif
+
+    /// <summary>
+    /// 現在のタイムスタンプ（ティック）
+    /// </summary>
+    /// <returns>タイムスタンプ</returns>
+    static uint64_t Now() {
+#ifdef BT_PROFILE_USE_RDTSC
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+private:
+    /// <summary>
+    /// 実行中ノードの計測フレーム
+    /// </summary>
+    struct Frame {
+        uint16_t node;       // ノードインデックス
+        uint64_t start;      // 開始時刻
+        uint64_t childTicks; // 子の包括時間の合計
+    };
+
+    /// <summary>
+    /// 1ティックあたりのナノ秒を計測
+    /// </summary>
+    /// <returns>ナノ秒/ティック</returns>
+    static double CalibrateNanosecondsPerTick();
+
+    // ノードごとの集計
+    std::vector<NodeStats> stats_;
+
+    // ノード名
+    std::vector<std::string> nodeNames_;
+
+    // 計測フレームのスタック（最大深さ分を確保済み）
+    std::vector<Frame> frames_;
+    size_t frameCount_ = 0;
+
+    // 直前に読んだ時刻
+    uint64_t lastStamp_ = 0;
+
+    // イベントのリングバッファ（サイズは2のべき乗）
+    std::vector<Event> events_;
+    uint64_t eventMask_ = 0;
+
+    // 次に書き込むイベントの通し番号
+    std::atomic<uint64_t> head_{ 0 };
+
+    // 1ティックあたりのナノ秒
+    double nsPerTick_ = 1.0;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include "Vector3.h"
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+
+/// <summary>
+/// エージェントごとの乱数列
+/// 共有の乱数エンジンから引くと、エージェントを並列に実行した場合に消費される順番が
+/// スレッドのスケジュールで変わってしまうため、ツリーの実行中に使う乱数はこちらから引く
+/// 同じシードなら実行するスレッドに関係なく同じ列になる
+/// </summary>
+class BTRandomStream {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="seed">シード</param>
+    explicit BTRandomStream(uint32_t seed = 5489u) : engine_(seed) {}
+
+    /// <summary>
+    /// シードの設定
+    /// </summary>
+    /// <param name="seed">シード</param>
+    void Seed(uint32_t seed) { engine_.seed(seed); }
+
+    /// <summary>
+    /// 範囲内の整数を取得
+    /// </summary>
+    /// <param name="min">最小値</param>
+    /// <param name="max">最大値（含む）</param>
+    /// <returns>乱数</returns>
+    int GetInt(int min, int max) { return std::uniform_int_distribution<int>(min, max)(engine_); }
+
+    /// <summary>
+    /// 範囲内の浮動小数点数を取得
+    /// </summary>
+    /// <param name="min">最小値</param>
+    /// <param name="max">最大値</param>
+    /// <returns>乱数</returns>
+    float GetFloat(float min, float max) { return std::uniform_real_distribution<float>(min, max)(engine_); }
+
+    /// <summary>
+    /// XZ平面上のランダムな単位ベクトルを取得
+    /// </summary>
+    /// <returns>方向</returns>
+    Vector3 GetRandomDirectionXZ() {
+        float angle = GetFloat(0.0f, 2.0f * std::numbers::pi_v<float>);
+        return Vector3(std::cos(angle), 0.0f, std::sin(angle));
+    }
+
+private:
+    // 乱数エンジン
+    std::mt19937 engine_;
+};
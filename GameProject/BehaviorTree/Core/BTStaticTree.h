@@ -0,0 +1,253 @@
+#pragma once
+#include "BTLeafNode.h"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+class BTBlackboard;
+
+/// <summary>
+/// 形が決まっているツリーを型として記述する静的ビヘイビアツリー
+///   using MainLoop = BTStatic::Sequence&lt;BTBossIdle, BTStatic::Selector&lt;...&gt;&gt;;
+///   BTStatic::Tree&lt;MainLoop&gt; tree;
+/// ・子の呼び出しはテンプレートで展開されるため仮想呼び出し・子リストの走査がない
+/// ・実行中の状態（コンポジットの位置とリーフのTState）はTree::Stateの1つの構造体にまとまる
+/// ・ノードは値として保持し、構築後・実行中のヒープ確保はない
+/// リーフにはBTLeafNode派生クラスをそのまま使える（コンストラクタ引数が必要な場合はLeafで指定する）
+/// JSONから読み込むツリー（BTCompiledTree）と同じリーフを使うので、調整後に形を固定する用途を想定している
+/// </summary>
+namespace BTStatic {
+
+    /// <summary>
+    /// DSLのノード型（Sequence・Selector・Leaf）かどうか
+    /// </summary>
+    template<typename T>
+    concept Node = requires { typename T::StaticNodeTag; };
+
+    namespace Detail {
+
+        /// <summary>
+        /// BTLeafNode&lt;TState&gt;派生クラスからTStateを取り出す（宣言のみ、decltype用）
+        /// </summary>
+        template<typename TState>
+        TState LeafStateOf(const BTLeafNode<TState>*);
+
+    }
+
+    /// <summary>
+    /// リーフ
+    /// TLeafをArgsで構築して保持し、TLeaf::Tickを非仮想で呼び出す
+    /// </summary>
+    /// <template name="TLeaf">BTLeafNode派生クラス</template>
+    /// <template name="Args">コンストラクタ引数（定数）</template>
+    template<typename TLeaf, auto... Args>
+    class Leaf {
+    public:
+        using StaticNodeTag = void;
+        using State = decltype(Detail::LeafStateOf(static_cast<const TLeaf*>(nullptr)));
+
+        static constexpr size_t kLeafCount = 1;
+
+        /// <summary>
+        /// 実行
+        /// </summary>
+        BTNodeStatus Tick(BTBlackboard* blackboard, State& state) const {
+            return node_.TLeaf::Tick(blackboard, state);
+        }
+
+        /// <summary>
+        /// 全リーフを訪問（キーの解決・パラメータの適用用）
+        /// </summary>
+        template<typename F>
+        void ForEachLeaf(F&& visitor) { visitor(static_cast<BTNode&>(node_)); }
+
+    private:
+        TLeaf node_{ Args... };
+    };
+
+    /// <summary>
+    /// DSLのノード型へ変換（BTLeafNode派生クラスはLeafで包む）
+    /// </summary>
+    template<typename T>
+    struct NodeOfImpl { using Type = Leaf<T>; };
+
+    template<Node T>
+    struct NodeOfImpl<T> { using Type = T; };
+
+    template<typename T>
+    using NodeOf = typename NodeOfImpl<T>::Type;
+
+    namespace Detail {
+
+        /// <summary>
+        /// コンポジットの共通部分
+        /// 子ノードと、実行中の子の位置・子の状態をまとめた状態を定義する
+        /// </summary>
+        template<typename... Children>
+        class CompositeBase {
+            static_assert(sizeof...(Children) < 256, "BTStatic composite supports up to 255 children");
+
+        public:
+            using StaticNodeTag = void;
+
+            /// <summary>
+            /// 状態（実行中の子の位置と子の状態）
+            /// </summary>
+            struct State {
+                uint8_t current = 0;
+                std::tuple<typename NodeOf<Children>::State...> children{};
+            };
+
+            static constexpr size_t kLeafCount = (size_t{ 0 } + ... + NodeOf<Children>::kLeafCount);
+
+            /// <summary>
+            /// 全リーフを訪問
+            /// </summary>
+            template<typename F>
+            void ForEachLeaf(F&& visitor) {
+                std::apply([&](auto&... child) { (child.ForEachLeaf(visitor), ...); }, children_);
+            }
+
+        protected:
+            std::tuple<NodeOf<Children>...> children_;
+        };
+
+    }
+
+    /// <summary>
+    /// シーケンス（BTSequenceと同じ動作）
+    /// 子を順に実行し、失敗した時点で失敗、実行中ならその子から再開する
+    /// </summary>
+    template<typename... Children>
+    class Sequence : public Detail::CompositeBase<Children...> {
+        using Base = Detail::CompositeBase<Children...>;
+
+    public:
+        using typename Base::State;
+
+        /// <summary>
+        /// 実行
+        /// </summary>
+        BTNodeStatus Tick(BTBlackboard* blackboard, State& state) const {
+            return TickFrom<0>(blackboard, state);
+        }
+
+    private:
+        template<size_t I>
+        BTNodeStatus TickFrom(BTBlackboard* blackboard, State& state) const {
+            if constexpr (I == sizeof...(Children)) {
+                state.current = 0;
+                return BTNodeStatus::Success;
+            }
+            else {
+                // 前回Runningだった子より前は飛ばす
+                if (state.current <= I) {
+                    BTNodeStatus status = std::get<I>(this->children_).Tick(blackboard, std::get<I>(state.children));
+                    if (status == BTNodeStatus::Failure) {
+                        state.current = 0;
+                        return status;
+                    }
+                    if (status == BTNodeStatus::Running) {
+                        state.current = static_cast<uint8_t>(I);
+                        return status;
+                    }
+                }
+                return TickFrom<I + 1>(blackboard, state);
+            }
+        }
+    };
+
+    /// <summary>
+    /// セレクター（BTSelectorと同じ動作）
+    /// 子を順に実行し、成功した時点で成功、実行中ならその子から再開する
+    /// </summary>
+    template<typename... Children>
+    class Selector : public Detail::CompositeBase<Children...> {
+        using Base = Detail::CompositeBase<Children...>;
+
+    public:
+        using typename Base::State;
+
+        /// <summary>
+        /// 実行
+        /// </summary>
+        BTNodeStatus Tick(BTBlackboard* blackboard, State& state) const {
+            return TickFrom<0>(blackboard, state);
+        }
+
+    private:
+        template<size_t I>
+        BTNodeStatus TickFrom(BTBlackboard* blackboard, State& state) const {
+            if constexpr (I == sizeof...(Children)) {
+                state.current = 0;
+                return BTNodeStatus::Failure;
+            }
+            else {
+                if (state.current <= I) {
+                    BTNodeStatus status = std::get<I>(this->children_).Tick(blackboard, std::get<I>(state.children));
+                    if (status == BTNodeStatus::Success) {
+                        state.current = 0;
+                        return status;
+                    }
+                    if (status == BTNodeStatus::Running) {
+                        state.current = static_cast<uint8_t>(I);
+                        return status;
+                    }
+                }
+                return TickFrom<I + 1>(blackboard, state);
+            }
+        }
+    };
+
+    /// <summary>
+    /// 静的ツリーの定義
+    /// ノード（パラメータ）だけを持ち、状態は呼び出し側がStateとして持つ
+    /// 1つの定義を複数のエージェントで共有する場合は、ブラックボードのキー構成を揃えること
+    /// </summary>
+    /// <template name="TRoot">ルートノードの型</template>
+    template<typename TRoot>
+    class Tree {
+    public:
+        using Root = NodeOf<TRoot>;
+        using State = typename Root::State;
+
+        static constexpr size_t kLeafCount = Root::kLeafCount;
+
+        /// <summary>
+        /// ブラックボードキーをハンドルへ解決（実行前に一度呼ぶ）
+        /// </summary>
+        /// <param name="blackboard">ブラックボード</param>
+        void ResolveBlackboardKeys(BTBlackboard& blackboard) {
+            root_.ForEachLeaf([&](BTNode& leaf) { leaf.ResolveBlackboardKeys(blackboard); });
+        }
+
+        /// <summary>
+        /// 1フレーム分の実行
+        /// </summary>
+        /// <param name="blackboard">エージェントのブラックボード</param>
+        /// <param name="state">エージェントの状態</param>
+        /// <returns>ルートの実行結果</returns>
+        BTNodeStatus Tick(BTBlackboard* blackboard, State& state) const {
+            return root_.Tick(blackboard, state);
+        }
+
+        /// <summary>
+        /// 状態を初期状態に戻す
+        /// </summary>
+        /// <param name="state">エージェントの状態</param>
+        static void Reset(State& state) { state = State{}; }
+
+        /// <summary>
+        /// 全リーフを訪問（パラメータの適用・編集用）
+        /// </summary>
+        template<typename F>
+        void ForEachLeaf(F&& visitor) { root_.ForEachLeaf(visitor); }
+
+    private:
+        Root root_;
+    };
+
+}
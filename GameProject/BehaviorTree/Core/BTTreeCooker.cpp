@@ -0,0 +1,233 @@
+#include "BTTreeCooker.h"
+#include "BTTreeFormat.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace {
+
+    /// <summary>
+    /// 出力バッファへ値を追加
+    /// </summary>
+    template<typename T>
+    void Append(std::vector<uint8_t>& blob, const T& value) {
+        size_t offset = blob.size();
+        blob.resize(offset + sizeof(T));
+        std::memcpy(blob.data() + offset, &value, sizeof(T));
+    }
+
+    /// <summary>
+    /// 文字列テーブルへNUL終端で追加
+    /// </summary>
+    uint32_t AppendString(std::vector<char>& strings, const std::string& value) {
+        uint32_t offset = static_cast<uint32_t>(strings.size());
+        strings.insert(strings.end(), value.begin(), value.end());
+        strings.push_back('\0');
+        return offset;
+    }
+
+}
+
+bool BTTreeCooker::Cook(const nlohmann::json& json, uint64_t sourceHash, std::vector<uint8_t>& outBlob) {
+    using namespace BTTreeFormat;
+    outBlob.clear();
+
+    try {
+        // バージョンチェック
+        if (!json.contains("version") || json["version"] != "1.0") {
+            return false;
+        }
+        if (!json.contains("nodes") || !json["nodes"].is_array() || json["nodes"].empty()) {
+            return false;
+        }
+
+        const nlohmann::json& nodesJson = json["nodes"];
+        const size_t sourceCount = nodesJson.size();
+
+        // ノードID → nodes配列内の位置（同じIDが複数あれば後のものを使う）
+        std::unordered_map<int, uint32_t> idToSource;
+        idToSource.reserve(sourceCount);
+        for (size_t i = 0; i < sourceCount; ++i) {
+            idToSource[nodesJson[i]["id"].get<int>()] = static_cast<uint32_t>(i);
+        }
+
+        // リンクを一度だけ走査して隣接リストを作る（子の順序はリンクの順序）
+        std::vector<std::vector<uint32_t>> sourceChildren(sourceCount);
+        std::vector<uint8_t> hasParent(sourceCount, 0);
+        if (json.contains("links")) {
+            for (const auto& link : json["links"]) {
+                auto targetIt = idToSource.find(link["targetNodeId"].get<int>());
+                if (targetIt == idToSource.end()) {
+                    continue;
+                }
+                hasParent[targetIt->second] = 1;
+
+                auto sourceIt = idToSource.find(link["sourceNodeId"].get<int>());
+                if (sourceIt != idToSource.end()) {
+                    sourceChildren[sourceIt->second].push_back(targetIt->second);
+                }
+            }
+        }
+
+        // ルートノードを探す（親リンクを持たない最初のノード、なければ先頭）
+        uint32_t root = 0;
+        for (size_t i = 0; i < sourceCount; ++i) {
+            if (!hasParent[i]) {
+                root = static_cast<uint32_t>(i);
+                break;
+            }
+        }
+
+        // 深さ優先の前順で番号を振る（訪問済みのノードは再訪しないので循環参照も切れる）
+        struct Frame {
+            uint32_t source;    // nodes配列内の位置
+            uint32_t cooked;    // 出力するノード番号
+            size_t next;        // 次に訪問する子の位置
+        };
+        std::vector<uint32_t> order;                       // 出力番号 → nodes配列内の位置
+        std::vector<std::vector<uint32_t>> cookedChildren; // 出力番号ごとの子の出力番号
+        std::vector<uint8_t> visited(sourceCount, 0);
+        std::vector<Frame> stack;
+
+        auto enter = [&](uint32_t source) {
+            if (visited[source]) {
+                return kNone;
+            }
+            visited[source] = 1;
+            uint32_t cooked = static_cast<uint32_t>(order.size());
+            order.push_back(source);
+            cookedChildren.emplace_back();
+            stack.push_back({ source, cooked, 0 });
+            return cooked;
+        };
+
+        enter(root);
+        while (!stack.empty()) {
+            Frame& frame = stack.back();
+            if (frame.next >= sourceChildren[frame.source].size()) {
+                stack.pop_back();
+                continue;
+            }
+
+            // enterでstackが伸びるとframeは無効になるため先に値を取り出す
+            uint32_t parent = frame.cooked;
+            uint32_t child = sourceChildren[frame.source][frame.next++];
+            uint32_t cookedChild = enter(child);
+            if (cookedChild != kNone) {
+                cookedChildren[parent].push_back(cookedChild);
+            }
+        }
+
+        // ノードレコード・文字列・パラメータを組み立てる
+        std::vector<NodeRecord> records(order.size());
+        std::vector<uint32_t> childIndices;
+        std::vector<uint32_t> typeNameOffsets;
+        std::vector<char> strings;
+        std::vector<uint8_t> params;
+        std::unordered_map<std::string, uint16_t> typeIndices;
+
+        for (size_t i = 0; i < order.size(); ++i) {
+            const nlohmann::json& nodeJson = nodesJson[order[i]];
+            NodeRecord& record = records[i];
+
+            // ノードタイプ（同じタイプ名は共有）
+            std::string type = nodeJson["type"].get<std::string>();
+            auto typeIt = typeIndices.find(type);
+            if (typeIt == typeIndices.end()) {
+                if (typeNameOffsets.size() >= 0xFFFF) {
+                    return false;
+                }
+                typeIt = typeIndices.emplace(type, static_cast<uint16_t>(typeNameOffsets.size())).first;
+                typeNameOffsets.push_back(AppendString(strings, type));
+            }
+            record.typeIndex = typeIt->second;
+
+            // 子の範囲
+            const std::vector<uint32_t>& children = cookedChildren[i];
+            if (children.size() > 0xFFFF) {
+                return false;
+            }
+            record.childBegin = static_cast<uint32_t>(childIndices.size());
+            record.childCount = static_cast<uint16_t>(children.size());
+            childIndices.insert(childIndices.end(), children.begin(), children.end());
+
+            // 表示名（オプション）
+            if (nodeJson.contains("displayName") && nodeJson["displayName"].is_string()) {
+                record.nameOffset = AppendString(strings, nodeJson["displayName"].get<std::string>());
+            }
+
+            // パラメータはMessagePackで格納（空なら省略）
+            if (nodeJson.contains("parameters") && !nodeJson["parameters"].is_null() && !nodeJson["parameters"].empty()) {
+                std::vector<uint8_t> packed = nlohmann::json::to_msgpack(nodeJson["parameters"]);
+                record.paramOffset = static_cast<uint32_t>(params.size());
+                record.paramSize = static_cast<uint32_t>(packed.size());
+                params.insert(params.end(), packed.begin(), packed.end());
+            }
+        }
+
+        strings.resize(AlignUp4(strings.size()), '\0');
+
+        Header header;
+        header.sourceHash = sourceHash;
+        header.nodeCount = static_cast<uint32_t>(records.size());
+        header.childIndexCount = static_cast<uint32_t>(childIndices.size());
+        header.typeCount = static_cast<uint32_t>(typeNameOffsets.size());
+        header.stringBytes = static_cast<uint32_t>(strings.size());
+        header.paramBytes = static_cast<uint32_t>(params.size());
+
+        outBlob.reserve(sizeof(Header) + records.size() * sizeof(NodeRecord) +
+            (childIndices.size() + typeNameOffsets.size()) * sizeof(uint32_t) + strings.size() + params.size());
+        Append(outBlob, header);
+        for (const NodeRecord& record : records) {
+            Append(outBlob, record);
+        }
+        for (uint32_t childIndex : childIndices) {
+            Append(outBlob, childIndex);
+        }
+        for (uint32_t offset : typeNameOffsets) {
+            Append(outBlob, offset);
+        }
+        outBlob.insert(outBlob.end(), strings.begin(), strings.end());
+        outBlob.insert(outBlob.end(), params.begin(), params.end());
+        return true;
+    }
+    catch (const std::exception&) {
+        // 必須フィールドの欠落・型違い
+        outBlob.clear();
+        return false;
+    }
+}
+
+bool BTTreeCooker::CookFile(const std::string& jsonPath, const std::string& cookedPath) {
+    // 更新検出用にファイルの内容をハッシュする（改行コードの違いは無視）
+    std::ifstream file(jsonPath, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    std::vector<uint8_t> blob;
+    try {
+        nlohmann::json json = nlohmann::json::parse(text);
+        if (!Cook(json, BTTreeFormat::HashText(text.data(), text.size()), blob)) {
+            return false;
+        }
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+
+    std::ofstream out(cookedPath, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(blob.data()), static_cast<std::streamsize>(blob.size()));
+    return out.good();
+}
+
+std::string BTTreeCooker::GetCookedPath(const std::string& jsonPath) {
+    return std::filesystem::path(jsonPath).replace_extension(".bttree").string();
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <json.hpp>
+
+/// <summary>
+/// ビヘイビアツリーのクッカー
+/// ノードエディタのJSON（nodes + links）を、親子関係を解決済みのバイナリ（BTTreeFormat）へ変換する
+/// 変換はノード数・リンク数に対して線形（リンクは一度だけ走査して隣接リストを作る）
+/// </summary>
+class BTTreeCooker {
+public:
+    /// <summary>
+    /// JSONをバイナリへ変換
+    /// </summary>
+    /// <param name="json">ツリーJSON（version "1.0"）</param>
+    /// <param name="sourceHash">元ファイルのハッシュ（ヘッダーに記録）</param>
+    /// <param name="outBlob">出力先</param>
+    /// <returns>成功したらtrue</returns>
+    static bool Cook(const nlohmann::json& json, uint64_t sourceHash, std::vector<uint8_t>& outBlob);
+
+    /// <summary>
+    /// JSONファイルをバイナリファイルへ変換
+    /// </summary>
+    /// <param name="jsonPath">ツリーJSONのパス</param>
+    /// <param name="cookedPath">出力先のパス</param>
+    /// <returns>成功したらtrue</returns>
+    static bool CookFile(const std::string& jsonPath, const std::string& cookedPath);
+
+    /// <summary>
+    /// JSONのパスに対応するクッキング済みファイルのパスを取得（拡張子を.bttreeに置き換え）
+    /// </summary>
+    /// <param name="jsonPath">ツリーJSONのパス</param>
+    /// <returns>クッキング済みファイルのパス</returns>
+    static std::string GetCookedPath(const std::string& jsonPath);
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// クッキング済みビヘイビアツリー（.bttree）のバイナリ形式
+///
+/// レイアウト（リトルエンディアン、各セクションは4バイト境界）
+///   Header
+///   NodeRecord[nodeCount]        深さ優先の前順（先頭がルート、子は必ず親より後ろ）
+///   uint32_t childIndices[childIndexCount]
+///   uint32_t typeNameOffsets[typeCount]
+///   char     strings[stringBytes] NUL終端文字列の連結（4バイト境界まで0埋め）
+///   uint8_t  params[paramBytes]   ノードごとのパラメータ（MessagePack）
+/// </summary>
+namespace BTTreeFormat {
+
+    /// <summary>
+    /// 識別子（"BTTR"）
+    /// </summary>
+    inline constexpr uint32_t kMagic = 0x52545442;
+
+    /// <summary>
+    /// 形式のバージョン（レイアウトを変えたら上げる）
+    /// </summary>
+    inline constexpr uint32_t kVersion = 1;
+
+    /// <summary>
+    /// 参照なしを表すオフセット
+    /// </summary>
+    inline constexpr uint32_t kNone = 0xFFFFFFFF;
+
+    /// <summary>
+    /// ファイルヘッダー
+    /// </summary>
+    struct Header {
+        uint32_t magic = kMagic;        // 識別子
+        uint32_t version = kVersion;    // 形式のバージョン
+        uint64_t sourceHash = 0;        // 元のJSONファイルのハッシュ（HashText、更新検出用）
+        uint32_t nodeCount = 0;         // ノード数
+        uint32_t childIndexCount = 0;   // 子インデックスの総数
+        uint32_t typeCount = 0;         // ノードタイプ名の数
+        uint32_t stringBytes = 0;       // 文字列テーブルのバイト数
+        uint32_t paramBytes = 0;        // パラメータ領域のバイト数
+        uint32_t reserved = 0;          // 予約
+    };
+
+    /// <summary>
+    /// ノードレコード
+    /// </summary>
+    struct NodeRecord {
+        uint16_t typeIndex = 0;         // typeNameOffsets内のインデックス
+        uint16_t childCount = 0;        // 子の数
+        uint32_t childBegin = 0;        // childIndices内の子範囲の先頭
+        uint32_t nameOffset = kNone;    // 表示名の文字列オフセット（なければkNone）
+        uint32_t paramOffset = 0;       // params内のオフセット
+        uint32_t paramSize = 0;         // パラメータのバイト数（なければ0）
+    };
+
+    static_assert(sizeof(Header) == 40, "BTTreeFormat::Header layout changed");
+    static_assert(sizeof(NodeRecord) == 20, "BTTreeFormat::NodeRecord layout changed");
+
+    /// <summary>
+    /// テキストのハッシュ（FNV-1a 64bit、改行はCRLFをLFとして扱う）
+    /// チェックアウト時の改行コード変換でクッキング済みファイルが古い扱いにならないようにする
+    /// </summary>
+    /// <param name="data">先頭アドレス</param>
+    /// <param name="size">バイト数</param>
+    /// <returns>ハッシュ値</returns>
+    inline uint64_t HashText(const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        uint64_t hash = 0xCBF29CE484222325ull;
+        for (size_t i = 0; i < size; ++i) {
+            if (bytes[i] == '\r' && i + 1 < size && bytes[i + 1] == '\n') {
+                continue;
+            }
+            hash ^= bytes[i];
+            hash *= 0x100000001B3ull;
+        }
+        return hash;
+    }
+
+    /// <summary>
+    /// 4バイト境界への切り上げ
+    /// </summary>
+    /// <param name="size">バイト数</param>
+    /// <returns>切り上げたバイト数</returns>
+    inline constexpr size_t AlignUp4(size_t size) {
+        return (size + 3) & ~static_cast<size_t>(3);
+    }
+
+}
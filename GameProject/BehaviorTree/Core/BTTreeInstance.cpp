@@ -0,0 +1,395 @@
+#include "BTTreeInstance.h"
+#include "BTBlackboard.h"
+#include <algorithm>
+#include <string>
+#include <utility>
+
+BTTreeInstance::BTTreeInstance(std::shared_ptr<const BTCompiledTree> definition) {
+    Bind(std::move(definition));
+}
+
+BTTreeInstance::~BTTreeInstance() = default;
+
+BTTreeInstance::BTTreeInstance(BTTreeInstance&&) noexcept = default;
+
+BTTreeInstance& BTTreeInstance::operator=(BTTreeInstance&&) noexcept = default;
+
+void BTTreeInstance::Bind(std::shared_ptr<const BTCompiledTree> definition) {
+    Unbind();
+    if (!definition || !definition->IsValid()) {
+        return;
+    }
+
+    definition_ = std::move(definition);
+
+    // 状態はすべて1回の確保で得た連続領域に置く
+    const size_t size = definition_->GetInstanceStateSize();
+    block_ = std::make_unique<std::max_align_t[]>((size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t));
+
+    NodeState* states = States();
+    for (size_t i = 0; i < definition_->nodes_.size(); ++i) {
+        ::new (&states[i]) NodeState{};
+    }
+
+    // 初回は全リーフの状態を初期化
+    for (const Node& node : definition_->nodes_) {
+        if (node.kind == BTCompiledNodeKind::Leaf) {
+            definition_->leaves_[node.leafIndex]->InitializeInstanceState(LeafState(node));
+        }
+    }
+
+    InitializeProfiler();
+}
+
+void BTTreeInstance::Unbind() {
+    definition_.reset();
+    block_.reset();
+    touchedCount_ = 0;
+    runningIndex_ = kInvalidIndex;
+    runningDepth_ = 0;
+    abortCount_ = 0;
+}
+
+BTNodeStatus BTTreeInstance::Tick(BTBlackboard* blackboard) {
+    uint16_t resumeIndex = runningIndex_;
+    runningIndex_ = kInvalidIndex;
+    if (!definition_) {
+        return BTNodeStatus::Failure;
+    }
+
+    const BTCompiledTree& tree = *definition_;
+    const Node* nodes = tree.nodes_.data();
+    NodeState* states = States();
+
+    // 再帰呼び出しの代わりに明示的なスタックで走査する
+    // 下降：コンポジットは継続位置の子へ進み、リーフは実行して結果を得る
+    // 上昇：親コンポジットが子の結果を受けて、次の子へ進むか自身の結果を確定する
+    uint16_t* stack = Indices(tree.stackOffset_);
+    size_t depth = 0;
+    uint16_t current = 0;
+    BTNodeStatus result = BTNodeStatus::Failure;
+#if BT_PROFILE_ENABLED
+    BTProfiler* profiler = profiler_.get();
+#endif
+
+    if (resumeIndex != kInvalidIndex) {
+        // 前回実行中だったリーフから再開（祖先は前回のTickのままスタックに残っている）
+        depth = runningDepth_;
+        current = resumeIndex;
+
+        // 監視キーが変化していれば条件を再評価し、必要なら祖先から再実行する
+        if (reactive_ && blackboard) {
+            EvaluateGuards(blackboard, depth, current);
+        }
+    }
+    if (blackboard) {
+        blackboard->ClearChanges();
+    }
+
+#if BT_PROFILE_ENABLED
+    // 再開した経路上のコンポジットも今回のTickの実行として計測する
+    if (profiler) {
+        for (size_t i = 0; i < depth; ++i) {
+            profiler->Enter(stack[i], i == 0);
+        }
+    }
+#endif
+
+    for (;;) {
+        // ===== 下降 =====
+        const Node& node = nodes[current];
+        NodeState& state = states[current];
+
+        if (node.kind == BTCompiledNodeKind::Leaf) {
+#if BT_PROFILE_ENABLED
+            if (profiler) {
+                profiler->Enter(current);
+                result = ExecuteLeaf(current, blackboard);
+                profiler->Exit(result);
+            }
+            else
+#endif
+            {
+                result = ExecuteLeaf(current, blackboard);
+            }
+            if (result == BTNodeStatus::Running) {
+                // 祖先は下降時にRunningにしてあるので、経路を保持したまま終了
+                runningIndex_ = current;
+                runningDepth_ = depth;
+#if BT_PROFILE_ENABLED
+                if (profiler) {
+                    for (size_t i = depth; i > 0; --i) {
+                        profiler->Exit(BTNodeStatus::Running, false);
+                    }
+                }
+#endif
+                return result;
+            }
+        }
+        else if (node.childCount == 0) {
+            // 子を持たないコンポジット（Sequenceのみ成功）
+            result = (node.kind == BTCompiledNodeKind::Sequence) ? BTNodeStatus::Success : BTNodeStatus::Failure;
+            state.status = result;
+#if BT_PROFILE_ENABLED
+            if (profiler) {
+                profiler->Enter(current, false);
+                profiler->Exit(result, false);
+            }
+#endif
+        }
+        else {
+            // 新しい選択サイクルの開始時のみシャッフル
+            if (node.kind == BTCompiledNodeKind::RandomSelector && state.needsShuffle) {
+                ShuffleChildren(node, blackboard);
+                state.needsShuffle = false;
+                state.cursor = 0;
+            }
+
+            // 前回Runningだった場合、その子ノードから続行
+            state.status = BTNodeStatus::Running;
+#if BT_PROFILE_ENABLED
+            if (profiler) {
+                profiler->Enter(current, depth == 0);
+            }
+#endif
+            stack[depth++] = current;
+            current = ChildAt(node, state.cursor);
+            continue;
+        }
+
+        // ===== 上昇 =====
+        while (depth > 0) {
+            uint16_t parentIndex = stack[depth - 1];
+            const Node& parent = nodes[parentIndex];
+            NodeState& parentState = states[parentIndex];
+
+            // 子の結果で親の結果が確定するか（Selectorは成功、Sequenceは失敗で確定）
+            BTNodeStatus decisive = (parent.kind == BTCompiledNodeKind::Sequence) ? BTNodeStatus::Failure : BTNodeStatus::Success;
+
+            if (result == decisive || parentState.cursor + 1 >= parent.childCount) {
+                // 結果が確定、または全ての子を実行し終えた
+                parentState.cursor = 0;
+                parentState.status = result;
+                if (parent.kind == BTCompiledNodeKind::RandomSelector) {
+                    parentState.needsShuffle = true;
+                }
+#if BT_PROFILE_ENABLED
+                if (profiler) {
+                    profiler->Exit(result, false);
+                }
+#endif
+            }
+            else {
+                // 次の子ノードへ
+                ++parentState.cursor;
+                current = ChildAt(parent, parentState.cursor);
+                break;
+            }
+
+            --depth;
+        }
+
+        if (depth == 0) {
+            return result;
+        }
+    }
+}
+
+void BTTreeInstance::Reset() {
+    if (!definition_) {
+        return;
+    }
+
+    NodeState* states = States();
+    std::fill(states, states + definition_->nodes_.size(), NodeState{});
+
+    // 前回のリセット以降に実行されていないリーフは初期状態のまま
+    const uint16_t* touched = Indices(definition_->touchedOffset_);
+    for (uint16_t i = 0; i < touchedCount_; ++i) {
+        const Node& node = definition_->nodes_[touched[i]];
+        definition_->leaves_[node.leafIndex]->InitializeInstanceState(LeafState(node));
+    }
+    touchedCount_ = 0;
+    runningIndex_ = kInvalidIndex;
+    runningDepth_ = 0;
+}
+
+BTNodePtr BTTreeInstance::GetRunningNode() const {
+    if (!definition_ || runningIndex_ == kInvalidIndex) {
+        return nullptr;
+    }
+    return definition_->sourceNodes_[runningIndex_];
+}
+
+void BTTreeInstance::EnableProfiling([[maybe_unused]] bool enable) {
+#if BT_PROFILE_ENABLED
+    if (!enable) {
+        profiler_.reset();
+        return;
+    }
+    if (!profiler_) {
+        profiler_ = std::make_unique<BTProfiler>();
+        InitializeProfiler();
+    }
+#endif
+}
+
+BTProfiler* BTTreeInstance::GetProfiler() const {
+#if BT_PROFILE_ENABLED
+    return profiler_.get();
+#else
+    return nullptr;
+#endif
+}
+
+void BTTreeInstance::InitializeProfiler() {
+#if BT_PROFILE_ENABLED
+    if (!profiler_ || !definition_) {
+        return;
+    }
+
+    const auto& sourceNodes = definition_->sourceNodes_;
+    std::vector<std::string> names(sourceNodes.size());
+    for (size_t i = 0; i < sourceNodes.size(); ++i) {
+        names[i] = sourceNodes[i]->GetName();
+    }
+    // コンポジットの経路 + リーフ1段
+    profiler_->Initialize(std::move(names), definition_->maxDepth_ + 1);
+#endif
+}
+
+uint16_t BTTreeInstance::ChildAt(const Node& node, uint16_t position) const {
+    if (node.kind == BTCompiledNodeKind::RandomSelector) {
+        position = Indices(definition_->shuffleOffset_)[node.childBegin + position];
+    }
+    return definition_->childIndices_[node.childBegin + position];
+}
+
+void BTTreeInstance::ShuffleChildren(const Node& node, BTBlackboard* blackboard) {
+    uint16_t* order = Indices(definition_->shuffleOffset_) + node.childBegin;
+    for (uint16_t i = 0; i < node.childCount; ++i) {
+        order[i] = i;
+    }
+
+    // Fisher-Yatesシャッフル（エージェントの乱数列を使用、BTRandomSelectorと同じ手順）
+    BTRandomStream& rng = blackboard->GetRandom();
+    for (uint16_t i = static_cast<uint16_t>(node.childCount - 1); i > 0; --i) {
+        uint16_t j = static_cast<uint16_t>(rng.GetInt(0, static_cast<int>(i)));
+        std::swap(order[i], order[j]);
+    }
+}
+
+BTNodeStatus BTTreeInstance::ExecuteLeaf(uint16_t index, BTBlackboard* blackboard) {
+    const Node& node = definition_->nodes_[index];
+    NodeState& state = States()[index];
+
+    // リセット対象として記録（Resetでは実行したリーフのみ戻す）
+    if (!state.touched) {
+        state.touched = true;
+        Indices(definition_->touchedOffset_)[touchedCount_++] = index;
+    }
+
+    state.status = definition_->leaves_[node.leafIndex]->ExecuteInstance(blackboard, LeafState(node));
+    return state.status;
+}
+
+bool BTTreeInstance::EvaluateGuards(BTBlackboard* blackboard, size_t& outDepth, uint16_t& outCurrent) {
+    const BTCompiledTree& tree = *definition_;
+    if (tree.observers_.empty()) {
+        return false;
+    }
+
+    const std::vector<uint16_t>& changedSlots = blackboard->GetChangedSlots();
+    if (changedSlots.empty()) {
+        return false;
+    }
+
+    NodeState* states = States();
+    const uint16_t* stack = Indices(tree.stackOffset_);
+
+    // 中断する場合は最も浅い（優先度の高い）ガードを採用する
+    const Guard* abortGuard = nullptr;
+    size_t abortDepth = runningDepth_;
+
+    for (uint16_t slot : changedSlots) {
+        auto range = std::equal_range(tree.observers_.begin(), tree.observers_.end(), std::make_pair(slot, uint16_t{ 0 }),
+            [](const std::pair<uint16_t, uint16_t>& a, const std::pair<uint16_t, uint16_t>& b) { return a.first < b.first; });
+
+        for (auto it = range.first; it != range.second; ++it) {
+            const Guard& guard = tree.guards_[it->second];
+
+            // ownerが実行中の経路上にあり、既に採用したガードより浅い場合のみ評価
+            size_t ownerDepth = 0;
+            while (ownerDepth < abortDepth && stack[ownerDepth] != guard.owner) {
+                ++ownerDepth;
+            }
+            if (ownerDepth >= abortDepth) {
+                continue;
+            }
+
+            // 実行中の子より前の位置（今回のサイクルで評価済み）の条件のみ対象
+            if (guard.position >= states[guard.owner].cursor) {
+                continue;
+            }
+
+            const uint16_t* conditions = tree.guardConditions_.data() + guard.conditionBegin;
+            bool before = true;
+            bool after = true;
+            for (uint16_t i = 0; i < guard.conditionCount; ++i) {
+                before = before && (states[conditions[i]].status == BTNodeStatus::Success);
+
+                BTNodeStatus status;
+#if BT_PROFILE_ENABLED
+                if (profiler_) {
+                    profiler_->Enter(conditions[i]);
+                    status = ExecuteLeaf(conditions[i], blackboard);
+                    profiler_->Exit(status);
+                }
+                else
+#endif
+                {
+                    status = ExecuteLeaf(conditions[i], blackboard);
+                }
+                after = after && (status == BTNodeStatus::Success);
+            }
+
+            bool triggered = guard.abortOnSuccess ? (!before && after) : (before && !after);
+            if (triggered) {
+                abortGuard = &guard;
+                abortDepth = ownerDepth;
+            }
+        }
+    }
+
+    if (!abortGuard) {
+        return false;
+    }
+
+    // 実行中の枝を破棄し、ガードの位置からownerを再実行する
+    NodeState& ownerState = states[abortGuard->owner];
+    ResetSubtree(ChildAt(tree.nodes_[abortGuard->owner], ownerState.cursor));
+    ownerState.cursor = abortGuard->position;
+    ++abortCount_;
+
+    outDepth = abortDepth;
+    outCurrent = abortGuard->owner;
+    return true;
+}
+
+void BTTreeInstance::ResetSubtree(uint16_t root) {
+    const BTCompiledTree& tree = *definition_;
+    NodeState* states = States();
+
+    for (uint16_t i = root; i < tree.nodes_[root].subtreeEnd; ++i) {
+        NodeState& state = states[i];
+        state.status = BTNodeStatus::Failure;
+        state.cursor = 0;
+        state.needsShuffle = true;
+
+        // 実行中だったアクションもここで中断される
+        if (state.touched) {
+            const Node& node = tree.nodes_[i];
+            tree.leaves_[node.leafIndex]->InitializeInstanceState(LeafState(node));
+        }
+    }
+}
@@ -0,0 +1,235 @@
+#pragma once
+#include "BTCompiledTree.h"
+#include "BTProfiler.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class BTBlackboard;
+
+/// <summary>
+/// コンパイル済みツリーを実行するエージェント1体分の状態
+/// 共有する定義（BTCompiledTree）を参照し、可変状態はすべて1回の確保で得た連続ブロックに置く
+///   ・コンポジットの継続位置と直前の結果、ランダムセレクターの実行順
+///   ・走査スタックと実行済みリーフの記録
+///   ・各リーフの状態（経過時間・発射数など、BTLeafNodeのTState）
+///
+/// 実行中のリーフがある間は、ルートから辿り直さずそのリーフから再開する
+/// リアクティブ実行時は、監視キーを持つ条件ノードを変化したキーに応じてだけ再評価し、
+/// 結果が変わった場合に実行中の枝を中断する
+///   ・Sequence内の条件が不成立になった → そのSequenceを条件の位置から再実行（自身の中断）
+///   ・Selectorの上位の枝の先頭条件が成立した → Selectorをその枝から再実行（下位優先の中断）
+/// </summary>
+class BTTreeInstance {
+public:
+    /// <summary>
+    /// 無効なノードインデックス
+    /// </summary>
+    static constexpr uint16_t kInvalidIndex = BTCompiledTree::kInvalidIndex;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    BTTreeInstance() = default;
+
+    /// <summary>
+    /// コンストラクタ（定義に結び付けて状態を確保）
+    /// </summary>
+    /// <param name="definition">共有する定義</param>
+    explicit BTTreeInstance(std::shared_ptr<const BTCompiledTree> definition);
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~BTTreeInstance();
+
+    BTTreeInstance(BTTreeInstance&&) noexcept;
+    BTTreeInstance& operator=(BTTreeInstance&&) noexcept;
+    BTTreeInstance(const BTTreeInstance&) = delete;
+    BTTreeInstance& operator=(const BTTreeInstance&) = delete;
+
+    /// <summary>
+    /// 定義に結び付けて状態ブロックを確保・初期化
+    /// </summary>
+    /// <param name="definition">共有する定義（無効な定義ならUnbindと同じ）</param>
+    void Bind(std::shared_ptr<const BTCompiledTree> definition);
+
+    /// <summary>
+    /// 定義との結び付けと状態ブロックの解放
+    /// </summary>
+    void Unbind();
+
+    /// <summary>
+    /// ツリーの実行（1フレーム分）
+    /// </summary>
+    /// <param name="blackboard">このエージェントのブラックボード</param>
+    /// <returns>ルートノードの実行結果</returns>
+    BTNodeStatus Tick(BTBlackboard* blackboard);
+
+    /// <summary>
+    /// 全ノードの状態をリセット
+    /// リーフの状態は前回のリセット以降に実行したものだけ初期化し直す
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// 定義に結び付いているか
+    /// </summary>
+    /// <returns>実行可能な場合true</returns>
+    bool IsValid() const { return definition_ != nullptr; }
+
+    /// <summary>
+    /// 共有している定義の取得
+    /// </summary>
+    /// <returns>定義（未結び付けならnullptr）</returns>
+    const std::shared_ptr<const BTCompiledTree>& GetDefinition() const { return definition_; }
+
+    /// <summary>
+    /// 状態ブロックのサイズ（バイト）
+    /// </summary>
+    /// <returns>サイズ</returns>
+    size_t GetStateSize() const { return definition_ ? definition_->GetInstanceStateSize() : 0; }
+
+    /// <summary>
+    /// リアクティブ実行（条件の監視による中断）の設定
+    /// </summary>
+    /// <param name="reactive">有効にする場合true</param>
+    void SetReactive(bool reactive) { reactive_ = reactive; }
+
+    /// <summary>
+    /// リアクティブ実行が有効か
+    /// </summary>
+    /// <returns>有効な場合true</returns>
+    bool IsReactive() const { return reactive_; }
+
+    /// <summary>
+    /// 条件の変化による中断回数の取得
+    /// </summary>
+    /// <returns>中断回数</returns>
+    uint32_t GetAbortCount() const { return abortCount_; }
+
+    /// <summary>
+    /// ノード単位のプロファイリングの設定
+    /// BT_PROFILE_ENABLEDが0の場合は何もしない
+    /// </summary>
+    /// <param name="enable">有効にする場合true</param>
+    void EnableProfiling(bool enable);
+
+    /// <summary>
+    /// プロファイリングが有効か
+    /// </summary>
+    /// <returns>有効な場合true</returns>
+    bool IsProfiling() const { return GetProfiler() != nullptr; }
+
+    /// <summary>
+    /// プロファイラの取得
+    /// </summary>
+    /// <returns>プロファイラ（無効な場合はnullptr）</returns>
+    BTProfiler* GetProfiler() const;
+
+    /// <summary>
+    /// 直前のTickで実行中だった最深ノードのインデックスを取得
+    /// </summary>
+    /// <returns>ノードインデックス（なければkInvalidIndex）</returns>
+    uint16_t GetRunningIndex() const { return runningIndex_; }
+
+    /// <summary>
+    /// 直前のTickで実行中だった最深ノードを取得（エディタのハイライト用）
+    /// </summary>
+    /// <returns>実行中ノード（なければnullptr）</returns>
+    BTNodePtr GetRunningNode() const;
+
+private:
+    using Node = BTCompiledTree::Node;
+    using Guard = BTCompiledTree::Guard;
+    using NodeState = BTCompiledTree::NodeState;
+
+    /// <summary>
+    /// 状態ブロック内のノード状態の先頭
+    /// </summary>
+    NodeState* States() const { return reinterpret_cast<NodeState*>(block_.get()); }
+
+    /// <summary>
+    /// 状態ブロック内の16bit配列の先頭
+    /// </summary>
+    uint16_t* Indices(size_t offset) const {
+        return reinterpret_cast<uint16_t*>(reinterpret_cast<std::byte*>(block_.get()) + offset);
+    }
+
+    /// <summary>
+    /// 状態ブロック内のリーフ状態
+    /// </summary>
+    void* LeafState(const Node& node) const {
+        return reinterpret_cast<std::byte*>(block_.get()) + node.stateOffset;
+    }
+
+    /// <summary>
+    /// コンポジットの指定位置の子ノードを取得（RandomSelectorはシャッフル順）
+    /// </summary>
+    /// <param name="node">コンポジットのノード定義</param>
+    /// <param name="position">実行順での位置</param>
+    /// <returns>子ノードのインデックス</returns>
+    uint16_t ChildAt(const Node& node, uint16_t position) const;
+
+    /// <summary>
+    /// ランダムセレクターの子の実行順をシャッフル
+    /// </summary>
+    /// <param name="node">ノード定義</param>
+    /// <param name="blackboard">乱数列を持つブラックボード</param>
+    void ShuffleChildren(const Node& node, BTBlackboard* blackboard);
+
+    /// <summary>
+    /// リーフを実行（実行済みとして記録）
+    /// </summary>
+    /// <param name="index">ノードインデックス</param>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus ExecuteLeaf(uint16_t index, BTBlackboard* blackboard);
+
+    /// <summary>
+    /// 変化したキーを監視しているガードを再評価し、中断する場合は再開位置を求める
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="outDepth">再開時のスタックの深さ</param>
+    /// <param name="outCurrent">再開するノード</param>
+    /// <returns>中断した場合true</returns>
+    bool EvaluateGuards(BTBlackboard* blackboard, size_t& outDepth, uint16_t& outCurrent);
+
+    /// <summary>
+    /// 部分木の状態をリセット（中断時）
+    /// </summary>
+    /// <param name="root">部分木のルート</param>
+    void ResetSubtree(uint16_t root);
+
+    /// <summary>
+    /// プロファイラをノード構成に合わせて初期化
+    /// </summary>
+    void InitializeProfiler();
+
+private:
+    // 共有する定義
+    std::shared_ptr<const BTCompiledTree> definition_;
+
+    // 状態ブロック（レイアウトはBTCompiledTree::BuildInstanceLayoutで決定）
+    std::unique_ptr<std::max_align_t[]> block_;
+
+    // 前回のリセット以降に実行したリーフの数（記録は状態ブロック内）
+    uint16_t touchedCount_ = 0;
+
+    // 直前のTickで実行中だったリーフのインデックス
+    uint16_t runningIndex_ = kInvalidIndex;
+
+    // 実行中リーフまでのスタックの深さ（スタック[0]～[runningDepth_-1]が祖先）
+    size_t runningDepth_ = 0;
+
+    // リアクティブ実行が有効か
+    bool reactive_ = true;
+
+    // 条件の変化による中断回数
+    uint32_t abortCount_ = 0;
+
+#if BT_PROFILE_ENABLED
+    // ノード単位のプロファイラ（無効時はnullptr）
+    std::unique_ptr<BTProfiler> profiler_;
+#endif
+};
@@ -0,0 +1,158 @@
+#include "BTTreeLoader.h"
+#include "BTTreeCooker.h"
+#include "BTTreeFormat.h"
+#include "BTComposite.h"
+#include "../../Common/MappedFile.h"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+    /// <summary>
+    /// 文字列テーブルから範囲チェック付きで取り出す
+    /// </summary>
+    bool ReadString(const char* strings, uint32_t stringBytes, uint32_t offset, std::string_view& out) {
+        if (offset >= stringBytes) {
+            return false;
+        }
+        const void* end = std::memchr(strings + offset, '\0', stringBytes - offset);
+        if (!end) {
+            return false;
+        }
+        out = std::string_view(strings + offset, static_cast<const char*>(end) - (strings + offset));
+        return true;
+    }
+
+}
+
+BTNodePtr BTTreeLoader::Load(const uint8_t* data, size_t size, const BTNodeCreator& creator) {
+    using namespace BTTreeFormat;
+
+    if (!data || size < sizeof(Header) || !creator) {
+        return nullptr;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != kMagic || header.version != kVersion || header.nodeCount == 0) {
+        return nullptr;
+    }
+
+    // 各セクションの位置（サイズが一致しないデータは拒否）
+    const size_t nodesOffset = sizeof(Header);
+    const size_t childOffset = nodesOffset + static_cast<size_t>(header.nodeCount) * sizeof(NodeRecord);
+    const size_t typeOffset = childOffset + static_cast<size_t>(header.childIndexCount) * sizeof(uint32_t);
+    const size_t stringOffset = typeOffset + static_cast<size_t>(header.typeCount) * sizeof(uint32_t);
+    const size_t paramOffset = stringOffset + header.stringBytes;
+    if (paramOffset + header.paramBytes != size) {
+        return nullptr;
+    }
+
+    const NodeRecord* nodes = reinterpret_cast<const NodeRecord*>(data + nodesOffset);
+    const uint32_t* childIndices = reinterpret_cast<const uint32_t*>(data + childOffset);
+    const uint32_t* typeNameOffsets = reinterpret_cast<const uint32_t*>(data + typeOffset);
+    const char* strings = reinterpret_cast<const char*>(data + stringOffset);
+    const uint8_t* params = data + paramOffset;
+
+    try {
+        // タイプ名は種類ごとに一度だけ文字列化する
+        std::vector<std::string> typeNames(header.typeCount);
+        for (uint32_t i = 0; i < header.typeCount; ++i) {
+            std::string_view typeName;
+            if (!ReadString(strings, header.stringBytes, typeNameOffsets[i], typeName)) {
+                return nullptr;
+            }
+            typeNames[i] = std::string(typeName);
+        }
+
+        // 子は必ず親より後ろにあるため、末尾から構築すれば親の時点で子が揃っている
+        std::vector<BTNodePtr> built(header.nodeCount);
+        for (uint32_t i = header.nodeCount; i-- > 0;) {
+            const NodeRecord& record = nodes[i];
+            if (record.typeIndex >= header.typeCount ||
+                static_cast<uint64_t>(record.childBegin) + record.childCount > header.childIndexCount ||
+                static_cast<uint64_t>(record.paramOffset) + record.paramSize > header.paramBytes) {
+                return nullptr;
+            }
+
+            // 未知のタイプは部分木ごと除外（JSON読み込み時と同じ扱い）
+            BTNodePtr node = creator(typeNames[record.typeIndex]);
+            if (!node) {
+                continue;
+            }
+
+            // パラメータを適用
+            if (record.paramSize > 0) {
+                const uint8_t* packed = params + record.paramOffset;
+                node->ApplyParameters(nlohmann::json::from_msgpack(packed, packed + record.paramSize));
+            }
+
+            // 表示名を設定
+            if (record.nameOffset != kNone) {
+                std::string_view name;
+                if (!ReadString(strings, header.stringBytes, record.nameOffset, name)) {
+                    return nullptr;
+                }
+                node->SetName(std::string(name));
+            }
+
+            // コンポジットノードの場合、子ノードを接続
+            if (record.childCount > 0 && node->IsComposite()) {
+                BTComposite* composite = static_cast<BTComposite*>(node.get());
+                for (uint32_t c = 0; c < record.childCount; ++c) {
+                    uint32_t childIndex = childIndices[record.childBegin + c];
+                    if (childIndex <= i || childIndex >= header.nodeCount) {
+                        // 前順になっていない（循環や不正な参照）
+                        return nullptr;
+                    }
+                    // 接続済みの子は空になるので、複数の親から参照されても一度しか接続しない
+                    if (built[childIndex]) {
+                        composite->AddChild(std::move(built[childIndex]));
+                    }
+                }
+            }
+
+            built[i] = std::move(node);
+        }
+
+        return built[0];
+    }
+    catch (const std::exception&) {
+        // パラメータの展開に失敗
+        return nullptr;
+    }
+}
+
+BTNodePtr BTTreeLoader::LoadFile(const std::string& cookedPath, const std::string& sourcePath, const BTNodeCreator& creator) {
+    MappedFile file;
+    if (!file.Open(cookedPath) || file.GetSize() < sizeof(BTTreeFormat::Header)) {
+        return nullptr;
+    }
+
+    // 元のJSONが手元にある場合は、クッキング後に編集されていないか確認する
+    // （DOMは構築せず、改行コードを揃えたテキストのハッシュだけを比較する）
+    if (!sourcePath.empty()) {
+        std::ifstream source(sourcePath, std::ios::binary);
+        if (source.is_open()) {
+            std::string text((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+            BTTreeFormat::Header header;
+            std::memcpy(&header, file.GetData(), sizeof(header));
+            if (header.sourceHash != BTTreeFormat::HashText(text.data(), text.size())) {
+                return nullptr;
+            }
+        }
+    }
+
+    return Load(file.GetData(), file.GetSize(), creator);
+}
+
+BTNodePtr BTTreeLoader::LoadFromJSON(const nlohmann::json& json, const BTNodeCreator& creator) {
+    std::vector<uint8_t> blob;
+    if (!BTTreeCooker::Cook(json, 0, blob)) {
+        return nullptr;
+    }
+    return Load(blob.data(), blob.size(), creator);
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "BTNode.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <json.hpp>
+
+/// <summary>
+/// ノードタイプ名からノードを生成する関数
+/// </summary>
+using BTNodeCreator = std::function<BTNodePtr(const std::string&)>;
+
+/// <summary>
+/// クッキング済みビヘイビアツリーのローダー
+/// ノードは前順に並んでいるため、末尾から1回走査するだけで子を親へ接続できる
+/// </summary>
+class BTTreeLoader {
+public:
+    /// <summary>
+    /// メモリ上のバイナリからツリーを構築
+    /// </summary>
+    /// <param name="data">先頭アドレス</param>
+    /// <param name="size">バイト数</param>
+    /// <param name="creator">ノード生成関数</param>
+    /// <returns>ルートノード（不正なデータの場合はnullptr）</returns>
+    static BTNodePtr Load(const uint8_t* data, size_t size, const BTNodeCreator& creator);
+
+    /// <summary>
+    /// クッキング済みファイルをメモリマップしてツリーを構築
+    /// 元のJSONが存在し、内容がクッキング時と異なる場合は古いデータとして失敗する
+    /// </summary>
+    /// <param name="cookedPath">クッキング済みファイルのパス</param>
+    /// <param name="sourcePath">元のJSONのパス（空なら更新チェックしない）</param>
+    /// <param name="creator">ノード生成関数</param>
+    /// <returns>ルートノード（失敗時はnullptr）</returns>
+    static BTNodePtr LoadFile(const std::string& cookedPath, const std::string& sourcePath, const BTNodeCreator& creator);
+
+    /// <summary>
+    /// JSONからツリーを構築（エディタ用のフォールバック）
+    /// メモリ上でクッキングしてから同じ手順で構築する
+    /// </summary>
+    /// <param name="json">ツリーJSON</param>
+    /// <param name="creator">ノード生成関数</param>
+    /// <returns>ルートノード（失敗時はnullptr）</returns>
+    static BTNodePtr LoadFromJSON(const nlohmann::json& json, const BTNodeCreator& creator);
+};
@@ -7,7 +7,6 @@
 #include <fstream>
 #include <filesystem>
 #include <cmath>
-#include <numbers>
 #include <DirectXMath.h>
 
 #ifdef _DEBUG
@@ -60,7 +59,7 @@ void CameraAnimation::Update(float deltaTime) {
         // 最初のキーフレームまで補間
         if (!keyframes_.empty()) {
             const CameraKeyframe& firstKf = keyframes_[0];
-            float t = ApplyEasing(blendProgress_, CameraKeyframe::InterpolationType::EASE_IN_OUT);
+            float t = CameraAnimationSampler::ApplyEasing(blendProgress_, CameraKeyframe::InterpolationType::EASE_IN_OUT);
 
             // 位置の補間（ターゲット相対の場合も考慮）
             Vector3 targetPosition = firstKf.position;
@@ -70,10 +69,10 @@ void CameraAnimation::Update(float deltaTime) {
             Vector3 position = Vec3::Lerp(blendStartPosition_, targetPosition, t);
 
             // 回転の補間（クォータニオンでSlerp）
-            Quaternion q1 = EulerToQuaternion(blendStartRotation_);
-            Quaternion q2 = EulerToQuaternion(firstKf.rotation);
+            Quaternion q1 = CameraAnimationSampler::EulerToQuaternion(blendStartRotation_);
+            Quaternion q2 = CameraAnimationSampler::EulerToQuaternion(firstKf.rotation);
             Quaternion qResult = Quat::Slerp(q1, q2, t);
-            Vector3 rotation = QuaternionToEuler(qResult);
+            Vector3 rotation = CameraAnimationSampler::QuaternionToEuler(qResult);
 
             // FOVの補間
             float fov = Vec3::Lerp(blendStartFov_, firstKf.fov, t);
@@ -130,26 +129,8 @@ void CameraAnimation::Update(float deltaTime) {
         }
     }
 
-    // キーフレーム間の補間を実行
-    size_t prevIndex = 0, nextIndex = 0;
-    if (FindKeyframeIndices(currentTime_, prevIndex, nextIndex)) {
-        const CameraKeyframe& prev = keyframes_[prevIndex];
-        const CameraKeyframe& next = keyframes_[nextIndex];
-
-        // 補間係数を計算（0.0～1.0）
-        float timeDiff = next.time - prev.time;
-        float t = 0.0f;
-        if (timeDiff > 0.0f) {
-            t = (currentTime_ - prev.time) / timeDiff;
-            t = std::clamp(t, 0.0f, 1.0f);
-
-            // イージング関数を適用
-            t = ApplyEasing(t, prev.interpolation);
-        }
-
-        // キーフレーム間を補間してカメラに適用
-        InterpolateKeyframes(prev, next, t);
-    }
+    // キーフレーム間を補間してカメラに適用（区間はサンプラーのカーソルから探す）
+    ApplyPose(sampler_.Sample(currentTime_));
 }
 
 /// <summary>
@@ -167,7 +148,7 @@ void CameraAnimation::AddKeyframe(const CameraKeyframe& keyframe) {
     }
 #endif
 
-    UpdateDuration();
+    OnKeyframesChanged();
 }
 
 /// <summary>
@@ -199,7 +180,7 @@ void CameraAnimation::RemoveKeyframe(size_t index) {
     }
 
     keyframes_.erase(keyframes_.begin() + index);
-    UpdateDuration();
+    OnKeyframesChanged();
 }
 
 /// <summary>
@@ -220,7 +201,7 @@ void CameraAnimation::EditKeyframe(size_t index, const CameraKeyframe& keyframe)
     }
 #endif
 
-    UpdateDuration();
+    OnKeyframesChanged();
 }
 
 /// <summary>
@@ -228,6 +209,7 @@ void CameraAnimation::EditKeyframe(size_t index, const CameraKeyframe& keyframe)
 /// </summary>
 void CameraAnimation::ClearKeyframes() {
     keyframes_.clear();
+    sampler_.Clear();
     duration_ = 0.0f;
     currentTime_ = 0.0f;
     playState_ = PlayState::STOPPED;
@@ -329,26 +311,8 @@ void CameraAnimation::SetCurrentTime(float time) {
         return;
     }
 
-    // キーフレーム間の補間を実行
-    size_t prevIndex = 0, nextIndex = 0;
-    if (FindKeyframeIndices(currentTime_, prevIndex, nextIndex)) {
-        const CameraKeyframe& prev = keyframes_[prevIndex];
-        const CameraKeyframe& next = keyframes_[nextIndex];
-
-        // 補間係数を計算（0.0～1.0）
-        float timeDiff = next.time - prev.time;
-        float t = 0.0f;
-        if (timeDiff > 0.0f) {
-            t = (currentTime_ - prev.time) / timeDiff;
-            t = std::clamp(t, 0.0f, 1.0f);
-
-            // イージング関数を適用
-            t = ApplyEasing(t, prev.interpolation);
-        }
-
-        // キーフレーム間を補間してカメラに適用
-        InterpolateKeyframes(prev, next, t);
-    }
+    // キーフレーム間を補間してカメラに適用（区間はサンプラーのカーソルから探す）
+    ApplyPose(sampler_.Sample(currentTime_));
 }
 
 /// <summary>
@@ -375,151 +339,32 @@ void CameraAnimation::UpdateDuration() {
 }
 
 /// <summary>
-/// 現在時刻に対応する2つのキーフレームを検索
+/// キーフレームの変更後の更新
 /// </summary>
-bool CameraAnimation::FindKeyframeIndices(float time, size_t& prevIndex, size_t& nextIndex) const {
-    if (keyframes_.size() < 2) {
-        return false;
-    }
-
-    // 時刻以下の最大のキーフレームを探す
-    prevIndex = 0;
-    for (size_t i = 0; i < keyframes_.size(); ++i) {
-        if (keyframes_[i].time <= time) {
-            prevIndex = i;
-        } else {
-            break;
-        }
-    }
-
-    // 次のキーフレームを設定
-    nextIndex = prevIndex + 1;
-    if (nextIndex >= keyframes_.size()) {
-        // 最後のキーフレームを超えた場合
-        if (isLooping_ && keyframes_.size() > 1) {
-            // ループ時は最初のキーフレームに戻る
-            nextIndex = 0;
-        } else {
-            // ループしない場合は最後のキーフレームを維持
-            nextIndex = prevIndex;
-        }
-    }
-
-    return true;
+void CameraAnimation::OnKeyframesChanged() {
+    UpdateDuration();
+    sampler_.Build(keyframes_);
 }
 
 /// <summary>
-/// キーフレーム間の補間
+/// サンプラーで求めた姿勢をカメラに適用
 /// </summary>
-void CameraAnimation::InterpolateKeyframes(const CameraKeyframe& prev, const CameraKeyframe& next, float t) {
+void CameraAnimation::ApplyPose(const CameraAnimationSampler::Pose& pose) {
     if (!camera_) {
         return;
     }
 
-    // 位置の補間
-    Vector3 position = Vec3::Lerp(prev.position, next.position, t);
-
-    // 座標系タイプを考慮（両方のキーフレームが同じ座標系である必要がある）
-    // 異なる場合は前のキーフレームの座標系を優先
-    CameraKeyframe::CoordinateType coordinateType = prev.coordinateType;
-
-    // TARGET_RELATIVEモードの場合、ターゲット位置を加算
-    if (coordinateType == CameraKeyframe::CoordinateType::TARGET_RELATIVE && targetTransform_) {
-        // positionはオフセットとして扱う
-        position = Vec3::Add(targetTransform_->translate, position);
-    }
+    // TARGET_RELATIVEの区間では位置をターゲットからのオフセットとして扱う
     // ターゲットが設定されていない場合は、ワールド座標として扱う
-
-    // 回転の補間（クォータニオンでSlerp）
-    Quaternion q1 = EulerToQuaternion(prev.rotation);
-    Quaternion q2 = EulerToQuaternion(next.rotation);
-    Quaternion qResult = Quat::Slerp(q1, q2, t);
-    Vector3 rotation = QuaternionToEuler(qResult);
-
-    // FOVの補間（線形補間）
-    float fov = Vec3::Lerp(prev.fov, next.fov, t);
+    Vector3 position = pose.position;
+    if (pose.targetRelative && targetTransform_) {
+        position = Vec3::Add(targetTransform_->translate, pose.position);
+    }
 
     // カメラに適用
     camera_->SetTranslate(position);
-    camera_->SetRotate(rotation);
-    camera_->SetFovY(fov);
-}
-
-/// <summary>
-/// イージング関数の適用
-/// </summary>
-float CameraAnimation::ApplyEasing(float t, CameraKeyframe::InterpolationType type) const {
-    switch (type) {
-        case CameraKeyframe::InterpolationType::LINEAR:
-            return t;
-
-        case CameraKeyframe::InterpolationType::EASE_IN:
-            // 二次関数でゆっくり開始
-            return t * t;
-
-        case CameraKeyframe::InterpolationType::EASE_OUT:
-            // 二次関数でゆっくり終了
-            return 1.0f - (1.0f - t) * (1.0f - t);
-
-        case CameraKeyframe::InterpolationType::EASE_IN_OUT:
-            // 両端でゆっくり（三次関数）
-            if (t < 0.5f) {
-                return 2.0f * t * t;
-            } else {
-                return 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
-            }
-
-        case CameraKeyframe::InterpolationType::CUBIC_BEZIER:
-            // TODO: カスタムベジェカーブの実装
-            // 現在は線形補間にフォールバック
-            return t;
-
-        default:
-            return t;
-    }
-}
-
-/// <summary>
-/// オイラー角をクォータニオンに変換
-/// </summary>
-Quaternion CameraAnimation::EulerToQuaternion(const Vector3& euler) const {
-    // 各軸周りの回転をクォータニオンで作成
-    Quaternion qx = Quat::MakeRotateAxisAngle(Vector3(1.0f, 0.0f, 0.0f), euler.x);
-    Quaternion qy = Quat::MakeRotateAxisAngle(Vector3(0.0f, 1.0f, 0.0f), euler.y);
-    Quaternion qz = Quat::MakeRotateAxisAngle(Vector3(0.0f, 0.0f, 1.0f), euler.z);
-
-    // 回転順序: Y * X * Z
-    Quaternion result = Quat::Multiply(qy, qx);
-    result = Quat::Multiply(result, qz);
-
-    return result;
-}
-
-/// <summary>
-/// クォータニオンをオイラー角に変換
-/// </summary>
-Vector3 CameraAnimation::QuaternionToEuler(const Quaternion& q) const {
-    Vector3 euler;
-
-    // クォータニオンから回転行列の要素を計算
-    float sinr_cosp = 2.0f * (q.w * q.x + q.y * q.z);
-    float cosr_cosp = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
-    euler.x = std::atan2f(sinr_cosp, cosr_cosp);
-
-    // Pitch (Y軸回転)
-    float sinp = 2.0f * (q.w * q.y - q.z * q.x);
-    if (std::abs(sinp) >= 1.0f) {
-        euler.y = std::copysignf(std::numbers::pi_v<float> / 2.0f, sinp); // ジンバルロック時
-    } else {
-        euler.y = std::asinf(sinp);
-    }
-
-    // Yaw (Z軸回転)
-    float siny_cosp = 2.0f * (q.w * q.z + q.x * q.y);
-    float cosy_cosp = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
-    euler.z = std::atan2f(siny_cosp, cosy_cosp);
-
-    return euler;
+    camera_->SetRotate(pose.rotation);
+    camera_->SetFovY(pose.fov);
 }
 
 /// <summary>
@@ -661,7 +506,7 @@ bool CameraAnimation::LoadFromJson(const std::string& filepath) {
 
         // キーフレームをソートして総時間を更新
         SortKeyframes();
-        UpdateDuration();
+        OnKeyframesChanged();
 
 #ifdef _DEBUG
         DebugUIManager::GetInstance()->AddLog(
@@ -852,6 +697,7 @@ void CameraAnimation::DrawImGui() {
 
         if (ImGui::Button("Sort Keyframes")) {
             SortKeyframes();
+            OnKeyframesChanged();
         }
         ImGui::SameLine();
         if (ImGui::Button("Clear All Keyframes")) {
@@ -1,5 +1,6 @@
 #pragma once
 #include "CameraKeyframe.h"
+#include "CameraAnimationSampler.h"
 #include "Camera.h"
 #include "Quaternion.h"
 #include "Transform.h"
@@ -150,6 +151,11 @@ public:
     /// </summary>
     [[nodiscard]] const CameraKeyframe& GetKeyframe(size_t index) const { return keyframes_[index]; }
 
+    /// <summary>
+    /// キーフレームの補間のサンプラーを取得（カーブ表示などでまとめて姿勢を求める用）
+    /// </summary>
+    [[nodiscard]] const CameraAnimationSampler& GetSampler() const { return sampler_; }
+
     /// <summary>
     /// アニメーションの総時間を取得
     /// </summary>
@@ -262,43 +268,15 @@ private:
     void UpdateDuration();
 
     /// <summary>
-    /// 現在時刻に対応する2つのキーフレームを検索
+    /// キーフレームの変更後の更新（総時間とサンプラーの区間を作り直す）
     /// </summary>
-    /// <param name="time">検索時刻</param>
-    /// <param name="prevIndex">前のキーフレームインデックス（出力）</param>
-    /// <param name="nextIndex">次のキーフレームインデックス（出力）</param>
-    /// <returns>キーフレームが見つかったか</returns>
-    bool FindKeyframeIndices(float time, size_t& prevIndex, size_t& nextIndex) const;
+    void OnKeyframesChanged();
 
     /// <summary>
-    /// キーフレーム間の補間
+    /// サンプラーで求めた姿勢をカメラに適用
     /// </summary>
-    /// <param name="prev">前のキーフレーム</param>
-    /// <param name="next">次のキーフレーム</param>
-    /// <param name="t">補間係数（0.0～1.0）</param>
-    void InterpolateKeyframes(const CameraKeyframe& prev, const CameraKeyframe& next, float t);
-
-    /// <summary>
-    /// イージング関数の適用
-    /// </summary>
-    /// <param name="t">元の補間係数</param>
-    /// <param name="type">補間タイプ</param>
-    /// <returns>イージング適用後の補間係数</returns>
-    float ApplyEasing(float t, CameraKeyframe::InterpolationType type) const;
-
-    /// <summary>
-    /// オイラー角をクォータニオンに変換
-    /// </summary>
-    /// <param name="euler">オイラー角（ラジアン）</param>
-    /// <returns>クォータニオン</returns>
-    Quaternion EulerToQuaternion(const Vector3& euler) const;
-
-    /// <summary>
-    /// クォータニオンをオイラー角に変換
-    /// </summary>
-    /// <param name="q">クォータニオン</param>
-    /// <returns>オイラー角（ラジアン）</returns>
-    Vector3 QuaternionToEuler(const Quaternion& q) const;
+    /// <param name="pose">姿勢</param>
+    void ApplyPose(const CameraAnimationSampler::Pose& pose);
 
     /// <summary>
     /// 選択解除時の処理（カメラを元の値に戻す）
@@ -315,6 +293,8 @@ private:
 
     std::vector<CameraKeyframe> keyframes_;  ///< キーフレーム配列
 
+    CameraAnimationSampler sampler_;  ///< キーフレームの補間（区間ごとの係数と再生位置のカーソル）
+
     Camera* camera_ = nullptr;  ///< アニメーション対象のカメラ
 
     const Transform* targetTransform_ = nullptr;  ///< ターゲットトランスフォーム（相対座標の基準）
@@ -0,0 +1,232 @@
+#include "CameraAnimationSampler.h"
+#include "Vec3Func.h"
+#include "QuatFunc.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+/// <summary>
+/// キーフレームから区間の係数を作り直す
+/// </summary>
+void CameraAnimationSampler::Build(const std::vector<CameraKeyframe>& keyframes) {
+    Clear();
+    startTimes_.reserve(keyframes.size());
+    segments_.reserve(keyframes.size());
+
+    for (size_t i = 0; i < keyframes.size(); ++i) {
+        const CameraKeyframe& prev = keyframes[i];
+        // 最後のキーフレームは自分自身への長さ0の区間にする（以降の時刻は最後の姿勢のまま）
+        const CameraKeyframe& next = i + 1 < keyframes.size() ? keyframes[i + 1] : prev;
+
+        Segment segment;
+        const float timeDiff = next.time - prev.time;
+        segment.inverseDuration = timeDiff > 0.0f ? 1.0f / timeDiff : 0.0f;
+        segment.easing = prev.interpolation;
+
+        // 座標系は始点のキーフレームのものを使う
+        segment.targetRelative = prev.coordinateType == CameraKeyframe::CoordinateType::TARGET_RELATIVE;
+        segment.positionStart = prev.position;
+        segment.positionDelta = Vec3::Subtract(next.position, prev.position);
+        segment.fovStart = prev.fov;
+        segment.fovDelta = next.fov - prev.fov;
+
+        // オイラー角からの変換は区間ごとに1回だけ行う
+        segment.rotationStart = EulerToQuaternion(prev.rotation);
+        segment.rotationEnd = EulerToQuaternion(next.rotation);
+        segment.constantRotation =
+            segment.rotationStart.x == segment.rotationEnd.x && segment.rotationStart.y == segment.rotationEnd.y &&
+            segment.rotationStart.z == segment.rotationEnd.z && segment.rotationStart.w == segment.rotationEnd.w;
+        if (segment.constantRotation) {
+            segment.constantEuler = QuaternionToEuler(segment.rotationStart);
+        }
+
+        startTimes_.push_back(prev.time);
+        segments_.push_back(segment);
+    }
+}
+
+/// <summary>
+/// 区間の破棄
+/// </summary>
+void CameraAnimationSampler::Clear() {
+    startTimes_.clear();
+    segments_.clear();
+    cursor_ = 0;
+}
+
+/// <summary>
+/// 指定時刻の姿勢
+/// </summary>
+CameraAnimationSampler::Pose CameraAnimationSampler::Sample(float time) const {
+    if (segments_.empty()) {
+        return Pose{};
+    }
+
+    if (!Locate(time, cursor_)) {
+        ++seekCount_;
+    }
+    return Evaluate(time, cursor_);
+}
+
+/// <summary>
+/// 複数の時刻の姿勢をまとめて求める
+/// </summary>
+void CameraAnimationSampler::Sample(std::span<const float> times, std::span<Pose> out, uint32_t& cursor) const {
+    const size_t count = (std::min)(times.size(), out.size());
+    if (segments_.empty()) {
+        std::fill_n(out.begin(), count, Pose{});
+        return;
+    }
+
+    // 区間を作り直した後などで範囲外になっていれば先頭から
+    if (cursor >= segments_.size()) {
+        cursor = 0;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        Locate(times[i], cursor);
+        out[i] = Evaluate(times[i], cursor);
+    }
+}
+
+/// <summary>
+/// 時刻を含む区間を二分探索で求める
+/// </summary>
+uint32_t CameraAnimationSampler::FindSegment(float time) const {
+    // 時刻以下で最後の始点（同じ時刻のキーフレームが並ぶ場合は後ろのもの）
+    const auto it = std::upper_bound(startTimes_.begin(), startTimes_.end(), time);
+    if (it == startTimes_.begin()) {
+        return 0;
+    }
+    return static_cast<uint32_t>(std::distance(startTimes_.begin(), it) - 1);
+}
+
+/// <summary>
+/// カーソルから時刻を含む区間を探す
+/// </summary>
+bool CameraAnimationSampler::Locate(float time, uint32_t& cursor) const {
+    const uint32_t count = static_cast<uint32_t>(startTimes_.size());
+    if (time < startTimes_[0]) {
+        cursor = 0;
+        return true;
+    }
+
+    // 前回の区間から数区間先までに入っていれば探索しない（通常の再生はほとんどこちら）
+    // 同じ時刻のキーフレームが並ぶと長さ0の区間ができるので、1つ先だけでなく少し先まで進める
+    constexpr uint32_t kMaxForwardSteps = 4;
+    if (startTimes_[cursor] <= time) {
+        uint32_t index = cursor;
+        for (uint32_t step = 0; step < kMaxForwardSteps && index + 1 < count && startTimes_[index + 1] <= time; ++step) {
+            ++index;
+        }
+        if (index + 1 == count || time < startTimes_[index + 1]) {
+            cursor = index;
+            return true;
+        }
+    }
+
+    cursor = FindSegment(time);
+    return false;
+}
+
+/// <summary>
+/// 区間内の時刻の姿勢
+/// </summary>
+CameraAnimationSampler::Pose CameraAnimationSampler::Evaluate(float time, uint32_t index) const {
+    const Segment& segment = segments_[index];
+
+    // 補間係数を計算（0.0～1.0）してイージングを適用
+    float t = 0.0f;
+    if (segment.inverseDuration > 0.0f) {
+        t = std::clamp((time - startTimes_[index]) * segment.inverseDuration, 0.0f, 1.0f);
+        t = ApplyEasing(t, segment.easing);
+    }
+
+    Pose pose;
+    pose.position = Vec3::Add(segment.positionStart, Vec3::Multiply(segment.positionDelta, t));
+    pose.rotation = segment.constantRotation
+        ? segment.constantEuler
+        : QuaternionToEuler(Quat::Slerp(segment.rotationStart, segment.rotationEnd, t));
+    pose.fov = segment.fovStart + segment.fovDelta * t;
+    pose.targetRelative = segment.targetRelative;
+    pose.segment = index;
+    pose.blend = t;
+    return pose;
+}
+
+/// <summary>
+/// イージング関数の適用
+/// </summary>
+float CameraAnimationSampler::ApplyEasing(float t, CameraKeyframe::InterpolationType type) {
+    switch (type) {
+        case CameraKeyframe::InterpolationType::LINEAR:
+            return t;
+
+        case CameraKeyframe::InterpolationType::EASE_IN:
+            // 二次関数でゆっくり開始
+            return t * t;
+
+        case CameraKeyframe::InterpolationType::EASE_OUT:
+            // 二次関数でゆっくり終了
+            return 1.0f - (1.0f - t) * (1.0f - t);
+
+        case CameraKeyframe::InterpolationType::EASE_IN_OUT:
+            // 両端でゆっくり（三次関数）
+            if (t < 0.5f) {
+                return 2.0f * t * t;
+            } else {
+                return 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
+            }
+
+        case CameraKeyframe::InterpolationType::CUBIC_BEZIER:
+            // TODO: カスタムベジェカーブの実装
+            // 現在は線形補間にフォールバック
+            return t;
+
+        default:
+            return t;
+    }
+}
+
+/// <summary>
+/// オイラー角をクォータニオンに変換
+/// </summary>
+Quaternion CameraAnimationSampler::EulerToQuaternion(const Vector3& euler) {
+    // 各軸周りの回転をクォータニオンで作成
+    Quaternion qx = Quat::MakeRotateAxisAngle(Vector3(1.0f, 0.0f, 0.0f), euler.x);
+    Quaternion qy = Quat::MakeRotateAxisAngle(Vector3(0.0f, 1.0f, 0.0f), euler.y);
+    Quaternion qz = Quat::MakeRotateAxisAngle(Vector3(0.0f, 0.0f, 1.0f), euler.z);
+
+    // 回転順序: Y * X * Z
+    Quaternion result = Quat::Multiply(qy, qx);
+    result = Quat::Multiply(result, qz);
+
+    return result;
+}
+
+/// <summary>
+/// クォータニオンをオイラー角に変換
+/// </summary>
+Vector3 CameraAnimationSampler::QuaternionToEuler(const Quaternion& q) {
+    Vector3 euler;
+
+    // クォータニオンから回転行列の要素を計算
+    float sinr_cosp = 2.0f * (q.w * q.x + q.y * q.z);
+    float cosr_cosp = 1.0f - 2.0f * (q.x * q.x + q.y * q.y);
+    euler.x = std::atan2f(sinr_cosp, cosr_cosp);
+
+    // Pitch (Y軸回転)
+    float sinp = 2.0f * (q.w * q.y - q.z * q.x);
+    if (std::abs(sinp) >= 1.0f) {
+        euler.y = std::copysignf(std::numbers::pi_v<float> / 2.0f, sinp); // ジンバルロック時
+    } else {
+        euler.y = std::asinf(sinp);
+    }
+
+    // Yaw (Z軸回転)
+    float siny_cosp = 2.0f * (q.w * q.z + q.x * q.y);
+    float cosy_cosp = 1.0f - 2.0f * (q.y * q.y + q.z * q.z);
+    euler.z = std::atan2f(siny_cosp, cosy_cosp);
+
+    return euler;
+}
@@ -0,0 +1,143 @@
+#pragma once
+#include "CameraKeyframe.h"
+#include "Quaternion.h"
+#include "Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// <summary>
+/// カメラアニメーションのサンプラー
+/// キーフレームから区間ごとの補間の係数（始点・差分・クォータニオン）を前もって作り、時刻からカメラの姿勢を求める
+/// 区間の検索は前回の区間（カーソル）から始めるので、時刻を進めながらの取得は1回あたりほぼ定数時間
+/// カーソルから外れた時刻（シーク・ループ）は二分探索で区間を探す
+/// キーフレームは時刻順に並んでいる前提（CameraAnimationがソートしてから渡す）
+/// Sample(float)は再生用のカーソルを書き換えるため、同じサンプラーを複数のスレッドから同時に使わないこと
+/// エディタの描画など再生と別の用途では、カーソルを引数に取るSampleを使う
+/// </summary>
+class CameraAnimationSampler {
+public:
+    /// <summary>
+    /// ある時刻のカメラの姿勢
+    /// </summary>
+    struct Pose {
+        Vector3 position = { 0.0f, 0.0f, 0.0f };  ///< 位置（targetRelativeならターゲットからのオフセット）
+        Vector3 rotation = { 0.0f, 0.0f, 0.0f };  ///< 回転（オイラー角、ラジアン）
+        float fov = 0.45f;                         ///< 視野角（ラジアン）
+        bool targetRelative = false;               ///< 区間の始点のキーフレームがターゲット相対か
+        uint32_t segment = 0;                      ///< 区間の始点のキーフレームのインデックス
+        float blend = 0.0f;                        ///< 区間内の補間係数（イージング適用後、0.0～1.0）
+    };
+
+    /// <summary>
+    /// キーフレームから区間の係数を作り直す（カーソルは先頭に戻る）
+    /// </summary>
+    /// <param name="keyframes">時刻順のキーフレーム</param>
+    void Build(const std::vector<CameraKeyframe>& keyframes);
+
+    /// <summary>
+    /// 区間の破棄
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 指定時刻の姿勢
+    /// 最初のキーフレームより前は最初のキーフレーム、最後のキーフレーム以降は最後のキーフレームの姿勢になる
+    /// </summary>
+    /// <param name="time">時刻（秒）</param>
+    /// <returns>姿勢（キーフレームが無ければ既定値）</returns>
+    Pose Sample(float time) const;
+
+    /// <summary>
+    /// 複数の時刻の姿勢をまとめて求める（時刻が昇順ならカーソルを進めるだけで区間が見つかる）
+    /// 呼び出し側のカーソルを使うので、再生用のカーソル（Sample(float)）は動かさない
+    /// </summary>
+    /// <param name="times">時刻（秒）</param>
+    /// <param name="out">姿勢（times.size()要素以上）</param>
+    /// <param name="cursor">呼び出し側が持つカーソル（最初は0、範囲外なら先頭から探す）</param>
+    void Sample(std::span<const float> times, std::span<Pose> out, uint32_t& cursor) const;
+
+    /// <summary>
+    /// 時刻を含む区間（始点のキーフレームのインデックス）を二分探索で求める（カーソルは使わない）
+    /// </summary>
+    /// <param name="time">時刻（秒）</param>
+    /// <returns>区間のインデックス（最初のキーフレームより前は0）</returns>
+    uint32_t FindSegment(float time) const;
+
+    /// <summary>
+    /// 区間の数（キーフレームの数と同じ、最後の区間は最後のキーフレームの姿勢のまま）
+    /// </summary>
+    [[nodiscard]] size_t GetSegmentCount() const { return segments_.size(); }
+
+    /// <summary>
+    /// 再生用のカーソルが二分探索に戻った回数の累計（カーソルが効いているかの確認用）
+    /// </summary>
+    [[nodiscard]] uint64_t GetSeekCount() const { return seekCount_; }
+
+    /// <summary>
+    /// イージング関数の適用
+    /// </summary>
+    /// <param name="t">元の補間係数</param>
+    /// <param name="type">補間タイプ</param>
+    /// <returns>イージング適用後の補間係数</returns>
+    static float ApplyEasing(float t, CameraKeyframe::InterpolationType type);
+
+    /// <summary>
+    /// オイラー角をクォータニオンに変換
+    /// </summary>
+    /// <param name="euler">オイラー角（ラジアン）</param>
+    /// <returns>クォータニオン</returns>
+    static Quaternion EulerToQuaternion(const Vector3& euler);
+
+    /// <summary>
+    /// クォータニオンをオイラー角に変換
+    /// </summary>
+    /// <param name="q">クォータニオン</param>
+    /// <returns>オイラー角（ラジアン）</returns>
+    static Vector3 QuaternionToEuler(const Quaternion& q);
+
+private:
+    /// <summary>
+    /// 区間1つ分の補間の係数
+    /// </summary>
+    struct Segment {
+        float inverseDuration = 0.0f;   // 区間の長さの逆数（0なら長さが0で、常に始点の姿勢）
+        CameraKeyframe::InterpolationType easing = CameraKeyframe::InterpolationType::LINEAR;
+        bool targetRelative = false;
+        bool constantRotation = false;  // 始点と終点の回転が同じ（Slerpを省く）
+        Vector3 positionStart;
+        Vector3 positionDelta;
+        float fovStart = 0.0f;
+        float fovDelta = 0.0f;
+        Quaternion rotationStart;
+        Quaternion rotationEnd;
+        Vector3 constantEuler;          // constantRotationの場合の回転
+    };
+
+    /// <summary>
+    /// カーソルから時刻を含む区間を探し、カーソルを移す
+    /// </summary>
+    /// <param name="time">時刻（秒）</param>
+    /// <param name="cursor">カーソル（区間の範囲内であること）</param>
+    /// <returns>二分探索せずに見つかった場合true</returns>
+    bool Locate(float time, uint32_t& cursor) const;
+
+    /// <summary>
+    /// 区間内の時刻の姿勢
+    /// </summary>
+    /// <param name="time">時刻（秒）</param>
+    /// <param name="index">時刻を含む区間</param>
+    /// <returns>姿勢</returns>
+    Pose Evaluate(float time, uint32_t index) const;
+
+    // 区間の始点の時刻（二分探索用に係数とは分けて持つ）
+    std::vector<float> startTimes_;
+
+    // 区間ごとの係数
+    std::vector<Segment> segments_;
+
+    // 再生用の前回の区間と、二分探索に戻った回数
+    mutable uint32_t cursor_ = 0;
+    mutable uint64_t seekCount_ = 0;
+};
@@ -154,37 +154,46 @@ void CameraAnimationCurveEditor::DrawCurve(CurveType curveType) {
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     ImU32 color = curveColors_[static_cast<int>(curveType)];
 
-    // キーフレーム間の補間カーブを描画
-    std::vector<ImVec2> points;
-
-    for (size_t i = 0; i < animation_->GetKeyframeCount() - 1; ++i) {
-        const CameraKeyframe& kf1 = animation_->GetKeyframe(i);
-        const CameraKeyframe& kf2 = animation_->GetKeyframe(i + 1);
-
-        float v1 = GetCurveValue(kf1, curveType);
-        float v2 = GetCurveValue(kf2, curveType);
-
-        // 補間曲線を描画（解像度分のポイントを生成）
-        for (int j = 0; j <= curveResolution_; ++j) {
-            float t = static_cast<float>(j) / curveResolution_;
-            float time = kf1.time + (kf2.time - kf1.time) * t;
-
-            // イージング適用
-            float easedT = ApplyEasing(t, kf1.interpolation);
-            float value = v1 + (v2 - v1) * easedT;
-
-            ImVec2 p = ValueToGraph(time, value);
-            if (p.x >= graphPos_.x && p.x <= graphPos_.x + graphSize_.x &&
-                p.y >= graphPos_.y && p.y <= graphPos_.y + graphSize_.y) {
+    // 表示中の時刻の範囲（キーフレームの範囲に収める）
+    const size_t keyframeCount = animation_->GetKeyframeCount();
+    float viewStart = 0.0f;
+    float viewEnd = 0.0f;
+    float unusedValue = 0.0f;
+    GraphToValue(graphPos_, viewStart, unusedValue);
+    GraphToValue(ImVec2(graphPos_.x + graphSize_.x, graphPos_.y), viewEnd, unusedValue);
+    viewStart = std::max<float>(viewStart, animation_->GetKeyframe(0).time);
+    viewEnd = std::min<float>(viewEnd, animation_->GetKeyframe(keyframeCount - 1).time);
+
+    // 補間カーブを描画（表示中の区間だけを、区間数×解像度の点でまとめてサンプリング）
+    // 点の数はグラフの幅のピクセル数までにするので、キーフレームが増えても描画の量は増えない
+    if (viewStart < viewEnd) {
+        const CameraAnimationSampler& sampler = animation_->GetSampler();
+        const size_t visibleSegments = sampler.FindSegment(viewEnd) - sampler.FindSegment(viewStart) + 1;
+        const size_t maxSamples = std::max<size_t>(2, static_cast<size_t>(graphSize_.x));
+        const size_t sampleCount = std::clamp<size_t>(visibleSegments * curveResolution_ + 1, 2, maxSamples);
+
+        curveTimes_.resize(sampleCount);
+        curvePoses_.resize(sampleCount);
+        for (size_t i = 0; i < sampleCount; ++i) {
+            curveTimes_[i] = viewStart + (viewEnd - viewStart) * static_cast<float>(i) / static_cast<float>(sampleCount - 1);
+        }
+        // 再生用のカーソルを動かさないよう、エディタ側のカーソルで探す
+        sampler.Sample(curveTimes_, curvePoses_, curveCursor_);
+
+        std::vector<ImVec2> points;
+        points.reserve(sampleCount);
+        for (size_t i = 0; i < sampleCount; ++i) {
+            ImVec2 p = ValueToGraph(curveTimes_[i], GetCurveValue(curvePoses_[i], curveType));
+            if (p.y >= graphPos_.y && p.y <= graphPos_.y + graphSize_.y) {
                 points.push_back(p);
             }
         }
-    }
 
-    // カーブを描画
-    if (points.size() > 1) {
-        for (size_t i = 0; i < points.size() - 1; ++i) {
-            drawList->AddLine(points[i], points[i + 1], color, 2.0f);
+        // カーブを描画
+        if (points.size() > 1) {
+            for (size_t i = 0; i < points.size() - 1; ++i) {
+                drawList->AddLine(points[i], points[i + 1], color, 2.0f);
+            }
         }
     }
 
@@ -362,6 +371,16 @@ float CameraAnimationCurveEditor::GetCurveValue(const CameraKeyframe& kf, CurveT
     }
 }
 
+float CameraAnimationCurveEditor::GetCurveValue(const CameraAnimationSampler::Pose& pose, CurveType type) const {
+    // 区間の両端のキーフレームの値を、サンプラーが求めた補間係数で補間する
+    const size_t lastIndex = animation_->GetKeyframeCount() - 1;
+    const CameraKeyframe& kf1 = animation_->GetKeyframe(pose.segment);
+    const CameraKeyframe& kf2 = animation_->GetKeyframe(std::min<size_t>(pose.segment + 1, lastIndex));
+    float v1 = GetCurveValue(kf1, type);
+    float v2 = GetCurveValue(kf2, type);
+    return v1 + (v2 - v1) * pose.blend;
+}
+
 void CameraAnimationCurveEditor::SetCurveValue(CameraKeyframe& kf, CurveType type, float value) {
     switch (type) {
         case CurveType::POSITION_X: kf.position.x = value; break;
@@ -374,29 +393,6 @@ void CameraAnimationCurveEditor::SetCurveValue(CameraKeyframe& kf, CurveType typ
     }
 }
 
-float CameraAnimationCurveEditor::ApplyEasing(float t, CameraKeyframe::InterpolationType type) const {
-    switch (type) {
-        case CameraKeyframe::InterpolationType::LINEAR:
-            return t;
-
-        case CameraKeyframe::InterpolationType::EASE_IN:
-            return t * t;
-
-        case CameraKeyframe::InterpolationType::EASE_OUT:
-            return 1.0f - (1.0f - t) * (1.0f - t);
-
-        case CameraKeyframe::InterpolationType::EASE_IN_OUT:
-            if (t < 0.5f) {
-                return 2.0f * t * t;
-            } else {
-                return 1.0f - 2.0f * (1.0f - t) * (1.0f - t);
-            }
-
-        default:
-            return t;
-    }
-}
-
 void CameraAnimationCurveEditor::SnapToGrid(float& time, float& value) const {
     time = std::round(time / gridSnapIntervalX_) * gridSnapIntervalX_;
     value = std::round(value / gridSnapIntervalY_) * gridSnapIntervalY_;
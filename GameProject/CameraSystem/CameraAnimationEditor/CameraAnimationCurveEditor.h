@@ -146,6 +146,11 @@ private:
     /// </summary>
     float GetCurveValue(const CameraKeyframe& kf, CurveType type) const;
 
+    /// <summary>
+    /// サンプラーで求めた姿勢でのカーブ値の取得（区間の両端のキーフレームの値を補間）
+    /// </summary>
+    float GetCurveValue(const CameraAnimationSampler::Pose& pose, CurveType type) const;
+
     /// <summary>
     /// カーブ値の設定
     /// </summary>
@@ -156,11 +161,6 @@ private:
     /// </summary>
     float CalculateBezier(float t, float p0, float p1, float p2, float p3) const;
 
-    /// <summary>
-    /// イージング関数の適用
-    /// </summary>
-    float ApplyEasing(float t, CameraKeyframe::InterpolationType type) const;
-
     /// <summary>
     /// グリッドにスナップ
     /// </summary>
@@ -205,7 +205,10 @@ private:
     bool showAxes_ = true;                       ///< 軸表示
     bool showTangents_ = true;                   ///< タンジェント表示
     bool showValues_ = true;                     ///< 値表示
-    int curveResolution_ = 50;                   ///< カーブ解像度
+    int curveResolution_ = 50;                   ///< カーブ解像度（区間あたりの点の数）
+    std::vector<float> curveTimes_;              ///< カーブのサンプリング時刻の作業領域
+    std::vector<CameraAnimationSampler::Pose> curvePoses_; ///< カーブのサンプリング結果の作業領域
+    uint32_t curveCursor_ = 0;                   ///< カーブのサンプリング用のカーソル（再生用とは別）
 
     // タンジェント設定（将来的にベジェカーブ実装用）
     struct TangentData {
@@ -1,6 +1,7 @@
 #include "BossBulletCollider.h"
 #include "../Object/Player/Player.h"
 #include "CollisionTypeIdDef.h"
+#include "HitEventQueue.h"
 #include "CollisionManager.h"
 
 BossBulletCollider::BossBulletCollider(BossBullet* owner)
@@ -14,9 +15,8 @@ void BossBulletCollider::OnCollisionEnter(Collider* other) {
 
     // プレイヤーとの衝突判定
     if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeId::PLAYER)) {
-        // 多重ヒット防止チェック
-        void* targetPtr = other->GetOwner();
-        if (hitTargets_.find(targetPtr) != hitTargets_.end()) {
+        // 多重ヒット防止チェック（グリッドの接触の状態に記録する）
+        if (!owner_->RegisterHit(other)) {
             return;  // 既にヒット済み
         }
 
@@ -24,10 +24,15 @@ void BossBulletCollider::OnCollisionEnter(Collider* other) {
         Player* player = static_cast<Player*>(other->GetOwner());
         if (player) {
             hitPlayer_ = player;
-            hitTargets_.insert(targetPtr);
 
-            // プレイヤーにダメージを与える
-            player->OnHit(owner_->GetDamage());
+            // プレイヤーへのダメージはヒットとして書き込み、判定が終わった後に適用する
+            HitEvent hit;
+            hit.attacker = this;
+            hit.victim = other;
+            hit.damage = owner_->GetDamage();
+            hit.point = owner_->GetTransform().translate;
+            hit.source = HitSource::BossBullet;
+            HitEventQueue::Submit(owner_->GetHitEventQueue(), hit);
             hasDealtDamage_ = true;
 
             // 弾を非アクティブ化
@@ -50,7 +55,6 @@ void BossBulletCollider::OnCollisionExit(Collider* other) {
 }
 
 void BossBulletCollider::Reset() {
-    hitTargets_.clear();
     hitPlayer_ = nullptr;
     hasDealtDamage_ = false;
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 
 #include "SphereCollider.h"
 #include "../Object/Projectile/BossBullet.h"
-#include <unordered_set>
 
 class BossBullet;
 class Player;
@@ -56,9 +55,6 @@ private:
     // 所有者（BossBullet）への参照
     BossBullet* owner_ = nullptr;
 
-    // ヒット済みターゲット（多重ヒット防止用）
-    std::unordered_set<void*> hitTargets_;
-
     // 現在ヒットしているプレイヤー
     Player* hitPlayer_ = nullptr;
 
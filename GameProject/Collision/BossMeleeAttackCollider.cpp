@@ -2,6 +2,7 @@
 #include "../Object/Boss/Boss.h"
 #include "../Object/Player/Player.h"
 #include "CollisionTypeIdDef.h"
+#include "HitEventQueue.h"
 #include "GlobalVariables.h"
 
 BossMeleeAttackCollider::BossMeleeAttackCollider(Boss* boss)
@@ -21,8 +22,13 @@ void BossMeleeAttackCollider::OnCollisionEnter(Collider* other) {
 
     // プレイヤーとの衝突判定
     if (typeID == static_cast<uint32_t>(CollisionTypeId::PLAYER)) {
-        Player* player = static_cast<Player*>(other->GetOwner());
-        player->OnHit(damage_);
+        HitEvent hit;
+        hit.attacker = this;
+        hit.victim = other;
+        hit.damage = damage_;
+        hit.point = GetCenter();
+        hit.source = HitSource::BossMelee;
+        HitEventQueue::Submit(hitEvents_, hit);
         hasHitPlayer_ = true;  // 多重ヒット防止
     }
 }
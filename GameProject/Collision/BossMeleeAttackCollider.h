@@ -3,6 +3,7 @@
 
 class Boss;
 class Player;
+class HitEventQueue;
 
 /// <summary>
 /// ボス近接攻撃用コライダークラス
@@ -58,8 +59,15 @@ public:
 	/// <returns>ヒット済みならtrue</returns>
 	bool HasHitPlayer() const { return hasHitPlayer_; }
 
+	/// <summary>
+	/// ヒットの書き込み先を設定（ダメージはResolveの時に適用される）
+	/// </summary>
+	/// <param name="hitEvents">書き込み先（nullptrなら当たった時にその場で適用）</param>
+	void SetHitEventQueue(HitEventQueue* hitEvents) { hitEvents_ = hitEvents; }
+
 private:
 	Boss* boss_ = nullptr;           ///< このコライダーを所有するボス
 	float damage_ = 10.0f;           ///< 攻撃ダメージ量
 	bool hasHitPlayer_ = false;      ///< 多重ヒット防止フラグ
+	HitEventQueue* hitEvents_ = nullptr;  ///< ヒットの書き込み先（nullptrなら即時に適用）
 };
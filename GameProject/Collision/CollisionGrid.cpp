@@ -0,0 +1,559 @@
+#include "CollisionGrid.h"
+#include "NarrowphaseBatch.h"
+#include "OBBCollider.h"
+#include "SphereCollider.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+    using Box = NarrowphaseBatch::OBBShape;
+
+    Box MakeBox(const OBBCollider& obb) {
+        const Matrix4x4& orientation = obb.GetOrientation();
+        const Vector3 half = obb.GetSize() * 0.5f;
+        Box box;
+        box.center = obb.GetCenter();
+        for (int i = 0; i < 3; ++i) {
+            box.axes[i] = Vector3(orientation.m[i][0], orientation.m[i][1], orientation.m[i][2]);
+        }
+        box.halfExtents[0] = half.x;
+        box.halfExtents[1] = half.y;
+        box.halfExtents[2] = half.z;
+        return box;
+    }
+
+    bool SphereSphere(const Vector3& centerA, float radiusA, const Vector3& centerB, float radiusB) {
+        const Vector3 diff = centerB - centerA;
+        const float radius = radiusA + radiusB;
+        return diff.Dot(diff) <= radius * radius;
+    }
+
+    Vector3 Cross(const Vector3& a, const Vector3& b) {
+        return Vector3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+    }
+
+    /// <summary>
+    /// 軸へ投影したOBBの半分の長さ
+    /// </summary>
+    float ProjectBox(const Box& box, const Vector3& axis) {
+        return box.halfExtents[0] * std::abs(axis.Dot(box.axes[0]))
+             + box.halfExtents[1] * std::abs(axis.Dot(box.axes[1]))
+             + box.halfExtents[2] * std::abs(axis.Dot(box.axes[2]));
+    }
+
+    bool BoxBox(const Box& a, const Box& b) {
+        // 分離軸判定（面法線6本＋辺の外積9本、平行な辺の外積は飛ばす）
+        constexpr float kEpsilon = 1.0e-6f;
+        const Vector3 diff = b.center - a.center;
+        auto separated = [&](const Vector3& axis) {
+            return std::abs(diff.Dot(axis)) > ProjectBox(a, axis) + ProjectBox(b, axis);
+        };
+        for (int i = 0; i < 3; ++i) {
+            if (separated(a.axes[i]) || separated(b.axes[i])) {
+                return false;
+            }
+        }
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                const Vector3 axis = Cross(a.axes[i], b.axes[j]);
+                if (axis.Dot(axis) > kEpsilon && separated(axis)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+}
+
+void CollisionGrid::Initialize(const Vector3& min, const Vector3& max, float cellSize) {
+    minX_ = min.x;
+    minZ_ = min.z;
+    inverseCellSize_ = 1.0f / cellSize;
+    columns_ = (std::max)(1, static_cast<int32_t>(std::ceil((max.x - min.x) * inverseCellSize_)));
+    rows_ = (std::max)(1, static_cast<int32_t>(std::ceil((max.z - min.z) * inverseCellSize_)));
+    buckets_.assign(static_cast<size_t>(columns_) * static_cast<size_t>(rows_) * kCollisionTypeCount, {});
+    layers_ = CollisionLayerMatrix{};
+
+    Clear();
+    stats_ = Stats{};
+    stats_.cellCount = static_cast<size_t>(columns_) * static_cast<size_t>(rows_);
+}
+
+void CollisionGrid::Clear() {
+    for (auto& bucket : buckets_) {
+        bucket.clear();
+    }
+    for (auto& handles : typeEntries_) {
+        handles.clear();
+    }
+    queryOnlyEntries_.clear();
+    entries_.clear();
+    freeHandles_.clear();
+    currentPairs_.clear();
+    contacts_.Clear();
+    stats_.colliderCount = 0;
+}
+
+void CollisionGrid::SetLayerMatrix(const CollisionLayerMatrix& layers) {
+    layers_ = layers;
+
+    // セルから全て外しておき、判定相手のいるタイプだけ次の判定で入れ直す
+    for (Handle handle = 0; handle < entries_.size(); ++handle) {
+        Entry& entry = entries_[handle];
+        if (entry.inUse) {
+            Unlink(handle, entry.cells);
+            entry.cells = CellRange{};
+        }
+    }
+}
+
+CollisionGrid::Handle CollisionGrid::Insert(Collider* collider) {
+    const Handle handle = Allocate(collider);
+    if (handle == kInvalidHandle) {
+        return kInvalidHandle;
+    }
+
+    Entry& entry = entries_[handle];
+    entry.typeIndex = static_cast<uint32_t>(typeEntries_[entry.type].size());
+    typeEntries_[entry.type].push_back(handle);
+
+    // 判定相手のいないタイプはセルに入れない
+    if (layers_.GetRow(entry.type) != 0) {
+        entry.cells = CaptureShape(entry);
+        Link(handle, entry.cells);
+    }
+    return handle;
+}
+
+CollisionGrid::Handle CollisionGrid::InsertQueryOnly(Collider* collider) {
+    const Handle handle = Allocate(collider);
+    if (handle == kInvalidHandle) {
+        return kInvalidHandle;
+    }
+
+    Entry& entry = entries_[handle];
+    entry.queryOnly = true;
+    entry.typeIndex = static_cast<uint32_t>(queryOnlyEntries_.size());
+    queryOnlyEntries_.push_back(handle);
+    return handle;
+}
+
+CollisionGrid::Handle CollisionGrid::Allocate(Collider* collider) {
+    if (!collider || collider->GetTypeID() >= kCollisionTypeCount) {
+        return kInvalidHandle;
+    }
+
+    Shape shape;
+    if (dynamic_cast<SphereCollider*>(collider)) {
+        shape = Shape::Sphere;
+    }
+    else if (dynamic_cast<OBBCollider*>(collider)) {
+        shape = Shape::OBB;
+    }
+    else {
+        return kInvalidHandle;
+    }
+
+    Handle handle;
+    if (!freeHandles_.empty()) {
+        handle = freeHandles_.back();
+        freeHandles_.pop_back();
+    }
+    else {
+        handle = static_cast<Handle>(entries_.size());
+        entries_.emplace_back();
+    }
+
+    Entry& entry = entries_[handle];
+    entry.collider = collider;
+    entry.sequence = nextSequence_++;
+    entry.type = collider->GetTypeID();
+    entry.shape = shape;
+    entry.inUse = true;
+
+    ++stats_.colliderCount;
+    return handle;
+}
+
+void CollisionGrid::Remove(Handle handle) {
+    if (handle >= entries_.size() || !entries_[handle].inUse) {
+        return;
+    }
+
+    Entry& entry = entries_[handle];
+    Unlink(handle, entry.cells);
+
+    // タイプごと（クエリ専用は専用）の一覧からは末尾と入れ替えて外す
+    std::vector<Handle>& handles = entry.queryOnly ? queryOnlyEntries_ : typeEntries_[entry.type];
+    const Handle last = handles.back();
+    handles[entry.typeIndex] = last;
+    entries_[last].typeIndex = entry.typeIndex;
+    handles.pop_back();
+
+    // 次の判定でExitを通知しないよう、接触の状態からも外す
+    contacts_.Forget(entry.sequence);
+
+    entry = Entry{};
+    freeHandles_.push_back(handle);
+    --stats_.colliderCount;
+}
+
+void CollisionGrid::CheckAllCollisions() {
+    stats_.movedCount = 0;
+    stats_.bruteForcePairs = 0;
+    stats_.testedPairs = 0;
+    stats_.batchCalls = 0;
+    stats_.batchedPairs = 0;
+
+    // 判定相手のいるタイプのうち、動いたコライダーだけセルを入れ替える
+    for (uint32_t type = 0; type < kCollisionTypeCount; ++type) {
+        if (layers_.GetRow(type) == 0) {
+            continue;
+        }
+        for (Handle handle : typeEntries_[type]) {
+            Entry& entry = entries_[handle];
+            const CellRange cells = CaptureShape(entry);
+            if (cells != entry.cells) {
+                Unlink(handle, entry.cells);
+                Link(handle, cells);
+                entry.cells = cells;
+                ++stats_.movedCount;
+            }
+        }
+    }
+
+    // 許可された組み合わせごとに、数の少ない方のタイプのセルから相手のタイプを探す
+    currentPairs_.clear();
+    for (const CollisionLayerMatrix::TypePair& layerPair : layers_.GetPairs()) {
+        const uint32_t typeA = layerPair.typeA;
+        const uint32_t typeB = layerPair.typeB;
+
+        const size_t countA = typeEntries_[typeA].size();
+        const size_t countB = typeEntries_[typeB].size();
+        stats_.bruteForcePairs += typeA == typeB ? countA * (countA > 0 ? countA - 1 : 0) / 2 : countA * countB;
+
+        const uint32_t outerType = countA <= countB ? typeA : typeB;
+        const uint32_t innerType = outerType == typeA ? typeB : typeA;
+        for (Handle outer : typeEntries_[outerType]) {
+            const Entry& a = entries_[outer];
+            if (!a.collider->IsActive()) {
+                continue;
+            }
+            sphereBatch_.Clear();
+            for (int32_t z = a.cells.minZ; z <= a.cells.maxZ; ++z) {
+                for (int32_t x = a.cells.minX; x <= a.cells.maxX; ++x) {
+                    for (Handle inner : buckets_[BucketIndex(x, z, innerType)]) {
+                        const Entry& b = entries_[inner];
+                        // 同じタイプ同士は片方向だけ、複数のセルで重なる組み合わせは範囲の重なりの最小のセルでだけ調べる
+                        if (inner == outer || (typeA == typeB && b.sequence < a.sequence) || !b.collider->IsActive()) {
+                            continue;
+                        }
+                        if (x != (std::max)(a.cells.minX, b.cells.minX) || z != (std::max)(a.cells.minZ, b.cells.minZ)) {
+                            continue;
+                        }
+
+                        ++stats_.testedPairs;
+
+                        // OBBと球は集めておき、OBB1つにつき1回でまとめて判定する
+                        if (a.shape == Shape::OBB && b.shape == Shape::Sphere) {
+                            sphereBatch_.Add(inner, b.box.center, b.radius);
+                            continue;
+                        }
+                        if (!Intersects(a, b)) {
+                            continue;
+                        }
+                        currentPairs_.push_back(MakePair(outer, inner));
+                    }
+                }
+            }
+
+            if (!sphereBatch_.handles.empty()) {
+                const size_t count = sphereBatch_.handles.size();
+                sphereBatch_.hitMask.resize(NarrowphaseBatch::GetMaskWordCount(count));
+                const NarrowphaseBatch::SphereArrays spheres{
+                    sphereBatch_.x.data(), sphereBatch_.y.data(), sphereBatch_.z.data(), sphereBatch_.radius.data(), count };
+                NarrowphaseBatch::SphereOBB(a.box, spheres, sphereBatch_.hitMask.data());
+                for (size_t i = 0; i < count; ++i) {
+                    if (sphereBatch_.hitMask[i / 32] & (1u << (i % 32))) {
+                        currentPairs_.push_back(MakePair(outer, sphereBatch_.handles[i]));
+                    }
+                }
+                ++stats_.batchCalls;
+                stats_.batchedPairs += count;
+            }
+        }
+    }
+    std::sort(currentPairs_.begin(), currentPairs_.end());
+    stats_.hitPairs = currentPairs_.size();
+    stats_.totalTestedPairs += stats_.testedPairs;
+    stats_.totalHitPairs += stats_.hitPairs;
+
+    // 接触の状態を更新し、できたイベントの順にコライダーへ通知する
+    contacts_.Update(currentPairs_);
+    for (const ContactEvent& event : contacts_.GetEvents()) {
+        switch (event.type) {
+        case ContactEventType::Enter:
+            event.first->OnCollisionEnter(event.second);
+            event.second->OnCollisionEnter(event.first);
+            break;
+        case ContactEventType::Stay:
+            event.first->OnCollisionStay(event.second);
+            event.second->OnCollisionStay(event.first);
+            break;
+        case ContactEventType::Exit:
+            event.first->OnCollisionExit(event.second);
+            event.second->OnCollisionExit(event.first);
+            break;
+        }
+    }
+}
+
+bool CollisionGrid::RegisterHit(Handle attacker, const Collider* target) {
+    if (attacker >= entries_.size() || !entries_[attacker].inUse || !target || target->GetTypeID() >= kCollisionTypeCount) {
+        return true;
+    }
+    for (Handle handle : typeEntries_[target->GetTypeID()]) {
+        if (entries_[handle].collider == target) {
+            const ContactPair pair = MakePair(attacker, handle);
+            return contacts_.RegisterHit(pair, pair.firstSlot == attacker);
+        }
+    }
+    return true;
+}
+
+void CollisionGrid::ResetHits(Handle handle) {
+    if (handle < entries_.size() && entries_[handle].inUse) {
+        contacts_.ResetHits(handle);
+    }
+}
+
+size_t CollisionGrid::QueryOverlapSphere(const Vector3& center, float radius, uint32_t typeMask, std::vector<Collider*>& out) {
+    out.clear();
+    GatherCandidates(center, radius, typeMask);
+
+    Entry probe;
+    probe.shape = Shape::Sphere;
+    probe.box.center = center;
+    probe.radius = radius;
+    for (const Entry& candidate : queryCandidates_) {
+        if (Intersects(probe, candidate)) {
+            out.push_back(candidate.collider);
+        }
+    }
+    return out.size();
+}
+
+size_t CollisionGrid::QueryOverlapCone(const Vector3& origin, const Vector3& forward, float halfAngle, float range,
+    uint32_t typeMask, std::vector<Collider*>& out) {
+    out.clear();
+    GatherCandidates(origin, range, typeMask);
+
+    const float cosHalf = std::cos(halfAngle);
+    const float sinHalf = std::sin(halfAngle);
+    for (const Entry& candidate : queryCandidates_) {
+        const float radius = BoundingRadius(candidate);
+        const Vector3 toCenter = candidate.box.center - origin;
+        const float distance = std::sqrt(toCenter.Dot(toCenter));
+        if (distance - radius > range) {
+            continue;
+        }
+        if (distance > radius) {
+            // 向きとのなす角が扇の外なら、扇のふちまでの距離が半径以内かを見る（90度以上後ろは外れ）
+            const float cosAngle = toCenter.Dot(forward) / distance;
+            if (cosAngle < cosHalf) {
+                const float sinAngle = std::sqrt((std::max)(0.0f, 1.0f - cosAngle * cosAngle));
+                const float cosOutside = cosAngle * cosHalf + sinAngle * sinHalf;
+                const float sinOutside = sinAngle * cosHalf - cosAngle * sinHalf;
+                if (cosOutside <= 0.0f || distance * sinOutside > radius) {
+                    continue;
+                }
+            }
+        }
+        out.push_back(candidate.collider);
+    }
+    return out.size();
+}
+
+Collider* CollisionGrid::QueryNearest(const Vector3& center, float maxDistance, uint32_t typeMask) {
+    GatherCandidates(center, maxDistance, typeMask);
+
+    Collider* nearest = nullptr;
+    float nearestDistance = maxDistance;
+    for (const Entry& candidate : queryCandidates_) {
+        // 候補は登録順なので、同じ距離なら先のものが残る
+        const float distance = DistanceToSurface(candidate, center);
+        if (distance > maxDistance || (nearest && distance >= nearestDistance)) {
+            continue;
+        }
+        nearest = candidate.collider;
+        nearestDistance = distance;
+    }
+    return nearest;
+}
+
+void CollisionGrid::ResetStats() {
+    stats_.totalTestedPairs = 0;
+    stats_.totalHitPairs = 0;
+    stats_.totalQueries = 0;
+    stats_.totalQueryCandidates = 0;
+    contacts_.ResetStats();
+}
+
+CollisionGrid::CellRange CollisionGrid::CaptureShape(Entry& entry) const {
+    const Vector3& center = entry.box.center;
+    float extentX;
+    float extentZ;
+    if (entry.shape == Shape::Sphere) {
+        const auto* sphere = static_cast<const SphereCollider*>(entry.collider);
+        entry.box.center = sphere->GetCenter();
+        entry.radius = sphere->GetRadius();
+        extentX = entry.radius;
+        extentZ = extentX;
+    }
+    else {
+        // OBBを囲むAABBのXZの大きさ
+        entry.box = MakeBox(*static_cast<const OBBCollider*>(entry.collider));
+        extentX = 0.0f;
+        extentZ = 0.0f;
+        for (int i = 0; i < 3; ++i) {
+            extentX += std::abs(entry.box.axes[i].x) * entry.box.halfExtents[i];
+            extentZ += std::abs(entry.box.axes[i].z) * entry.box.halfExtents[i];
+        }
+    }
+
+    return ToCellRange(center.x - extentX, center.x + extentX, center.z - extentZ, center.z + extentZ);
+}
+
+CollisionGrid::CellRange CollisionGrid::ToCellRange(float minX, float maxX, float minZ, float maxZ) const {
+    // 範囲外はふちのセルにまとめる
+    auto toCell = [this](float value, float origin, int32_t count) {
+        const float cell = std::floor((value - origin) * inverseCellSize_);
+        return static_cast<int32_t>(std::clamp(cell, 0.0f, static_cast<float>(count - 1)));
+    };
+    CellRange cells;
+    cells.minX = toCell(minX, minX_, columns_);
+    cells.maxX = toCell(maxX, minX_, columns_);
+    cells.minZ = toCell(minZ, minZ_, rows_);
+    cells.maxZ = toCell(maxZ, minZ_, rows_);
+    return cells;
+}
+
+void CollisionGrid::GatherCandidates(const Vector3& center, float extent, uint32_t typeMask) {
+    queryCandidates_.clear();
+    ++queryStamp_;
+    ++stats_.totalQueries;
+
+    auto addCandidate = [this](Handle handle) {
+        Entry& entry = entries_[handle];
+        if (entry.queryStamp == queryStamp_ || !entry.collider->IsActive()) {
+            return;
+        }
+        entry.queryStamp = queryStamp_;
+        queryCandidates_.push_back(entry);
+        CaptureShape(queryCandidates_.back());
+    };
+
+    // セルは直前の判定の時の位置なので、その後セル1つ分まで動いたものも拾えるよう1セル広げて探す
+    const float margin = extent + 1.0f / inverseCellSize_;
+    const CellRange cells = ToCellRange(center.x - margin, center.x + margin, center.z - margin, center.z + margin);
+    for (uint32_t type = 0; type < kCollisionTypeCount; ++type) {
+        if ((typeMask >> type & 1u) == 0) {
+            continue;
+        }
+        // 判定相手のいないタイプはセルに入っていないので全て調べる
+        if (layers_.GetRow(type) == 0) {
+            for (Handle handle : typeEntries_[type]) {
+                addCandidate(handle);
+            }
+            continue;
+        }
+        for (int32_t z = cells.minZ; z <= cells.maxZ; ++z) {
+            for (int32_t x = cells.minX; x <= cells.maxX; ++x) {
+                for (Handle handle : buckets_[BucketIndex(x, z, type)]) {
+                    addCandidate(handle);
+                }
+            }
+        }
+    }
+
+    // クエリ専用の登録は数が少ないので全て調べる
+    for (Handle handle : queryOnlyEntries_) {
+        if (typeMask >> entries_[handle].type & 1u) {
+            addCandidate(handle);
+        }
+    }
+
+    // セルの並びに依存しないよう登録順にする
+    std::sort(queryCandidates_.begin(), queryCandidates_.end(),
+        [](const Entry& a, const Entry& b) { return a.sequence < b.sequence; });
+    stats_.totalQueryCandidates += queryCandidates_.size();
+}
+
+void CollisionGrid::Link(Handle handle, const CellRange& cells) {
+    const uint32_t type = entries_[handle].type;
+    for (int32_t z = cells.minZ; z <= cells.maxZ; ++z) {
+        for (int32_t x = cells.minX; x <= cells.maxX; ++x) {
+            buckets_[BucketIndex(x, z, type)].push_back(handle);
+        }
+    }
+}
+
+void CollisionGrid::Unlink(Handle handle, const CellRange& cells) {
+    const uint32_t type = entries_[handle].type;
+    for (int32_t z = cells.minZ; z <= cells.maxZ; ++z) {
+        for (int32_t x = cells.minX; x <= cells.maxX; ++x) {
+            std::vector<Handle>& bucket = buckets_[BucketIndex(x, z, type)];
+            auto it = std::find(bucket.begin(), bucket.end(), handle);
+            if (it != bucket.end()) {
+                *it = bucket.back();
+                bucket.pop_back();
+            }
+        }
+    }
+}
+
+ContactPair CollisionGrid::MakePair(Handle a, Handle b) const {
+    if (entries_[b].sequence < entries_[a].sequence) {
+        std::swap(a, b);
+    }
+    return { entries_[a].collider, entries_[b].collider, entries_[a].sequence, entries_[b].sequence, a, b };
+}
+
+float CollisionGrid::BoundingRadius(const Entry& entry) {
+    if (entry.shape == Shape::Sphere) {
+        return entry.radius;
+    }
+    const float* half = entry.box.halfExtents;
+    return std::sqrt(half[0] * half[0] + half[1] * half[1] + half[2] * half[2]);
+}
+
+float CollisionGrid::DistanceToSurface(const Entry& entry, const Vector3& point) {
+    const Vector3 diff = point - entry.box.center;
+    if (entry.shape == Shape::Sphere) {
+        return (std::max)(0.0f, std::sqrt(diff.Dot(diff)) - entry.radius);
+    }
+    // OBBのローカル空間で各軸のはみ出した分から最近接点までの距離を求める
+    float distanceSq = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        const float excess = std::abs(diff.Dot(entry.box.axes[i])) - entry.box.halfExtents[i];
+        if (excess > 0.0f) {
+            distanceSq += excess * excess;
+        }
+    }
+    return std::sqrt(distanceSq);
+}
+
+bool CollisionGrid::Intersects(const Entry& a, const Entry& b) {
+    if (a.shape == Shape::Sphere && b.shape == Shape::Sphere) {
+        return SphereSphere(a.box.center, a.radius, b.box.center, b.radius);
+    }
+    if (a.shape == Shape::Sphere) {
+        return NarrowphaseBatch::SphereOBB(b.box, a.box.center, a.radius);
+    }
+    if (b.shape == Shape::Sphere) {
+        return NarrowphaseBatch::SphereOBB(a.box, b.box.center, b.radius);
+    }
+    return BoxBox(a.box, b.box);
+}
@@ -0,0 +1,338 @@
+#pragma once
+#include "CollisionLayerMatrix.h"
+#include "CollisionTypeIdDef.h"
+#include "ContactCache.h"
+#include "NarrowphaseBatch.h"
+#include "Vector3.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class Collider;
+
+/// <summary>
+/// 弾のコライダー用の一様グリッド（XZ平面）
+/// CollisionManagerは登録された全ての組み合わせを総当たりで調べるため、弾の数が増えるほど判定の数が増える
+/// 弾とその相手（プレイヤー・ボスの本体）はこちらに登録し、判定表で許可したタイプの両方が入っているセルでだけ形状を判定する
+/// 判定表で相手のいないタイプはセルに入れず、組み合わせの走査も許可された組み合わせの一覧だけを回す
+/// セルはタイプごとに分けて持ち、登録・移動はセルが変わった時だけ入れ替える（毎フレームの作り直しはしない）
+/// 重なりの状態はContactCacheで持ち、イベントの配列として取り出せる（コライダーへの通知もこの配列から行う）
+/// 通知（Enter/Stay/Exit）の内容と順序はCollisionManagerと同じ（登録順の組み合わせ順）
+/// 判定するコライダーは球とOBBのみ（OBBと球の組み合わせはOBBごとに集めてNarrowphaseBatchでまとめて判定する）
+/// 判定とは別に、球・扇形・最寄りのクエリをその場で行える（セルで候補を絞り、候補は今の位置・形状で判定する）
+/// CollisionManagerで判定するコライダー（ボスの近接攻撃など）もクエリでだけ見つかるよう登録できる
+/// </summary>
+class CollisionGrid {
+public:
+    /// <summary>
+    /// 登録のハンドル
+    /// </summary>
+    using Handle = uint32_t;
+
+    /// <summary>
+    /// 無効なハンドル
+    /// </summary>
+    static constexpr Handle kInvalidHandle = UINT32_MAX;
+
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t cellCount = 0;          // セルの数
+        size_t colliderCount = 0;      // 登録中のコライダーの数
+        size_t movedCount = 0;         // 直前の判定でセルを移ったコライダーの数
+        size_t bruteForcePairs = 0;    // 直前の判定で総当たりなら調べる組み合わせの数
+        size_t testedPairs = 0;        // 直前の判定で形状を判定した組み合わせの数
+        size_t hitPairs = 0;           // 直前の判定で重なっていた組み合わせの数
+        size_t batchCalls = 0;         // 直前の判定でOBBと球をまとめて判定した回数
+        size_t batchedPairs = 0;       // 直前の判定でまとめて判定した組み合わせの数（testedPairsの内数）
+        uint64_t totalTestedPairs = 0; // 形状を判定した組み合わせの累計
+        uint64_t totalHitPairs = 0;    // 重なっていた組み合わせの累計
+        uint64_t totalQueries = 0;     // クエリの累計
+        uint64_t totalQueryCandidates = 0; // クエリで形状を調べたコライダーの累計
+    };
+
+    /// <summary>
+    /// クエリで対象にするタイプのビット（複数のタイプは|でまとめる）
+    /// </summary>
+    static constexpr uint32_t TypeBit(CollisionTypeId type) {
+        return 1u << static_cast<uint32_t>(type);
+    }
+
+    /// <summary>
+    /// 初期化（登録・衝突状態・判定表を全て破棄）
+    /// </summary>
+    /// <param name="min">範囲の最小（Yは使わない）</param>
+    /// <param name="max">範囲の最大（Yは使わない）</param>
+    /// <param name="cellSize">セルの一辺の長さ</param>
+    void Initialize(const Vector3& min, const Vector3& max, float cellSize);
+
+    /// <summary>
+    /// 登録と衝突状態の破棄（判定表・セルの領域は残す）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// タイプの組み合わせごとの判定表を設定（登録済みのコライダーは次の判定でセルを入れ直す）
+    /// </summary>
+    /// <param name="layers">判定表（シーンで static constexpr に宣言したもの）</param>
+    void SetLayerMatrix(const CollisionLayerMatrix& layers);
+
+    /// <summary>
+    /// コライダーの登録（タイプと形状は登録時の値を使う）
+    /// </summary>
+    /// <param name="collider">コライダー（球またはOBB）</param>
+    /// <returns>ハンドル（タイプ・形状が対象外ならkInvalidHandle）</returns>
+    Handle Insert(Collider* collider);
+
+    /// <summary>
+    /// クエリでだけ見つかるコライダーの登録（判定・通知・ヒットの記録には使わない）
+    /// 判定は別の場所（CollisionManager）で行うコライダーを、パリィなどのクエリの対象にするために使う
+    /// </summary>
+    /// <param name="collider">コライダー（球またはOBB）</param>
+    /// <returns>ハンドル（タイプ・形状が対象外ならkInvalidHandle、解除はRemoveで行う）</returns>
+    Handle InsertQueryOnly(Collider* collider);
+
+    /// <summary>
+    /// 登録の解除（解除したコライダーへExitは通知しない）
+    /// </summary>
+    /// <param name="handle">ハンドル（kInvalidHandleなら何もしない）</param>
+    void Remove(Handle handle);
+
+    /// <summary>
+    /// 登録中のコライダーの位置からセルを更新し、判定と通知を行う
+    /// </summary>
+    void CheckAllCollisions();
+
+    /// <summary>
+    /// 直前の判定の接触イベント（コライダーへ通知した順）
+    /// </summary>
+    std::span<const ContactEvent> GetContactEvents() const { return contacts_.GetEvents(); }
+
+    /// <summary>
+    /// 攻撃側から相手へのヒットを記録（攻撃側の今の世代で同じ相手へ2回目ならfalse）
+    /// 相手がグリッドに登録されていない場合は記録せずtrueを返す
+    /// </summary>
+    /// <param name="attacker">攻撃側のハンドル</param>
+    /// <param name="target">相手のコライダー</param>
+    /// <returns>ヒットとして扱ってよい場合true</returns>
+    bool RegisterHit(Handle attacker, const Collider* target);
+
+    /// <summary>
+    /// 攻撃側として記録したヒットを全て無効にする（同じ相手へ再びヒットできるようになる）
+    /// </summary>
+    /// <param name="handle">ハンドル</param>
+    void ResetHits(Handle handle);
+
+    /// <summary>
+    /// 球と重なっているコライダーを集める（有効なものだけ、登録順）
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <param name="typeMask">対象のタイプ（TypeBitの組み合わせ）</param>
+    /// <param name="out">結果（先に空にする）</param>
+    /// <returns>見つかった数</returns>
+    size_t QueryOverlapSphere(const Vector3& center, float radius, uint32_t typeMask, std::vector<Collider*>& out);
+
+    /// <summary>
+    /// 扇形（円錐）と重なっているコライダーを集める（有効なものだけ、登録順）
+    /// コライダーは形状を囲む球で判定する
+    /// </summary>
+    /// <param name="origin">頂点</param>
+    /// <param name="forward">向き（正規化済み）</param>
+    /// <param name="halfAngle">向きからの角度の上限（ラジアン）</param>
+    /// <param name="range">頂点からの距離の上限</param>
+    /// <param name="typeMask">対象のタイプ（TypeBitの組み合わせ）</param>
+    /// <param name="out">結果（先に空にする）</param>
+    /// <returns>見つかった数</returns>
+    size_t QueryOverlapCone(const Vector3& origin, const Vector3& forward, float halfAngle, float range,
+        uint32_t typeMask, std::vector<Collider*>& out);
+
+    /// <summary>
+    /// 形状の表面までの距離が最も近いコライダー（有効なものだけ、同じ距離なら登録順で先のもの）
+    /// </summary>
+    /// <param name="center">基準の位置</param>
+    /// <param name="maxDistance">探す距離の上限</param>
+    /// <param name="typeMask">対象のタイプ（TypeBitの組み合わせ）</param>
+    /// <returns>コライダー（見つからなければnullptr）</returns>
+    Collider* QueryNearest(const Vector3& center, float maxDistance, uint32_t typeMask);
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 接触の状態の使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const ContactCache::Stats& GetContactStats() const { return contacts_.GetStats(); }
+
+    /// <summary>
+    /// 使用状況の累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// 形状
+    /// </summary>
+    enum class Shape : uint8_t {
+        Sphere,
+        OBB,
+    };
+
+    /// <summary>
+    /// セルの範囲（両端を含む）
+    /// </summary>
+    struct CellRange {
+        int32_t minX = 0;
+        int32_t minZ = 0;
+        int32_t maxX = -1;
+        int32_t maxZ = -1;
+
+        bool operator==(const CellRange&) const = default;
+    };
+
+    /// <summary>
+    /// 登録1件
+    /// </summary>
+    struct Entry {
+        Collider* collider = nullptr;
+        uint64_t sequence = 0;  // 登録順（組み合わせと通知の順に使う）
+        uint32_t type = 0;      // タイプID
+        uint32_t typeIndex = 0; // タイプごとの一覧での位置（クエリ専用はqueryOnlyEntries_での位置）
+        Shape shape = Shape::Sphere;
+        CellRange cells;        // 入っているセルの範囲
+        NarrowphaseBatch::OBBShape box; // 判定に使う形状（セルの更新時に控える、球は中心のみ）
+        float radius = 0.0f;    // 球の半径（セルの更新時に控える）
+        uint32_t queryStamp = 0; // 最後に候補にしたクエリの番号（複数のセルに入っているものを1回だけ調べる）
+        bool inUse = false;
+        bool queryOnly = false; // クエリでだけ見つかる登録（セル・タイプごとの一覧には入れない）
+    };
+
+    /// <summary>
+    /// OBB1つと判定する球を集める作業領域（SoA）
+    /// </summary>
+    struct SphereBatch {
+        std::vector<Handle> handles;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+        std::vector<float> radius;
+        std::vector<uint32_t> hitMask;
+
+        void Clear() {
+            handles.clear();
+            x.clear();
+            y.clear();
+            z.clear();
+            radius.clear();
+        }
+
+        void Add(Handle handle, const Vector3& center, float sphereRadius) {
+            handles.push_back(handle);
+            x.push_back(center.x);
+            y.push_back(center.y);
+            z.push_back(center.z);
+            radius.push_back(sphereRadius);
+        }
+    };
+
+    /// <summary>
+    /// コライダーの現在の形状を控え、入るセルの範囲を返す
+    /// </summary>
+    CellRange CaptureShape(Entry& entry) const;
+
+    /// <summary>
+    /// XZの範囲が入るセルの範囲（範囲外はふちのセルにまとめる）
+    /// </summary>
+    CellRange ToCellRange(float minX, float maxX, float minZ, float maxZ) const;
+
+    /// <summary>
+    /// 登録の共通部分（ハンドルの確保と形状の判別）
+    /// </summary>
+    Handle Allocate(Collider* collider);
+
+    /// <summary>
+    /// クエリの候補を集める（位置から距離extentまでのセルにいるもの、セルに入れないタイプとクエリ専用は全て）
+    /// 候補は今の形状を控えてqueryCandidates_へ入れる
+    /// </summary>
+    void GatherCandidates(const Vector3& center, float extent, uint32_t typeMask);
+
+    /// <summary>
+    /// セルの範囲へ出し入れ
+    /// </summary>
+    void Link(Handle handle, const CellRange& cells);
+    void Unlink(Handle handle, const CellRange& cells);
+
+    /// <summary>
+    /// セルとタイプから一覧の位置
+    /// </summary>
+    size_t BucketIndex(int32_t x, int32_t z, uint32_t type) const {
+        return (static_cast<size_t>(z) * columns_ + static_cast<size_t>(x)) * kCollisionTypeCount + type;
+    }
+
+    /// <summary>
+    /// 2つの登録の組み合わせ（登録順に並べる）
+    /// </summary>
+    ContactPair MakePair(Handle a, Handle b) const;
+
+    /// <summary>
+    /// 2つの登録の形状が重なっているか
+    /// </summary>
+    static bool Intersects(const Entry& a, const Entry& b);
+
+    /// <summary>
+    /// 登録の形状を囲む球の半径
+    /// </summary>
+    static float BoundingRadius(const Entry& entry);
+
+    /// <summary>
+    /// 位置から登録の形状の表面までの距離（内側なら0）
+    /// </summary>
+    static float DistanceToSurface(const Entry& entry, const Vector3& point);
+
+    // 範囲とセル
+    float minX_ = 0.0f;
+    float minZ_ = 0.0f;
+    float inverseCellSize_ = 1.0f;
+    int32_t columns_ = 0;
+    int32_t rows_ = 0;
+
+    // セル×タイプごとの登録（ハンドルの配列）
+    std::vector<std::vector<Handle>> buckets_;
+
+    // 登録（ハンドルが添字）と空きのハンドル
+    std::vector<Entry> entries_;
+    std::vector<Handle> freeHandles_;
+    uint64_t nextSequence_ = 0;
+
+    // タイプごとの登録中のハンドル
+    std::array<std::vector<Handle>, kCollisionTypeCount> typeEntries_;
+
+    // クエリ専用の登録中のハンドル（数が少ないのでセルに入れず全て調べる）
+    std::vector<Handle> queryOnlyEntries_;
+
+    // タイプの組み合わせごとの判定表
+    CollisionLayerMatrix layers_;
+
+    // OBBとまとめて判定する球の作業領域
+    SphereBatch sphereBatch_;
+
+    // クエリの候補（今の形状を控えた登録の写し）とクエリの番号
+    std::vector<Entry> queryCandidates_;
+    uint32_t queryStamp_ = 0;
+
+    // 今フレームの重なっている組み合わせ（登録順に並べる）
+    std::vector<ContactPair> currentPairs_;
+
+    // 組み合わせごとの接触の状態
+    ContactCache contacts_;
+
+    // 使用状況
+    Stats stats_;
+};
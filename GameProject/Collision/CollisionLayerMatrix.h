@@ -0,0 +1,93 @@
+#pragma once
+#include "CollisionTypeIdDef.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+
+/// <summary>
+/// 衝突判定を行うタイプの組み合わせ（順不同）
+/// </summary>
+struct CollisionLayerPair {
+    CollisionTypeId a = CollisionTypeId::DEFAULT;
+    CollisionTypeId b = CollisionTypeId::DEFAULT;
+};
+
+/// <summary>
+/// タイプの組み合わせごとの判定可否の表（コンパイル時に作る）
+/// シーンごとに static constexpr で組み合わせを並べて宣言し、タイプごとのビットマスクと許可された組み合わせの一覧をコンパイル時に作る
+/// 判定側は一覧だけを回せばよく、許可されていない組み合わせはタイプ単位でまとめて飛ばせる
+/// 一覧はタイプIDの小さい方、大きい方の順に並ぶ（宣言の順や重複には依存しない）
+/// </summary>
+class CollisionLayerMatrix {
+public:
+    static_assert(kCollisionTypeCount <= 32, "タイプごとのビットマスクはuint32_tに収まる数まで");
+
+    /// <summary>
+    /// 組み合わせの最大数（同じタイプ同士を含む）
+    /// </summary>
+    static constexpr size_t kMaxPairCount = kCollisionTypeCount * (kCollisionTypeCount + 1) / 2;
+
+    /// <summary>
+    /// 許可された組み合わせ（typeA <= typeB）
+    /// </summary>
+    struct TypePair {
+        uint32_t typeA = 0;
+        uint32_t typeB = 0;
+    };
+
+    /// <summary>
+    /// 全ての組み合わせを判定しない表
+    /// </summary>
+    constexpr CollisionLayerMatrix() = default;
+
+    /// <summary>
+    /// 組み合わせの一覧から作る（範囲外のタイプはコンパイルエラーになる）
+    /// </summary>
+    /// <param name="pairs">判定を行う組み合わせ</param>
+    constexpr CollisionLayerMatrix(std::initializer_list<CollisionLayerPair> pairs) {
+        for (const CollisionLayerPair& pair : pairs) {
+            const uint32_t a = static_cast<uint32_t>(pair.a);
+            const uint32_t b = static_cast<uint32_t>(pair.b);
+            rows_[a] |= 1u << b;
+            rows_[b] |= 1u << a;
+        }
+        for (uint32_t a = 0; a < kCollisionTypeCount; ++a) {
+            for (uint32_t b = a; b < kCollisionTypeCount; ++b) {
+                if (Test(a, b)) {
+                    pairs_[pairCount_++] = TypePair{ a, b };
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// 2つのタイプが判定を行う組み合わせか
+    /// </summary>
+    constexpr bool Test(uint32_t typeA, uint32_t typeB) const {
+        return typeA < kCollisionTypeCount && typeB < kCollisionTypeCount && (rows_[typeA] >> typeB & 1u) != 0;
+    }
+
+    /// <summary>
+    /// タイプの判定相手のビットマスク（0ならどのタイプとも判定しない）
+    /// </summary>
+    constexpr uint32_t GetRow(uint32_t type) const {
+        return type < kCollisionTypeCount ? rows_[type] : 0u;
+    }
+
+    /// <summary>
+    /// 許可された組み合わせの一覧
+    /// </summary>
+    constexpr std::span<const TypePair> GetPairs() const {
+        return std::span<const TypePair>(pairs_.data(), pairCount_);
+    }
+
+private:
+    // タイプごとの判定相手のビットマスク
+    std::array<uint32_t, kCollisionTypeCount> rows_{};
+
+    // 許可された組み合わせ（先頭のpairCount_件）
+    std::array<TypePair, kMaxPairCount> pairs_{};
+    size_t pairCount_ = 0;
+};
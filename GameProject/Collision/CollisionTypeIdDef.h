@@ -12,4 +12,9 @@ enum class CollisionTypeId : uint32_t {
 	BOSS,                   /// 敵キャラクター
 	BOSS_ATTACK,            /// 敵の攻撃
 	ENVIRONMENT,            /// 環境オブジェクト
-};
\ No newline at end of file
+};
+
+/// <summary>
+/// 衝突判定タイプIDの数（タイプごとに領域を持つ処理で使う）
+/// </summary>
+inline constexpr uint32_t kCollisionTypeCount = static_cast<uint32_t>(CollisionTypeId::ENVIRONMENT) + 1;
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "ContactCache.h"
+#include <algorithm>
+
+void ContactCache::Clear() {
+    contacts_.clear();
+    scratch_.clear();
+    generations_.clear();
+    events_.clear();
+    exits_.clear();
+    frame_ = 1;
+    stats_.contactCount = 0;
+    stats_.enterCount = 0;
+    stats_.stayCount = 0;
+    stats_.exitCount = 0;
+}
+
+void ContactCache::Update(std::span<const ContactPair> pairs) {
+    ++frame_;
+    events_.clear();
+    exits_.clear();
+    scratch_.clear();
+    stats_.enterCount = 0;
+    stats_.stayCount = 0;
+    stats_.exitCount = 0;
+
+    // 表と今フレームの組み合わせはどちらもキーの順なので、1回の走査で突き合わせる
+    const uint32_t previousFrame = frame_ - 1;
+    size_t contactIndex = 0;
+    size_t pairIndex = 0;
+    while (contactIndex < contacts_.size() || pairIndex < pairs.size()) {
+        const bool hasContact = contactIndex < contacts_.size();
+        const bool hasPair = pairIndex < pairs.size();
+
+        // 表にだけある：前フレームに重なっていればExit
+        if (!hasPair || (hasContact && contacts_[contactIndex].pair < pairs[pairIndex])) {
+            const Contact& contact = contacts_[contactIndex++];
+            if (contact.lastFrame == previousFrame) {
+                exits_.push_back({ ContactEventType::Exit, contact.pair.first, contact.pair.second });
+                ++stats_.exitCount;
+            }
+            if (HasLiveHit(contact)) {
+                scratch_.push_back(contact);
+            }
+            continue;
+        }
+
+        // 今フレームにだけある：Enter
+        if (!hasContact || pairs[pairIndex] < contacts_[contactIndex].pair) {
+            Contact contact;
+            contact.pair = pairs[pairIndex++];
+            contact.lastFrame = frame_;
+            events_.push_back({ ContactEventType::Enter, contact.pair.first, contact.pair.second });
+            ++stats_.enterCount;
+            scratch_.push_back(contact);
+            continue;
+        }
+
+        // 両方にある：前フレームにも重なっていればStay（ヒットの記録だけ残っていた組み合わせはEnter）
+        Contact contact = contacts_[contactIndex++];
+        contact.pair = pairs[pairIndex++];
+        if (contact.lastFrame == previousFrame) {
+            events_.push_back({ ContactEventType::Stay, contact.pair.first, contact.pair.second });
+            ++stats_.stayCount;
+        }
+        else {
+            events_.push_back({ ContactEventType::Enter, contact.pair.first, contact.pair.second });
+            ++stats_.enterCount;
+        }
+        contact.lastFrame = frame_;
+        scratch_.push_back(contact);
+    }
+
+    std::swap(contacts_, scratch_);
+    events_.insert(events_.end(), exits_.begin(), exits_.end());
+    stats_.contactCount = contacts_.size();
+    stats_.totalEnterCount += stats_.enterCount;
+}
+
+bool ContactCache::RegisterHit(const ContactPair& pair, bool attackerIsFirst) {
+    auto it = std::lower_bound(contacts_.begin(), contacts_.end(), pair,
+        [](const Contact& contact, const ContactPair& key) { return contact.pair < key; });
+    if (it == contacts_.end() || pair < it->pair) {
+        Contact contact;
+        contact.pair = pair;
+        it = contacts_.insert(it, contact);
+        stats_.contactCount = contacts_.size();
+    }
+
+    const int side = attackerIsFirst ? 0 : 1;
+    const uint32_t generation = GetGeneration(attackerIsFirst ? pair.firstSlot : pair.secondSlot);
+    if (it->hitGeneration[side] == generation) {
+        ++stats_.suppressedCount;
+        return false;
+    }
+    it->hitGeneration[side] = generation;
+    ++stats_.hitCount;
+    return true;
+}
+
+void ContactCache::ResetHits(uint32_t slot) {
+    GetGeneration(slot);
+    ++generations_[slot];
+}
+
+void ContactCache::Forget(uint64_t key) {
+    std::erase_if(contacts_, [key](const Contact& contact) {
+        return contact.pair.firstKey == key || contact.pair.secondKey == key;
+    });
+    stats_.contactCount = contacts_.size();
+}
+
+void ContactCache::ResetStats() {
+    stats_.totalEnterCount = 0;
+    stats_.hitCount = 0;
+    stats_.suppressedCount = 0;
+}
+
+uint32_t ContactCache::GetGeneration(uint32_t slot) {
+    if (slot >= generations_.size()) {
+        generations_.resize(static_cast<size_t>(slot) + 1, 1);
+    }
+    return generations_[slot];
+}
+
+bool ContactCache::HasLiveHit(const Contact& contact) {
+    return (contact.hitGeneration[0] != 0 && contact.hitGeneration[0] == GetGeneration(contact.pair.firstSlot))
+        || (contact.hitGeneration[1] != 0 && contact.hitGeneration[1] == GetGeneration(contact.pair.secondSlot));
+}
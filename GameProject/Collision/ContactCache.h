@@ -0,0 +1,150 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class Collider;
+
+/// <summary>
+/// 接触イベントの種類
+/// </summary>
+enum class ContactEventType : uint8_t {
+    Enter,  // このフレームから重なった
+    Stay,   // 前フレームから重なり続けている
+    Exit,   // このフレームで離れた
+};
+
+/// <summary>
+/// 接触イベント（firstが先に登録した方）
+/// </summary>
+struct ContactEvent {
+    ContactEventType type = ContactEventType::Enter;
+    Collider* first = nullptr;
+    Collider* second = nullptr;
+};
+
+/// <summary>
+/// 重なっている組み合わせ（firstが先に登録した方）
+/// キーは登録ごとに変わる通し番号、スロットは登録先での番号（ヒットの世代の添字に使う）
+/// </summary>
+struct ContactPair {
+    Collider* first = nullptr;
+    Collider* second = nullptr;
+    uint64_t firstKey = 0;
+    uint64_t secondKey = 0;
+    uint32_t firstSlot = 0;
+    uint32_t secondSlot = 0;
+
+    bool operator<(const ContactPair& other) const {
+        return firstKey != other.firstKey ? firstKey < other.firstKey : secondKey < other.secondKey;
+    }
+};
+
+/// <summary>
+/// 組み合わせごとの接触状態の表
+/// 最後に重なっていたフレーム番号を組み合わせごとに持ち、前フレームとの比較でEnter/Stay/Exitを決めてイベントの配列にまとめる
+/// 多重ヒットの防止も組み合わせ単位で持つ：ヒットを記録した時の攻撃側の世代を残し、世代が同じ間は再びヒットさせない
+/// 世代はスロットごとの数値で、ResetHitsで1つ進めるだけで過去のヒットが全て無効になる（コライダーごとの集合を持たない）
+/// 組み合わせはキーの順に並べて持つので、イベントの順序は登録順の組み合わせ順になる
+/// </summary>
+class ContactCache {
+public:
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t contactCount = 0;       // 表にある組み合わせの数（離れていてもヒットの記録が有効なものを含む）
+        size_t enterCount = 0;         // 直前の更新のEnterの数
+        size_t stayCount = 0;          // 直前の更新のStayの数
+        size_t exitCount = 0;          // 直前の更新のExitの数
+        uint64_t totalEnterCount = 0;  // Enterの累計
+        uint64_t hitCount = 0;         // 記録したヒットの累計
+        uint64_t suppressedCount = 0;  // 同じ世代で2回目以降のため防いだヒットの累計
+    };
+
+    /// <summary>
+    /// 全ての組み合わせ・世代・イベントの破棄
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// このフレームに重なっている組み合わせで表を更新し、イベントを作る
+    /// </summary>
+    /// <param name="pairs">重なっている組み合わせ（キーの順に並べ、重複させない）</param>
+    void Update(std::span<const ContactPair> pairs);
+
+    /// <summary>
+    /// 直前の更新のイベント（Enter/Stayを組み合わせ順に並べた後にExitを組み合わせ順に並べる）
+    /// </summary>
+    std::span<const ContactEvent> GetEvents() const { return events_; }
+
+    /// <summary>
+    /// ヒットの記録（同じ世代の攻撃側が同じ相手へ2回目ならfalse）
+    /// 重なりを検出していない組み合わせ（連続衝突判定で先に当たった場合など）でも記録できる
+    /// </summary>
+    /// <param name="pair">組み合わせ</param>
+    /// <param name="attackerIsFirst">攻撃側がpair.firstか</param>
+    /// <returns>ヒットとして扱ってよい場合true</returns>
+    bool RegisterHit(const ContactPair& pair, bool attackerIsFirst);
+
+    /// <summary>
+    /// スロットの世代を進め、そのスロットが攻撃側として記録したヒットを全て無効にする
+    /// </summary>
+    /// <param name="slot">スロット</param>
+    void ResetHits(uint32_t slot);
+
+    /// <summary>
+    /// キーを含む組み合わせを表から外す（Exitは作らない）
+    /// </summary>
+    /// <param name="key">キー</param>
+    void Forget(uint64_t key);
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// 表の1行
+    /// </summary>
+    struct Contact {
+        ContactPair pair;
+        uint32_t lastFrame = 0;              // 最後に重なっていたフレーム（0なら重なったことがない）
+        uint32_t hitGeneration[2] = { 0, 0 }; // first・secondが攻撃側として記録したヒットの世代（0なら記録なし）
+    };
+
+    /// <summary>
+    /// スロットの現在の世代（1から始まる）
+    /// </summary>
+    uint32_t GetGeneration(uint32_t slot);
+
+    /// <summary>
+    /// 離れている組み合わせを表に残すか（まだ有効なヒットの記録がある）
+    /// </summary>
+    bool HasLiveHit(const Contact& contact);
+
+    // 組み合わせ（キーの順）と更新時の作業領域
+    std::vector<Contact> contacts_;
+    std::vector<Contact> scratch_;
+
+    // スロットごとの世代
+    std::vector<uint32_t> generations_;
+
+    // 直前の更新のイベントとExitの作業領域
+    std::vector<ContactEvent> events_;
+    std::vector<ContactEvent> exits_;
+
+    // 更新の回数（フレーム番号）
+    uint32_t frame_ = 1;
+
+    // 使用状況
+    Stats stats_;
+};
@@ -0,0 +1,97 @@
+#include "HitEventQueue.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Player/Player.h"
+#include "../CameraSystem/CameraManager.h"
+#include <algorithm>
+
+namespace {
+
+    /// <summary>
+    /// プレイヤーの攻撃が当たった時のボスのシェイクの強さ
+    /// </summary>
+    constexpr float kPlayerBulletBossShake = 0.5f;
+    constexpr float kPlayerMeleeBossShake = 1.0f;
+
+    /// <summary>
+    /// プレイヤーの近接攻撃が当たった時のカメラシェイク（攻撃ヒット時は軽めに）
+    /// </summary>
+    constexpr float kPlayerMeleeCameraShake = 0.3f;
+
+}
+
+void HitEventQueue::Initialize(size_t capacity) {
+    events_.assign(capacity, HitEvent{});
+    size_.store(0, std::memory_order_relaxed);
+    overflow_.store(0, std::memory_order_relaxed);
+
+    stats_ = Stats{};
+    stats_.capacity = capacity;
+}
+
+bool HitEventQueue::Push(const HitEvent& event) {
+    const size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= events_.size()) {
+        overflow_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    events_[index] = event;
+    return true;
+}
+
+std::span<const HitEvent> HitEventQueue::GetEvents() const {
+    const size_t count = (std::min)(size_.load(std::memory_order_relaxed), events_.size());
+    return std::span<const HitEvent>(events_.data(), count);
+}
+
+void HitEventQueue::Resolve() {
+    const std::span<const HitEvent> events = GetEvents();
+    for (const HitEvent& event : events) {
+        Apply(event);
+    }
+
+    stats_.resolvedCount = events.size();
+    stats_.peakCount = (std::max)(stats_.peakCount, events.size());
+    stats_.totalCount += events.size();
+    Clear();
+}
+
+void HitEventQueue::Clear() {
+    stats_.overflowCount += overflow_.exchange(0, std::memory_order_relaxed);
+    size_.store(0, std::memory_order_relaxed);
+}
+
+void HitEventQueue::Submit(HitEventQueue* queue, const HitEvent& event) {
+    if (queue) {
+        queue->Push(event);
+    }
+    else {
+        Apply(event);
+    }
+}
+
+void HitEventQueue::Apply(const HitEvent& event) {
+    if (!event.victim || !event.victim->GetOwner()) {
+        return;
+    }
+
+    switch (event.source) {
+    case HitSource::PlayerBullet:
+        static_cast<Boss*>(event.victim->GetOwner())->OnHit(event.damage, kPlayerBulletBossShake);
+        break;
+    case HitSource::PlayerMelee:
+        static_cast<Boss*>(event.victim->GetOwner())->OnHit(event.damage, kPlayerMeleeBossShake);
+        CameraManager::GetInstance()->StartShake(kPlayerMeleeCameraShake);
+        break;
+    case HitSource::BossBullet:
+    case HitSource::BossMelee:
+    case HitSource::Danmaku:
+        static_cast<Player*>(event.victim->GetOwner())->OnHit(event.damage);
+        break;
+    }
+}
+
+void HitEventQueue::ResetStats() {
+    stats_.peakCount = 0;
+    stats_.totalCount = 0;
+    stats_.overflowCount = 0;
+}
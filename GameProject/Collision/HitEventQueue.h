@@ -0,0 +1,117 @@
+#pragma once
+#include "Vector3.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+class Collider;
+
+/// <summary>
+/// ヒットの発生元（ダメージ以外の反応の選択に使う）
+/// </summary>
+enum class HitSource : uint8_t {
+    BossBullet,    // ボスの弾 → プレイヤー
+    BossMelee,     // ボスの近接攻撃 → プレイヤー
+    Danmaku,       // 弾幕の弾（まとめて1件） → プレイヤー
+    PlayerBullet,  // プレイヤーの弾 → ボス
+    PlayerMelee,   // プレイヤーの近接攻撃 → ボス
+};
+
+/// <summary>
+/// ヒット1件
+/// </summary>
+struct HitEvent {
+    Collider* attacker = nullptr;          // 攻撃側のコライダー（弾幕はnullptr）
+    Collider* victim = nullptr;            // 受けた側の本体のコライダー（所有者がPlayer・Boss）
+    float damage = 0.0f;                   // ダメージ量
+    Vector3 point{};                       // 当たった位置
+    HitSource source = HitSource::BossBullet;
+};
+
+/// <summary>
+/// 1フレーム分のヒットをためる固定容量のキュー
+/// 衝突判定のコールバックはヒットを書き込むだけにし、ダメージ・シェイク・振動などの反応は
+/// 全ての判定が終わった後のResolveでまとめて適用する（判定中にゲームの状態を変えない）
+/// 書き込み先はatomicな加算で予約するので、判定を複数のスレッドで行っても書き込める
+/// 適用は追加順（1スレッドで判定した場合はコールバックの順）
+/// </summary>
+class HitEventQueue {
+public:
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;         // 1フレームにためられるヒットの数
+        size_t resolvedCount = 0;    // 直前のResolveで適用したヒットの数
+        size_t peakCount = 0;        // 1フレームのヒットの数の最大
+        uint64_t totalCount = 0;     // 適用したヒットの累計
+        uint64_t overflowCount = 0;  // 容量を超えて捨てたヒットの累計
+    };
+
+    /// <summary>
+    /// 初期化（容量分の領域を確保する）
+    /// </summary>
+    /// <param name="capacity">1フレームにためられるヒットの数</param>
+    void Initialize(size_t capacity);
+
+    /// <summary>
+    /// ヒットを1件追加（スレッドセーフ）
+    /// </summary>
+    /// <param name="event">ヒット</param>
+    /// <returns>追加できた場合true</returns>
+    bool Push(const HitEvent& event);
+
+    /// <summary>
+    /// たまっているヒット（追加順）
+    /// </summary>
+    std::span<const HitEvent> GetEvents() const;
+
+    /// <summary>
+    /// たまっているヒットを追加順に適用して破棄する（メインスレッドで呼ぶ）
+    /// </summary>
+    void Resolve();
+
+    /// <summary>
+    /// ヒットの破棄（適用しない）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// キューがあれば追加し、なければその場で適用する（キューを持たないシーン・シミュレーション用）
+    /// </summary>
+    /// <param name="queue">キュー（nullptrなら即時に適用）</param>
+    /// <param name="event">ヒット</param>
+    static void Submit(HitEventQueue* queue, const HitEvent& event);
+
+    /// <summary>
+    /// ヒット1件の反応を適用（ダメージと、発生元ごとのシェイクなど）
+    /// </summary>
+    /// <param name="event">ヒット</param>
+    static void Apply(const HitEvent& event);
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    // ヒット（要素数は容量で固定）
+    std::vector<HitEvent> events_;
+
+    // 予約済みの数（容量を超えることがあるので、読み出し時は容量で切る）
+    std::atomic<size_t> size_{ 0 };
+
+    // 容量を超えて捨てた数（Resolve・Clearで累計へ移す）
+    std::atomic<uint64_t> overflow_{ 0 };
+
+    // 使用状況
+    Stats stats_;
+};
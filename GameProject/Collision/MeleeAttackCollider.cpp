@@ -2,8 +2,8 @@
 #include "../Object/Player/Player.h"
 #include "../Object/Boss/Boss.h"
 #include "CollisionTypeIdDef.h"
+#include "HitEventQueue.h"
 #include "GlobalVariables.h"
-#include "../CameraSystem/CameraManager.h"
 
 MeleeAttackCollider::MeleeAttackCollider(Player* player)
     : player_(player) {
@@ -23,11 +23,7 @@ void MeleeAttackCollider::OnCollisionEnter(Collider* other) {
     if (typeID == static_cast<uint32_t>(CollisionTypeId::BOSS)) {
         Boss* enemy = static_cast<Boss*>(other->GetOwner());
         if (enemy) {
-
-            enemy->OnHit(attackDamage_, 1.0f);
-
-            // カメラシェイク発動（攻撃ヒット時は軽めに）
-            CameraManager::GetInstance()->StartShake(0.3f);
+            SubmitHit(other);
 
             if (!detectedEnemy_) {
                 detectedEnemy_ = enemy;
@@ -51,11 +47,7 @@ void MeleeAttackCollider::OnCollisionStay(Collider* other) {
             detectedEnemy_ = enemy;
             if (canDamage)
             {
-                enemy->OnHit(attackDamage_, 1.0f);
-
-                // カメラシェイク発動（攻撃ヒット時は軽めに）
-                CameraManager::GetInstance()->StartShake(0.3f);
-
+                SubmitHit(other);
                 canDamage = false;
             }
         }
@@ -63,7 +55,6 @@ void MeleeAttackCollider::OnCollisionStay(Collider* other) {
 }
 
 void MeleeAttackCollider::Reset() {
-    hitEnemies_.clear();
     detectedEnemy_ = nullptr;
 #ifdef _DEBUG
     collisionCount_ = 0;
@@ -75,6 +66,13 @@ void MeleeAttackCollider::Damage()
     canDamage = true;
 }
 
-bool MeleeAttackCollider::HasHitEnemy(uint32_t enemyId) const {
-    return hitEnemies_.find(enemyId) != hitEnemies_.end();
+void MeleeAttackCollider::SubmitHit(Collider* enemy) {
+    // ダメージとカメラシェイクは判定が終わった後にまとめて適用する
+    HitEvent hit;
+    hit.attacker = this;
+    hit.victim = enemy;
+    hit.damage = attackDamage_;
+    hit.point = GetCenter();
+    hit.source = HitSource::PlayerMelee;
+    HitEventQueue::Submit(hitEvents_, hit);
 }
\ No newline at end of file
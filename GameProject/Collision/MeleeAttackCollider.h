@@ -1,10 +1,10 @@
 #pragma once
 #include "OBBCollider.h"
 #include <vector>
-#include <unordered_set>
 
 class Player;
 class Boss;
+class HitEventQueue;
 
 /// <summary>
 /// 近接攻撃用コライダークラス
@@ -13,14 +13,20 @@ class Boss;
 class MeleeAttackCollider : public OBBCollider {
 private:
 	Player* player_ = nullptr;  ///< このコライダーを所有するプレイヤーへのポインタ
-	std::unordered_set<uint32_t> hitEnemies_;  ///< この攻撃で既にヒットした敵のIDセット（多重ヒット防止用）
 	Boss* detectedEnemy_ = nullptr;  ///< 現在検出されている敵への参照
 	bool canDamage = false;  ///< ダメージを与えられる状態かどうか
 	float attackDamage_ = 10.0f;  ///< 攻撃ダメージ量（GlobalVariablesから取得）
+	HitEventQueue* hitEvents_ = nullptr;  ///< ヒットの書き込み先（nullptrなら即時に適用）
 
 #ifdef _DEBUG
 	int collisionCount_ = 0;  ///< デバッグ用：衝突検出回数
 #endif
+
+	/// <summary>
+	/// 敵へのヒットを書き込む
+	/// </summary>
+	/// <param name="enemy">敵の本体のコライダー</param>
+	void SubmitHit(Collider* enemy);
 	
 public:
 	/// <summary>
@@ -48,7 +54,7 @@ public:
 
 	/// <summary>
 	/// コライダーの状態をリセット（新しい攻撃の開始時に呼び出す）
-	/// hitEnemiesリストとdetectedEnemyをクリア
+	/// detectedEnemyをクリア
 	/// </summary>
 	void Reset();
 
@@ -65,11 +71,10 @@ public:
 	Boss* GetDetectedEnemy() const { return detectedEnemy_; }
 
 	/// <summary>
-	/// 指定した敵IDが既にヒット済みかチェック
+	/// ヒットの書き込み先を設定（ダメージ・シェイクはResolveの時に適用される）
 	/// </summary>
-	/// <param name="enemyId">チェックする敵のID</param>
-	/// <returns>ヒット済みならtrue</returns>
-	bool HasHitEnemy(uint32_t enemyId) const;
+	/// <param name="hitEvents">書き込み先（nullptrなら当たった時にその場で適用）</param>
+	void SetHitEventQueue(HitEventQueue* hitEvents) { hitEvents_ = hitEvents; }
 
 #ifdef _DEBUG
 	/// <summary>
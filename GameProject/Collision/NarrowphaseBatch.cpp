@@ -0,0 +1,105 @@
+#include "NarrowphaseBatch.h"
+#include <bit>
+#include <cmath>
+
+// x86/x64ではSSEで4つずつ処理する（それ以外の環境は同じ計算をスカラーで行う）
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define NARROWPHASE_BATCH_USE_SSE 1
+#include <xmmintrin.h>
+#else
+#define NARROWPHASE_BATCH_USE_SSE 0
+#endif
+
+namespace {
+
+    /// <summary>
+    /// 1つずつ判定して[first, count)のビットを立てる
+    /// </summary>
+    void SphereOBBRange(const NarrowphaseBatch::OBBShape& box, const NarrowphaseBatch::SphereArrays& spheres,
+        size_t first, uint32_t* outMask) {
+        for (size_t i = first; i < spheres.count; ++i) {
+            const Vector3 center(spheres.x[i], spheres.y[i], spheres.z[i]);
+            if (NarrowphaseBatch::SphereOBB(box, center, spheres.radius[i])) {
+                outMask[i / 32] |= 1u << (i % 32);
+            }
+        }
+    }
+
+    /// <summary>
+    /// 立っているビットの数
+    /// </summary>
+    uint32_t CountHits(const uint32_t* mask, size_t count) {
+        uint32_t hits = 0;
+        for (size_t word = 0; word < NarrowphaseBatch::GetMaskWordCount(count); ++word) {
+            hits += static_cast<uint32_t>(std::popcount(mask[word]));
+        }
+        return hits;
+    }
+
+}
+
+bool NarrowphaseBatch::SphereOBB(const OBBShape& box, const Vector3& center, float radius) {
+    const Vector3 diff = center - box.center;
+    float distanceSq = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        const float excess = std::abs(diff.Dot(box.axes[i])) - box.halfExtents[i];
+        if (excess > 0.0f) {
+            distanceSq += excess * excess;
+        }
+    }
+    return distanceSq <= radius * radius;
+}
+
+uint32_t NarrowphaseBatch::SphereOBB(const OBBShape& box, const SphereArrays& spheres, uint32_t* outMask) {
+#if NARROWPHASE_BATCH_USE_SSE
+    for (size_t word = 0; word < GetMaskWordCount(spheres.count); ++word) {
+        outMask[word] = 0;
+    }
+
+    const __m128 centerX = _mm_set1_ps(box.center.x);
+    const __m128 centerY = _mm_set1_ps(box.center.y);
+    const __m128 centerZ = _mm_set1_ps(box.center.z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 axisX[3];
+    __m128 axisY[3];
+    __m128 axisZ[3];
+    __m128 half[3];
+    for (int k = 0; k < 3; ++k) {
+        axisX[k] = _mm_set1_ps(box.axes[k].x);
+        axisY[k] = _mm_set1_ps(box.axes[k].y);
+        axisZ[k] = _mm_set1_ps(box.axes[k].z);
+        half[k] = _mm_set1_ps(box.halfExtents[k]);
+    }
+
+    // 4つ単位で処理し、端数はスカラーで処理する（32は4の倍数なので4つ分のビットはワードをまたがない）
+    const size_t groupEnd = spheres.count & ~static_cast<size_t>(3);
+    for (size_t i = 0; i < groupEnd; i += 4) {
+        const __m128 dx = _mm_sub_ps(_mm_loadu_ps(&spheres.x[i]), centerX);
+        const __m128 dy = _mm_sub_ps(_mm_loadu_ps(&spheres.y[i]), centerY);
+        const __m128 dz = _mm_sub_ps(_mm_loadu_ps(&spheres.z[i]), centerZ);
+        __m128 distanceSq = zero;
+        for (int k = 0; k < 3; ++k) {
+            // 軸への投影の絶対値から半分の長さを引き、はみ出した分だけ加える
+            const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, axisX[k]), _mm_mul_ps(dy, axisY[k])), _mm_mul_ps(dz, axisZ[k]));
+            const __m128 excess = _mm_max_ps(_mm_sub_ps(_mm_andnot_ps(signMask, dot), half[k]), zero);
+            distanceSq = _mm_add_ps(distanceSq, _mm_mul_ps(excess, excess));
+        }
+        const __m128 radius = _mm_loadu_ps(&spheres.radius[i]);
+        const uint32_t hitMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_mul_ps(radius, radius))));
+        outMask[i / 32] |= hitMask << (i % 32);
+    }
+    SphereOBBRange(box, spheres, groupEnd, outMask);
+    return CountHits(outMask, spheres.count);
+#else
+    return SphereOBBScalar(box, spheres, outMask);
+#endif
+}
+
+uint32_t NarrowphaseBatch::SphereOBBScalar(const OBBShape& box, const SphereArrays& spheres, uint32_t* outMask) {
+    for (size_t word = 0; word < GetMaskWordCount(spheres.count); ++word) {
+        outMask[word] = 0;
+    }
+    SphereOBBRange(box, spheres, 0, outMask);
+    return CountHits(outMask, spheres.count);
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Vector3.h"
+#include <cstddef>
+#include <cstdint>
+
+/// <summary>
+/// 1つのOBBと多数の球をまとめて判定する形状判定
+/// 球はコライダーではなく中心・半径の配列（SoA）で受け取り、x86/x64ではSSEで4つずつ判定する（それ以外はスカラー）
+/// SSE版とスカラー版は同じ順序で同じ演算を行うため、結果はビット単位で一致する
+/// </summary>
+namespace NarrowphaseBatch {
+
+    /// <summary>
+    /// 判定用のOBB（軸は正規化済み、大きさは各軸の半分の長さ）
+    /// </summary>
+    struct OBBShape {
+        Vector3 center;
+        Vector3 axes[3];
+        float halfExtents[3] = { 0.0f, 0.0f, 0.0f };
+    };
+
+    /// <summary>
+    /// 球の配列（SoA、各配列はcount要素）
+    /// </summary>
+    struct SphereArrays {
+        const float* x = nullptr;
+        const float* y = nullptr;
+        const float* z = nullptr;
+        const float* radius = nullptr;
+        size_t count = 0;
+    };
+
+    /// <summary>
+    /// 結果のビットマスクに必要なuint32_tの数
+    /// </summary>
+    constexpr size_t GetMaskWordCount(size_t count) {
+        return (count + 31) / 32;
+    }
+
+    /// <summary>
+    /// 球1つとOBB（OBBのローカル空間で最近接点までの距離を求める）
+    /// </summary>
+    /// <param name="box">OBB</param>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <returns>重なっている場合true</returns>
+    bool SphereOBB(const OBBShape& box, const Vector3& center, float radius);
+
+    /// <summary>
+    /// 球の配列とOBB（SSEが使えればSSE、使えなければスカラー）
+    /// </summary>
+    /// <param name="box">OBB</param>
+    /// <param name="spheres">球の配列</param>
+    /// <param name="outMask">i番目の球が重なっていればi番目のビットを立てる（GetMaskWordCount(spheres.count)要素）</param>
+    /// <returns>重なっている球の数</returns>
+    uint32_t SphereOBB(const OBBShape& box, const SphereArrays& spheres, uint32_t* outMask);
+
+    /// <summary>
+    /// 球の配列とOBB（常にスカラー、SSE版の検証・比較用）
+    /// </summary>
+    /// <param name="box">OBB</param>
+    /// <param name="spheres">球の配列</param>
+    /// <param name="outMask">i番目の球が重なっていればi番目のビットを立てる（GetMaskWordCount(spheres.count)要素）</param>
+    /// <returns>重なっている球の数</returns>
+    uint32_t SphereOBBScalar(const OBBShape& box, const SphereArrays& spheres, uint32_t* outMask);
+
+}
@@ -2,6 +2,7 @@
 #include "../Object/Projectile/PlayerBullet.h"
 #include "../Object/Boss/Boss.h"
 #include "CollisionTypeIdDef.h"
+#include "HitEventQueue.h"
 #include "CollisionManager.h"
 
 PlayerBulletCollider::PlayerBulletCollider(PlayerBullet* owner)
@@ -15,9 +16,8 @@ void PlayerBulletCollider::OnCollisionEnter(Collider* other) {
 
     // ボスとの衝突判定
     if (other->GetTypeID() == static_cast<uint32_t>(CollisionTypeId::BOSS)) {
-        // 多重ヒット防止チェック
-        void* targetPtr = other->GetOwner();
-        if (hitTargets_.find(targetPtr) != hitTargets_.end()) {
+        // 多重ヒット防止チェック（グリッドの接触の状態に記録する）
+        if (!owner_->RegisterHit(other)) {
             return;  // 既にヒット済み
         }
 
@@ -25,10 +25,15 @@ void PlayerBulletCollider::OnCollisionEnter(Collider* other) {
         Boss* boss = static_cast<Boss*>(other->GetOwner());
         if (boss) {
             hitBoss_ = boss;
-            hitTargets_.insert(targetPtr);
 
-            // ボスにダメージを与える
-            boss->OnHit(owner_->GetDamage(), 0.5f);
+            // ボスへのダメージはヒットとして書き込み、判定が終わった後に適用する
+            HitEvent hit;
+            hit.attacker = this;
+            hit.victim = other;
+            hit.damage = owner_->GetDamage();
+            hit.point = owner_->GetTransform().translate;
+            hit.source = HitSource::PlayerBullet;
+            HitEventQueue::Submit(owner_->GetHitEventQueue(), hit);
             hasDealtDamage_ = true;
 
             // 弾を非アクティブ化
@@ -49,7 +54,6 @@ void PlayerBulletCollider::OnCollisionExit(Collider* other) {
 }
 
 void PlayerBulletCollider::Reset() {
-    hitTargets_.clear();
     hitBoss_ = nullptr;
     hasDealtDamage_ = false;
 }
@@ -1,7 +1,6 @@
 #pragma once
 
 #include "SphereCollider.h"
-#include <unordered_set>
 
 class PlayerBullet;
 class Boss;
@@ -55,9 +54,6 @@ private:
     // 所有者（PlayerBullet）への参照
     PlayerBullet* owner_ = nullptr;
 
-    // ヒット済みターゲット（多重ヒット防止用）
-    std::unordered_set<void*> hitTargets_;
-
     // 現在ヒットしているボス
     Boss* hitBoss_ = nullptr;
 
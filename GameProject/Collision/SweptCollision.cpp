@@ -0,0 +1,137 @@
+#include "SweptCollision.h"
+#include "OBBCollider.h"
+#include "SphereCollider.h"
+#include <cmath>
+
+namespace {
+
+    /// <summary>
+    /// 移動量がこれ以下なら止まっているものとして扱う（移動量の2乗）
+    /// </summary>
+    constexpr float kMinMoveSq = 1.0e-12f;
+
+    float Dot(const Vector3& a, const Vector3& b) {
+        return a.x * b.x + a.y * b.y + a.z * b.z;
+    }
+
+    /// <summary>
+    /// 2次式 a t^2 + b t + c が0以下になる最初の時刻を[t0, t1]の範囲で求める
+    /// </summary>
+    bool FirstRootInRange(float a, float b, float c, float t0, float t1, float& outTime) {
+        auto evaluate = [&](float t) { return (a * t + b) * t + c; };
+        if (evaluate(t0) <= 0.0f) {
+            outTime = t0;
+            return true;
+        }
+        if (a <= 0.0f) {
+            return false;
+        }
+        const float discriminant = b * b - 4.0f * a * c;
+        if (discriminant < 0.0f) {
+            return false;
+        }
+        // t0で正なので、範囲内に入るのは小さい方の解
+        const float t = (-b - std::sqrt(discriminant)) / (2.0f * a);
+        if (t < t0 || t > t1) {
+            return false;
+        }
+        outTime = t;
+        return true;
+    }
+
+}
+
+bool SweptCollision::SweepSphereSphere(const Vector3& start, const Vector3& end, float radius,
+    const Vector3& center, float targetRadius, float& outTime) {
+    const Vector3 offset = start - center;
+    const Vector3 move = end - start;
+    const float radiusSum = radius + targetRadius;
+    return FirstRootInRange(Dot(move, move), 2.0f * Dot(offset, move),
+        Dot(offset, offset) - radiusSum * radiusSum, 0.0f, 1.0f, outTime);
+}
+
+bool SweptCollision::SweepSphereOBB(const Vector3& start, const Vector3& end, float radius,
+    const Vector3& center, const Vector3 (&axes)[3], const Vector3& halfExtents, float& outTime) {
+    // OBBのローカル空間へ
+    const Vector3 offset = start - center;
+    const Vector3 move = end - start;
+    const float origin[3] = { Dot(offset, axes[0]), Dot(offset, axes[1]), Dot(offset, axes[2]) };
+    const float velocity[3] = { Dot(move, axes[0]), Dot(move, axes[1]), Dot(move, axes[2]) };
+    const float half[3] = { halfExtents.x, halfExtents.y, halfExtents.z };
+
+    // 各軸で箱の面を横切る時刻を区切りにする（区間内では各軸の最近接点の面が変わらない）
+    float breaks[8] = { 0.0f };
+    int breakCount = 1;
+    for (int i = 0; i < 3; ++i) {
+        if (velocity[i] * velocity[i] <= kMinMoveSq) {
+            continue;
+        }
+        const float faces[2] = { -half[i], half[i] };
+        for (float face : faces) {
+            const float t = (face - origin[i]) / velocity[i];
+            if (t > 0.0f && t < 1.0f) {
+                breaks[breakCount++] = t;
+            }
+        }
+    }
+    breaks[breakCount++] = 1.0f;
+
+    // 区切りは高々8個なので挿入ソートで並べる
+    for (int i = 1; i < breakCount; ++i) {
+        const float value = breaks[i];
+        int j = i;
+        for (; j > 0 && breaks[j - 1] > value; --j) {
+            breaks[j] = breaks[j - 1];
+        }
+        breaks[j] = value;
+    }
+
+    // 区間ごとに、箱までの距離の2乗 - 半径の2乗 を時刻の2次式にして解く
+    const float radiusSq = radius * radius;
+    for (int k = 0; k + 1 < breakCount; ++k) {
+        const float t0 = breaks[k];
+        const float t1 = breaks[k + 1];
+        const float middle = (t0 + t1) * 0.5f;
+
+        float a = 0.0f;
+        float b = 0.0f;
+        float c = -radiusSq;
+        for (int i = 0; i < 3; ++i) {
+            const float position = origin[i] + velocity[i] * middle;
+            float face = 0.0f;
+            if (position > half[i]) {
+                face = half[i];
+            }
+            else if (position < -half[i]) {
+                face = -half[i];
+            }
+            else {
+                continue;  // 箱の幅の内側にある軸は距離に寄与しない
+            }
+            const float relative = origin[i] - face;
+            a += velocity[i] * velocity[i];
+            b += 2.0f * relative * velocity[i];
+            c += relative * relative;
+        }
+        if (FirstRootInRange(a, b, c, t0, t1, outTime)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SweptCollision::SweepSphere(const Vector3& start, const Vector3& end, float radius, const Collider& target, float& outTime) {
+    if (const auto* sphere = dynamic_cast<const SphereCollider*>(&target)) {
+        return SweepSphereSphere(start, end, radius, sphere->GetCenter(), sphere->GetRadius(), outTime);
+    }
+    if (const auto* obb = dynamic_cast<const OBBCollider*>(&target)) {
+        const Matrix4x4& orientation = obb->GetOrientation();
+        const Vector3 axes[3] = {
+            Vector3(orientation.m[0][0], orientation.m[0][1], orientation.m[0][2]),
+            Vector3(orientation.m[1][0], orientation.m[1][1], orientation.m[1][2]),
+            Vector3(orientation.m[2][0], orientation.m[2][1], orientation.m[2][2]),
+        };
+        return SweepSphereOBB(start, end, radius, obb->GetCenter(), axes, obb->GetSize() * 0.5f, outTime);
+    }
+    return false;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "Vector3.h"
+
+class Collider;
+class OBBCollider;
+class SphereCollider;
+
+/// <summary>
+/// 移動する球の連続衝突判定
+/// 前フレームの位置から今フレームの位置までの移動を線分として扱い、相手に最初に触れる時刻を求める
+/// 時刻は移動の割合（0で前フレームの位置、1で今フレームの位置）で返す
+/// 相手はこのフレームの位置で静止しているものとして扱う
+/// </summary>
+namespace SweptCollision {
+
+    /// <summary>
+    /// 移動する球と球
+    /// </summary>
+    /// <param name="start">移動開始位置</param>
+    /// <param name="end">移動終了位置</param>
+    /// <param name="radius">移動する球の半径</param>
+    /// <param name="center">相手の球の中心</param>
+    /// <param name="targetRadius">相手の球の半径</param>
+    /// <param name="outTime">最初に触れる時刻（当たった場合のみ書き込む）</param>
+    /// <returns>移動中に触れた場合true（開始時点で重なっていれば時刻0）</returns>
+    bool SweepSphereSphere(const Vector3& start, const Vector3& end, float radius,
+        const Vector3& center, float targetRadius, float& outTime);
+
+    /// <summary>
+    /// 移動する球とOBB
+    /// OBBのローカル空間で球の中心からOBBまでの距離を時刻の区分ごとの2次式として解くため、辺や角に当たる場合も厳密に求まる
+    /// </summary>
+    /// <param name="start">移動開始位置</param>
+    /// <param name="end">移動終了位置</param>
+    /// <param name="radius">移動する球の半径</param>
+    /// <param name="center">OBBの中心</param>
+    /// <param name="axes">OBBのローカル軸（正規化済み）</param>
+    /// <param name="halfExtents">OBBの各軸の半分の長さ</param>
+    /// <param name="outTime">最初に触れる時刻（当たった場合のみ書き込む）</param>
+    /// <returns>移動中に触れた場合true（開始時点で重なっていれば時刻0）</returns>
+    bool SweepSphereOBB(const Vector3& start, const Vector3& end, float radius,
+        const Vector3& center, const Vector3 (&axes)[3], const Vector3& halfExtents, float& outTime);
+
+    /// <summary>
+    /// 移動する球とコライダー（形状に応じて上の判定を使い分ける）
+    /// </summary>
+    /// <param name="start">移動開始位置</param>
+    /// <param name="end">移動終了位置</param>
+    /// <param name="radius">移動する球の半径</param>
+    /// <param name="target">相手のコライダー（球またはOBB）</param>
+    /// <param name="outTime">最初に触れる時刻（当たった場合のみ書き込む）</param>
+    /// <returns>移動中に触れた場合true</returns>
+    bool SweepSphere(const Vector3& start, const Vector3& end, float radius, const Collider& target, float& outTime);
+
+}
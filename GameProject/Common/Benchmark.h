@@ -0,0 +1,105 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+/// <summary>
+/// マイクロベンチマーク用の簡易計測ユーティリティ
+/// 各モジュールのベンチマーク（BTBenchmark等）から使用する
+/// </summary>
+namespace Benchmark {
+
+    /// <summary>
+    /// 計測結果
+    /// </summary>
+    struct Result {
+        std::string name;             // 計測項目名
+        uint64_t iterations = 0;      // 反復回数
+        double totalMs = 0.0;         // 合計時間（ミリ秒）
+        double nsPerOp = 0.0;         // 1回あたりの時間（ナノ秒）
+        double baselineNsPerOp = 0.0; // 比較対象の1回あたりの時間（0なら比較なし）
+    };
+
+    /// <summary>
+    /// 最適化による計算の削除を防ぐための書き込み先
+    /// </summary>
+    inline volatile uint64_t gSink = 0;
+
+    /// <summary>
+    /// 値を消費して最適化で消されないようにする
+    /// </summary>
+    /// <param name="value">消費する値</param>
+    inline void Consume(uint64_t value) { gSink = gSink + value; }
+
+    /// <summary>
+    /// 関数を指定回数実行して1回あたりの時間を計測
+    /// </summary>
+    /// <template name="Func">void(uint64_t index) の呼び出し可能オブジェクト</template>
+    /// <param name="name">計測項目名</param>
+    /// <param name="iterations">反復回数</param>
+    /// <param name="func">計測対象</param>
+    /// <returns>計測結果</returns>
+    template<typename Func>
+    Result Measure(const std::string& name, uint64_t iterations, Func&& func) {
+        using Clock = std::chrono::steady_clock;
+
+        auto start = Clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            func(i);
+        }
+        auto end = Clock::now();
+
+        Result result;
+        result.name = name;
+        result.iterations = iterations;
+        result.totalMs = std::chrono::duration<double, std::milli>(end - start).count();
+        result.nsPerOp = (iterations > 0) ? (result.totalMs * 1.0e6 / static_cast<double>(iterations)) : 0.0;
+        return result;
+    }
+
+#ifdef _DEBUG
+    /// <summary>
+    /// 計測結果をImGuiテーブルで表示
+    /// </summary>
+    /// <param name="id">テーブルID</param>
+    /// <param name="results">計測結果</param>
+    inline void DrawResultsTable(const char* id, const std::vector<Result>& results) {
+        if (results.empty()) {
+            ImGui::TextDisabled("No results");
+            return;
+        }
+
+        if (ImGui::BeginTable(id, 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+            ImGui::TableSetupColumn("Case");
+            ImGui::TableSetupColumn("ns/op");
+            ImGui::TableSetupColumn("total ms");
+            ImGui::TableSetupColumn("speedup");
+            ImGui::TableHeadersRow();
+
+            for (const Result& result : results) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(result.name.c_str());
+                ImGui::TableSetColumnIndex(1);
+                ImGui::Text("%.2f", result.nsPerOp);
+                ImGui::TableSetColumnIndex(2);
+                ImGui::Text("%.2f", result.totalMs);
+                ImGui::TableSetColumnIndex(3);
+                if (result.baselineNsPerOp > 0.0 && result.nsPerOp > 0.0) {
+                    ImGui::Text("x%.2f", result.baselineNsPerOp / result.nsPerOp);
+                }
+                else {
+                    ImGui::TextDisabled("-");
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+#endif
+
+}
@@ -15,6 +15,12 @@ namespace GameConst {
     inline constexpr float kStageZMin = -140.0f;
     inline constexpr float kStageZMax = 60.0f;
 
+    /// <summary>
+    /// 弾が存在できる高さの範囲（これを超えた弾は消える）
+    /// </summary>
+    inline constexpr float kProjectileYMin = -10.0f;
+    inline constexpr float kProjectileYMax = 50.0f;
+
     /// <summary>
     /// 方向ベクトルの有効判定閾値
     /// これより小さい長さのベクトルは無効とみなす
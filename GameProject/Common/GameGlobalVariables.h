@@ -0,0 +1,18 @@
+#pragma once
+
+class GlobalVariables;
+
+/// <summary>
+/// ゲームロジックが参照する調整項目の既定値
+/// ゲーム本体とヘッドレスシミュレーターで同じ値から始めるために共有する
+/// </summary>
+namespace GameGlobalVariables {
+
+    /// <summary>
+    /// 全グループと既定値を登録（既に登録済みの項目は変更しない）
+    /// JSONファイルの読み込みより前に呼ぶ
+    /// </summary>
+    /// <param name="gv">登録先</param>
+    void RegisterDefaults(GlobalVariables* gv);
+
+}
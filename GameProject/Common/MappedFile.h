@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// <summary>
+/// 読み取り専用のメモリマップドファイル
+/// ファイル内容をコピーせずにアドレス空間へ割り当てる（クッキング済みアセットの読み込み用）
+/// </summary>
+class MappedFile {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    MappedFile() = default;
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// <summary>
+    /// ファイルを開いてマップ
+    /// </summary>
+    /// <param name="filepath">ファイルパス</param>
+    /// <returns>成功したらtrue（空のファイルは失敗扱い）</returns>
+    bool Open(const std::string& filepath);
+
+    /// <summary>
+    /// マップの解除
+    /// </summary>
+    void Close();
+
+    /// <summary>
+    /// マップ済みかどうか
+    /// </summary>
+    /// <returns>マップ済みの場合true</returns>
+    bool IsOpen() const { return data_ != nullptr; }
+
+    /// <summary>
+    /// 先頭アドレスの取得
+    /// </summary>
+    /// <returns>先頭アドレス（未オープン時はnullptr）</returns>
+    const uint8_t* GetData() const { return data_; }
+
+    /// <summary>
+    /// サイズの取得
+    /// </summary>
+    /// <returns>バイト数</returns>
+    size_t GetSize() const { return size_; }
+
+private:
+    // マップした先頭アドレス
+    const uint8_t* data_ = nullptr;
+
+    // マップしたサイズ
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    // ファイルハンドル
+    void* fileHandle_ = nullptr;
+
+    // ファイルマッピングハンドル
+    void* mappingHandle_ = nullptr;
+#endif
+};
@@ -0,0 +1,96 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::WorkerPool(uint32_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = (std::max)(1u, std::thread::hardware_concurrency());
+    }
+
+    // 呼び出し元がワーカー0になるので、起動するのは1つ少ない数
+    threads_.reserve(threadCount - 1);
+    for (uint32_t worker = 1; worker < threadCount; ++worker) {
+        threads_.emplace_back(&WorkerPool::WorkerLoop, this, worker);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeCondition_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+void WorkerPool::ParallelFor(size_t count, const Task& task) {
+    if (count == 0) {
+        return;
+    }
+
+    // ワーカーがいない、または1チャンクに収まる場合は起こさずにその場で処理
+    if (threads_.empty() || count <= kChunkSize) {
+        for (size_t i = 0; i < count; ++i) {
+            task(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        nextIndex_.store(0, std::memory_order_relaxed);
+        activeWorkers_ = static_cast<uint32_t>(threads_.size());
+        ++generation_;
+    }
+    wakeCondition_.notify_all();
+
+    // 呼び出し元も処理に加わる
+    Drain(0);
+
+    // 全ワーカーが手を離すまで待つ（taskの寿命はこの関数の中だけなので）
+    std::unique_lock<std::mutex> lock(mutex_);
+    doneCondition_.wait(lock, [this]() { return activeWorkers_ == 0; });
+    task_ = nullptr;
+}
+
+void WorkerPool::WorkerLoop(uint32_t worker) {
+    uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeCondition_.wait(lock, [&]() { return stop_ || generation_ != seenGeneration; });
+            if (stop_) {
+                return;
+            }
+            seenGeneration = generation_;
+        }
+
+        Drain(worker);
+
+        bool last = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            last = --activeWorkers_ == 0;
+        }
+        if (last) {
+            doneCondition_.notify_one();
+        }
+    }
+}
+
+void WorkerPool::Drain(uint32_t worker) {
+    const Task& task = *task_;
+    for (;;) {
+        size_t begin = nextIndex_.fetch_add(kChunkSize, std::memory_order_relaxed);
+        if (begin >= count_) {
+            return;
+        }
+        size_t end = (std::min)(begin + kChunkSize, count_);
+        for (size_t i = begin; i < end; ++i) {
+            task(i, worker);
+        }
+    }
+}
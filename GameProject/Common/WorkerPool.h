@@ -0,0 +1,82 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// 常駐ワーカースレッドで添字の範囲を分担して処理するスレッドプール
+/// 呼び出し元のスレッドもワーカー0として処理に加わり、全件終わるまで戻らない
+/// スレッドはコンストラクタで起動し、フレームごとの生成・破棄は行わない
+/// </summary>
+class WorkerPool {
+public:
+    /// <summary>
+    /// 処理関数（index = 添字, worker = 処理したワーカーの番号 0..GetThreadCount()-1）
+    /// </summary>
+    using Task = std::function<void(size_t index, uint32_t worker)>;
+
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="threadCount">呼び出し元を含むスレッド数（0ならハードウェアスレッド数）</param>
+    explicit WorkerPool(uint32_t threadCount = 0);
+
+    /// <summary>
+    /// デストラクタ（ワーカーを停止して合流）
+    /// </summary>
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// <summary>
+    /// 0..count-1 の添字をワーカーで分担して処理
+    /// 同じ添字が2回処理されることはなく、処理の順番は不定
+    /// </summary>
+    /// <param name="count">添字の数</param>
+    /// <param name="task">処理関数</param>
+    void ParallelFor(size_t count, const Task& task);
+
+    /// <summary>
+    /// 呼び出し元を含むスレッド数の取得
+    /// </summary>
+    /// <returns>スレッド数</returns>
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(threads_.size()) + 1; }
+
+private:
+    /// <summary>
+    /// ワーカースレッドの本体
+    /// </summary>
+    /// <param name="worker">ワーカー番号（1以上）</param>
+    void WorkerLoop(uint32_t worker);
+
+    /// <summary>
+    /// 未処理の添字を取り出して処理（全件取り出し終わるまで）
+    /// </summary>
+    /// <param name="worker">ワーカー番号</param>
+    void Drain(uint32_t worker);
+
+    // 一度に取り出す添字の数（1件あたりの処理が軽いので、取り出しの競合を減らす）
+    static constexpr size_t kChunkSize = 4;
+
+    // ワーカースレッド（呼び出し元は含まない）
+    std::vector<std::thread> threads_;
+
+    // 起床・完了待ちの同期
+    std::mutex mutex_;
+    std::condition_variable wakeCondition_;
+    std::condition_variable doneCondition_;
+    uint64_t generation_ = 0;
+    uint32_t activeWorkers_ = 0;
+    bool stop_ = false;
+
+    // 実行中の処理
+    const Task* task_ = nullptr;
+    size_t count_ = 0;
+    std::atomic<size_t> nextIndex_{ 0 };
+};
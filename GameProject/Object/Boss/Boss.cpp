@@ -6,6 +6,7 @@
 #include "CollisionManager.h"
 #include "../../Collision/CollisionTypeIdDef.h"
 #include "../../Collision/BossMeleeAttackCollider.h"
+#include "../Projectile/ProjectileSpawnQueue.h"
 #include "FrameTimer.h"
 #include "Sprite.h"
 #include "WinApp.h"
@@ -133,6 +134,25 @@ void Boss::Finalize()
 }
 
 void Boss::Update(float deltaTime)
+{
+    UpdateBeforeAI();
+
+    // AIシステムの更新（記録した操作はすぐに適用する）
+    if (IsAIActive()) {
+        aiCommands_.Clear();
+        behaviorTree_->Update(deltaTime, aiCommands_);
+        aiCommands_.ApplyTo(*this);
+    }
+
+    UpdateAfterAI(deltaTime);
+}
+
+bool Boss::IsAIActive() const
+{
+    return !isDead_ && !isPause_ && behaviorTree_;
+}
+
+void Boss::UpdateBeforeAI()
 {
     // HPバーの更新
     if (phase_ == 1) {
@@ -159,24 +179,24 @@ void Boss::Update(float deltaTime)
 
     // フェーズとライフの更新
     UpdatePhaseAndLive();
+}
 
-    // AIシステムの更新
-    if (!isDead_ && !isPause_) {
-        if (behaviorTree_) {
-            // ビヘイビアツリーの更新
-            behaviorTree_->Update(deltaTime);
-
+void Boss::UpdateAfterAI(float deltaTime)
+{
 #ifdef _DEBUG
-            // エディタが有効な場合、実行中のノードをハイライト
-            if (nodeEditor_ && showNodeEditor_) {
-                BTNodePtr currentNode = behaviorTree_->GetCurrentRunningNode();
-                if (currentNode) {
-                    nodeEditor_->HighlightRunningNode(currentNode);
-                }
-            }
-#endif
+    // エディタが有効な場合、実行中のノードをハイライト
+    if (IsAIActive() && nodeEditor_ && showNodeEditor_) {
+        BTNodePtr currentNode = behaviorTree_->GetCurrentRunningNode();
+        if (currentNode) {
+            nodeEditor_->HighlightRunningNode(currentNode);
+        }
+
+        // プロファイリング中はノードごとのコストを重ねて表示
+        if (behaviorTree_->IsProfiling()) {
+            nodeEditor_->SetProfileData(behaviorTree_->GetTreeInstance());
         }
     }
+#endif
 
     // ヒットエフェクトの更新
     float hitEffectDuration = GlobalVariables::GetInstance()->GetValueFloat("Boss", "HitEffectDuration");
@@ -393,6 +413,57 @@ void Boss::DrawImGui()
             }
         }
 
+        // コンパイル済みツリーでの実行切り替え
+        bool useCompiledTree = behaviorTree_->IsUsingCompiledTree();
+        if (ImGui::Checkbox("Compiled Tree", &useCompiledTree)) {
+            behaviorTree_->SetUseCompiledTree(useCompiledTree);
+        }
+        const BTTreeInstance& treeInstance = behaviorTree_->GetTreeInstance();
+        const BTCompiledTree* compiledTree = behaviorTree_->GetCompiledTree().get();
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%zu nodes, %zu leaves, %zu bytes/agent)",
+            compiledTree ? compiledTree->GetNodeCount() : 0,
+            compiledTree ? compiledTree->GetLeafCount() : 0,
+            treeInstance.GetStateSize());
+
+        // 固定ツリー（型で展開したMainLoop）での実行切り替え
+        bool useStaticTree = behaviorTree_->IsUsingStaticTree();
+        if (ImGui::Checkbox("Static Tree", &useStaticTree)) {
+            behaviorTree_->SetUseStaticTree(useStaticTree);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%zu leaves, %zu bytes/agent)",
+            BossStaticTree::Tree::kLeafCount, sizeof(BossStaticTree::Tree::State));
+
+        // 条件の監視による中断の切り替え
+        bool reactive = behaviorTree_->IsReactive();
+        if (ImGui::Checkbox("Reactive", &reactive)) {
+            behaviorTree_->SetReactive(reactive);
+        }
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%zu guards, %u aborts)", compiledTree ? compiledTree->GetGuardCount() : 0, treeInstance.GetAbortCount());
+
+        // ノード単位のプロファイリング
+        bool profiling = behaviorTree_->IsProfiling();
+        if (ImGui::Checkbox("Profile Nodes", &profiling)) {
+            behaviorTree_->SetProfiling(profiling);
+            if (!profiling && nodeEditor_) {
+                nodeEditor_->ClearProfileData();
+            }
+        }
+        if (BTProfiler* profiler = behaviorTree_->GetProfiler()) {
+            ImGui::SameLine();
+            if (ImGui::Button("Reset##BTProfiler")) {
+                profiler->Reset();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button("Export Trace")) {
+                profiler->ExportChromeTrace("BossTreeTrace.json");
+                profiler->ExportSummaryCSV("BossTreeProfile.csv");
+            }
+            profiler->DrawImGui();
+        }
+
         // デバッグビルド専用：ノードエディタ機能
         if (nodeEditor_) {
             ImGui::SameLine();
@@ -477,14 +548,16 @@ void Boss::DrawImGui()
 #endif
 }
 
-void Boss::RequestBulletSpawn(const Vector3& position, const Vector3& velocity) {
-    pendingBullets_.push_back({ position, velocity });
+void Boss::RequestBulletSpawn(const Vector3& position, const Vector3& velocity, float turnRate) {
+    if (spawnQueue_) {
+        spawnQueue_->PushBullet({ position, velocity, turnRate, ProjectileOwner::Boss });
+    }
 }
 
-std::vector<Boss::BulletSpawnRequest> Boss::ConsumePendingBullets() {
-    auto result = std::move(pendingBullets_);
-    pendingBullets_.clear();
-    return result;
+void Boss::RequestPatternSpawn(const BulletPattern& pattern) {
+    if (spawnQueue_) {
+        spawnQueue_->PushPattern(pattern);
+    }
 }
 
 void Boss::SetPlayer(Player* player) {
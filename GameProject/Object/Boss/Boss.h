@@ -7,6 +7,7 @@
 #include "vector2.h"
 #include "Vector4.h"
 #include "Vector3.h"
+#include "BossBehaviorTree/BossCommandBuffer.h"
 
 class Sprite;
 class OBBCollider;
@@ -18,6 +19,7 @@ class Player;
 class BossShootState;
 class BossMeleeAttackCollider;
 class EmitterManager;
+class ProjectileSpawnQueue;
 
 /// <summary>
 /// ボスエネミークラス
@@ -36,15 +38,6 @@ private:
     // フェーズ2開始時のHP
     static constexpr float kPhase2InitialHp = 100.0f;
 
-public:
-    /// <summary>
-    /// 弾生成リクエスト構造体
-    /// </summary>
-    struct BulletSpawnRequest {
-        Vector3 position;  // 発射位置
-        Vector3 velocity;  // 弾の速度ベクトル
-    };
-
 public:
     Boss();
     ~Boss();
@@ -64,6 +57,25 @@ public:
     /// </summary>
     void Update(float deltaTime);
 
+    /// <summary>
+    /// AI更新前の処理（HPバー、フェーズとライフ）
+    /// 複数のボスのAIをまとめて更新する場合は
+    /// UpdateBeforeAI → AI（BossBehaviorTree::Update） → 操作の適用 → UpdateAfterAI の順に呼ぶ
+    /// </summary>
+    void UpdateBeforeAI();
+
+    /// <summary>
+    /// AI更新後の処理（エフェクト、モデル）
+    /// </summary>
+    /// <param name="deltaTime">経過時間</param>
+    void UpdateAfterAI(float deltaTime);
+
+    /// <summary>
+    /// このフレームにAIを更新するか
+    /// </summary>
+    /// <returns>更新する場合true</returns>
+    bool IsAIActive() const;
+
     /// <summary>
     /// 描画
     /// </summary>
@@ -111,17 +123,18 @@ public:
     void UpdatePhaseAndLive();
 
     /// <summary>
-    /// 弾生成リクエストを追加
+    /// 弾生成リクエストを生成キューへ追加（キュー未設定・容量超過なら捨てる）
     /// </summary>
     /// <param name="position">弾の発射位置</param>
     /// <param name="velocity">弾の速度ベクトル</param>
-    void RequestBulletSpawn(const Vector3& position, const Vector3& velocity);
+    /// <param name="turnRate">追尾の旋回速度（ラジアン/秒、0なら直進）</param>
+    void RequestBulletSpawn(const Vector3& position, const Vector3& velocity, float turnRate = 0.0f);
 
     /// <summary>
-    /// 保留中の弾生成リクエストを取得して消費
+    /// 弾幕の模様の生成リクエストを生成キューへ追加（キュー未設定・容量超過なら捨てる）
     /// </summary>
-    /// <returns>弾生成リクエストのリスト（moveで返される）</returns>
-    std::vector<BulletSpawnRequest> ConsumePendingBullets();
+    /// <param name="pattern">模様</param>
+    void RequestPatternSpawn(const BulletPattern& pattern);
 
     //-----------------------------Getters/Setters------------------------------//
     /// <summary>
@@ -244,6 +257,12 @@ public:
     /// <returns>ボスのOBBコライダーのポインタ</returns>
     OBBCollider* GetCollider() const { return bodyCollider_.get(); }
 
+    /// <summary>
+    /// ビヘイビアツリーを取得
+    /// </summary>
+    /// <returns>ビヘイビアツリーのポインタ</returns>
+    BossBehaviorTree* GetBehaviorTree() const { return behaviorTree_.get(); }
+
     //-----------------------------近接攻撃関連------------------------------//
     /// <summary>
     /// 攻撃ブロックを取得
@@ -287,6 +306,12 @@ public:
     /// <param name="emitterManager">EmitterManagerのポインタ</param>
     void SetEmitterManager(EmitterManager* emitterManager) { emitterManager_ = emitterManager; }
 
+    /// <summary>
+    /// 弾・弾幕の模様の生成キューを設定
+    /// </summary>
+    /// <param name="spawnQueue">生成キュー</param>
+    void SetSpawnQueue(ProjectileSpawnQueue* spawnQueue) { spawnQueue_ = spawnQueue; }
+
 private:
     // ボスの3Dモデルオブジェクト（描画とアニメーション管理）
     std::unique_ptr<Object3d> model_;
@@ -297,6 +322,9 @@ private:
     // ビヘイビアツリー
     std::unique_ptr<BossBehaviorTree> behaviorTree_;
 
+    // 単体で更新する場合のAIの操作の記録先（毎フレーム使い回す）
+    BossCommandBuffer aiCommands_;
+
 #ifdef _DEBUG
     // ビヘイビアツリーノードエディタ
     std::unique_ptr<BossNodeEditor> nodeEditor_;
@@ -365,8 +393,8 @@ private:
     // 描画用シェイクオフセット
     Vector3 shakeOffset_ = { 0.0f, 0.0f, 0.0f };
 
-    // 弾生成リクエストのキュー（GameSceneが処理）
-    std::vector<BulletSpawnRequest> pendingBullets_;
+    // 弾・弾幕の模様の生成キュー（GameSceneが所有し、まとめて処理）
+    ProjectileSpawnQueue* spawnQueue_ = nullptr;
 
     // HPバースプライト
     std::unique_ptr<Sprite> hpBarSprite1_;
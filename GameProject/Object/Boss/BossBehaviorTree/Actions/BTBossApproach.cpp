@@ -1,5 +1,6 @@
 #include "BTBossApproach.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
 
@@ -10,85 +11,80 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossApproach> kRegistrar("BTBossApproach", { "Approach", BTNodeCategory::Action, { 0.4f, 0.9f, 0.4f, 1.0f } });
+
+}
+
 BTBossApproach::BTBossApproach() {
     name_ = "BossApproach";
 }
 
-BTNodeStatus BTBossApproach::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossApproach::Tick(BTBlackboard* blackboard, BTBossApproachState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     Player* player = blackboard->GetPlayer();
     if (!player) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeApproach(boss, player);
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        InitializeApproach(boss, player, state);
+        state.isFirstExecute = false;
 
         // 既に目標距離内にいる場合は即座に成功
-        if (approachDuration_ <= 0.0f) {
-            isFirstExecute_ = true;
-            status_ = BTNodeStatus::Success;
+        if (state.approachDuration <= 0.0f) {
+            state.isFirstExecute = true;
             return BTNodeStatus::Success;
         }
     }
 
     // 接近移動の更新
-    UpdateApproachMovement(boss, deltaTime);
+    UpdateApproachMovement(boss, state);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // 終了判定（位置ベース）
     Vector3 currentPos = boss->GetTransform().translate;
-    Vector3 diff = currentPos - targetPosition_;
+    Vector3 diff = currentPos - state.targetPosition;
     diff.y = 0.0f;  // 水平距離のみ
     float distanceToTarget = diff.Length();
 
     if (distanceToTarget < kArrivalThreshold) {
         // 目標位置に到達
-        boss->SetTranslate(targetPosition_);
+        boss->SetTranslate(state.targetPosition);
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state.isFirstExecute = true;
+        state.elapsedTime = 0.0f;
         return BTNodeStatus::Success;
     }
 
     // まだ接近中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossApproach::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-    approachDuration_ = 0.0f;
-}
-
-void BTBossApproach::InitializeApproach(Boss* boss, Player* player) {
+void BTBossApproach::InitializeApproach(BossAgent* boss, Player* player, BTBossApproachState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
+    state.elapsedTime = 0.0f;
 
     // 開始位置を記録
-    startPosition_ = boss->GetTransform().translate;
+    state.startPosition = boss->GetTransform().translate;
 
     // プレイヤー位置を取得
     Vector3 playerPos = player->GetTransform().translate;
 
     // プレイヤーへの方向ベクトル
-    Vector3 toPlayer = playerPos - startPosition_;
+    Vector3 toPlayer = playerPos - state.startPosition;
     toPlayer.y = 0.0f;  // 水平面のみ
     float distance = toPlayer.Length();
 
@@ -102,47 +98,45 @@ void BTBossApproach::InitializeApproach(Boss* boss, Player* player) {
         // 目標位置 = プレイヤー位置から targetDistance_ 手前
         float approachDistance = distance - targetDistance_;
         if (approachDistance > 0.0f) {
-            targetPosition_ = startPosition_ + direction * approachDistance;
-            targetPosition_ = ClampToArea(targetPosition_);
+            state.targetPosition = state.startPosition + direction * approachDistance;
+            state.targetPosition = ClampToArea(state.targetPosition);
 
             // 実際の移動距離から所要時間を計算
-            Vector3 actualMove = targetPosition_ - startPosition_;
+            Vector3 actualMove = state.targetPosition - state.startPosition;
             actualMove.y = 0.0f;
             float actualDistance = actualMove.Length();
-            approachDuration_ = actualDistance / approachSpeed_;
+            state.approachDuration = actualDistance / approachSpeed_;
         }
         else {
             // 既に目標距離内にいる
-            targetPosition_ = startPosition_;
-            approachDuration_ = 0.0f;
+            state.targetPosition = state.startPosition;
+            state.approachDuration = 0.0f;
         }
     }
     else {
         // プレイヤーとほぼ同じ位置
-        targetPosition_ = startPosition_;
-        approachDuration_ = 0.0f;
+        state.targetPosition = state.startPosition;
+        state.approachDuration = 0.0f;
     }
 }
 
-void BTBossApproach::UpdateApproachMovement(Boss* boss, float deltaTime) {
-    deltaTime; // 未使用警告抑制
-
-    if (approachDuration_ > 0.0f) {
+void BTBossApproach::UpdateApproachMovement(BossAgent* boss, const BTBossApproachState& state) const {
+    if (state.approachDuration > 0.0f) {
         // 接近中の移動
-        float t = elapsedTime_ / approachDuration_;
+        float t = state.elapsedTime / state.approachDuration;
 
-        // clamp to [0, 1] - これにより elapsedTime_ > approachDuration_ でも t=1.0 となる
+        // clamp to [0, 1] - これにより経過時間が所要時間を超えても t=1.0 となる
         t = std::clamp(t, 0.0f, 1.0f);
 
         // イージング（加速→減速）: smoothstep
         t = t * t * (kEasingCoeffA - kEasingCoeffB * t);
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
     }
 }
 
-Vector3 BTBossApproach::ClampToArea(const Vector3& position) {
+Vector3 BTBossApproach::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
 
     // GameConstantsのステージ境界を使用
@@ -178,8 +172,8 @@ bool BTBossApproach::DrawImGui() {
 
     ImGui::Separator();
     ImGui::Text("Runtime Info:");
-    ImGui::Text("Duration: %.2f sec", approachDuration_);
-    ImGui::Text("Elapsed: %.2f sec", elapsedTime_);
+    ImGui::Text("Duration: %.2f sec", GetOwnState().approachDuration);
+    ImGui::Text("Elapsed: %.2f sec", GetOwnState().elapsedTime);
 
     return changed;
 }
@@ -1,16 +1,27 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
 class Player;
 
+/// <summary>
+/// BTBossApproachのエージェントごとの状態
+/// </summary>
+struct BTBossApproachState {
+    Vector3 startPosition;          ///< 開始位置
+    Vector3 targetPosition;         ///< 目標位置（計算済み）
+    float elapsedTime = 0.0f;       ///< 経過時間
+    float approachDuration = 0.0f;  ///< 接近所要時間（距離から動的計算）
+    bool isFirstExecute = true;     ///< 初回実行フラグ
+};
+
 /// <summary>
 /// ボスのプレイヤー接近アクションノード
 /// プレイヤー方向にイージング移動で素早く接近し、一定距離で停止する
 /// </summary>
-class BTBossApproach : public BTNode {
+class BTBossApproach : public BTLeafNode<BTBossApproachState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -35,13 +46,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossApproachState& state) const override;
 
     // パラメータ取得・設定
     float GetApproachSpeed() const { return approachSpeed_; }
@@ -80,21 +87,22 @@ private:
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="player">プレイヤー</param>
-    void InitializeApproach(Boss* boss, Player* player);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeApproach(BossAgent* boss, Player* player, BTBossApproachState& state) const;
 
     /// <summary>
     /// 接近移動の更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateApproachMovement(Boss* boss, float deltaTime);
+    /// <param name="state">エージェントごとの状態</param>
+    void UpdateApproachMovement(BossAgent* boss, const BTBossApproachState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Vector3 ClampToArea(const Vector3& position);
+    Vector3 ClampToArea(const Vector3& position) const;
 
     //=========================================================================================
     // メンバ変数
@@ -104,10 +112,4 @@ private:
     float approachSpeed_ = 80.0f;      ///< 接近速度
     float targetDistance_ = 12.0f;     ///< 目標距離（プレイヤーからの距離）
 
-    // 状態管理
-    Vector3 startPosition_;            ///< 開始位置
-    Vector3 targetPosition_;           ///< 目標位置（計算済み）
-    float elapsedTime_ = 0.0f;         ///< 経過時間
-    float approachDuration_ = 0.0f;    ///< 接近所要時間（距離から動的計算）
-    bool isFirstExecute_ = true;       ///< 初回実行フラグ
 };
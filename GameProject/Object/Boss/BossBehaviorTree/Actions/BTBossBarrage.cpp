@@ -0,0 +1,166 @@
+#include "BTBossBarrage.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
+#include "../../../Player/Player.h"
+#include "../../../../Common/GameConst.h"
+#include <cmath>
+
+#ifdef _DEBUG
+#include "ImGuiManager.h"
+#endif
+
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossBarrage> kRegistrar("BTBossBarrage", { "Barrage", BTNodeCategory::Action, { 0.9f, 0.5f, 0.2f, 1.0f } });
+
+}
+
+BTBossBarrage::BTBossBarrage() {
+    name_ = "BossBarrage";
+}
+
+BTNodeStatus BTBossBarrage::Tick(BTBlackboard* blackboard, BTBossBarrageState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
+    if (!boss) {
+        return BTNodeStatus::Failure;
+    }
+
+    float deltaTime = blackboard->GetDeltaTime();
+
+    // 初回実行時の初期化
+    if (state.isFirstExecute) {
+        state.elapsedTime = 0.0f;
+        state.totalDuration = chargeTime_ + recoveryTime_;
+        state.hasFired = false;
+        state.isFirstExecute = false;
+    }
+
+    // プレイヤーの方向を向く（発射準備中）
+    if (state.elapsedTime < chargeTime_) {
+        AimAtPlayer(boss);
+    }
+
+    // 模様を発射（弾数によらず生成要求は1件）
+    if (state.elapsedTime >= chargeTime_ && !state.hasFired) {
+        FirePattern(boss);
+        state.hasFired = true;
+    }
+
+    // 経過時間を更新
+    state.elapsedTime += deltaTime;
+
+    // 状態終了チェック
+    if (state.elapsedTime >= state.totalDuration) {
+        state = BTBossBarrageState{};
+        return BTNodeStatus::Success;
+    }
+
+    return BTNodeStatus::Running;
+}
+
+void BTBossBarrage::AimAtPlayer(BossAgent* boss) const {
+    Player* player = boss->GetPlayer();
+    if (!player) {
+        return;
+    }
+
+    Vector3 toPlayer = player->GetTransform().translate - boss->GetTransform().translate;
+    toPlayer.y = 0.0f; // Y軸は無視
+
+    if (toPlayer.Length() > GameConst::kDirectionEpsilon) {
+        boss->SetRotate(Vector3(0.0f, atan2f(toPlayer.x, toPlayer.z), 0.0f));
+    }
+}
+
+void BTBossBarrage::FirePattern(BossAgent* boss) const {
+    BulletPattern pattern = pattern_;
+    pattern.origin = boss->GetTransform().translate;
+
+    // 基準方向はプレイヤーの方向（いなければボスの向き）
+    pattern.baseAngle = boss->GetRotate().y;
+    if (Player* player = boss->GetPlayer()) {
+        Vector3 toPlayer = player->GetTransform().translate - pattern.origin;
+        if (sqrtf(toPlayer.x * toPlayer.x + toPlayer.z * toPlayer.z) > GameConst::kDirectionEpsilon) {
+            pattern.baseAngle = atan2f(toPlayer.x, toPlayer.z);
+        }
+    }
+
+    boss->RequestPatternSpawn(pattern);
+}
+
+nlohmann::json BTBossBarrage::ExtractParameters() const {
+    return {
+        {"chargeTime", chargeTime_},
+        {"recoveryTime", recoveryTime_},
+        {"patternType", static_cast<int>(pattern_.type)},
+        {"bulletCount", pattern_.bulletCount},
+        {"bulletSpeed", pattern_.speed},
+        {"spreadAngle", pattern_.spreadAngle},
+        {"interval", pattern_.interval},
+        {"angularSpeed", pattern_.angularSpeed},
+        {"waveAmplitude", pattern_.waveAmplitude},
+        {"waveFrequency", pattern_.waveFrequency}
+    };
+}
+
+#ifdef _DEBUG
+bool BTBossBarrage::DrawImGui() {
+    bool changed = false;
+
+    if (ImGui::DragFloat("Charge Time##barrage", &chargeTime_, 0.05f, 0.0f, 3.0f)) {
+        changed = true;
+    }
+    if (ImGui::DragFloat("Recovery Time##barrage", &recoveryTime_, 0.05f, 0.0f, 3.0f)) {
+        changed = true;
+    }
+
+    const char* items[] = { "Fan", "Ring", "Spiral", "Wave", "Aimed" };
+    static_assert(static_cast<uint32_t>(IM_ARRAYSIZE(items)) == kBulletPatternTypeCount, "BulletPatternType names out of sync");
+    int type = static_cast<int>(pattern_.type);
+    if (type >= IM_ARRAYSIZE(items)) {
+        type = static_cast<int>(BulletPattern{}.type);
+    }
+    if (ImGui::Combo("Pattern##barrage", &type, items, IM_ARRAYSIZE(items))) {
+        pattern_.type = static_cast<BulletPatternType>(type);
+        changed = true;
+    }
+
+    int bulletCount = static_cast<int>(pattern_.bulletCount);
+    if (ImGui::DragInt("Bullet Count##barrage", &bulletCount, 1, 1, 512)) {
+        pattern_.bulletCount = static_cast<uint32_t>(bulletCount);
+        changed = true;
+    }
+    if (ImGui::DragFloat("Bullet Speed##barrage", &pattern_.speed, 0.5f, 1.0f, 100.0f)) {
+        changed = true;
+    }
+
+    // 種類ごとに使う値だけを表示
+    const BulletPatternType current = pattern_.type;
+    if (current == BulletPatternType::Fan || current == BulletPatternType::Wave || current == BulletPatternType::Aimed) {
+        if (ImGui::SliderAngle("Spread Angle##barrage", &pattern_.spreadAngle, 0.0f, 360.0f)) {
+            changed = true;
+        }
+    }
+    if (current == BulletPatternType::Spiral || current == BulletPatternType::Aimed) {
+        if (ImGui::DragFloat("Interval##barrage", &pattern_.interval, 0.005f, 0.0f, 1.0f)) {
+            changed = true;
+        }
+    }
+    if (current == BulletPatternType::Spiral) {
+        if (ImGui::DragFloat("Angular Speed##barrage", &pattern_.angularSpeed, 0.05f, -10.0f, 10.0f)) {
+            changed = true;
+        }
+    }
+    if (current == BulletPatternType::Wave) {
+        if (ImGui::DragFloat("Wave Amplitude##barrage", &pattern_.waveAmplitude, 0.1f, 0.0f, 20.0f)) {
+            changed = true;
+        }
+        if (ImGui::DragFloat("Wave Frequency##barrage", &pattern_.waveFrequency, 0.05f, 0.0f, 10.0f)) {
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
+#include "../../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../Projectile/BulletPattern.h"
+
+class BossAgent;
+
+/// <summary>
+/// BTBossBarrageのエージェントごとの状態
+/// </summary>
+struct BTBossBarrageState {
+    float elapsedTime = 0.0f;    // 経過時間
+    float totalDuration = 1.0f;  // 状態の総時間（開始時のパラメータから計算）
+    bool hasFired = false;       // 模様を発射済みかどうか
+    bool isFirstExecute = true;  // 初回実行フラグ
+};
+
+/// <summary>
+/// ボスの弾幕アクションノード
+/// 準備中にプレイヤーの方を向き、プレイヤー方向を基準にした模様（扇・円・渦巻き・波・狙い撃ち）を1件の生成要求で発射する
+/// 弾の動きは模様のパラメータだけで決まるため、発射後の弾の管理はBulletPatternSystemが行う
+/// </summary>
+class BTBossBarrage : public BTLeafNode<BTBossBarrageState> {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    BTBossBarrage();
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    virtual ~BTBossBarrage() = default;
+
+    /// <summary>
+    /// ノードの実行
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
+    /// <returns>実行結果</returns>
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossBarrageState& state) const override;
+
+    // パラメータ取得・設定
+    float GetChargeTime() const { return chargeTime_; }
+    void SetChargeTime(float time) { chargeTime_ = time; }
+    float GetRecoveryTime() const { return recoveryTime_; }
+    void SetRecoveryTime(float time) { recoveryTime_ = time; }
+    const BulletPattern& GetPattern() const { return pattern_; }
+    void SetPattern(const BulletPattern& pattern) { pattern_ = pattern; }
+
+    /// <summary>
+    /// JSONからパラメータを適用
+    /// </summary>
+    /// <param name="params">パラメータJSON</param>
+    void ApplyParameters(const nlohmann::json& params) override {
+        if (params.contains("chargeTime")) {
+            chargeTime_ = params["chargeTime"];
+        }
+        if (params.contains("recoveryTime")) {
+            recoveryTime_ = params["recoveryTime"];
+        }
+        if (params.contains("patternType")) {
+            // 範囲外の値は既定の種類にする（範囲外のままだと生成とエディタの表示が壊れる）
+            const int type = params["patternType"].get<int>();
+            pattern_.type = (type >= 0 && type < static_cast<int>(kBulletPatternTypeCount))
+                ? static_cast<BulletPatternType>(type) : BulletPattern{}.type;
+        }
+        if (params.contains("bulletCount")) {
+            pattern_.bulletCount = params["bulletCount"];
+        }
+        if (params.contains("bulletSpeed")) {
+            pattern_.speed = params["bulletSpeed"];
+        }
+        if (params.contains("spreadAngle")) {
+            pattern_.spreadAngle = params["spreadAngle"];
+        }
+        if (params.contains("interval")) {
+            pattern_.interval = params["interval"];
+        }
+        if (params.contains("angularSpeed")) {
+            pattern_.angularSpeed = params["angularSpeed"];
+        }
+        if (params.contains("waveAmplitude")) {
+            pattern_.waveAmplitude = params["waveAmplitude"];
+        }
+        if (params.contains("waveFrequency")) {
+            pattern_.waveFrequency = params["waveFrequency"];
+        }
+    }
+
+    /// <summary>
+    /// パラメータをJSONとして抽出
+    /// </summary>
+    nlohmann::json ExtractParameters() const override;
+
+#ifdef _DEBUG
+    /// <summary>
+    /// ImGuiでパラメータ編集UIを描画
+    /// </summary>
+    bool DrawImGui() override;
+#endif
+
+private:
+    /// <summary>
+    /// プレイヤーを狙う処理
+    /// </summary>
+    /// <param name="boss">ボス</param>
+    void AimAtPlayer(BossAgent* boss) const;
+
+    /// <summary>
+    /// 模様を発射
+    /// </summary>
+    /// <param name="boss">ボス</param>
+    void FirePattern(BossAgent* boss) const;
+
+    // 発射前の準備時間
+    float chargeTime_ = 0.5f;
+
+    // 発射後の硬直時間
+    float recoveryTime_ = 0.8f;
+
+    // 模様（発射位置と基準方向は発射時に決める）
+    BulletPattern pattern_{};
+};
@@ -1,8 +1,8 @@
 #include "BTBossDash.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
-#include "RandomEngine.h"
 
 #include <algorithm>
 #include <cmath>
@@ -11,113 +11,108 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossDash> kRegistrar("BTBossDash", { "Dash", BTNodeCategory::Action, { 0.3f, 0.8f, 0.5f, 1.0f } });
+
+}
+
 BTBossDash::BTBossDash() {
     name_ = "BossDash";
 }
 
-BTNodeStatus BTBossDash::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossDash::Tick(BTBlackboard* blackboard, BTBossDashState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeDash(boss);
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        InitializeDash(boss, blackboard->GetRandom(), state);
+        state.isFirstExecute = false;
     }
 
     // ダッシュ移動の更新
-    UpdateDashMovement(boss, deltaTime);
+    UpdateDashMovement(boss, state);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // ダッシュが完了したか確認
-    if (elapsedTime_ >= dashDuration_) {
+    if (state.elapsedTime >= state.dashDuration) {
         // 最終位置に設定
-        boss->SetTranslate(targetPosition_);
+        boss->SetTranslate(state.targetPosition);
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state.isFirstExecute = true;
+        state.elapsedTime = 0.0f;
         return BTNodeStatus::Success;
     }
 
     // まだダッシュ中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossDash::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-}
-
-void BTBossDash::InitializeDash(Boss* boss) {
+void BTBossDash::InitializeDash(BossAgent* boss, BTRandomStream& rng, BTBossDashState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
+    state.elapsedTime = 0.0f;
+    state.dashDuration = dashDuration_;
 
     // 開始位置を記録
-    startPosition_ = boss->GetTransform().translate;
-
-    // ランダムな方向を生成
-    RandomEngine* rng = RandomEngine::GetInstance();
+    state.startPosition = boss->GetTransform().translate;
 
-    // XZ平面上のランダムな方向を取得（Y=0で正規化済み）
-    dashDirection_ = rng->GetRandomDirectionXZ();
+    // XZ平面上のランダムな方向を取得（Y=0で正規化済み、乱数はエージェントごとの列から引く）
+    state.dashDirection = rng.GetRandomDirectionXZ();
 
     // ランダムなダッシュ距離を取得
-    float dashDistance = rng->GetFloat(minDistance_, maxDistance_);
+    float dashDistance = rng.GetFloat(minDistance_, maxDistance_);
 
     // 目標位置を計算
-    targetPosition_ = startPosition_ + dashDirection_ * dashDistance;
+    state.targetPosition = state.startPosition + state.dashDirection * dashDistance;
 
     // エリア内に収まるよう調整
-    targetPosition_ = ClampToArea(targetPosition_);
+    state.targetPosition = ClampToArea(state.targetPosition);
 
     // ダッシュ方向を再計算（エリア制限後）
-    dashDirection_ = targetPosition_ - startPosition_;
-    float actualDistance = dashDirection_.Length();
+    state.dashDirection = state.targetPosition - state.startPosition;
+    float actualDistance = state.dashDirection.Length();
     if (actualDistance > kDirectionEpsilon) {
-        dashDirection_ = dashDirection_.Normalize();
+        state.dashDirection = state.dashDirection.Normalize();
         // ダッシュ時間を調整（距離に応じて）
-        dashDuration_ = actualDistance / dashSpeed_;
+        state.dashDuration = actualDistance / dashSpeed_;
     }
 
     // ダッシュ方向を向く
-    if (dashDirection_.Length() > kDirectionEpsilon) {
-        float angle = atan2f(dashDirection_.x, dashDirection_.z);
+    if (state.dashDirection.Length() > kDirectionEpsilon) {
+        float angle = atan2f(state.dashDirection.x, state.dashDirection.z);
         boss->SetRotate(Vector3(0.0f, angle, 0.0f));
     }
 }
 
-void BTBossDash::UpdateDashMovement(Boss* boss, float deltaTime) {
-    deltaTime; // 未使用警告抑制
-    if (elapsedTime_ < dashDuration_) {
+void BTBossDash::UpdateDashMovement(BossAgent* boss, const BTBossDashState& state) const {
+    if (state.elapsedTime < state.dashDuration) {
         // ダッシュ中の移動
-        float t = elapsedTime_ / dashDuration_;
+        float t = state.elapsedTime / state.dashDuration;
 
         // イージング（加速→減速）
         t = t * t * (kEasingCoeffA - kEasingCoeffB * t);
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
 
         // ダッシュエフェクト的な表現（少し振動させる）
-        float vibration = sinf(elapsedTime_ * vibrationFreq_) * vibrationAmp_;
+        float vibration = sinf(state.elapsedTime * vibrationFreq_) * vibrationAmp_;
         Vector3 currentPos = boss->GetTransform().translate;
         currentPos.y += vibration;
         boss->SetTranslate(currentPos);
     }
 }
 
-Vector3 BTBossDash::ClampToArea(const Vector3& position) {
+Vector3 BTBossDash::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
 
     // GameConstantsのステージ境界を使用
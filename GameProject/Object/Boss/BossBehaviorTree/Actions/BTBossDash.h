@@ -1,14 +1,26 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
+
+/// <summary>
+/// BTBossDashのエージェントごとの状態
+/// </summary>
+struct BTBossDashState {
+    Vector3 dashDirection;       // ダッシュ方向
+    Vector3 startPosition;       // ダッシュ開始位置
+    Vector3 targetPosition;      // ダッシュ目標位置
+    float dashDuration = 0.0f;   // 今回のダッシュ時間（距離に応じて調整）
+    float elapsedTime = 0.0f;    // 経過時間
+    bool isFirstExecute = true;  // 初回実行フラグ
+};
 
 /// <summary>
 /// ボスのダッシュアクションノード
 /// </summary>
-class BTBossDash : public BTNode {
+class BTBossDash : public BTLeafNode<BTBossDashState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -32,13 +44,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossDashState& state) const override;
 
     // パラメータ取得・設定
     float GetDashSpeed() const { return dashSpeed_; }
@@ -76,43 +84,30 @@ private:
     /// ダッシュパラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeDash(Boss* boss);
+    /// <param name="rng">エージェントの乱数列</param>
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeDash(BossAgent* boss, BTRandomStream& rng, BTBossDashState& state) const;
 
     /// <summary>
     /// ダッシュ移動の更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateDashMovement(Boss* boss, float deltaTime);
+    /// <param name="state">エージェントごとの状態</param>
+    void UpdateDashMovement(BossAgent* boss, const BTBossDashState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Vector3 ClampToArea(const Vector3& position);
-
-    // ダッシュ方向
-    Vector3 dashDirection_;
+    Vector3 ClampToArea(const Vector3& position) const;
 
     // ダッシュ速度
     float dashSpeed_ = 60.0f;
 
-    // ダッシュ時間
+    // ダッシュ時間（距離から求まらない場合の既定値）
     float dashDuration_ = 0.5f;
 
-    // ダッシュ開始位置
-    Vector3 startPosition_;
-
-    // ダッシュ目標位置
-    Vector3 targetPosition_;
-
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
-
     // ダッシュ距離範囲（ImGui調整用）
     float minDistance_ = 10.0f;  ///< 最小ダッシュ距離
     float maxDistance_ = 50.0f;  ///< 最大ダッシュ距離
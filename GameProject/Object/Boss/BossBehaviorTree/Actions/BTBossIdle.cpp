@@ -1,6 +1,8 @@
 #include "BTBossIdle.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
+#include "../BossBlackboardKeys.h"
 #include "Vector3.h"
 #include <cmath>
 #include <numbers>
@@ -9,54 +11,56 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossIdle> kRegistrar("BTBossIdle", { "Idle", BTNodeCategory::Action, { 0.2f, 0.8f, 0.4f, 1.0f } });
+
+}
+
 BTBossIdle::BTBossIdle() {
     name_ = "BossIdle";
 }
 
-BTNodeStatus BTBossIdle::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossIdle::Tick(BTBlackboard* blackboard, BTBossIdleState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        elapsedTime_ = 0.0f;
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        state.elapsedTime = 0.0f;
+        state.isFirstExecute = false;
 
         // 次のアクションカウンターをインクリメント
-        int actionCounter = blackboard->GetInt("ActionCounter", 0);
-        blackboard->SetInt("ActionCounter", actionCounter + 1);
+        int actionCounter = blackboard->GetInt(actionCounterKey_, 0);
+        blackboard->SetInt(actionCounterKey_, actionCounter + 1);
     }
 
     // プレイヤーの方向を向く
     LookAtPlayer(boss, deltaTime);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // 待機時間が経過したら成功を返す
-    if (elapsedTime_ >= idleDuration_) {
-        isFirstExecute_ = true;  // 次回実行時のためにリセット
-        status_ = BTNodeStatus::Success;
+    if (state.elapsedTime >= idleDuration_) {
+        state.isFirstExecute = true;  // 次回実行時のためにリセット
         return BTNodeStatus::Success;
     }
 
     // まだ待機中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossIdle::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
+void BTBossIdle::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    actionCounterKey_ = blackboard.RegisterKey<int>(BossBlackboardKeys::kActionCounter);
 }
 
-void BTBossIdle::LookAtPlayer(Boss* boss, float deltaTime) {
+void BTBossIdle::LookAtPlayer(BossAgent* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -1,13 +1,21 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 
-class Boss;
+class BossAgent;
+
+/// <summary>
+/// BTBossIdleのエージェントごとの状態
+/// </summary>
+struct BTBossIdleState {
+    float elapsedTime = 0.0f;    // 経過時間
+    bool isFirstExecute = true;  // 初回実行フラグ
+};
 
 /// <summary>
 /// ボスの待機アクションノード
 /// </summary>
-class BTBossIdle : public BTNode {
+class BTBossIdle : public BTLeafNode<BTBossIdleState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -29,13 +37,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossIdleState& state) const override;
 
     /// <summary>
     /// 待機時間の設定
@@ -64,6 +68,12 @@ public:
     /// </summary>
     nlohmann::json ExtractParameters() const override;
 
+    /// <summary>
+    /// ブラックボードキーの解決
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    void ResolveBlackboardKeys(BTBlackboard& blackboard) override;
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGuiでパラメータ編集UIを描画
@@ -77,7 +87,7 @@ private:
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void LookAtPlayer(Boss* boss, float deltaTime);
+    void LookAtPlayer(BossAgent* boss, float deltaTime) const;
 
 
     // 待機時間（次の行動までの時間）
@@ -86,9 +96,6 @@ private:
     // 回転速度（ラジアン/秒）
     float rotationSpeed_ = 5.0f;
 
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
+    // 行動カウンターのキーハンドル
+    BTBlackboardKey<int> actionCounterKey_;
 };
\ No newline at end of file
@@ -1,9 +1,8 @@
 #include "BTBossMeleeAttack.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
-#include "../../../../Collision/BossMeleeAttackCollider.h"
 #include "../../../../Common/GameConst.h"
-#include "Object3d.h"
 #include "Mat4x4Func.h"
 #include <cmath>
 #include <algorithm>
@@ -12,60 +11,64 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossMeleeAttack> kRegistrar("BTBossMeleeAttack", { "Melee Attack", BTNodeCategory::Action, { 0.9f, 0.4f, 0.1f, 1.0f } });
+
+}
+
 BTBossMeleeAttack::BTBossMeleeAttack() {
     name_ = "BossMeleeAttack";
 }
 
-BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossMeleeAttack::Tick(BTBlackboard* blackboard, BTBossMeleeAttackState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeMeleeAttack(boss);
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        InitializeMeleeAttack(boss, state);
+        state.isFirstExecute = false;
     }
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
-    phaseTimer_ += deltaTime;
+    state.elapsedTime += deltaTime;
+    state.phaseTimer += deltaTime;
 
     // フェーズに応じた処理
-    switch (currentPhase_) {
+    switch (state.currentPhase) {
     case MeleePhase::Prepare:
-        ProcessPreparePhase(boss, deltaTime);
+        ProcessPreparePhase(boss, deltaTime, state);
         // 準備時間終了でExecuteフェーズへ
-        if (phaseTimer_ >= prepareTime_) {
-            currentPhase_ = MeleePhase::Execute;
-            phaseTimer_ = 0.0f;
+        if (state.phaseTimer >= prepareTime_) {
+            state.currentPhase = MeleePhase::Execute;
+            state.phaseTimer = 0.0f;
             // 予兆エフェクトをOFF
             boss->SetAttackSignEmitterActive(false);
             // コライダーを有効化
-            if (boss->GetMeleeAttackCollider()) {
-                boss->GetMeleeAttackCollider()->SetActive(true);
-                boss->GetMeleeAttackCollider()->Reset();
-                colliderActivated_ = true;
+            if (boss->HasMeleeAttackCollider()) {
+                boss->SetMeleeAttackColliderActive(true);
+                boss->ResetMeleeAttackCollider();
+                state.colliderActivated = true;
             }
             // ★突進の初期化（Execute開始時にプレイヤー位置を確定）
-            InitializeRush(boss);
+            InitializeRush(boss, state);
         }
         break;
 
     case MeleePhase::Execute:
-        ProcessExecutePhase(boss, deltaTime);
+        ProcessExecutePhase(boss, deltaTime, state);
         // 攻撃時間終了でRecoveryフェーズへ
-        if (phaseTimer_ >= attackDuration_) {
-            currentPhase_ = MeleePhase::Recovery;
-            phaseTimer_ = 0.0f;
+        if (state.phaseTimer >= attackDuration_) {
+            state.currentPhase = MeleePhase::Recovery;
+            state.phaseTimer = 0.0f;
             // コライダーを無効化
-            if (boss->GetMeleeAttackCollider()) {
-                boss->GetMeleeAttackCollider()->SetActive(false);
-            }
+            boss->SetMeleeAttackColliderActive(false);
             // ブロックを非表示
             boss->SetMeleeAttackBlockVisible(false);
         }
@@ -74,45 +77,32 @@ BTNodeStatus BTBossMeleeAttack::Execute(BTBlackboard* blackboard) {
     case MeleePhase::Recovery:
         ProcessRecoveryPhase(boss);
         // 硬直時間終了で完了
-        if (phaseTimer_ >= recoveryTime_) {
+        if (state.phaseTimer >= recoveryTime_) {
             // リセットして成功を返す
-            isFirstExecute_ = true;
-            elapsedTime_ = 0.0f;
-            phaseTimer_ = 0.0f;
-            currentPhase_ = MeleePhase::Prepare;
-            colliderActivated_ = false;
-            status_ = BTNodeStatus::Success;
+            state.isFirstExecute = true;
+            state.elapsedTime = 0.0f;
+            state.phaseTimer = 0.0f;
+            state.currentPhase = MeleePhase::Prepare;
+            state.colliderActivated = false;
             return BTNodeStatus::Success;
         }
         break;
     }
 
     // まだ処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossMeleeAttack::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    phaseTimer_ = 0.0f;
-    blockAngle_ = 0.0f;
-    isFirstExecute_ = true;
-    currentPhase_ = MeleePhase::Prepare;
-    colliderActivated_ = false;
-    rushInitialized_ = false;
-}
-
-void BTBossMeleeAttack::InitializeMeleeAttack(Boss* boss) {
+void BTBossMeleeAttack::InitializeMeleeAttack(BossAgent* boss, State& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    phaseTimer_ = 0.0f;
-    blockAngle_ = kBlockStartAngle;
-    currentPhase_ = MeleePhase::Prepare;
-    colliderActivated_ = false;
+    state.elapsedTime = 0.0f;
+    state.phaseTimer = 0.0f;
+    state.blockAngle = kBlockStartAngle;
+    state.currentPhase = MeleePhase::Prepare;
+    state.colliderActivated = false;
 
     // totalDurationを計算
-    totalDuration_ = prepareTime_ + attackDuration_ + recoveryTime_;
+    state.totalDuration = prepareTime_ + attackDuration_ + recoveryTime_;
 
     // ブロックを表示
     boss->SetMeleeAttackBlockVisible(true);
@@ -121,13 +111,13 @@ void BTBossMeleeAttack::InitializeMeleeAttack(Boss* boss) {
     boss->SetAttackSignEmitterActive(true);
 
     // 初期位置を設定
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 
     // 突進フラグをリセット（Execute開始時に初期化する）
-    rushInitialized_ = false;
+    state.rushInitialized = false;
 }
 
-void BTBossMeleeAttack::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::AimAtPlayer(BossAgent* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -160,24 +150,22 @@ void BTBossMeleeAttack::AimAtPlayer(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossMeleeAttack::ProcessPreparePhase(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::ProcessPreparePhase(BossAgent* boss, float deltaTime, const State& state) const {
     // プレイヤーの方向を向く
     AimAtPlayer(boss, deltaTime);
 
     // ブロック位置を更新（振らない、開始位置に固定）
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 
     // 予兆エフェクトの位置を更新
-    Object3d* block = boss->GetMeleeAttackBlock();
-    if (block) {
-        boss->SetAttackSignEmitterPosition(block->GetTransform().translate);
+    if (boss->HasMeleeAttackBlock()) {
+        boss->SetAttackSignEmitterPosition(boss->GetMeleeAttackBlockTransform().translate);
     }
 }
 
-void BTBossMeleeAttack::ProcessExecutePhase(Boss* boss, float deltaTime) {
+void BTBossMeleeAttack::ProcessExecutePhase(BossAgent* boss, float deltaTime, State& state) const {
     // ヒット判定をチェック
-    BossMeleeAttackCollider* collider = boss->GetMeleeAttackCollider();
-    bool hasHit = collider && collider->HasHitPlayer();
+    bool hasHit = boss->HasMeleeAttackHitPlayer();
 
     if (hasHit) {
         // ヒット時: プレイヤーと一定距離を保って停止
@@ -200,28 +188,28 @@ void BTBossMeleeAttack::ProcessExecutePhase(Boss* boss, float deltaTime) {
         }
     } else {
         // ミス時: 通常通り突進
-        float t = phaseTimer_ / attackDuration_;
+        float t = state.phaseTimer / attackDuration_;
         t = std::clamp(t, 0.0f, 1.0f);
         t = t * t * (3.0f - 2.0f * t);  // Smoothstep
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
     }
 
     // ブロックを回転させる（右から左へ）
     float rotationSpeed = swingAngle_ / attackDuration_;
-    blockAngle_ += rotationSpeed * deltaTime;
+    state.blockAngle += rotationSpeed * deltaTime;
 
     // ブロック位置を更新
-    UpdateBlockPosition(boss);
+    UpdateBlockPosition(boss, state);
 }
 
-void BTBossMeleeAttack::ProcessRecoveryPhase(Boss* boss) {
+void BTBossMeleeAttack::ProcessRecoveryPhase(BossAgent* boss) const {
     // 硬直中は特に処理なし
     (void)boss;
 }
 
-Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) {
+Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
     clampedPos.x = std::clamp(clampedPos.x,
         GameConst::kStageXMin + GameConst::kAreaMargin,
@@ -233,46 +221,45 @@ Vector3 BTBossMeleeAttack::ClampToArea(const Vector3& position) {
     return clampedPos;
 }
 
-void BTBossMeleeAttack::InitializeRush(Boss* boss) {
-    rushInitialized_ = true;
-    startPosition_ = boss->GetTransform().translate;
+void BTBossMeleeAttack::InitializeRush(BossAgent* boss, State& state) const {
+    state.rushInitialized = true;
+    state.startPosition = boss->GetTransform().translate;
 
     Player* player = boss->GetPlayer();
     if (player) {
         Vector3 playerPos = player->GetTransform().translate;
-        Vector3 toPlayer = playerPos - startPosition_;
+        Vector3 toPlayer = playerPos - state.startPosition;
         toPlayer.y = 0.0f;
 
         if (toPlayer.Length() > kDirectionEpsilon) {
-            rushDirection_ = toPlayer.Normalize();
+            state.rushDirection = toPlayer.Normalize();
 
             // 突進方向に向く
-            float angle = atan2f(rushDirection_.x, rushDirection_.z);
+            float angle = atan2f(state.rushDirection.x, state.rushDirection.z);
             boss->SetRotate(Vector3(0.0f, angle, 0.0f));
 
             // 目標位置 = 開始位置 + 方向 * 突進距離
-            targetPosition_ = startPosition_ + rushDirection_ * rushDistance_;
-            targetPosition_ = ClampToArea(targetPosition_);
+            state.targetPosition = state.startPosition + state.rushDirection * rushDistance_;
+            state.targetPosition = ClampToArea(state.targetPosition);
         } else {
-            rushDirection_ = Vector3(0.0f, 0.0f, 1.0f);
-            targetPosition_ = startPosition_;
+            state.rushDirection = Vector3(0.0f, 0.0f, 1.0f);
+            state.targetPosition = state.startPosition;
         }
     } else {
-        rushDirection_ = Vector3(0.0f, 0.0f, 1.0f);
-        targetPosition_ = startPosition_;
+        state.rushDirection = Vector3(0.0f, 0.0f, 1.0f);
+        state.targetPosition = state.startPosition;
     }
 }
 
-void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss) {
-    Object3d* block = boss->GetMeleeAttackBlock();
-    if (!block) return;
+void BTBossMeleeAttack::UpdateBlockPosition(BossAgent* boss, const State& state) const {
+    if (!boss->HasMeleeAttackBlock()) return;
 
     // ボスの位置と回転を取得
     Vector3 bossPos = boss->GetTranslate();
     float bossRotY = boss->GetRotate().y;
 
     // ワールド空間での角度を計算
-    float worldAngle = bossRotY + blockAngle_;
+    float worldAngle = bossRotY + state.blockAngle;
 
     // Mat4x4::MakeRotateYで回転行列を作成
     Matrix4x4 rotationMatrix = Mat4x4::MakeRotateY(worldAngle);
@@ -289,13 +276,11 @@ void BTBossMeleeAttack::UpdateBlockPosition(Boss* boss) {
     blockTransform.translate = blockPos;
     blockTransform.rotate = { 0.0f, worldAngle, 0.0f };
     blockTransform.scale = { blockScale_, blockScale_, blockScale_ };
-    block->SetTransform(blockTransform);
-    block->Update();
+    boss->SetMeleeAttackBlockTransform(blockTransform);
 
     // コライダーの向き設定（ボスの向きに追従）
-    BossMeleeAttackCollider* collider = boss->GetMeleeAttackCollider();
-    if (collider && colliderActivated_) {
-        collider->SetOrientation(Mat4x4::MakeRotateY(bossRotY));
+    if (state.colliderActivated) {
+        boss->SetMeleeAttackColliderOrientation(bossRotY);
     }
 }
 
@@ -1,17 +1,43 @@
 #pragma once
 #include <numbers>
 
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
+
+/// <summary>
+/// 近接攻撃のフェーズ
+/// </summary>
+enum class BTBossMeleePhase {
+    Prepare,    ///< 準備フェーズ（プレイヤー方向を向く、予兆表示）
+    Execute,    ///< 攻撃実行フェーズ（ブロック回転、ダメージ判定）
+    Recovery    ///< 硬直フェーズ
+};
+
+/// <summary>
+/// BTBossMeleeAttackのエージェントごとの状態
+/// </summary>
+struct BTBossMeleeAttackState {
+    BTBossMeleePhase currentPhase = BTBossMeleePhase::Prepare; ///< 現在のフェーズ
+    float totalDuration = 1.6f;     ///< 総時間
+    float blockAngle = 0.0f;        ///< 現在のブロック角度
+    float elapsedTime = 0.0f;       ///< 経過時間
+    float phaseTimer = 0.0f;        ///< 現在フェーズのタイマー
+    bool isFirstExecute = true;     ///< 初回実行フラグ
+    bool colliderActivated = false; ///< コライダー有効化済みフラグ
+    bool rushInitialized = false;   ///< 突進初期化済みフラグ
+    Vector3 startPosition;          ///< 突進開始位置
+    Vector3 targetPosition;         ///< 突進目標位置（Execute開始時に固定）
+    Vector3 rushDirection;          ///< 突進方向
+};
 
 /// <summary>
 /// ボスの近接攻撃アクションノード
 /// 準備→攻撃→硬直の3フェーズで武器ブロックを振る
 /// </summary>
-class BTBossMeleeAttack : public BTNode {
+class BTBossMeleeAttack : public BTLeafNode<BTBossMeleeAttackState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -24,14 +50,8 @@ private:
     // 列挙型
     //=========================================================================================
 private:
-    /// <summary>
-    /// 攻撃フェーズ
-    /// </summary>
-    enum class MeleePhase {
-        Prepare,    ///< 準備フェーズ（プレイヤー方向を向く、予兆表示）
-        Execute,    ///< 攻撃実行フェーズ（ブロック回転、ダメージ判定）
-        Recovery    ///< 硬直フェーズ
-    };
+    using MeleePhase = BTBossMeleePhase;
+    using State = BTBossMeleeAttackState;
 
 public:
     /// <summary>
@@ -48,13 +68,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossMeleeAttackState& state) const override;
 
     // パラメータ取得・設定
     float GetPrepareTime() const { return prepareTime_; }
@@ -122,87 +138,75 @@ private:
     /// 攻撃パラメータの初期化
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeMeleeAttack(Boss* boss);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeMeleeAttack(BossAgent* boss, State& state) const;
 
     /// <summary>
     /// プレイヤー方向を向く処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(BossAgent* boss, float deltaTime) const;
 
     /// <summary>
     /// 準備フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void ProcessPreparePhase(Boss* boss, float deltaTime);
+    /// <param name="state">エージェントごとの状態</param>
+    void ProcessPreparePhase(BossAgent* boss, float deltaTime, const State& state) const;
 
     /// <summary>
     /// 攻撃実行フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void ProcessExecutePhase(Boss* boss, float deltaTime);
+    /// <param name="state">エージェントごとの状態</param>
+    void ProcessExecutePhase(BossAgent* boss, float deltaTime, State& state) const;
 
     /// <summary>
     /// 硬直フェーズの処理
     /// </summary>
     /// <param name="boss">ボス</param>
-    void ProcessRecoveryPhase(Boss* boss);
+    void ProcessRecoveryPhase(BossAgent* boss) const;
 
     /// <summary>
     /// ブロック位置の更新（Mat4x4使用）
     /// </summary>
     /// <param name="boss">ボス</param>
-    void UpdateBlockPosition(Boss* boss);
+    /// <param name="state">エージェントごとの状態</param>
+    void UpdateBlockPosition(BossAgent* boss, const State& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Vector3 ClampToArea(const Vector3& position);
+    Vector3 ClampToArea(const Vector3& position) const;
 
     /// <summary>
     /// 突進の初期化（Execute開始時に呼ぶ）
     /// </summary>
     /// <param name="boss">ボス</param>
-    void InitializeRush(Boss* boss);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeRush(BossAgent* boss, State& state) const;
 
     //=========================================================================================
     // メンバ変数
     //=========================================================================================
 private:
-    // フェーズ管理
-    MeleePhase currentPhase_ = MeleePhase::Prepare;
-
     // 時間パラメータ
     float prepareTime_ = 1.0f;      ///< 準備時間
     float attackDuration_ = 0.3f;   ///< 攻撃持続時間
     float recoveryTime_ = 0.3f;     ///< 硬直時間
-    float totalDuration_ = 1.6f;    ///< 総時間
 
     // ブロックパラメータ
     float blockRadius_ = 8.0f;      ///< ボスからの距離
     float blockScale_ = 0.5f;       ///< ブロックスケール
     float swingAngle_ =             ///< 振り幅（π = 180度）
         static_cast<float>(std::numbers::pi);
-    float blockAngle_ = 0.0f;       ///< 現在のブロック角度
-
-    // 状態管理
-    float elapsedTime_ = 0.0f;      ///< 経過時間
-    float phaseTimer_ = 0.0f;       ///< 現在フェーズのタイマー
-    bool isFirstExecute_ = true;    ///< 初回実行フラグ
-    bool colliderActivated_ = false;///< コライダー有効化済みフラグ
 
     // 突進パラメータ
     float rushDistance_ = 20.0f;    ///< 突進距離（ミス時）
     float stopDistance_ = 5.0f;     ///< ヒット時の停止距離（プレイヤーからの距離）
-
-    // 突進状態管理
-    Vector3 startPosition_;         ///< 突進開始位置
-    Vector3 targetPosition_;        ///< 突進目標位置（Execute開始時に固定）
-    Vector3 rushDirection_;         ///< 突進方向
-    bool rushInitialized_ = false;  ///< 突進初期化済みフラグ
 };
@@ -1,5 +1,6 @@
 #include "BTBossRapidFire.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
 #include <cmath>
@@ -8,84 +9,77 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossRapidFire> kRegistrar("BTBossRapidFire", { "Rapid Fire", BTNodeCategory::Action, { 0.9f, 0.2f, 0.5f, 1.0f } });
+
+}
+
 BTBossRapidFire::BTBossRapidFire() {
     name_ = "BossRapidFire";
 }
 
-BTNodeStatus BTBossRapidFire::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossRapidFire::Tick(BTBlackboard* blackboard, BTBossRapidFireState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeRapidFire(boss);
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        InitializeRapidFire(state);
+        state.isFirstExecute = false;
     }
 
     // フェーズ1: チャージ中（プレイヤーに照準）
-    if (elapsedTime_ < chargeTime_) {
+    if (state.elapsedTime < chargeTime_) {
         AimAtPlayer(boss, deltaTime);
     }
     // フェーズ2: 連続発射中（追尾しながら発射）
-    else if (firedCount_ < bulletCount_) {
+    else if (state.firedCount < bulletCount_) {
         // 発射中もプレイヤー方向を追尾
         AimAtPlayer(boss, deltaTime);
 
         // 発射間隔チェック
-        timeSinceLastFire_ += deltaTime;
-        if (timeSinceLastFire_ >= fireInterval_) {
+        state.timeSinceLastFire += deltaTime;
+        if (state.timeSinceLastFire >= fireInterval_) {
             FireBullet(boss);
-            firedCount_++;
-            timeSinceLastFire_ = 0.0f;
+            state.firedCount++;
+            state.timeSinceLastFire = 0.0f;
         }
     }
     // フェーズ3: 硬直中（何もしない）
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // 状態終了チェック
-    if (elapsedTime_ >= totalDuration_) {
+    if (state.elapsedTime >= state.totalDuration) {
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        firedCount_ = 0;
-        timeSinceLastFire_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state = BTBossRapidFireState{};
         return BTNodeStatus::Success;
     }
 
     // まだ射撃処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossRapidFire::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    firedCount_ = 0;
-    timeSinceLastFire_ = 0.0f;
-    isFirstExecute_ = true;
-}
-
-void BTBossRapidFire::InitializeRapidFire(Boss* boss) {
+void BTBossRapidFire::InitializeRapidFire(BTBossRapidFireState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
-    firedCount_ = 0;
+    state.elapsedTime = 0.0f;
+    state.firedCount = 0;
     // 即座に1発目を撃てるように
-    timeSinceLastFire_ = fireInterval_;
+    state.timeSinceLastFire = fireInterval_;
 
     // totalDurationを計算
     // チャージ時間 + (発射間隔 × 弾数) + 硬直時間
-    totalDuration_ = chargeTime_ + (fireInterval_ * static_cast<float>(bulletCount_)) + recoveryTime_;
+    state.totalDuration = chargeTime_ + (fireInterval_ * static_cast<float>(bulletCount_)) + recoveryTime_;
 }
 
-void BTBossRapidFire::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossRapidFire::AimAtPlayer(BossAgent* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -103,7 +97,7 @@ void BTBossRapidFire::AimAtPlayer(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossRapidFire::FireBullet(Boss* boss) {
+void BTBossRapidFire::FireBullet(BossAgent* boss) const {
     // 発射位置（ボスの座標）
     Vector3 firePosition = boss->GetTransform().translate;
 
@@ -114,10 +108,10 @@ void BTBossRapidFire::FireBullet(Boss* boss) {
     Vector3 bulletVelocity = direction * bulletSpeed_;
 
     // ボスに弾生成をリクエスト
-    boss->RequestBulletSpawn(firePosition, bulletVelocity);
+    boss->RequestBulletSpawn(firePosition, bulletVelocity, homingTurnRate_);
 }
 
-Vector3 BTBossRapidFire::CalculateDirectionToPlayer(Boss* boss) {
+Vector3 BTBossRapidFire::CalculateDirectionToPlayer(BossAgent* boss) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         // プレイヤーがいない場合は前方向を返す
@@ -146,7 +140,8 @@ nlohmann::json BTBossRapidFire::ExtractParameters() const {
         {"bulletCount", bulletCount_},
         {"fireInterval", fireInterval_},
         {"bulletSpeed", bulletSpeed_},
-        {"recoveryTime", recoveryTime_}
+        {"recoveryTime", recoveryTime_},
+        {"homingTurnRate", homingTurnRate_}
     };
 }
 
@@ -169,6 +164,9 @@ bool BTBossRapidFire::DrawImGui() {
     if (ImGui::DragFloat("Recovery Time##rapidfire", &recoveryTime_, 0.05f, 0.0f, 3.0f)) {
         changed = true;
     }
+    if (ImGui::SliderAngle("Homing Turn Rate##rapidfire", &homingTurnRate_, 0.0f, 720.0f)) {
+        changed = true;
+    }
 
     return changed;
 }
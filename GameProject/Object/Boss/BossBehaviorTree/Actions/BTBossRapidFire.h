@@ -1,16 +1,27 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
+
+/// <summary>
+/// BTBossRapidFireのエージェントごとの状態
+/// </summary>
+struct BTBossRapidFireState {
+    float elapsedTime = 0.0f;        // 経過時間
+    float totalDuration = 0.0f;      // 状態の総時間（開始時のパラメータから計算）
+    float timeSinceLastFire = 0.0f;  // 前回発射からの経過時間
+    int firedCount = 0;              // 発射済み弾数
+    bool isFirstExecute = true;      // 初回実行フラグ
+};
 
 /// <summary>
 /// ボスの連続追尾射撃アクションノード
 /// プレイヤー方向に連続で弾を発射する攻撃パターン
 /// 発射中もプレイヤーの方向を追尾し続ける
 /// </summary>
-class BTBossRapidFire : public BTNode {
+class BTBossRapidFire : public BTLeafNode<BTBossRapidFireState> {
 public:
     /// <summary>
     /// コンストラクタ
@@ -26,13 +37,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossRapidFireState& state) const override;
 
     // パラメータ取得・設定
     float GetChargeTime() const { return chargeTime_; }
@@ -45,6 +52,8 @@ public:
     void SetBulletSpeed(float speed) { bulletSpeed_ = speed; }
     float GetRecoveryTime() const { return recoveryTime_; }
     void SetRecoveryTime(float time) { recoveryTime_ = time; }
+    float GetHomingTurnRate() const { return homingTurnRate_; }
+    void SetHomingTurnRate(float turnRate) { homingTurnRate_ = turnRate; }
 
     /// <summary>
     /// JSONからパラメータを適用
@@ -66,6 +75,9 @@ public:
         if (params.contains("recoveryTime")) {
             recoveryTime_ = params["recoveryTime"];
         }
+        if (params.contains("homingTurnRate")) {
+            homingTurnRate_ = params["homingTurnRate"];
+        }
     }
 
     /// <summary>
@@ -84,28 +96,28 @@ private:
     /// <summary>
     /// 射撃パラメータの初期化
     /// </summary>
-    /// <param name="boss">ボス</param>
-    void InitializeRapidFire(Boss* boss);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeRapidFire(BTBossRapidFireState& state) const;
 
     /// <summary>
     /// プレイヤーを狙う処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(BossAgent* boss, float deltaTime) const;
 
     /// <summary>
     /// 弾を1発発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireBullet(Boss* boss);
+    void FireBullet(BossAgent* boss) const;
 
     /// <summary>
     /// プレイヤーへの方向を計算
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <returns>プレイヤーへの正規化された方向ベクトル</returns>
-    Vector3 CalculateDirectionToPlayer(Boss* boss);
+    Vector3 CalculateDirectionToPlayer(BossAgent* boss) const;
 
     // 射撃前の準備時間
     float chargeTime_ = 0.5f;
@@ -119,21 +131,9 @@ private:
     // 射撃後の硬直時間
     float recoveryTime_ = 0.5f;
 
-    // 状態の総時間
-    float totalDuration_ = 0.0f;
-
     // 弾の速度
     float bulletSpeed_ = 20.0f;
 
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 発射済み弾数
-    int firedCount_ = 0;
-
-    // 前回発射からの経過時間
-    float timeSinceLastFire_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
+    // 追尾弾の旋回速度（ラジアン/秒、0なら直進弾）
+    float homingTurnRate_ = 0.0f;
 };
@@ -1,5 +1,6 @@
 #include "BTBossRetreat.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
 #include "../../../../Common/GameConst.h"
 #include "Mat4x4Func.h"
@@ -13,85 +14,80 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossRetreat> kRegistrar("BTBossRetreat", { "Retreat", BTNodeCategory::Action, { 0.3f, 0.7f, 0.9f, 1.0f } });
+
+}
+
 BTBossRetreat::BTBossRetreat() {
     name_ = "BossRetreat";
 }
 
-BTNodeStatus BTBossRetreat::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossRetreat::Tick(BTBlackboard* blackboard, BTBossRetreatState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     Player* player = blackboard->GetPlayer();
     if (!player) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeRetreat(boss, player);
-        isFirstExecute_ = false;
+    if (state.isFirstExecute) {
+        InitializeRetreat(boss, player, state);
+        state.isFirstExecute = false;
 
         // 既に目標距離以上離れている場合は即座に成功
-        if (retreatDuration_ <= 0.0f) {
-            isFirstExecute_ = true;
-            status_ = BTNodeStatus::Success;
+        if (state.retreatDuration <= 0.0f) {
+            state.isFirstExecute = true;
             return BTNodeStatus::Success;
         }
     }
 
     // 離脱移動の更新
-    UpdateRetreatMovement(boss, deltaTime);
+    UpdateRetreatMovement(boss, state);
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // 終了判定（位置ベース）
     Vector3 currentPos = boss->GetTransform().translate;
-    Vector3 diff = currentPos - targetPosition_;
+    Vector3 diff = currentPos - state.targetPosition;
     diff.y = 0.0f;  // 水平距離のみ
     float distanceToTarget = diff.Length();
 
     if (distanceToTarget < kArrivalThreshold) {
         // 目標位置に到達
-        boss->SetTranslate(targetPosition_);
+        boss->SetTranslate(state.targetPosition);
 
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        status_ = BTNodeStatus::Success;
+        state.isFirstExecute = true;
+        state.elapsedTime = 0.0f;
         return BTNodeStatus::Success;
     }
 
     // まだ離脱中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossRetreat::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-    retreatDuration_ = 0.0f;
-}
-
-void BTBossRetreat::InitializeRetreat(Boss* boss, Player* player) {
+void BTBossRetreat::InitializeRetreat(BossAgent* boss, Player* player, BTBossRetreatState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
+    state.elapsedTime = 0.0f;
 
     // 開始位置を記録
-    startPosition_ = boss->GetTransform().translate;
+    state.startPosition = boss->GetTransform().translate;
 
     // プレイヤー位置を取得
     Vector3 playerPos = player->GetTransform().translate;
 
     // プレイヤーからボスへの方向ベクトル（離れる方向）
-    Vector3 toRetreat = startPosition_ - playerPos;
+    Vector3 toRetreat = state.startPosition - playerPos;
     toRetreat.y = 0.0f;  // 水平面のみ
     float currentDistance = toRetreat.Length();
 
@@ -102,40 +98,38 @@ void BTBossRetreat::InitializeRetreat(Boss* boss, Player* player) {
         float retreatDistance = targetDistance_ - currentDistance;
         if (retreatDistance > 0.0f) {
             // 壁回避: 最適な離脱方向を探索
-            Vector3 bestDirection = FindBestRetreatDirection(primaryDirection, retreatDistance);
+            Vector3 bestDirection = FindBestRetreatDirection(state.startPosition, primaryDirection, retreatDistance);
 
             // プレイヤーを向いたまま（bestDirectionの逆方向を向く）
             float angle = atan2f(-bestDirection.x, -bestDirection.z);
             boss->SetRotate(Vector3(0.0f, angle, 0.0f));
 
-            targetPosition_ = startPosition_ + bestDirection * retreatDistance;
-            targetPosition_ = ClampToArea(targetPosition_);
+            state.targetPosition = state.startPosition + bestDirection * retreatDistance;
+            state.targetPosition = ClampToArea(state.targetPosition);
 
             // 実際の移動距離から所要時間を計算
-            Vector3 actualMove = targetPosition_ - startPosition_;
+            Vector3 actualMove = state.targetPosition - state.startPosition;
             actualMove.y = 0.0f;
             float actualDistance = actualMove.Length();
-            retreatDuration_ = actualDistance / retreatSpeed_;
+            state.retreatDuration = actualDistance / retreatSpeed_;
         }
         else {
             // 既に目標距離以上離れている
-            targetPosition_ = startPosition_;
-            retreatDuration_ = 0.0f;
+            state.targetPosition = state.startPosition;
+            state.retreatDuration = 0.0f;
         }
     }
     else {
         // プレイヤーとほぼ同じ位置
-        targetPosition_ = startPosition_;
-        retreatDuration_ = 0.0f;
+        state.targetPosition = state.startPosition;
+        state.retreatDuration = 0.0f;
     }
 }
 
-void BTBossRetreat::UpdateRetreatMovement(Boss* boss, float deltaTime) {
-    deltaTime; // 未使用警告抑制
-
-    if (retreatDuration_ > 0.0f) {
+void BTBossRetreat::UpdateRetreatMovement(BossAgent* boss, const BTBossRetreatState& state) const {
+    if (state.retreatDuration > 0.0f) {
         // 離脱中の移動
-        float t = elapsedTime_ / retreatDuration_;
+        float t = state.elapsedTime / state.retreatDuration;
 
         // clamp to [0, 1]
         t = std::clamp(t, 0.0f, 1.0f);
@@ -143,12 +137,12 @@ void BTBossRetreat::UpdateRetreatMovement(Boss* boss, float deltaTime) {
         // イージング（加速→減速）: smoothstep
         t = t * t * (kEasingCoeffA - kEasingCoeffB * t);
 
-        Vector3 newPosition = Vector3::Lerp(startPosition_, targetPosition_, t);
+        Vector3 newPosition = Vector3::Lerp(state.startPosition, state.targetPosition, t);
         boss->SetTranslate(newPosition);
     }
 }
 
-Vector3 BTBossRetreat::ClampToArea(const Vector3& position) {
+Vector3 BTBossRetreat::ClampToArea(const Vector3& position) const {
     Vector3 clampedPos = position;
 
     // GameConstantsのステージ境界を使用
@@ -164,9 +158,9 @@ Vector3 BTBossRetreat::ClampToArea(const Vector3& position) {
     return clampedPos;
 }
 
-Vector3 BTBossRetreat::FindBestRetreatDirection(const Vector3& primaryDirection, float retreatDistance) {
+Vector3 BTBossRetreat::FindBestRetreatDirection(const Vector3& startPosition, const Vector3& primaryDirection, float retreatDistance) const {
     // 元の方向での移動距離を評価
-    float primaryScore = EvaluateDirection(primaryDirection, retreatDistance);
+    float primaryScore = EvaluateDirection(startPosition, primaryDirection, retreatDistance);
 
     // 閾値以上なら元の方向を使用
     if (primaryScore >= kMinRetreatDistance) {
@@ -195,7 +189,7 @@ Vector3 BTBossRetreat::FindBestRetreatDirection(const Vector3& primaryDirection,
 
     // 各方向のスコアを計算
     for (size_t i = 1; i < candidates.size(); ++i) {
-        candidates[i].score = EvaluateDirection(candidates[i].direction, retreatDistance);
+        candidates[i].score = EvaluateDirection(startPosition, candidates[i].direction, retreatDistance);
     }
 
     // 最高スコアの方向を選択
@@ -207,11 +201,11 @@ Vector3 BTBossRetreat::FindBestRetreatDirection(const Vector3& primaryDirection,
     return best->direction;
 }
 
-float BTBossRetreat::EvaluateDirection(const Vector3& direction, float retreatDistance) {
-    Vector3 targetPos = startPosition_ + direction * retreatDistance;
+float BTBossRetreat::EvaluateDirection(const Vector3& startPosition, const Vector3& direction, float retreatDistance) const {
+    Vector3 targetPos = startPosition + direction * retreatDistance;
     targetPos = ClampToArea(targetPos);
 
-    Vector3 actualMove = targetPos - startPosition_;
+    Vector3 actualMove = targetPos - startPosition;
     actualMove.y = 0.0f;
     return actualMove.Length();
 }
@@ -236,8 +230,8 @@ bool BTBossRetreat::DrawImGui() {
 
     ImGui::Separator();
     ImGui::Text("Runtime Info:");
-    ImGui::Text("Duration: %.2f sec", retreatDuration_);
-    ImGui::Text("Elapsed: %.2f sec", elapsedTime_);
+    ImGui::Text("Duration: %.2f sec", GetOwnState().retreatDuration);
+    ImGui::Text("Elapsed: %.2f sec", GetOwnState().elapsedTime);
 
     return changed;
 }
@@ -1,16 +1,27 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
 class Player;
 
+/// <summary>
+/// BTBossRetreatのエージェントごとの状態
+/// </summary>
+struct BTBossRetreatState {
+    Vector3 startPosition;          ///< 開始位置
+    Vector3 targetPosition;         ///< 目標位置（計算済み）
+    float elapsedTime = 0.0f;       ///< 経過時間
+    float retreatDuration = 0.0f;   ///< 離脱所要時間（距離から動的計算）
+    bool isFirstExecute = true;     ///< 初回実行フラグ
+};
+
 /// <summary>
 /// ボスの離脱アクションノード
 /// プレイヤーを向いたまま後方にイージング移動で離れる
 /// </summary>
-class BTBossRetreat : public BTNode {
+class BTBossRetreat : public BTLeafNode<BTBossRetreatState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -36,13 +47,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossRetreatState& state) const override;
 
     // パラメータ取得・設定
     float GetRetreatSpeed() const { return retreatSpeed_; }
@@ -81,37 +88,40 @@ private:
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="player">プレイヤー</param>
-    void InitializeRetreat(Boss* boss, Player* player);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeRetreat(BossAgent* boss, Player* player, BTBossRetreatState& state) const;
 
     /// <summary>
     /// 離脱移動の更新
     /// </summary>
     /// <param name="boss">ボス</param>
-    /// <param name="deltaTime">経過時間</param>
-    void UpdateRetreatMovement(Boss* boss, float deltaTime);
+    /// <param name="state">エージェントごとの状態</param>
+    void UpdateRetreatMovement(BossAgent* boss, const BTBossRetreatState& state) const;
 
     /// <summary>
     /// エリア内に収まる位置を計算
     /// </summary>
     /// <param name="position">調整前の位置</param>
     /// <returns>エリア内に収まる位置</returns>
-    Vector3 ClampToArea(const Vector3& position);
+    Vector3 ClampToArea(const Vector3& position) const;
 
     /// <summary>
     /// 最適な離脱方向を探索（壁回避）
     /// </summary>
+    /// <param name="startPosition">離脱開始位置</param>
     /// <param name="primaryDirection">基本の離脱方向</param>
     /// <param name="retreatDistance">離脱距離</param>
     /// <returns>最適な離脱方向</returns>
-    Vector3 FindBestRetreatDirection(const Vector3& primaryDirection, float retreatDistance);
+    Vector3 FindBestRetreatDirection(const Vector3& startPosition, const Vector3& primaryDirection, float retreatDistance) const;
 
     /// <summary>
     /// 指定方向での移動距離を評価
     /// </summary>
+    /// <param name="startPosition">離脱開始位置</param>
     /// <param name="direction">評価する方向</param>
     /// <param name="retreatDistance">離脱距離</param>
     /// <returns>実際に移動できる距離</returns>
-    float EvaluateDirection(const Vector3& direction, float retreatDistance);
+    float EvaluateDirection(const Vector3& startPosition, const Vector3& direction, float retreatDistance) const;
 
     //=========================================================================================
     // メンバ変数
@@ -121,10 +131,4 @@ private:
     float retreatSpeed_ = 60.0f;       ///< 離脱速度
     float targetDistance_ = 55.0f;     ///< 目標距離（プレイヤーからの距離）
 
-    // 状態管理
-    Vector3 startPosition_;            ///< 開始位置
-    Vector3 targetPosition_;           ///< 目標位置（計算済み）
-    float elapsedTime_ = 0.0f;         ///< 経過時間
-    float retreatDuration_ = 0.0f;     ///< 離脱所要時間（距離から動的計算）
-    bool isFirstExecute_ = true;       ///< 初回実行フラグ
 };
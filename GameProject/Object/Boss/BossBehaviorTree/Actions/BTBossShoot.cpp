@@ -1,5 +1,6 @@
 #include "BTBossShoot.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
 #include <cmath>
 
@@ -7,71 +8,66 @@
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossShoot> kRegistrar("BTBossShoot", { "Shoot", BTNodeCategory::Action, { 0.8f, 0.3f, 0.3f, 1.0f } });
+
+}
+
 BTBossShoot::BTBossShoot() {
     name_ = "BossShoot";
 }
 
-BTNodeStatus BTBossShoot::Execute(BTBlackboard* blackboard) {
-    Boss* boss = blackboard->GetBoss();
+BTNodeStatus BTBossShoot::Tick(BTBlackboard* blackboard, BTBossShootState& state) const {
+    BossAgent* boss = blackboard->GetBoss();
     if (!boss) {
-        status_ = BTNodeStatus::Failure;
         return BTNodeStatus::Failure;
     }
 
     float deltaTime = blackboard->GetDeltaTime();
 
     // 初回実行時の初期化
-    if (isFirstExecute_) {
-        InitializeShoot(boss);
-        isFirstExecute_ = false;
-        hasFired_ = false;
+    if (state.isFirstExecute) {
+        InitializeShoot(state);
+        state.isFirstExecute = false;
+        state.hasFired = false;
     }
 
     // プレイヤーの方向を向く（射撃準備中）
-    if (elapsedTime_ < chargeTime_) {
+    if (state.elapsedTime < chargeTime_) {
         AimAtPlayer(boss, deltaTime);
     }
 
     // 弾を発射
-    if (elapsedTime_ >= chargeTime_ && !hasFired_) {
+    if (state.elapsedTime >= chargeTime_ && !state.hasFired) {
         FireBullets(boss);
-        hasFired_ = true;
+        state.hasFired = true;
     }
 
     // 経過時間を更新
-    elapsedTime_ += deltaTime;
+    state.elapsedTime += deltaTime;
 
     // 状態終了チェック
-    if (elapsedTime_ >= totalDuration_) {
+    if (state.elapsedTime >= state.totalDuration) {
         // リセットして成功を返す
-        isFirstExecute_ = true;
-        elapsedTime_ = 0.0f;
-        hasFired_ = false;
-        status_ = BTNodeStatus::Success;
+        state = BTBossShootState{};
         return BTNodeStatus::Success;
     }
 
     // まだ射撃処理中
-    status_ = BTNodeStatus::Running;
     return BTNodeStatus::Running;
 }
 
-void BTBossShoot::Reset() {
-    BTNode::Reset();
-    elapsedTime_ = 0.0f;
-    isFirstExecute_ = true;
-    hasFired_ = false;
-}
-
-void BTBossShoot::InitializeShoot(Boss* boss) {
+void BTBossShoot::InitializeShoot(BTBossShootState& state) const {
     // タイマーリセット
-    elapsedTime_ = 0.0f;
+    state.elapsedTime = 0.0f;
 
     // totalDurationを計算
-    totalDuration_ = chargeTime_ + recoveryTime_;
+    state.totalDuration = chargeTime_ + recoveryTime_;
 }
 
-void BTBossShoot::AimAtPlayer(Boss* boss, float deltaTime) {
+void BTBossShoot::AimAtPlayer(BossAgent* boss, float deltaTime) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -89,7 +85,7 @@ void BTBossShoot::AimAtPlayer(Boss* boss, float deltaTime) {
     }
 }
 
-void BTBossShoot::FireBullets(Boss* boss) {
+void BTBossShoot::FireBullets(BossAgent* boss) const {
     Player* player = boss->GetPlayer();
     if (!player) {
         return;
@@ -129,7 +125,7 @@ void BTBossShoot::FireBullets(Boss* boss) {
     }
 }
 
-Vector3 BTBossShoot::CalculateBulletDirection(const Vector3& baseDirection, float angleOffset) {
+Vector3 BTBossShoot::CalculateBulletDirection(const Vector3& baseDirection, float angleOffset) const {
     if (std::abs(angleOffset) < kAngleEpsilon) {
         // オフセットがない場合はそのまま返す
         return baseDirection;
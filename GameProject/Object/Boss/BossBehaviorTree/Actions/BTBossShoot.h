@@ -1,14 +1,24 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 #include "Vector3.h"
 
-class Boss;
+class BossAgent;
+
+/// <summary>
+/// BTBossShootのエージェントごとの状態
+/// </summary>
+struct BTBossShootState {
+    float elapsedTime = 0.0f;    // 経過時間
+    float totalDuration = 1.0f;  // 状態の総時間（開始時のパラメータから計算）
+    bool hasFired = false;       // 弾が発射済みかどうか
+    bool isFirstExecute = true;  // 初回実行フラグ
+};
 
 /// <summary>
 /// ボスの射撃アクションノード
 /// </summary>
-class BTBossShoot : public BTNode {
+class BTBossShoot : public BTLeafNode<BTBossShootState> {
     //=========================================================================================
     // 定数
     //=========================================================================================
@@ -31,13 +41,9 @@ public:
     /// ノードの実行
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">エージェントごとの状態</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTBossShootState& state) const override;
 
     // パラメータ取得・設定
     float GetChargeTime() const { return chargeTime_; }
@@ -84,21 +90,21 @@ private:
     /// <summary>
     /// 射撃パラメータの初期化
     /// </summary>
-    /// <param name="boss">ボス</param>
-    void InitializeShoot(Boss* boss);
+    /// <param name="state">エージェントごとの状態</param>
+    void InitializeShoot(BTBossShootState& state) const;
 
     /// <summary>
     /// プレイヤーを狙う処理
     /// </summary>
     /// <param name="boss">ボス</param>
     /// <param name="deltaTime">経過時間</param>
-    void AimAtPlayer(Boss* boss, float deltaTime);
+    void AimAtPlayer(BossAgent* boss, float deltaTime) const;
 
     /// <summary>
     /// 弾を発射
     /// </summary>
     /// <param name="boss">ボス</param>
-    void FireBullets(Boss* boss);
+    void FireBullets(BossAgent* boss) const;
 
     /// <summary>
     /// 弾の発射方向を計算
@@ -106,7 +112,7 @@ private:
     /// <param name="baseDirection">基準方向</param>
     /// <param name="angleOffset">角度オフセット（ラジアン）</param>
     /// <returns>発射方向</returns>
-    Vector3 CalculateBulletDirection(const Vector3& baseDirection, float angleOffset);
+    Vector3 CalculateBulletDirection(const Vector3& baseDirection, float angleOffset) const;
 
     // 射撃前の準備時間
     float chargeTime_ = 0.5f;
@@ -114,24 +120,12 @@ private:
     // 射撃後の硬直時間
     float recoveryTime_ = 0.5f;
 
-    // 状態の総時間
-    float totalDuration_ = 1.0f;
-
-    // 弾が発射済みかどうか
-    bool hasFired_ = false;
-
     // 弾の速度
     float bulletSpeed_ = 20.0f;
 
     // 扇状発射の角度（ラジアン）
     float spreadAngle_ = 0.2618f; // 約15度
 
-    // 経過時間
-    float elapsedTime_ = 0.0f;
-
-    // 初回実行フラグ
-    bool isFirstExecute_ = true;
-
     // 弾数（ImGui調整用）
     int bulletCount_ = 3;  ///< 発射する弾数
 };
\ No newline at end of file
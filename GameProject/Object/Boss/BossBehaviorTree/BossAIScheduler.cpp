@@ -0,0 +1,63 @@
+#include "BossAIScheduler.h"
+#include "BossBehaviorTree.h"
+#include "../Boss.h"
+
+BossAIScheduler::BossAIScheduler(uint32_t threadCount)
+    : pool_(threadCount) {
+    workerBuffers_.resize(pool_.GetThreadCount());
+}
+
+void BossAIScheduler::Update(const std::vector<Boss*>& bosses, float deltaTime) {
+    // HPバー・フェーズの更新（AIが読む状態を確定させる）
+    for (Boss* boss : bosses) {
+        boss->UpdateBeforeAI();
+    }
+
+    for (BossCommandBuffer& buffer : workerBuffers_) {
+        buffer.Clear();
+    }
+
+    // コンパイル済みツリー・固定ツリーはボスごとに状態が分かれているので並列に実行できる
+    parallelAgents_.clear();
+    for (Boss* boss : bosses) {
+        if (boss->IsAIActive() && boss->GetBehaviorTree()->CanTickInParallel()) {
+            parallelAgents_.push_back(boss);
+        }
+    }
+    parallelAgentCount_ = parallelAgents_.size();
+    spans_.resize(parallelAgents_.size());
+
+    pool_.ParallelFor(parallelAgents_.size(), [&](size_t index, uint32_t worker) {
+        BossCommandBuffer& buffer = workerBuffers_[worker];
+        CommandSpan& span = spans_[index];
+        span.worker = worker;
+        span.begin = buffer.GetSize();
+        parallelAgents_[index]->GetBehaviorTree()->Update(deltaTime, buffer);
+        span.end = buffer.GetSize();
+    });
+
+    // ボスの並び順に適用し、ポインタツリーのボスはその場で順番に更新する
+    BossCommandBuffer& mainBuffer = workerBuffers_[0];
+    size_t parallelIndex = 0;
+    for (Boss* boss : bosses) {
+        if (!boss->IsAIActive()) {
+            continue;
+        }
+
+        if (parallelIndex < parallelAgents_.size() && parallelAgents_[parallelIndex] == boss) {
+            const CommandSpan& span = spans_[parallelIndex++];
+            const BossCommandBuffer& buffer = workerBuffers_[span.worker];
+            BossCommandBuffer::Apply(*boss, buffer.GetData() + span.begin, span.end - span.begin);
+            continue;
+        }
+
+        size_t begin = mainBuffer.GetSize();
+        boss->GetBehaviorTree()->Update(deltaTime, mainBuffer);
+        BossCommandBuffer::Apply(*boss, mainBuffer.GetData() + begin, mainBuffer.GetSize() - begin);
+    }
+
+    // エフェクト・モデルの更新
+    for (Boss* boss : bosses) {
+        boss->UpdateAfterAI(deltaTime);
+    }
+}
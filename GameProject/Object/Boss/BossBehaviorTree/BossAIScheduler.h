@@ -0,0 +1,64 @@
+#pragma once
+#include "BossCommandBuffer.h"
+#include "../../../Common/WorkerPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Boss;
+
+/// <summary>
+/// 複数のボスのAIをまとめて更新するスケジューラー
+/// コンパイル済みツリー・固定ツリーを使うボスはワーカースレッドで並列にTickし、操作はワーカーごとのバッファへ記録する
+/// 適用はメインスレッドでボスの並び順に行うため、結果はスレッド数に関係なく単体で順番に更新した場合と同じになる
+/// </summary>
+class BossAIScheduler {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="threadCount">呼び出し元を含むスレッド数（0ならハードウェアスレッド数）</param>
+    explicit BossAIScheduler(uint32_t threadCount = 0);
+
+    /// <summary>
+    /// 全ボスの1フレーム分の更新（Boss::Updateの代わりに呼ぶ）
+    /// </summary>
+    /// <param name="bosses">更新するボス</param>
+    /// <param name="deltaTime">経過時間</param>
+    void Update(const std::vector<Boss*>& bosses, float deltaTime);
+
+    /// <summary>
+    /// 呼び出し元を含むスレッド数の取得
+    /// </summary>
+    /// <returns>スレッド数</returns>
+    uint32_t GetThreadCount() const { return pool_.GetThreadCount(); }
+
+    /// <summary>
+    /// 直前のフレームで並列にTickしたボスの数
+    /// </summary>
+    /// <returns>ボスの数</returns>
+    size_t GetParallelAgentCount() const { return parallelAgentCount_; }
+
+private:
+    /// <summary>
+    /// ボス1体分の操作の記録範囲
+    /// </summary>
+    struct CommandSpan {
+        uint32_t worker = 0; // 記録したワーカー
+        size_t begin = 0;    // 記録の先頭
+        size_t end = 0;      // 記録の終端
+    };
+
+    // ワーカースレッド
+    WorkerPool pool_;
+
+    // ワーカーごとの操作の記録先（毎フレーム使い回す）
+    std::vector<BossCommandBuffer> workerBuffers_;
+
+    // 並列にTickするボスとその記録範囲
+    std::vector<Boss*> parallelAgents_;
+    std::vector<CommandSpan> spans_;
+
+    // 直前のフレームで並列にTickしたボスの数
+    size_t parallelAgentCount_ = 0;
+};
@@ -0,0 +1,110 @@
+#include "BossAgent.h"
+#include "../Boss.h"
+#include "../../../Collision/BossMeleeAttackCollider.h"
+#include "Object3d.h"
+
+void BossAgent::BeginTick(BossCommandBuffer* commands) {
+    commands_ = commands;
+
+    player_ = boss_->GetPlayer();
+    transform_ = boss_->GetTransform();
+    hp_ = boss_->GetHp();
+    phase_ = boss_->GetPhase();
+    transformDirty_ = false;
+
+    const Object3d* block = boss_->GetMeleeAttackBlock();
+    hasMeleeBlock_ = block != nullptr;
+    meleeBlockTransform_ = block ? block->GetTransform() : Transform{};
+    meleeBlockDirty_ = false;
+
+    const BossMeleeAttackCollider* collider = boss_->GetMeleeAttackCollider();
+    hasMeleeCollider_ = collider != nullptr;
+    meleeHitPlayer_ = collider && collider->HasHitPlayer();
+}
+
+void BossAgent::EndTick() {
+    // 移動は1フレームに何度設定しても最終値だけを反映すればよい
+    if (transformDirty_) {
+        BossCommand command;
+        command.type = BossCommandType::SetTransform;
+        command.transform = transform_;
+        Record(command);
+        transformDirty_ = false;
+    }
+    if (meleeBlockDirty_) {
+        BossCommand command;
+        command.type = BossCommandType::SetMeleeBlockTransform;
+        command.transform = meleeBlockTransform_;
+        Record(command);
+        meleeBlockDirty_ = false;
+    }
+    commands_ = nullptr;
+}
+
+void BossAgent::RequestBulletSpawn(const Vector3& position, const Vector3& velocity, float turnRate) {
+    BossCommand command;
+    command.type = BossCommandType::SpawnBullet;
+    command.transform.translate = position;
+    command.velocity = velocity;
+    command.turnRate = turnRate;
+    Record(command);
+}
+
+void BossAgent::RequestPatternSpawn(const BulletPattern& pattern) {
+    BossCommand command;
+    command.type = BossCommandType::SpawnPattern;
+    command.pattern = pattern;
+    Record(command);
+}
+
+void BossAgent::SetAttackSignEmitterActive(bool active) {
+    BossCommand command;
+    command.type = BossCommandType::SetAttackSignActive;
+    command.flag = active;
+    Record(command);
+}
+
+void BossAgent::SetAttackSignEmitterPosition(const Vector3& position) {
+    BossCommand command;
+    command.type = BossCommandType::SetAttackSignPosition;
+    command.transform.translate = position;
+    Record(command);
+}
+
+void BossAgent::SetMeleeAttackBlockVisible(bool visible) {
+    BossCommand command;
+    command.type = BossCommandType::SetMeleeBlockVisible;
+    command.flag = visible;
+    Record(command);
+}
+
+void BossAgent::SetMeleeAttackColliderActive(bool active) {
+    if (!hasMeleeCollider_) {
+        return;
+    }
+    BossCommand command;
+    command.type = BossCommandType::SetMeleeColliderActive;
+    command.flag = active;
+    Record(command);
+}
+
+void BossAgent::ResetMeleeAttackCollider() {
+    if (!hasMeleeCollider_) {
+        return;
+    }
+    // 同じフレームの判定にも反映されるよう、複製したヒット状態も戻す
+    meleeHitPlayer_ = false;
+    BossCommand command;
+    command.type = BossCommandType::ResetMeleeCollider;
+    Record(command);
+}
+
+void BossAgent::SetMeleeAttackColliderOrientation(float rotateY) {
+    if (!hasMeleeCollider_) {
+        return;
+    }
+    BossCommand command;
+    command.type = BossCommandType::SetMeleeColliderOrientation;
+    command.angle = rotateY;
+    Record(command);
+}
@@ -0,0 +1,212 @@
+#pragma once
+#include "BossCommandBuffer.h"
+#include "Transform.h"
+#include "Vector3.h"
+#include <cstdint>
+
+class Boss;
+class Player;
+
+/// <summary>
+/// ビヘイビアツリーから見たボス
+/// Tick中の読み書きは更新開始時に複製したボスの状態に対して行い、
+/// ボス本体や共有のシステムへの副作用はBossCommandBufferへ記録する
+/// そのため、別々のボスのツリーを複数のスレッドで同時に実行できる
+/// （ボス本体への反映はメインスレッドでBossCommandBuffer::Applyを呼んだ時点）
+/// </summary>
+class BossAgent {
+public:
+    /// <summary>
+    /// コンストラクタ
+    /// </summary>
+    /// <param name="boss">操作するボス</param>
+    explicit BossAgent(Boss* boss) : boss_(boss) {}
+
+    /// <summary>
+    /// 1フレーム分の更新の開始（ボスの状態を複製し、記録先を設定）
+    /// </summary>
+    /// <param name="commands">操作の記録先</param>
+    void BeginTick(BossCommandBuffer* commands);
+
+    /// <summary>
+    /// 1フレーム分の更新の終了（変更したトランスフォームを記録）
+    /// </summary>
+    void EndTick();
+
+    //-----------------------------読み取り------------------------------//
+
+    /// <summary>
+    /// 操作するボスの取得（読み取り専用）
+    /// </summary>
+    /// <returns>ボス</returns>
+    const Boss* GetBoss() const { return boss_; }
+
+    /// <summary>
+    /// 座標変換情報の取得（このフレームで設定した値を含む）
+    /// </summary>
+    /// <returns>座標変換情報</returns>
+    const Transform& GetTransform() const { return transform_; }
+
+    /// <summary>
+    /// 座標の取得
+    /// </summary>
+    /// <returns>座標</returns>
+    Vector3 GetTranslate() const { return transform_.translate; }
+
+    /// <summary>
+    /// 回転の取得
+    /// </summary>
+    /// <returns>回転</returns>
+    Vector3 GetRotate() const { return transform_.rotate; }
+
+    /// <summary>
+    /// プレイヤーの取得（読み取り専用で使う）
+    /// </summary>
+    /// <returns>プレイヤー</returns>
+    Player* GetPlayer() const { return player_; }
+
+    /// <summary>
+    /// HPの取得
+    /// </summary>
+    /// <returns>HP</returns>
+    float GetHp() const { return hp_; }
+
+    /// <summary>
+    /// フェーズの取得
+    /// </summary>
+    /// <returns>フェーズ</returns>
+    uint32_t GetPhase() const { return phase_; }
+
+    //-----------------------------移動------------------------------//
+
+    /// <summary>
+    /// 座標変換情報の設定
+    /// </summary>
+    /// <param name="transform">座標変換情報</param>
+    void SetTransform(const Transform& transform) { transform_ = transform; transformDirty_ = true; }
+
+    /// <summary>
+    /// 座標の設定
+    /// </summary>
+    /// <param name="translate">座標</param>
+    void SetTranslate(const Vector3& translate) { transform_.translate = translate; transformDirty_ = true; }
+
+    /// <summary>
+    /// 回転の設定
+    /// </summary>
+    /// <param name="rotate">回転</param>
+    void SetRotate(const Vector3& rotate) { transform_.rotate = rotate; transformDirty_ = true; }
+
+    //-----------------------------弾・エフェクト------------------------------//
+
+    /// <summary>
+    /// 弾の生成要求
+    /// </summary>
+    /// <param name="position">発射位置</param>
+    /// <param name="velocity">速度</param>
+    /// <param name="turnRate">追尾の旋回速度（ラジアン/秒、0なら直進）</param>
+    void RequestBulletSpawn(const Vector3& position, const Vector3& velocity, float turnRate = 0.0f);
+
+    /// <summary>
+    /// 弾幕の模様の生成要求（弾数によらず1件）
+    /// </summary>
+    /// <param name="pattern">模様</param>
+    void RequestPatternSpawn(const BulletPattern& pattern);
+
+    /// <summary>
+    /// 予兆エフェクトの有効・無効
+    /// </summary>
+    /// <param name="active">有効にする場合true</param>
+    void SetAttackSignEmitterActive(bool active);
+
+    /// <summary>
+    /// 予兆エフェクトの位置
+    /// </summary>
+    /// <param name="position">位置</param>
+    void SetAttackSignEmitterPosition(const Vector3& position);
+
+    //-----------------------------近接攻撃------------------------------//
+
+    /// <summary>
+    /// 近接攻撃ブロックがあるか
+    /// </summary>
+    /// <returns>ある場合true</returns>
+    bool HasMeleeAttackBlock() const { return hasMeleeBlock_; }
+
+    /// <summary>
+    /// 近接攻撃ブロックの表示
+    /// </summary>
+    /// <param name="visible">表示する場合true</param>
+    void SetMeleeAttackBlockVisible(bool visible);
+
+    /// <summary>
+    /// 近接攻撃ブロックの座標変換情報の取得（このフレームで設定した値を含む）
+    /// </summary>
+    /// <returns>座標変換情報</returns>
+    const Transform& GetMeleeAttackBlockTransform() const { return meleeBlockTransform_; }
+
+    /// <summary>
+    /// 近接攻撃ブロックの座標変換情報の設定
+    /// </summary>
+    /// <param name="transform">座標変換情報</param>
+    void SetMeleeAttackBlockTransform(const Transform& transform) { meleeBlockTransform_ = transform; meleeBlockDirty_ = true; }
+
+    /// <summary>
+    /// 近接攻撃コライダーがあるか
+    /// </summary>
+    /// <returns>ある場合true</returns>
+    bool HasMeleeAttackCollider() const { return hasMeleeCollider_; }
+
+    /// <summary>
+    /// 近接攻撃がプレイヤーに当たったか（直前の衝突判定の結果）
+    /// </summary>
+    /// <returns>当たった場合true</returns>
+    bool HasMeleeAttackHitPlayer() const { return meleeHitPlayer_; }
+
+    /// <summary>
+    /// 近接攻撃コライダーの有効・無効
+    /// </summary>
+    /// <param name="active">有効にする場合true</param>
+    void SetMeleeAttackColliderActive(bool active);
+
+    /// <summary>
+    /// 近接攻撃コライダーのヒット状態のリセット
+    /// </summary>
+    void ResetMeleeAttackCollider();
+
+    /// <summary>
+    /// 近接攻撃コライダーの向きの設定
+    /// </summary>
+    /// <param name="rotateY">Y軸回転（ラジアン）</param>
+    void SetMeleeAttackColliderOrientation(float rotateY);
+
+private:
+    /// <summary>
+    /// 操作の記録
+    /// </summary>
+    void Record(const BossCommand& command) {
+        if (commands_) {
+            commands_->Push(command);
+        }
+    }
+
+    // 操作するボス
+    Boss* boss_ = nullptr;
+
+    // 操作の記録先（Tick中のみ有効）
+    BossCommandBuffer* commands_ = nullptr;
+
+    // 更新開始時に複製したボスの状態
+    Player* player_ = nullptr;
+    Transform transform_{};
+    float hp_ = 0.0f;
+    uint32_t phase_ = 1;
+    bool transformDirty_ = false;
+
+    // 近接攻撃の状態
+    Transform meleeBlockTransform_{};
+    bool hasMeleeBlock_ = false;
+    bool meleeBlockDirty_ = false;
+    bool hasMeleeCollider_ = false;
+    bool meleeHitPlayer_ = false;
+};
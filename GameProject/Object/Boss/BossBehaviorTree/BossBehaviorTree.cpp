@@ -9,30 +9,128 @@
 #include "../Boss.h"
 #include "../../Player/Player.h"
 #include "../BossBehaviorTree/BossNodeFactory.h"
+#include "BossBlackboardKeys.h"
+#include "../../../BehaviorTree/Core/BTTreeCooker.h"
+#include "../../../BehaviorTree/Core/BTTreeLoader.h"
+#include "RandomEngine.h"
+#include <climits>
 #include <fstream>
+#include <mutex>
 #include <unordered_map>
 
-BossBehaviorTree::BossBehaviorTree(Boss* boss, Player* player) {
+namespace {
+
+    /// <summary>
+    /// ツリー読み込み用のノード生成
+    /// </summary>
+    BTNodePtr CreateBossNode(const std::string& nodeType) {
+        return BossNodeFactory::CreateNode(nodeType);
+    }
+
+    /// <summary>
+    /// JSONファイルからノードツリーを構築
+    /// </summary>
+    BTNodePtr ReadTreeJSON(const std::string& filepath) {
+        std::ifstream file(filepath);
+        if (!file.is_open()) {
+            return nullptr;
+        }
+
+        nlohmann::json json;
+        file >> json;
+        file.close();
+
+        // 親子関係の解決はクッカーと共通（リンクは一度だけ走査する）
+        return BTTreeLoader::LoadFromJSON(json, CreateBossNode);
+    }
+
+    /// <summary>
+    /// ファイルパスごとの共有定義
+    /// 定義は使っているボスがいなくなれば解放される
+    /// キー構成は定義内のノードが解決したハンドルに対応するブラックボードのキー（値は持たない）
+    /// </summary>
+    struct SharedDefinition {
+        std::weak_ptr<const BTCompiledTree> definition;
+        std::shared_ptr<const BTBlackboard> keyLayout;
+    };
+
+    std::mutex gSharedDefinitionMutex;
+    std::unordered_map<std::string, SharedDefinition> gSharedDefinitions;
+
+}
+
+BossBehaviorTree::BossBehaviorTree(Boss* boss, Player* player)
+    : agent_(boss) {
     // ブラックボードの初期化
     blackboard_ = std::make_unique<BTBlackboard>();
-    blackboard_->SetBoss(boss);
+    blackboard_->SetBoss(&agent_);
     blackboard_->SetPlayer(player);
-    blackboard_->SetInt("ActionCounter", 0);
+
+    // ツリー内で使う乱数列（生成順で決まるので、全体のシードが同じなら毎回同じ列になる）
+    blackboard_->GetRandom().Seed(static_cast<uint32_t>(RandomEngine::GetInstance()->GetInt(0, INT_MAX)));
+
+    actionCounterKey_ = blackboard_->RegisterKey<int>(BossBlackboardKeys::kActionCounter);
+    blackboard_->SetInt(actionCounterKey_, 0);
+    hpPercentKey_ = blackboard_->RegisterKey<float>(BossBlackboardKeys::kBossHpPercent);
+    phaseKey_ = blackboard_->RegisterKey<int>(BossBlackboardKeys::kBossPhase);
+    playerDistanceKey_ = blackboard_->RegisterKey<float>(BossBlackboardKeys::kPlayerDistance);
 
     // ツリーを読み込み
-    LoadFromJSON("resources/Json/BossTree.json");
+    LoadTree("resources/Json/BossTree.json");
 }
 
 BossBehaviorTree::~BossBehaviorTree() = default;
 
-void BossBehaviorTree::Update(float deltaTime) {
-    if (!rootNode_) {
+void BossBehaviorTree::Update(float deltaTime, BossCommandBuffer& commands) {
+    if (!rootNode_ && !useStaticTree_) {
         return;
     }
 
+    // ボスの状態を複製し、副作用の記録先を設定
+    agent_.BeginTick(&commands);
+
     // ブラックボードにデルタータイムを設定
     blackboard_->SetDeltaTime(deltaTime);
 
+    // 条件ノードが参照する状態を更新（値が変わったキーだけ変更として記録される）
+    PublishBossState();
+
+    // ツリーを実行
+    TickTree();
+
+    // このフレームの移動を記録
+    agent_.EndTick();
+}
+
+void BossBehaviorTree::SetRandomSeed(uint32_t seed) {
+    blackboard_->GetRandom().Seed(seed);
+}
+
+void BossBehaviorTree::TickTree() {
+    // 固定ツリーで実行
+    if (useStaticTree_) {
+        if (staticTree_.Tick(blackboard_.get(), staticState_) != BTNodeStatus::Running) {
+            BossStaticTree::Tree::Reset(staticState_);
+        }
+        return;
+    }
+
+    // コンパイル済みツリーで実行
+    if (IsUsingCompiledTree()) {
+        BTNodeStatus status = treeInstance_.Tick(blackboard_.get());
+
+        // 完了したらリセット
+        if (status != BTNodeStatus::Running) {
+            treeInstance_.Reset();
+        }
+        return;
+    }
+
+    // 共有定義を読み込んだ時点で直接実行に切り替えていた場合は、ここで専用のノードを作る
+    if (sharesNodes_ && !BuildPrivateNodes()) {
+        return;
+    }
+
     // 実行前に実行中ノード情報をクリア
     currentRunningNode_ = nullptr;
 
@@ -49,10 +147,14 @@ void BossBehaviorTree::Update(float deltaTime) {
 }
 
 void BossBehaviorTree::Reset() {
-    if (rootNode_) {
+    // 共有しているノードは他のボスも参照しているので触れない
+    if (rootNode_ && !sharesNodes_) {
         rootNode_->Reset();
     }
-    blackboard_->SetInt("ActionCounter", 0);
+    treeInstance_.Reset();
+    BossStaticTree::Tree::Reset(staticState_);
+    currentRunningNode_ = nullptr;
+    blackboard_->SetInt(actionCounterKey_, 0);
 }
 
 void BossBehaviorTree::SetPlayer(Player* player) {
@@ -63,9 +165,170 @@ const std::string& BossBehaviorTree::GetCurrentNodeName() const {
     return currentNodeName_;
 }
 
+BTNodePtr BossBehaviorTree::GetCurrentRunningNode() const {
+    // 固定ツリーはノードオブジェクトを持たないので表示対象なし
+    if (useStaticTree_) {
+        return nullptr;
+    }
+    if (IsUsingCompiledTree()) {
+        return treeInstance_.GetRunningNode();
+    }
+    return currentRunningNode_;
+}
+
+void BossBehaviorTree::SetUseCompiledTree(bool useCompiledTree) {
+    if (useCompiledTree_ == useCompiledTree) {
+        return;
+    }
+
+    // ノードツリーを直接実行するとノード自身の状態を書き換えるため、このボス専用のノードを作り直す
+    // 作れなければコンパイル済みツリーのまま実行する
+    if (!useCompiledTree && sharesNodes_ && !BuildPrivateNodes()) {
+        return;
+    }
+    useCompiledTree_ = useCompiledTree;
+
+    // 実行方式の切り替え時は途中状態を破棄
+    if (rootNode_ && !sharesNodes_) {
+        rootNode_->Reset();
+    }
+    treeInstance_.Reset();
+    currentRunningNode_ = nullptr;
+}
+
+void BossBehaviorTree::SetUseStaticTree(bool useStaticTree) {
+    if (useStaticTree_ == useStaticTree) {
+        return;
+    }
+    useStaticTree_ = useStaticTree;
+
+    // キーは初めて使う時に一度だけ解決する
+    if (useStaticTree_ && !staticTreeKeysResolved_) {
+        staticTree_.ResolveBlackboardKeys(*blackboard_);
+        staticTreeKeysResolved_ = true;
+    }
+
+    // 実行方式の切り替え時は途中状態を破棄
+    if (rootNode_ && !sharesNodes_) {
+        rootNode_->Reset();
+    }
+    treeInstance_.Reset();
+    BossStaticTree::Tree::Reset(staticState_);
+    currentRunningNode_ = nullptr;
+}
+
+void BossBehaviorTree::OnRootNodeChanged() {
+    // 新しく構築したノードはこのボス専用
+    sharesNodes_ = false;
+
+    // ブラックボードキーをハンドルへ解決
+    rootNode_->ResolveBlackboardKeys(*blackboard_);
+
+    // 実行用にコンパイル（失敗時はノードツリーを直接実行）
+    auto definition = std::make_shared<BTCompiledTree>();
+    if (definition->Compile(rootNode_)) {
+        definition_ = std::move(definition);
+    }
+    else {
+        definition_.reset();
+    }
+    treeInstance_.Bind(definition_);
+
+    // ツリーをリセット
+    Reset();
+}
+
+void BossBehaviorTree::BindDefinition(std::shared_ptr<const BTCompiledTree> definition) {
+    // ノードのキーハンドルは解決済み（ブラックボードのキー構成は呼び出し側で揃えている）
+    definition_ = std::move(definition);
+    rootNode_ = definition_->GetSourceNode(0);
+    sharesNodes_ = true;
+    treeInstance_.Bind(definition_);
+    Reset();
+}
+
+bool BossBehaviorTree::BuildPrivateNodes() {
+    if (treeFilePath_.empty()) {
+        return false;
+    }
+
+    BTNodePtr root;
+    try {
+        root = BTTreeLoader::LoadFile(BTTreeCooker::GetCookedPath(treeFilePath_), treeFilePath_, CreateBossNode);
+        if (!root) {
+            root = ReadTreeJSON(treeFilePath_);
+        }
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+    if (!root) {
+        return false;
+    }
+
+    // 共有定義と同じキー構成なので、解決されるハンドルも同じになる（定義はそのまま使い続ける）
+    root->ResolveBlackboardKeys(*blackboard_);
+    rootNode_ = std::move(root);
+    sharesNodes_ = false;
+    currentRunningNode_ = nullptr;
+    return true;
+}
+
+std::shared_ptr<const BTCompiledTree> BossBehaviorTree::FindSharedDefinition(const std::string& filepath, BTBlackboard& blackboard) {
+    std::lock_guard<std::mutex> lock(gSharedDefinitionMutex);
+    auto it = gSharedDefinitions.find(filepath);
+    if (it == gSharedDefinitions.end()) {
+        return nullptr;
+    }
+
+    std::shared_ptr<const BTCompiledTree> definition = it->second.definition.lock();
+    if (!definition) {
+        gSharedDefinitions.erase(it);
+        return nullptr;
+    }
+
+    // 共有ノードのハンドルを書き換えずに済むよう、ブラックボード側のキー構成を合わせる
+    if (!blackboard.CopyKeyLayout(*it->second.keyLayout)) {
+        return nullptr;
+    }
+    return definition;
+}
+
+void BossBehaviorTree::RegisterSharedDefinition(const std::string& filepath, const std::shared_ptr<const BTCompiledTree>& definition, const BTBlackboard& blackboard) {
+    if (!definition) {
+        return;
+    }
+
+    auto keyLayout = std::make_shared<BTBlackboard>();
+    if (!keyLayout->CopyKeyLayout(blackboard)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(gSharedDefinitionMutex);
+    gSharedDefinitions[filepath] = { definition, std::move(keyLayout) };
+}
+
+void BossBehaviorTree::PublishBossState() {
+    const BossAgent* boss = blackboard_->GetBoss();
+    if (!boss) {
+        return;
+    }
+
+    blackboard_->SetFloat(hpPercentKey_, (boss->GetHp() / Boss::GetMaxHp()) * 100.0f);
+    blackboard_->SetInt(phaseKey_, static_cast<int>(boss->GetPhase()));
+
+    // 水平距離（Y軸を無視）
+    if (Player* player = blackboard_->GetPlayer()) {
+        Vector3 diff = player->GetTransform().translate - boss->GetTransform().translate;
+        diff.y = 0.0f;
+        blackboard_->SetFloat(playerDistanceKey_, diff.Length());
+    }
+}
+
 void BossBehaviorTree::BuildTree() {
     // ルートノードは行動ツリー
     rootNode_ = BuildActionTree();
+    OnRootNodeChanged();
 }
 
 BTNodePtr BossBehaviorTree::BuildActionTree() {
@@ -117,80 +380,66 @@ BTNodePtr BossBehaviorTree::BuildActionTree() {
 void BossBehaviorTree::SetRootNode(BTNodePtr rootNode) {
     if (rootNode) {
         rootNode_ = rootNode;
-        // 既存のツリーをリセット
-        Reset();
+        // キー解決・コンパイル・リセット
+        OnRootNodeChanged();
         currentNodeName_ = "External Tree";
     }
 }
 
 /// <summary>
-/// JSONファイルからツリーを読み込み
+/// ツリーを読み込み（クッキング済みファイルを優先）
 /// </summary>
-bool BossBehaviorTree::LoadFromJSON(const std::string& filepath) {
-    try {
-        // JSONファイルを読み込み
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
-            return false;
-        }
-
-        nlohmann::json json;
-        file >> json;
-        file.close();
-
-        // バージョンチェック
-        if (!json.contains("version") || json["version"] != "1.0") {
-            return false;
-        }
-
-        // ノードマップを作成（ID → ノード情報）
-        std::unordered_map<int, nlohmann::json> nodeMap;
-        if (json.contains("nodes")) {
-            for (const auto& nodeJson : json["nodes"]) {
-                int nodeId = nodeJson["id"];
-                nodeMap[nodeId] = nodeJson;
-            }
-        }
-
-        // リンク情報を取得
-        std::vector<nlohmann::json> links;
-        if (json.contains("links")) {
-            links = json["links"].get<std::vector<nlohmann::json>>();
-        }
+bool BossBehaviorTree::LoadTree(const std::string& filepath) {
+    // 他のボスが読み込み済みなら定義を共有し、状態ブロックだけを確保する
+    treeFilePath_ = filepath;
+    if (auto shared = FindSharedDefinition(filepath, *blackboard_)) {
+        BindDefinition(std::move(shared));
+        currentNodeName_ = "Shared compiled tree";
+        return true;
+    }
 
-        // ルートノードを探す（親リンクを持たないノード）
-        int rootNodeId = -1;
-        std::unordered_set<int> childNodeIds;
-        for (const auto& link : links) {
-            childNodeIds.insert(link["targetNodeId"].get<int>());
-        }
+    std::string cookedPath = BTTreeCooker::GetCookedPath(filepath);
 
-        for (const auto& [nodeId, nodeJson] : nodeMap) {
-            if (childNodeIds.find(nodeId) == childNodeIds.end()) {
-                rootNodeId = nodeId;
-                break;
-            }
-        }
+    // クッキング済みファイルをメモリマップして線形に構築
+    BTNodePtr root = BTTreeLoader::LoadFile(cookedPath, filepath, CreateBossNode);
+    if (root) {
+        rootNode_ = root;
+        OnRootNodeChanged();
+        RegisterSharedDefinition(filepath, definition_, *blackboard_);
+        sharesNodes_ = definition_ != nullptr;
+        currentNodeName_ = "Loaded from cooked tree";
+        return true;
+    }
 
-        if (rootNodeId == -1 && !nodeMap.empty()) {
-            // ルートが見つからない場合、最初のノードをルートとする
-            rootNodeId = nodeMap.begin()->first;
-        }
+    // 無いか古い場合はJSONから読み込む
+    if (!LoadFromJSON(filepath)) {
+        return false;
+    }
+    RegisterSharedDefinition(filepath, definition_, *blackboard_);
+    sharesNodes_ = definition_ != nullptr;
+
+#ifdef _DEBUG
+    // 次回から高速に読み込めるようにクッキングし直す
+    BTTreeCooker::CookFile(filepath, cookedPath);
+#endif
+    return true;
+}
 
-        if (rootNodeId == -1) {
+/// <summary>
+/// JSONファイルからツリーを読み込み
+/// </summary>
+bool BossBehaviorTree::LoadFromJSON(const std::string& filepath) {
+    try {
+        // JSONファイルを読み込み
+        BTNodePtr root = ReadTreeJSON(filepath);
+        if (!root) {
             return false;
         }
 
-        // ツリーを再帰的に構築
-        std::unordered_set<int> visitedNodes;
-        rootNode_ = BuildNodeFromJSON(nodeMap[rootNodeId], nodeMap, links, visitedNodes);
+        rootNode_ = root;
 
-        if (!rootNode_) {
-            return false;
-        }
-
-        // ツリーをリセット
-        Reset();
+        // キー解決・コンパイル・リセット
+        OnRootNodeChanged();
         currentNodeName_ = "Loaded from JSON";
 
         return true;
@@ -201,71 +450,6 @@ bool BossBehaviorTree::LoadFromJSON(const std::string& filepath) {
     }
 }
 
-/// <summary>
-/// JSONからノードツリーを再帰的に構築
-/// </summary>
-BTNodePtr BossBehaviorTree::BuildNodeFromJSON(
-    const nlohmann::json& nodeJson,
-    const std::unordered_map<int, nlohmann::json>& nodeMap,
-    const std::vector<nlohmann::json>& links,
-    std::unordered_set<int>& visitedNodes) {
-
-    if (nodeJson.empty()) return nullptr;
-
-    int nodeId = nodeJson["id"];
-
-    // 循環参照を防ぐ
-    if (visitedNodes.find(nodeId) != visitedNodes.end()) {
-        return nullptr;
-    }
-    visitedNodes.insert(nodeId);
-
-    // ノードを作成（BossNodeFactoryを使用）
-    std::string nodeType = nodeJson["type"];
-    BTNodePtr node = BossNodeFactory::CreateNode(nodeType);
-
-    if (!node) {
-        return nullptr;
-    }
-
-    // パラメータを適用（ポリモーフィズムで各ノードが自己処理）
-    if (nodeJson.contains("parameters") && !nodeJson["parameters"].is_null()) {
-        node->ApplyParameters(nodeJson["parameters"]);
-    }
-
-    // 表示名を設定（オプション）
-    if (nodeJson.contains("displayName")) {
-        node->SetName(nodeJson["displayName"]);
-    }
-
-    // コンポジットノードの場合、子ノードを追加
-    if (node->IsComposite()) {
-        auto compositeNode = std::dynamic_pointer_cast<BTComposite>(node);
-        if (compositeNode) {
-            // このノードの子ノードIDを収集
-            std::vector<int> childIds;
-            for (const auto& link : links) {
-                if (link["sourceNodeId"] == nodeId) {
-                    childIds.push_back(link["targetNodeId"]);
-                }
-            }
-
-            // 子ノードを再帰的に構築
-            for (int childId : childIds) {
-                auto childIt = nodeMap.find(childId);
-                if (childIt != nodeMap.end()) {
-                    BTNodePtr childNode = BuildNodeFromJSON(childIt->second, nodeMap, links, visitedNodes);
-                    if (childNode) {
-                        compositeNode->AddChild(childNode);
-                    }
-                }
-            }
-        }
-    }
-
-    return node;
-}
-
 /// <summary>
 /// 実行中のノードを再帰的に検索
 /// </summary>
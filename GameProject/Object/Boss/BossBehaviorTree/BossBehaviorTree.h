@@ -1,15 +1,21 @@
 #pragma once
 #include "../../../BehaviorTree/Core/BTNode.h"
 #include "../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../BehaviorTree/Core/BTCompiledTree.h"
+#include "../../../BehaviorTree/Core/BTTreeInstance.h"
+#include "BossAgent.h"
+#include "BossCommandBuffer.h"
+#include "BossStaticTree.h"
 #include <memory>
 #include <json.hpp>
-#include <unordered_set>
 
 class Boss;
 class Player;
 
 /// <summary>
 /// ボス用ビヘイビアツリー
+/// 同じファイルから読み込んだツリーの定義（BTCompiledTree）はボス間で共有し、
+/// ボスごとにはブラックボードと状態ブロック（BTTreeInstance）だけを持つ
 /// </summary>
 class BossBehaviorTree {
 public:
@@ -27,9 +33,18 @@ public:
 
     /// <summary>
     /// ビヘイビアツリーの更新
+    /// ボス本体には触れず、移動や弾・エフェクトの操作はcommandsへ記録する
+    /// （別のボスのツリーとは並列に実行できる。反映はBossCommandBuffer::Applyで行う）
     /// </summary>
     /// <param name="deltaTime">経過時間</param>
-    void Update(float deltaTime);
+    /// <param name="commands">操作の記録先</param>
+    void Update(float deltaTime, BossCommandBuffer& commands);
+
+    /// <summary>
+    /// ツリー内で使う乱数列のシードを設定
+    /// </summary>
+    /// <param name="seed">シード</param>
+    void SetRandomSeed(uint32_t seed);
 
     /// <summary>
     /// ビヘイビアツリーのリセット
@@ -67,7 +82,15 @@ public:
     BTBlackboard* GetBlackboard() const { return blackboard_.get(); }
 
     /// <summary>
-    /// JSONファイルからツリーを読み込み
+    /// ツリーを読み込み
+    /// クッキング済みファイル（.bttree）が最新ならそれを使い、なければJSONから読み込む
+    /// </summary>
+    /// <param name="filepath">JSONファイルのパス</param>
+    /// <returns>成功したらtrue</returns>
+    bool LoadTree(const std::string& filepath);
+
+    /// <summary>
+    /// JSONファイルからツリーを読み込み（エディタ用）
     /// </summary>
     /// <param name="filepath">JSONファイルのパス</param>
     /// <returns>成功したらtrue</returns>
@@ -77,7 +100,80 @@ public:
     /// 現在実行中のノードを取得
     /// </summary>
     /// <returns>実行中のノード（なければnullptr）</returns>
-    BTNodePtr GetCurrentRunningNode() const { return currentRunningNode_; }
+    BTNodePtr GetCurrentRunningNode() const;
+
+    /// <summary>
+    /// コンパイル済みツリーで実行するかの設定
+    /// </summary>
+    /// <param name="useCompiledTree">コンパイル済みツリーを使う場合true</param>
+    void SetUseCompiledTree(bool useCompiledTree);
+
+    /// <summary>
+    /// コンパイル済みツリーで実行しているか
+    /// </summary>
+    /// <returns>コンパイル済みツリーで実行している場合true</returns>
+    bool IsUsingCompiledTree() const { return useCompiledTree_ && treeInstance_.IsValid(); }
+
+    /// <summary>
+    /// 固定ツリー（BossStaticTree）で実行するかの設定
+    /// 読み込んだツリーの代わりに、BuildActionTreeと同じ形を型で展開したツリーを実行する
+    /// </summary>
+    /// <param name="useStaticTree">固定ツリーを使う場合true</param>
+    void SetUseStaticTree(bool useStaticTree);
+
+    /// <summary>
+    /// 固定ツリーで実行しているか
+    /// </summary>
+    /// <returns>固定ツリーで実行している場合true</returns>
+    bool IsUsingStaticTree() const { return useStaticTree_; }
+
+    /// <summary>
+    /// 他のボスと並列に更新できるか（状態がボスごとに分かれた実行方式か）
+    /// </summary>
+    /// <returns>並列に更新できる場合true</returns>
+    bool CanTickInParallel() const { return useStaticTree_ || IsUsingCompiledTree(); }
+
+    /// <summary>
+    /// コンパイル済みツリー（共有している定義）の取得
+    /// </summary>
+    /// <returns>定義（コンパイルできなかった場合はnullptr）</returns>
+    const std::shared_ptr<const BTCompiledTree>& GetCompiledTree() const { return definition_; }
+
+    /// <summary>
+    /// このボスの実行状態の取得
+    /// </summary>
+    /// <returns>実行状態</returns>
+    const BTTreeInstance& GetTreeInstance() const { return treeInstance_; }
+
+    /// <summary>
+    /// リアクティブ実行（条件の監視による中断）の設定
+    /// </summary>
+    /// <param name="reactive">有効にする場合true</param>
+    void SetReactive(bool reactive) { treeInstance_.SetReactive(reactive); }
+
+    /// <summary>
+    /// リアクティブ実行が有効か
+    /// </summary>
+    /// <returns>有効な場合true</returns>
+    bool IsReactive() const { return treeInstance_.IsReactive(); }
+
+    /// <summary>
+    /// ノード単位のプロファイリングの設定（コンパイル済みツリーのみ計測）
+    /// </summary>
+    /// <param name="enable">有効にする場合true</param>
+    void SetProfiling(bool enable) { treeInstance_.EnableProfiling(enable); }
+
+    /// <summary>
+    /// プロファイリングが有効か
+    /// </summary>
+    /// <returns>有効な場合true</returns>
+    bool IsProfiling() const { return treeInstance_.IsProfiling(); }
+
+    /// <summary>
+    /// プロファイラの取得
+    /// </summary>
+    /// <returns>プロファイラ（無効な場合はnullptr）</returns>
+    BTProfiler* GetProfiler() const { return treeInstance_.GetProfiler(); }
 
 private:
     /// <summary>
@@ -86,23 +182,54 @@ private:
     void BuildTree();
 
     /// <summary>
-    /// 行動ツリーの構築（Idle → Dash/Shoot の選択）
+    /// ルートノード設定後の共通処理（キー解決・コンパイル・リセット）
     /// </summary>
-    /// <returns>構築したノード</returns>
-    BTNodePtr BuildActionTree();
+    void OnRootNodeChanged();
+
+    /// <summary>
+    /// 共有する定義を結び付けてルートノードを差し替える（リセット）
+    /// </summary>
+    /// <param name="definition">共有する定義</param>
+    void BindDefinition(std::shared_ptr<const BTCompiledTree> definition);
 
     /// <summary>
-    /// JSONからノードツリーを再帰的に構築
+    /// 読み込んだファイルからこのボス専用のノードツリーを作り直す（ノードツリーを直接実行する前に使う）
+    /// </summary>
+    /// <returns>成功したらtrue</returns>
+    bool BuildPrivateNodes();
+
+    /// <summary>
+    /// 読み込み済みの定義を検索（他のボスが同じファイルを読み込んでいれば共有する）
+    /// 見つかった場合はブラックボードのキー構成を定義の解決済みハンドルに合わせる
+    /// </summary>
+    /// <param name="filepath">JSONファイルのパス</param>
+    /// <param name="blackboard">このボスのブラックボード</param>
+    /// <returns>定義（なければnullptr）</returns>
+    static std::shared_ptr<const BTCompiledTree> FindSharedDefinition(const std::string& filepath, BTBlackboard& blackboard);
+
+    /// <summary>
+    /// 読み込んだ定義を共有用に登録
+    /// </summary>
+    /// <param name="filepath">JSONファイルのパス</param>
+    /// <param name="definition">定義</param>
+    /// <param name="blackboard">キーを解決したブラックボード</param>
+    static void RegisterSharedDefinition(const std::string& filepath, const std::shared_ptr<const BTCompiledTree>& definition, const BTBlackboard& blackboard);
+
+    /// <summary>
+    /// 条件ノードが参照するボスの状態をブラックボードへ書き込む
+    /// </summary>
+    void PublishBossState();
+
+    /// <summary>
+    /// ツリーを1フレーム分実行
+    /// </summary>
+    void TickTree();
+
+    /// <summary>
+    /// 行動ツリーの構築（Idle → Dash/Shoot の選択）
     /// </summary>
-    /// <param name="nodeJson">ノードのJSON</param>
-    /// <param name="nodeMap">全ノードのマップ</param>
-    /// <param name="links">リンク情報</param>
-    /// <param name="visitedNodes">訪問済みノードセット</param>
     /// <returns>構築したノード</returns>
-    BTNodePtr BuildNodeFromJSON(const nlohmann::json& nodeJson,
-                                const std::unordered_map<int, nlohmann::json>& nodeMap,
-                                const std::vector<nlohmann::json>& links,
-                                std::unordered_set<int>& visitedNodes);
+    BTNodePtr BuildActionTree();
 
     /// <summary>
     /// 実行中のノードを再帰的に検索
@@ -110,15 +237,48 @@ private:
     /// <param name="node">検索開始ノード</param>
     void FindRunningNodeRecursive(const BTNodePtr& node);
 
+    // ツリーから見たボス（副作用をコマンドとして記録する）
+    BossAgent agent_;
+
+    // 固定ツリーとその状態
+    BossStaticTree::Tree staticTree_;
+    BossStaticTree::Tree::State staticState_{};
+    bool useStaticTree_ = false;
+    bool staticTreeKeysResolved_ = false;
+
     // ルートノード
     BTNodePtr rootNode_;
 
+    // rootNode_以下のノードが共有定義のもの（他のボスも参照する）か
+    // 共有中のノードは実行もリセットもせず、直接実行する場合はBuildPrivateNodesで作り直す
+    bool sharesNodes_ = false;
+
+    // LoadTreeで読み込んだJSONファイルのパス
+    std::string treeFilePath_;
+
     // ブラックボード
     std::unique_ptr<BTBlackboard> blackboard_;
 
+    // 行動カウンターのキーハンドル
+    BTBlackboardKey<int> actionCounterKey_;
+
+    // 条件ノードが監視するボス状態のキーハンドル
+    BTBlackboardKey<float> hpPercentKey_;
+    BTBlackboardKey<int> phaseKey_;
+    BTBlackboardKey<float> playerDistanceKey_;
+
     // 現在のノード名
     std::string currentNodeName_;
 
     // 実行中ノード追跡用
     BTNodePtr currentRunningNode_;
+
+    // コンパイル済みツリー（rootNode_から生成、同じファイルを読み込んだボス間で共有）
+    std::shared_ptr<const BTCompiledTree> definition_;
+
+    // このボスの実行状態（definition_を参照）
+    BTTreeInstance treeInstance_;
+
+    // コンパイル済みツリーで実行するか
+    bool useCompiledTree_ = true;
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+#include <string_view>
+
+/// <summary>
+/// ボス用ブラックボードのキー名定義
+/// ノードはツリー構築時にこの名前でキーを登録し、以降はハンドルでアクセスする
+/// </summary>
+namespace BossBlackboardKeys {
+
+    /// <summary>
+    /// 行動カウンター（Idle毎に加算、ActionSelectorの偶奇判定に使用）
+    /// </summary>
+    inline constexpr std::string_view kActionCounter = "ActionCounter";
+
+    /// <summary>
+    /// ボスのHP割合（0〜100、毎フレームBossBehaviorTreeが書き込む）
+    /// </summary>
+    inline constexpr std::string_view kBossHpPercent = "BossHpPercent";
+
+    /// <summary>
+    /// ボスのフェーズ（毎フレームBossBehaviorTreeが書き込む）
+    /// </summary>
+    inline constexpr std::string_view kBossPhase = "BossPhase";
+
+    /// <summary>
+    /// ボスとプレイヤーの水平距離（毎フレームBossBehaviorTreeが書き込む）
+    /// </summary>
+    inline constexpr std::string_view kPlayerDistance = "PlayerDistance";
+
+}
@@ -0,0 +1,61 @@
+#include "BossCommandBuffer.h"
+#include "../Boss.h"
+#include "../../../Collision/BossMeleeAttackCollider.h"
+#include "Object3d.h"
+#include "Mat4x4Func.h"
+
+void BossCommandBuffer::Apply(Boss& boss, const BossCommand* commands, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const BossCommand& command = commands[i];
+        switch (command.type) {
+        case BossCommandType::SetTransform:
+            boss.SetTransform(command.transform);
+            break;
+
+        case BossCommandType::SpawnBullet:
+            boss.RequestBulletSpawn(command.transform.translate, command.velocity, command.turnRate);
+            break;
+
+        case BossCommandType::SpawnPattern:
+            boss.RequestPatternSpawn(command.pattern);
+            break;
+
+        case BossCommandType::SetAttackSignActive:
+            boss.SetAttackSignEmitterActive(command.flag);
+            break;
+
+        case BossCommandType::SetAttackSignPosition:
+            boss.SetAttackSignEmitterPosition(command.transform.translate);
+            break;
+
+        case BossCommandType::SetMeleeBlockVisible:
+            boss.SetMeleeAttackBlockVisible(command.flag);
+            break;
+
+        case BossCommandType::SetMeleeBlockTransform:
+            if (Object3d* block = boss.GetMeleeAttackBlock()) {
+                block->SetTransform(command.transform);
+                block->Update();
+            }
+            break;
+
+        case BossCommandType::SetMeleeColliderActive:
+            if (BossMeleeAttackCollider* collider = boss.GetMeleeAttackCollider()) {
+                collider->SetActive(command.flag);
+            }
+            break;
+
+        case BossCommandType::ResetMeleeCollider:
+            if (BossMeleeAttackCollider* collider = boss.GetMeleeAttackCollider()) {
+                collider->Reset();
+            }
+            break;
+
+        case BossCommandType::SetMeleeColliderOrientation:
+            if (BossMeleeAttackCollider* collider = boss.GetMeleeAttackCollider()) {
+                collider->SetOrientation(Mat4x4::MakeRotateY(command.angle));
+            }
+            break;
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "../../Projectile/BulletPattern.h"
+#include "Transform.h"
+#include "Vector3.h"
+#include <cstdint>
+#include <vector>
+
+class Boss;
+
+/// <summary>
+/// ビヘイビアツリーからボスへの操作の種類
+/// </summary>
+enum class BossCommandType : uint8_t {
+    SetTransform,                // ボスのトランスフォーム（transform）
+    SpawnBullet,                 // 弾の生成要求（transform.translate = 位置, velocity = 速度, turnRate = 旋回速度）
+    SpawnPattern,                // 弾幕の模様の生成要求（pattern）
+    SetAttackSignActive,         // 予兆エフェクトの有効・無効（flag）
+    SetAttackSignPosition,       // 予兆エフェクトの位置（transform.translate）
+    SetMeleeBlockVisible,        // 近接攻撃ブロックの表示（flag）
+    SetMeleeBlockTransform,      // 近接攻撃ブロックのトランスフォーム（transform）
+    SetMeleeColliderActive,      // 近接攻撃コライダーの有効・無効（flag）
+    ResetMeleeCollider,          // 近接攻撃コライダーのヒット状態のリセット
+    SetMeleeColliderOrientation, // 近接攻撃コライダーの向き（angle = Y軸回転）
+};
+
+/// <summary>
+/// ビヘイビアツリーからボスへの操作（1件）
+/// </summary>
+struct BossCommand {
+    BossCommandType type = BossCommandType::SetTransform; // 操作の種類
+    bool flag = false;                                    // 有効・表示フラグ
+    float angle = 0.0f;                                   // 角度（ラジアン）
+    Transform transform{};                                // トランスフォーム・位置
+    Vector3 velocity{};                                   // 速度
+    float turnRate = 0.0f;                                // 追尾の旋回速度（ラジアン/秒）
+    BulletPattern pattern{};                              // 弾幕の模様
+};
+
+/// <summary>
+/// ボスへの操作を記録するバッファ
+/// AIの更新中はボスや共有のシステム（エミッター・コライダー・描画オブジェクト）に直接触れず、
+/// 操作をここへ記録してメインスレッドでまとめて適用する
+/// Clearしても確保済みの領域は残るため、毎フレーム使い回せる
+/// </summary>
+class BossCommandBuffer {
+public:
+    /// <summary>
+    /// 操作の追加
+    /// </summary>
+    /// <param name="command">操作</param>
+    void Push(const BossCommand& command) { commands_.push_back(command); }
+
+    /// <summary>
+    /// 記録した操作の破棄（領域は残す）
+    /// </summary>
+    void Clear() { commands_.clear(); }
+
+    /// <summary>
+    /// 記録した操作の数
+    /// </summary>
+    /// <returns>操作数</returns>
+    size_t GetSize() const { return commands_.size(); }
+
+    /// <summary>
+    /// 記録した操作の先頭
+    /// </summary>
+    /// <returns>操作の配列</returns>
+    const BossCommand* GetData() const { return commands_.data(); }
+
+    /// <summary>
+    /// 記録した操作をすべてボスへ適用（メインスレッドで呼ぶ）
+    /// </summary>
+    /// <param name="boss">適用先のボス</param>
+    void ApplyTo(Boss& boss) const { Apply(boss, commands_.data(), commands_.size()); }
+
+    /// <summary>
+    /// 操作の範囲を記録順にボスへ適用（メインスレッドで呼ぶ）
+    /// </summary>
+    /// <param name="boss">適用先のボス</param>
+    /// <param name="commands">操作の先頭</param>
+    /// <param name="count">操作数</param>
+    static void Apply(Boss& boss, const BossCommand* commands, size_t count);
+
+private:
+    // 記録した操作
+    std::vector<BossCommand> commands_;
+};
@@ -2,73 +2,19 @@
 
 #include "BossNodeFactory.h"
 
-// BehaviorTreeノードのインクルード
-#include "../../../BehaviorTree/Composites/BTSelector.h"
-#include "../../../BehaviorTree/Composites/BTSequence.h"
-#include "../../../BehaviorTree/Composites/BTRandomSelector.h"
-#include "../BossBehaviorTree/Actions/BTBossIdle.h"
-#include "../BossBehaviorTree/Actions/BTBossDash.h"
-#include "../BossBehaviorTree/Actions/BTBossShoot.h"
-#include "../BossBehaviorTree/Actions/BTBossRapidFire.h"
-#include "../BossBehaviorTree/Actions/BTBossMeleeAttack.h"
-#include "../BossBehaviorTree/Actions/BTBossApproach.h"
-#include "../BossBehaviorTree/Actions/BTBossRetreat.h"
-#include "../BossBehaviorTree/Conditions/BTActionSelector.h"
-#include "../BossBehaviorTree/Conditions/BTBossPhaseCondition.h"
-#include "../BossBehaviorTree/Conditions/BTBossHPCondition.h"
-#include "../BossBehaviorTree/Conditions/BTBossDistanceCondition.h"
-
 /// <summary>
 /// ノードの生成
 /// </summary>
 BTNodePtr BossNodeFactory::CreateNode(const std::string& nodeType) {
-    // Compositeノード
-    if (nodeType == "BTSelector") {
-        return std::make_shared<BTSelector>();
-    }
-    else if (nodeType == "BTSequence") {
-        return std::make_shared<BTSequence>();
-    }
-    else if (nodeType == "BTRandomSelector") {
-        return std::make_shared<BTRandomSelector>();
-    }
-    // Actionノード（Blackboard経由でBoss/Playerにアクセス）
-    else if (nodeType == "BTBossIdle") {
-        return std::make_shared<BTBossIdle>();
-    }
-    else if (nodeType == "BTBossDash") {
-        return std::make_shared<BTBossDash>();
-    }
-    else if (nodeType == "BTBossShoot") {
-        return std::make_shared<BTBossShoot>();
-    }
-    else if (nodeType == "BTBossRapidFire") {
-        return std::make_shared<BTBossRapidFire>();
-    }
-    else if (nodeType == "BTBossMeleeAttack") {
-        return std::make_shared<BTBossMeleeAttack>();
-    }
-    else if (nodeType == "BTBossApproach") {
-        return std::make_shared<BTBossApproach>();
-    }
-    else if (nodeType == "BTBossRetreat") {
-        return std::make_shared<BTBossRetreat>();
-    }
-    // Conditionノード
-    else if (nodeType == "BTActionSelector") {
-        return std::make_shared<BTActionSelector>(BTActionSelector::ActionType::Dash);
-    }
-    else if (nodeType == "BTBossPhaseCondition") {
-        return std::make_shared<BTBossPhaseCondition>();
-    }
-    else if (nodeType == "BTBossHPCondition") {
-        return std::make_shared<BTBossHPCondition>();
-    }
-    else if (nodeType == "BTBossDistanceCondition") {
-        return std::make_shared<BTBossDistanceCondition>();
-    }
+    // タイプIDのハッシュ表から検索（文字列比較は一致確認の1回のみ）
+    return BTNodeRegistry::GetInstance().Create(nodeType);
+}
 
-    return nullptr;
+/// <summary>
+/// ノードの生成（アリーナへ確保）
+/// </summary>
+BTNodePtr BossNodeFactory::CreateNode(const std::string& nodeType, std::pmr::memory_resource* arena) {
+    return BTNodeRegistry::GetInstance().Create(nodeType, arena);
 }
 
 /// <summary>
@@ -87,138 +33,13 @@ BTNodePtr BossNodeFactory::CreateNodeWithDependencies(
 
 #ifdef _DEBUG
 
-#include <typeinfo>
-#include <algorithm>
-
-// 静的メンバの定義
-std::vector<BossNodeFactory::NodeTypeInfo> BossNodeFactory::nodeTypes_;
-bool BossNodeFactory::initialized_ = false;
-
-/// <summary>
-/// ノードタイプ情報の初期化
-/// </summary>
-void BossNodeFactory::InitializeNodeTypes() {
-    if (initialized_) return;
-
-    // ノードタイプ情報の登録
-    nodeTypes_ = {
-        // ========== Composite ノード ==========
-        {
-            "BTSelector",
-            "Selector",
-            NodeCategory::Composite,
-            ImVec4(0.8f, 0.4f, 0.2f, 1.0f),  // オレンジ
-            true  // 子ノードを持てる
-        },
-        {
-            "BTSequence",
-            "Sequence",
-            NodeCategory::Composite,
-            ImVec4(0.2f, 0.6f, 0.8f, 1.0f),  // 青
-            true  // 子ノードを持てる
-        },
-        {
-            "BTRandomSelector",
-            "Random Selector",
-            NodeCategory::Composite,
-            ImVec4(0.9f, 0.6f, 0.2f, 1.0f),  // 明るいオレンジ
-            true  // 子ノードを持てる
-        },
-
-        // ========== Action ノード ==========
-        {
-            "BTBossIdle",
-            "Idle",
-            NodeCategory::Action,
-            ImVec4(0.2f, 0.8f, 0.4f, 1.0f),  // 緑
-            false  // 子ノードを持てない
-        },
-        {
-            "BTBossDash",
-            "Dash",
-            NodeCategory::Action,
-            ImVec4(0.3f, 0.8f, 0.5f, 1.0f),  // 明るい緑
-            false
-        },
-        {
-            "BTBossShoot",
-            "Shoot",
-            NodeCategory::Action,
-            ImVec4(0.8f, 0.3f, 0.3f, 1.0f),  // 赤
-            false
-        },
-        {
-            "BTBossRapidFire",
-            "Rapid Fire",
-            NodeCategory::Action,
-            ImVec4(0.9f, 0.2f, 0.5f, 1.0f),  // マゼンタ
-            false
-        },
-        {
-            "BTBossMeleeAttack",
-            "Melee Attack",
-            NodeCategory::Action,
-            ImVec4(0.9f, 0.4f, 0.1f, 1.0f),  // オレンジ-赤
-            false
-        },
-        {
-            "BTBossApproach",
-            "Approach",
-            NodeCategory::Action,
-            ImVec4(0.4f, 0.9f, 0.4f, 1.0f),  // 明るい緑（移動系）
-            false
-        },
-        {
-            "BTBossRetreat",
-            "Retreat",
-            NodeCategory::Action,
-            ImVec4(0.3f, 0.7f, 0.9f, 1.0f),  // 水色（Approachと対になる色）
-            false
-        },
-
-        // ========== Condition ノード ==========
-        {
-            "BTActionSelector",
-            "Action Selector",
-            NodeCategory::Condition,
-            ImVec4(0.8f, 0.8f, 0.2f, 1.0f),  // 黄色
-            false
-        },
-        {
-            "BTBossPhaseCondition",
-            "Phase Condition",
-            NodeCategory::Condition,
-            ImVec4(0.5f, 0.2f, 0.9f, 1.0f),  // 紫
-            false
-        },
-        {
-            "BTBossHPCondition",
-            "HP Condition",
-            NodeCategory::Condition,
-            ImVec4(0.9f, 0.5f, 0.2f, 1.0f),  // オレンジ
-            false
-        },
-        {
-            "BTBossDistanceCondition",
-            "Distance Condition",
-            NodeCategory::Condition,
-            ImVec4(0.2f, 0.7f, 0.5f, 1.0f),  // 緑
-            false
-        }
-    };
-
-    initialized_ = true;
-}
-
 /// <summary>
 /// 利用可能なノードタイプ一覧の取得
 /// </summary>
 std::vector<std::string> BossNodeFactory::GetAvailableNodeTypes() {
-    InitializeNodeTypes();
-
     std::vector<std::string> types;
-    for (const auto& nodeType : nodeTypes_) {
-        types.push_back(nodeType.typeName);
+    for (const auto& entry : BTNodeRegistry::GetInstance().GetEntries()) {
+        types.push_back(entry.typeName);
     }
     return types;
 }
@@ -227,12 +48,10 @@ std::vector<std::string> BossNodeFactory::GetAvailableNodeTypes() {
 /// カテゴリごとのノードタイプ取得
 /// </summary>
 std::vector<std::string> BossNodeFactory::GetNodeTypesByCategory(NodeCategory category) {
-    InitializeNodeTypes();
-
     std::vector<std::string> types;
-    for (const auto& nodeType : nodeTypes_) {
-        if (nodeType.category == category) {
-            types.push_back(nodeType.typeName);
+    for (const auto& entry : BTNodeRegistry::GetInstance().GetEntries()) {
+        if (entry.metadata.category == category) {
+            types.push_back(entry.typeName);
         }
     }
     return types;
@@ -244,38 +63,25 @@ std::vector<std::string> BossNodeFactory::GetNodeTypesByCategory(NodeCategory ca
 std::string BossNodeFactory::GetNodeType(const BTNodePtr& node) {
     if (!node) return "";
 
-    // RTTIを使用してタイプを判定
-    const std::type_info& typeInfo = typeid(*node);
-
-    // 各タイプと比較
-    if (typeInfo == typeid(BTSelector)) return "BTSelector";
-    if (typeInfo == typeid(BTSequence)) return "BTSequence";
-    if (typeInfo == typeid(BTRandomSelector)) return "BTRandomSelector";
-    if (typeInfo == typeid(BTBossIdle)) return "BTBossIdle";
-    if (typeInfo == typeid(BTBossDash)) return "BTBossDash";
-    if (typeInfo == typeid(BTBossShoot)) return "BTBossShoot";
-    if (typeInfo == typeid(BTBossRapidFire)) return "BTBossRapidFire";
-    if (typeInfo == typeid(BTBossMeleeAttack)) return "BTBossMeleeAttack";
-    if (typeInfo == typeid(BTBossApproach)) return "BTBossApproach";
-    if (typeInfo == typeid(BTBossRetreat)) return "BTBossRetreat";
-    if (typeInfo == typeid(BTActionSelector)) return "BTActionSelector";
-    if (typeInfo == typeid(BTBossPhaseCondition)) return "BTBossPhaseCondition";
-    if (typeInfo == typeid(BTBossHPCondition)) return "BTBossHPCondition";
-    if (typeInfo == typeid(BTBossDistanceCondition)) return "BTBossDistanceCondition";
-
-    return "";
+    // RTTIの型情報から登録エントリを検索
+    const BTNodeRegistry::Entry* entry = BTNodeRegistry::GetInstance().FindByNode(*node);
+    return entry ? entry->typeName : "";
 }
 
 /// <summary>
 /// ノードタイプ情報の取得
 /// </summary>
 BossNodeFactory::NodeTypeInfo BossNodeFactory::GetNodeTypeInfo(const std::string& nodeType) {
-    InitializeNodeTypes();
-
-    for (const auto& info : nodeTypes_) {
-        if (info.typeName == nodeType) {
-            return info;
-        }
+    const BTNodeRegistry::Entry* entry = BTNodeRegistry::GetInstance().Find(nodeType);
+    if (entry) {
+        const float* color = entry->metadata.color;
+        return {
+            entry->typeName,
+            entry->metadata.displayName,
+            entry->metadata.category,
+            ImVec4(color[0], color[1], color[2], color[3]),
+            entry->isComposite
+        };
     }
 
     // デフォルト値を返す
@@ -4,6 +4,7 @@
 #include <vector>
 #include <memory>
 #include "../../../BehaviorTree/Core/BTNode.h"
+#include "../../../BehaviorTree/Core/BTNodeRegistry.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
@@ -15,6 +16,7 @@ class Player;
 /// <summary>
 /// ボスノードの生成ファクトリ
 /// ノードタイプ文字列から実際のBTNodeインスタンスを生成
+/// 各ノードは自身の.cppでBTNodeRegistryへ登録されており、ここはその窓口となる
 /// </summary>
 class BossNodeFactory {
 public:
@@ -27,6 +29,14 @@ public:
     /// <returns>生成されたノード（失敗時はnullptr）</returns>
     static BTNodePtr CreateNode(const std::string& nodeType);
 
+    /// <summary>
+    /// ノードの生成（アリーナへ確保）
+    /// </summary>
+    /// <param name="nodeType">ノードタイプ名</param>
+    /// <param name="arena">確保先（ノードより長く生存させること）</param>
+    /// <returns>生成されたノード（失敗時はnullptr）</returns>
+    static BTNodePtr CreateNode(const std::string& nodeType, std::pmr::memory_resource* arena);
+
     /// <summary>
     /// Boss/Playerの依存関係を持つノードの生成
     /// </summary>
@@ -46,12 +56,7 @@ public:
     /// <summary>
     /// ノードカテゴリ
     /// </summary>
-    enum class NodeCategory {
-        Composite,      // 複合ノード（Selector, Sequence）
-        Action,         // アクションノード（Idle, Dash, Shoot）
-        Condition,      // 条件ノード（ActionSelector）
-        Decorator       // デコレータノード（将来の拡張用）
-    };
+    using NodeCategory = BTNodeCategory;
 
     /// <summary>
     /// ノードタイプ情報
@@ -118,21 +123,5 @@ public:
     /// <param name="nodeType">ノードタイプ名</param>
     /// <returns>ノードカテゴリ</returns>
     static NodeCategory GetNodeCategory(const std::string& nodeType);
-
-private:
-    /// <summary>
-    /// ノードタイプ情報の初期化（静的）
-    /// </summary>
-    static void InitializeNodeTypes();
-
-    /// <summary>
-    /// ノードタイプ情報のマップ
-    /// </summary>
-    static std::vector<NodeTypeInfo> nodeTypes_;
-
-    /// <summary>
-    /// 初期化フラグ
-    /// </summary>
-    static bool initialized_;
 #endif // _DEBUG
 };
@@ -0,0 +1,25 @@
+#pragma once
+#include "../../../BehaviorTree/Core/BTStaticTree.h"
+#include "Actions/BTBossIdle.h"
+#include "Actions/BTBossDash.h"
+#include "Actions/BTBossShoot.h"
+#include "Conditions/BTActionSelector.h"
+
+/// <summary>
+/// ボスの固定ツリー（BossBehaviorTree::BuildActionTreeと同じ形を型で記述したもの）
+/// MainLoop: Idle → ActionSelector（ActionCounterの偶奇でDashかShoot）
+/// </summary>
+namespace BossStaticTree {
+
+    using IsDash = BTStatic::Leaf<BTActionSelector, BTActionSelector::ActionType::Dash>;
+    using IsShoot = BTStatic::Leaf<BTActionSelector, BTActionSelector::ActionType::Shoot>;
+
+    using MainLoop = BTStatic::Sequence<
+        BTBossIdle,
+        BTStatic::Selector<
+            BTStatic::Sequence<IsDash, BTBossDash>,
+            BTStatic::Sequence<IsShoot, BTBossShoot>>>;
+
+    using Tree = BTStatic::Tree<MainLoop>;
+
+}
@@ -1,33 +1,40 @@
 #include "BTActionSelector.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossBlackboardKeys.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTActionSelector> kRegistrar("BTActionSelector", { "Action Selector", BTNodeCategory::Condition, { 0.8f, 0.8f, 0.2f, 1.0f } });
+
+}
+
 BTActionSelector::BTActionSelector(ActionType type)
     : expectedType_(type) {
     name_ = (type == ActionType::Dash) ? "ActionSelector(Dash)" : "ActionSelector(Shoot)";
 }
 
-BTNodeStatus BTActionSelector::Execute(BTBlackboard* blackboard) {
+BTNodeStatus BTActionSelector::Tick(BTBlackboard* blackboard, BTNoState&) const {
     // アクションカウンターを取得
-    int actionCounter = blackboard->GetInt("ActionCounter", 0);
+    int actionCounter = blackboard->GetInt(actionCounterKey_, 0);
 
     // カウンターの偶奇で判定
     int currentType = actionCounter % 2;
 
     // 期待するタイプと一致すれば成功
     if (currentType == static_cast<int>(expectedType_)) {
-        status_ = BTNodeStatus::Success;
         return BTNodeStatus::Success;
     }
 
-    status_ = BTNodeStatus::Failure;
     return BTNodeStatus::Failure;
 }
 
-void BTActionSelector::Reset() {
-    BTNode::Reset();
+void BTActionSelector::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    actionCounterKey_ = blackboard.RegisterKey<int>(BossBlackboardKeys::kActionCounter);
 }
 
 nlohmann::json BTActionSelector::ExtractParameters() const {
@@ -1,12 +1,12 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 
 /// <summary>
 /// アクション選択条件ノード
 /// ActionCounterの値に基づいて成功/失敗を返す
 /// </summary>
-class BTActionSelector : public BTNode {
+class BTActionSelector : public BTLeafNode<BTNoState> {
 public:
     /// <summary>
     /// 期待するアクションタイプ
@@ -19,8 +19,8 @@ public:
     /// <summary>
     /// コンストラクタ
     /// </summary>
-    /// <param name="type">期待するアクションタイプ</param>
-    explicit BTActionSelector(ActionType type);
+    /// <param name="type">期待するアクションタイプ（レジストリからの生成時はDash）</param>
+    explicit BTActionSelector(ActionType type = ActionType::Dash);
 
     /// <summary>
     /// デストラクタ
@@ -28,16 +28,12 @@ public:
     virtual ~BTActionSelector() = default;
 
     /// <summary>
-    /// ノードの実行
+    /// 条件の判定（状態を持たないため共有してもそのまま実行できる）
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">状態（未使用）</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTNoState& state) const override;
 
     /// <summary>
     /// アクションタイプを取得
@@ -66,6 +62,12 @@ public:
     /// </summary>
     nlohmann::json ExtractParameters() const override;
 
+    /// <summary>
+    /// ブラックボードキーの解決
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    void ResolveBlackboardKeys(BTBlackboard& blackboard) override;
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGuiでパラメータ編集UIを描画
@@ -76,4 +78,7 @@ public:
 private:
     // 期待するアクションタイプ
     ActionType expectedType_;
+
+    // 行動カウンターのキーハンドル
+    BTBlackboardKey<int> actionCounterKey_;
 };
\ No newline at end of file
@@ -1,47 +1,62 @@
 #include "BTBossDistanceCondition.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
 #include "../../../Player/Player.h"
+#include "../BossBlackboardKeys.h"
 #include "Vector3.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossDistanceCondition> kRegistrar("BTBossDistanceCondition", { "Distance Condition", BTNodeCategory::Condition, { 0.2f, 0.7f, 0.5f, 1.0f } });
+
+}
+
 BTBossDistanceCondition::BTBossDistanceCondition() {
     name_ = "DistanceCondition";
 }
 
-BTNodeStatus BTBossDistanceCondition::Execute(BTBlackboard* blackboard) {
-    // ボスとプレイヤーを取得
-    Boss* boss = blackboard->GetBoss();
-    Player* player = blackboard->GetPlayer();
-
-    if (!boss || !player) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+BTNodeStatus BTBossDistanceCondition::Tick(BTBlackboard* blackboard, BTNoState&) const {
+    float distance = 0.0f;
+    if (blackboard->HasValue(distanceKey_)) {
+        // 公開済みの水平距離を使用（変化を監視できるようにブラックボード経由で読む）
+        distance = blackboard->GetFloat(distanceKey_);
     }
+    else {
+        // 未公開の場合はボスとプレイヤーから直接計算
+        BossAgent* boss = blackboard->GetBoss();
+        Player* player = blackboard->GetPlayer();
 
-    // 位置を取得
-    Vector3 bossPos = boss->GetTransform().translate;
-    Vector3 playerPos = player->GetTransform().translate;
+        if (!boss || !player) {
+            return BTNodeStatus::Failure;
+        }
 
-    // 水平距離を計算（Y軸を無視）
-    Vector3 diff = playerPos - bossPos;
-    diff.y = 0.0f;
-    float distance = diff.Length();
+        // 水平距離を計算（Y軸を無視）
+        Vector3 diff = player->GetTransform().translate - boss->GetTransform().translate;
+        diff.y = 0.0f;
+        distance = diff.Length();
+    }
 
     // 範囲内チェック: minDistance_ <= distance <= maxDistance_
     if (distance >= minDistance_ && distance <= maxDistance_) {
-        status_ = BTNodeStatus::Success;
         return BTNodeStatus::Success;
     }
 
-    status_ = BTNodeStatus::Failure;
     return BTNodeStatus::Failure;
 }
 
-void BTBossDistanceCondition::Reset() {
-    BTNode::Reset();
+void BTBossDistanceCondition::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    distanceKey_ = blackboard.RegisterKey<float>(BossBlackboardKeys::kPlayerDistance);
+}
+
+void BTBossDistanceCondition::GetObservedKeys(std::vector<uint16_t>& outSlots) const {
+    if (distanceKey_.IsValid()) {
+        outSlots.push_back(distanceKey_.slot);
+    }
 }
 
 void BTBossDistanceCondition::ApplyParameters(const nlohmann::json& params) {
@@ -51,13 +66,16 @@ void BTBossDistanceCondition::ApplyParameters(const nlohmann::json& params) {
     if (params.contains("maxDistance")) {
         maxDistance_ = params["maxDistance"].get<float>();
     }
+    ApplyAbortMode(params);
 }
 
 nlohmann::json BTBossDistanceCondition::ExtractParameters() const {
-    return {
+    nlohmann::json params = {
         {"minDistance", minDistance_},
         {"maxDistance", maxDistance_}
     };
+    ExtractAbortMode(params);
+    return params;
 }
 
 #ifdef _DEBUG
@@ -85,6 +103,11 @@ bool BTBossDistanceCondition::DrawImGui() {
     // 補助テキスト
     ImGui::TextDisabled("Success if: %.1f <= distance <= %.1f", minDistance_, maxDistance_);
 
+    // 監視キーの変化による中断
+    if (DrawAbortModeImGui()) {
+        changed = true;
+    }
+
     return changed;
 }
 #endif
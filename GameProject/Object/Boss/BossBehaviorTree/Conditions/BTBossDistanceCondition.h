@@ -1,12 +1,12 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 
 /// <summary>
 /// 距離条件ノード
 /// プレイヤーとの距離が指定範囲内かを判定して成功/失敗を返す
 /// </summary>
-class BTBossDistanceCondition : public BTNode {
+class BTBossDistanceCondition : public BTLeafNode<BTNoState> {
 public:
     /// <summary>
     /// コンストラクタ
@@ -19,16 +19,12 @@ public:
     virtual ~BTBossDistanceCondition() = default;
 
     /// <summary>
-    /// ノードの実行
+    /// 条件の判定（状態を持たないため共有してもそのまま実行できる）
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">状態（未使用）</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTNoState& state) const override;
 
     /// <summary>
     /// JSONからパラメータを適用
@@ -41,6 +37,18 @@ public:
     /// </summary>
     nlohmann::json ExtractParameters() const override;
 
+    /// <summary>
+    /// ブラックボードキーの解決
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    void ResolveBlackboardKeys(BTBlackboard& blackboard) override;
+
+    /// <summary>
+    /// 監視するブラックボードキーの取得
+    /// </summary>
+    /// <param name="outSlots">監視するキーのスロット番号の追加先</param>
+    void GetObservedKeys(std::vector<uint16_t>& outSlots) const override;
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGuiでパラメータ編集UIを描画
@@ -61,4 +69,7 @@ private:
 
     // 最大距離（これ以下の距離である必要がある）
     float maxDistance_ = 15.0f;
+
+    // プレイヤーとの水平距離のキーハンドル
+    BTBlackboardKey<float> distanceKey_;
 };
@@ -1,37 +1,57 @@
 #include "BTBossHPCondition.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
 #include "../../Boss.h"
+#include "../BossAgent.h"
+#include "../BossBlackboardKeys.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossHPCondition> kRegistrar("BTBossHPCondition", { "HP Condition", BTNodeCategory::Condition, { 0.9f, 0.5f, 0.2f, 1.0f } });
+
+}
+
 BTBossHPCondition::BTBossHPCondition() {
     name_ = "HPCondition";
 }
 
-BTNodeStatus BTBossHPCondition::Execute(BTBlackboard* blackboard) {
-    // ボスを取得
-    Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+BTNodeStatus BTBossHPCondition::Tick(BTBlackboard* blackboard, BTNoState&) const {
+    float currentPercent = 0.0f;
+    if (blackboard->HasValue(hpPercentKey_)) {
+        // 公開済みのHP割合を使用（変化を監視できるようにブラックボード経由で読む）
+        currentPercent = blackboard->GetFloat(hpPercentKey_);
     }
+    else {
+        // 未公開の場合はボスから直接取得
+        BossAgent* boss = blackboard->GetBoss();
+        if (!boss) {
+            return BTNodeStatus::Failure;
+        }
 
-    // 現在のHPをパーセンテージに変換
-    float currentHp = boss->GetHp();
-    float currentPercent = (currentHp / Boss::GetMaxHp()) * 100.0f;
+        // 現在のHPをパーセンテージに変換
+        float currentHp = boss->GetHp();
+        currentPercent = (currentHp / Boss::GetMaxHp()) * 100.0f;
+    }
 
     if (EvaluateCondition(currentPercent)) {
-        status_ = BTNodeStatus::Success;
         return BTNodeStatus::Success;
     }
 
-    status_ = BTNodeStatus::Failure;
     return BTNodeStatus::Failure;
 }
 
-void BTBossHPCondition::Reset() {
-    BTNode::Reset();
+void BTBossHPCondition::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    hpPercentKey_ = blackboard.RegisterKey<float>(BossBlackboardKeys::kBossHpPercent);
+}
+
+void BTBossHPCondition::GetObservedKeys(std::vector<uint16_t>& outSlots) const {
+    if (hpPercentKey_.IsValid()) {
+        outSlots.push_back(hpPercentKey_.slot);
+    }
 }
 
 bool BTBossHPCondition::EvaluateCondition(float currentPercent) const {
@@ -56,13 +76,16 @@ void BTBossHPCondition::ApplyParameters(const nlohmann::json& params) {
     if (params.contains("comparison")) {
         comparison_ = static_cast<Comparison>(params["comparison"].get<int>());
     }
+    ApplyAbortMode(params);
 }
 
 nlohmann::json BTBossHPCondition::ExtractParameters() const {
-    return {
+    nlohmann::json params = {
         {"thresholdPercent", thresholdPercent_},
         {"comparison", static_cast<int>(comparison_)}
     };
+    ExtractAbortMode(params);
+    return params;
 }
 
 #ifdef _DEBUG
@@ -82,6 +105,11 @@ bool BTBossHPCondition::DrawImGui() {
         changed = true;
     }
 
+    // 監視キーの変化による中断
+    if (DrawAbortModeImGui()) {
+        changed = true;
+    }
+
     return changed;
 }
 #endif
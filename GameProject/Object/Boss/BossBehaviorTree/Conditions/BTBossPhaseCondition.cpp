@@ -1,36 +1,53 @@
 #include "BTBossPhaseCondition.h"
-#include "../../Boss.h"
+#include "../../../../BehaviorTree/Core/BTNodeRegistry.h"
+#include "../BossAgent.h"
+#include "../BossBlackboardKeys.h"
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
 #endif
 
+namespace {
+
+    // ノードタイプの登録
+    const BTNodeRegistrar<BTBossPhaseCondition> kRegistrar("BTBossPhaseCondition", { "Phase Condition", BTNodeCategory::Condition, { 0.5f, 0.2f, 0.9f, 1.0f } });
+
+}
+
 BTBossPhaseCondition::BTBossPhaseCondition() {
     name_ = "PhaseCondition";
 }
 
-BTNodeStatus BTBossPhaseCondition::Execute(BTBlackboard* blackboard) {
-    // ボスを取得
-    Boss* boss = blackboard->GetBoss();
-    if (!boss) {
-        status_ = BTNodeStatus::Failure;
-        return BTNodeStatus::Failure;
+BTNodeStatus BTBossPhaseCondition::Tick(BTBlackboard* blackboard, BTNoState&) const {
+    uint32_t currentPhase = 0;
+    if (blackboard->HasValue(phaseKey_)) {
+        // 公開済みのフェーズを使用（変化を監視できるようにブラックボード経由で読む）
+        currentPhase = static_cast<uint32_t>(blackboard->GetInt(phaseKey_));
+    }
+    else {
+        // 未公開の場合はボスから直接取得
+        BossAgent* boss = blackboard->GetBoss();
+        if (!boss) {
+            return BTNodeStatus::Failure;
+        }
+        currentPhase = boss->GetPhase();
     }
-
-    // 現在のフェーズを取得して比較
-    uint32_t currentPhase = boss->GetPhase();
 
     if (EvaluateCondition(currentPhase)) {
-        status_ = BTNodeStatus::Success;
         return BTNodeStatus::Success;
     }
 
-    status_ = BTNodeStatus::Failure;
     return BTNodeStatus::Failure;
 }
 
-void BTBossPhaseCondition::Reset() {
-    BTNode::Reset();
+void BTBossPhaseCondition::ResolveBlackboardKeys(BTBlackboard& blackboard) {
+    phaseKey_ = blackboard.RegisterKey<int>(BossBlackboardKeys::kBossPhase);
+}
+
+void BTBossPhaseCondition::GetObservedKeys(std::vector<uint16_t>& outSlots) const {
+    if (phaseKey_.IsValid()) {
+        outSlots.push_back(phaseKey_.slot);
+    }
 }
 
 bool BTBossPhaseCondition::EvaluateCondition(uint32_t currentPhase) const {
@@ -55,13 +72,16 @@ void BTBossPhaseCondition::ApplyParameters(const nlohmann::json& params) {
     if (params.contains("comparison")) {
         comparison_ = static_cast<Comparison>(params["comparison"].get<int>());
     }
+    ApplyAbortMode(params);
 }
 
 nlohmann::json BTBossPhaseCondition::ExtractParameters() const {
-    return {
+    nlohmann::json params = {
         {"targetPhase", targetPhase_},
         {"comparison", static_cast<int>(comparison_)}
     };
+    ExtractAbortMode(params);
+    return params;
 }
 
 #ifdef _DEBUG
@@ -83,6 +103,11 @@ bool BTBossPhaseCondition::DrawImGui() {
         changed = true;
     }
 
+    // 監視キーの変化による中断
+    if (DrawAbortModeImGui()) {
+        changed = true;
+    }
+
     return changed;
 }
 #endif
@@ -1,12 +1,12 @@
 #pragma once
-#include "../../../../BehaviorTree/Core/BTNode.h"
+#include "../../../../BehaviorTree/Core/BTLeafNode.h"
 #include "../../../../BehaviorTree/Core/BTBlackboard.h"
 
 /// <summary>
 /// フェーズ条件ノード
 /// 現在のボスフェーズを指定した値と比較して成功/失敗を返す
 /// </summary>
-class BTBossPhaseCondition : public BTNode {
+class BTBossPhaseCondition : public BTLeafNode<BTNoState> {
 public:
     /// <summary>
     /// 比較タイプ
@@ -29,16 +29,12 @@ public:
     virtual ~BTBossPhaseCondition() = default;
 
     /// <summary>
-    /// ノードの実行
+    /// 条件の判定（状態を持たないため共有してもそのまま実行できる）
     /// </summary>
     /// <param name="blackboard">ブラックボード</param>
+    /// <param name="state">状態（未使用）</param>
     /// <returns>実行結果</returns>
-    BTNodeStatus Execute(BTBlackboard* blackboard) override;
-
-    /// <summary>
-    /// ノードのリセット
-    /// </summary>
-    void Reset() override;
+    BTNodeStatus Tick(BTBlackboard* blackboard, BTNoState& state) const override;
 
     /// <summary>
     /// JSONからパラメータを適用
@@ -51,6 +47,18 @@ public:
     /// </summary>
     nlohmann::json ExtractParameters() const override;
 
+    /// <summary>
+    /// ブラックボードキーの解決
+    /// </summary>
+    /// <param name="blackboard">ブラックボード</param>
+    void ResolveBlackboardKeys(BTBlackboard& blackboard) override;
+
+    /// <summary>
+    /// 監視するブラックボードキーの取得
+    /// </summary>
+    /// <param name="outSlots">監視するキーのスロット番号の追加先</param>
+    void GetObservedKeys(std::vector<uint16_t>& outSlots) const override;
+
 #ifdef _DEBUG
     /// <summary>
     /// ImGuiでパラメータ編集UIを描画
@@ -78,4 +86,7 @@ private:
 
     // 比較タイプ
     Comparison comparison_ = Comparison::Equal;
+
+    // フェーズのキーハンドル
+    BTBlackboardKey<int> phaseKey_;
 };
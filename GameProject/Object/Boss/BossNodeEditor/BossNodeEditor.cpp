@@ -5,10 +5,12 @@
 #include "../BossBehaviorTree/BossBehaviorTree.h"
 #include "../../../BehaviorTree/Core/BTComposite.h"
 #include "../../../BehaviorTree/Core/BTBlackboard.h"
+#include "../../../BehaviorTree/Core/BTTreeCooker.h"
 #include "../BossBehaviorTree/Conditions/BTActionSelector.h"
 #include "DebugUIManager.h"
 #include <imgui_internal.h>
 #include <algorithm>
+#include <cstdio>
 #include <queue>
 #include <set>
 #include <unordered_map>
@@ -148,6 +150,7 @@ void BossNodeEditor::Clear() {
     highlightedNodeId_ = -1;
     highlightStartTime_ = 0.0f;
     selectedNodeId_ = -1;
+    nodeProfiles_.clear();
     firstFrame_ = true;
 }
 
@@ -164,7 +167,20 @@ void BossNodeEditor::DrawToolbar() {
     static std::string selectedNodeType = "BTSelector"; // デフォルト
 
     if (ImGui::Button("Save##bne_toolbar")) {
-        SaveToJSON("resources/Json/BossTree.json");
+        if (SaveToJSON("resources/Json/BossTree.json")) {
+            // ランタイム用のバイナリも同時に更新
+            std::string cookedPath = BTTreeCooker::GetCookedPath("resources/Json/BossTree.json");
+            if (BTTreeCooker::CookFile("resources/Json/BossTree.json", cookedPath)) {
+                DebugUIManager::GetInstance()->AddLog(
+                    "[BossNodeEditor] Cooked tree to: " + cookedPath,
+                    DebugUIManager::LogType::Info);
+            }
+            else {
+                DebugUIManager::GetInstance()->AddLog(
+                    "[BossNodeEditor] Failed to cook tree: " + cookedPath,
+                    DebugUIManager::LogType::Error);
+            }
+        }
     }
     ImGui::SameLine();
 
@@ -178,6 +194,9 @@ void BossNodeEditor::DrawToolbar() {
         nodeOffsetX = 100.0f;
         nodeOffsetY = 100.0f;
     }
+    ImGui::SameLine();
+
+    ImGui::Checkbox("Profile##bne_toolbar", &showProfileOverlay_);
 
     // ノード作成用のUIセクション
     ImGui::SameLine();
@@ -373,6 +392,29 @@ void BossNodeEditor::DrawNode(const EditorNode& node) {
     ImGui::SetWindowFontScale(1.0f);
     ImGui::PopStyleColor();
 
+    // プロファイル表示（実行回数・平均時間・排他時間の割合をバーで表示）
+    if (showProfileOverlay_) {
+        auto profileIt = nodeProfiles_.find(node.id);
+        if (profileIt != nodeProfiles_.end()) {
+            const NodeProfile& profile = profileIt->second;
+            char profileText[64];
+            snprintf(profileText, sizeof(profileText), "%llu calls  %.0f ns",
+                static_cast<unsigned long long>(profile.callCount), profile.averageNs);
+            float profileWidth = ImGui::CalcTextSize(profileText).x;
+            ImGui::Dummy(ImVec2((nodeWidth - profileWidth) * 0.5f, 0));
+            ImGui::SameLine(0, 0);
+            ImGui::TextUnformatted(profileText);
+
+            // 割合が大きいほど赤くする
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+            ImVec2 costMin = ImGui::GetCursorScreenPos();
+            ImVec2 costMax = ImVec2(costMin.x + nodeWidth * profile.exclusiveShare, costMin.y + 4.0f);
+            drawList->AddRectFilled(costMin, ImVec2(costMin.x + nodeWidth, costMax.y), IM_COL32(30, 30, 30, 255));
+            drawList->AddRectFilled(costMin, costMax, ImColor(ImVec4(0.4f + profile.exclusiveShare * 0.6f, 0.8f - profile.exclusiveShare * 0.6f, 0.2f, 1.0f)));
+            ImGui::Dummy(ImVec2(nodeWidth, 4.0f));
+        }
+    }
+
     ImGui::Spacing();
 
     // ========== 出力ピンバー（下部） ==========
@@ -1003,6 +1045,43 @@ void BossNodeEditor::HighlightRunningNode(const BTNodePtr& nodePtr) {
     }
 }
 
+/// <summary>
+/// プロファイラの集計をエディタノードへ対応付ける
+/// </summary>
+void BossNodeEditor::SetProfileData(const BTTreeInstance& instance) {
+    nodeProfiles_.clear();
+
+    const BTCompiledTree* tree = instance.GetDefinition().get();
+    const BTProfiler* profiler = instance.GetProfiler();
+    if (!tree || !profiler || profiler->GetNodeCount() != tree->GetNodeCount()) {
+        return;
+    }
+
+    uint64_t totalExclusive = 0;
+    for (uint16_t i = 0; i < profiler->GetNodeCount(); ++i) {
+        totalExclusive += profiler->GetStats(i).exclusiveTicks;
+    }
+
+    for (uint16_t i = 0; i < profiler->GetNodeCount(); ++i) {
+        const BTProfiler::NodeStats& stats = profiler->GetStats(i);
+        if (stats.callCount == 0) {
+            continue;
+        }
+
+        EditorNode* editorNode = FindNodeByRuntimeNode(tree->GetSourceNode(i));
+        if (!editorNode) {
+            continue;
+        }
+
+        NodeProfile& profile = nodeProfiles_[editorNode->id];
+        profile.callCount = stats.callCount;
+        profile.averageNs = profiler->TicksToNanoseconds(stats.inclusiveTicks) / static_cast<double>(stats.callCount);
+        profile.exclusiveShare = (totalExclusive > 0)
+            ? static_cast<float>(static_cast<double>(stats.exclusiveTicks) / static_cast<double>(totalExclusive))
+            : 0.0f;
+    }
+}
+
 // ==========================================
 // ヘルパー関数の実装
 // ==========================================
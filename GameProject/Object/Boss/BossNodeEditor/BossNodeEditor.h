@@ -12,6 +12,7 @@
 #include <string>
 #include <json.hpp>
 #include "../../../BehaviorTree/Core/BTNode.h"
+#include "../../../BehaviorTree/Core/BTTreeInstance.h"
 
 // 名前空間エイリアス
 namespace ed = ax::NodeEditor;
@@ -124,6 +125,18 @@ public:
     /// <param name="nodePtr">実行中のノード</param>
     void HighlightRunningNode(const BTNodePtr& nodePtr);
 
+    /// <summary>
+    /// プロファイラの集計をノード上に重ねて表示する（デバッグ用）
+    /// エディタのノードが実行中のツリーと同じインスタンスの場合のみ対応付けられる
+    /// </summary>
+    /// <param name="instance">プロファイリング中のツリーの実行状態</param>
+    void SetProfileData(const BTTreeInstance& instance);
+
+    /// <summary>
+    /// プロファイル表示のクリア
+    /// </summary>
+    void ClearProfileData() { nodeProfiles_.clear(); }
+
     /// <summary>
     /// エディタのクリア
     /// </summary>
@@ -156,6 +169,15 @@ private:
     float highlightStartTime_;  // ハイライト開始時刻（パルスエフェクト用）
     int selectedNodeId_ = -1;  // 選択中のノードID（インスペクター用）
 
+    // ノードごとのプロファイル表示データ
+    struct NodeProfile {
+        uint64_t callCount = 0;     // 実行回数
+        double averageNs = 0.0;     // 1回あたりの包括時間（ナノ秒）
+        float exclusiveShare = 0.0f; // ツリー全体の排他時間に占める割合（0～1）
+    };
+    std::unordered_map<int, NodeProfile> nodeProfiles_;  // エディタノードID → プロファイル
+    bool showProfileOverlay_ = true;  // プロファイルを重ねて表示するか
+
     // 内部処理
     void DrawNodes();
     void DrawNode(const EditorNode& node);
@@ -1,6 +1,8 @@
 #include "Player.h"
 #include "Object3d.h"
 #include "Input.h"
+#include "Mat4x4Func.h"
+#include "Vec3Func.h"
 #include "Camera.h"
 #include "State/PlayerStateMachine.h"
 #include "State/IdleState.h"
@@ -15,6 +17,7 @@
 #include "CollisionManager.h"
 #include "../../Collision/CollisionTypeIdDef.h"
 #include "../Boss/Boss.h"
+#include "../Projectile/ProjectileSpawnQueue.h"
 #include "GlobalVariables.h"
 #include "../../Common/GameConst.h"
 #include "FrameTimer.h"
@@ -727,10 +730,7 @@ void Player::ClearDynamicBounds()
 
 void Player::RequestBulletSpawn(const Vector3& position, const Vector3& velocity)
 {
-    pendingBullets_.push_back({ position, velocity });
-}
-
-std::vector<Player::BulletSpawnRequest> Player::ConsumePendingBullets()
-{
-    return std::move(pendingBullets_);
+    if (spawnQueue_) {
+        spawnQueue_->PushBullet({ position, velocity, 0.0f, ProjectileOwner::Player });
+    }
 }
\ No newline at end of file
@@ -15,6 +15,10 @@ class InputHandler;
 class Camera;
 class MeleeAttackCollider;
 class Boss;
+class ProjectileSpawnQueue;
+class CollisionGrid;
+class ProjectileSystem;
+class BulletPatternSystem;
 
 /// <summary>
 /// プレイヤーキャラクタークラス
@@ -264,6 +268,12 @@ public: // メンバ関数
     /// <returns>近接攻撃コライダーのポインタ</returns>
     MeleeAttackCollider* GetMeleeAttackCollider() const { return meleeAttackCollider_.get(); }
 
+    /// <summary>
+    /// コライダーを取得
+    /// </summary>
+    /// <returns>プレイヤー本体のOBBコライダーのポインタ</returns>
+    OBBCollider* GetCollider() const { return bodyCollider_.get(); }
+
     /// <summary>
     /// 攻撃ブロックを取得
     /// </summary>
@@ -329,25 +339,47 @@ public: // メンバ関数
 
     //-----------------------------弾生成リクエストシステム------------------------------//
     /// <summary>
-    /// 弾生成リクエスト構造体
+    /// 弾の生成キューを設定
     /// </summary>
-    struct BulletSpawnRequest {
-        Vector3 position;  ///< 発射位置
-        Vector3 velocity;  ///< 弾の速度ベクトル
-    };
+    void SetSpawnQueue(ProjectileSpawnQueue* spawnQueue) { spawnQueue_ = spawnQueue; }
 
     /// <summary>
-    /// 弾生成リクエストを追加
+    /// 弾生成リクエストを生成キューへ追加（キュー未設定・容量超過なら捨てる）
     /// </summary>
     /// <param name="position">発射位置</param>
     /// <param name="velocity">弾の速度ベクトル</param>
     void RequestBulletSpawn(const Vector3& position, const Vector3& velocity);
 
+    //-----------------------------空間クエリ------------------------------//
+    /// <summary>
+    /// パリィ・ターゲット検索のクエリに使う衝突判定グリッドを設定
+    /// </summary>
+    void SetCollisionGrid(CollisionGrid* collisionGrid) { collisionGrid_ = collisionGrid; }
+
+    /// <summary>
+    /// 衝突判定グリッドを取得（未設定ならnullptr）
+    /// </summary>
+    CollisionGrid* GetCollisionGrid() const { return collisionGrid_; }
+
     /// <summary>
-    /// 保留中の弾生成リクエストを取得して消費
+    /// パリィのクエリに使う弾幕の弾システムを設定（コライダーを持たない弾も脅威として扱う）
     /// </summary>
-    /// <returns>弾生成リクエストのリスト</returns>
-    std::vector<BulletSpawnRequest> ConsumePendingBullets();
+    /// <param name="danmakuBullets">弾幕用の弾</param>
+    /// <param name="bulletPatterns">弾幕の模様</param>
+    void SetDanmakuSystems(const ProjectileSystem* danmakuBullets, BulletPatternSystem* bulletPatterns) {
+        danmakuBullets_ = danmakuBullets;
+        bulletPatterns_ = bulletPatterns;
+    }
+
+    /// <summary>
+    /// 弾幕用の弾を取得（未設定ならnullptr）
+    /// </summary>
+    const ProjectileSystem* GetDanmakuBullets() const { return danmakuBullets_; }
+
+    /// <summary>
+    /// 弾幕の模様を取得（未設定ならnullptr）
+    /// </summary>
+    BulletPatternSystem* GetBulletPatterns() const { return bulletPatterns_; }
 
 private: // メンバ変数
 
@@ -395,8 +427,15 @@ private: // メンバ変数
     float moveDuration_ = 0.0f;           ///< 移動所要時間
     bool isMoveInitialized_ = false;      ///< 移動初期化済みフラグ
 
-    // 弾生成リクエスト
-    std::vector<BulletSpawnRequest> pendingBullets_;
+    // 弾の生成キュー（GameSceneが所有）
+    ProjectileSpawnQueue* spawnQueue_ = nullptr;
+
+    // 空間クエリ用の衝突判定グリッド（GameSceneが所有）
+    CollisionGrid* collisionGrid_ = nullptr;
+
+    // パリィのクエリ用の弾幕の弾システム（GameSceneが所有）
+    const ProjectileSystem* danmakuBullets_ = nullptr;
+    BulletPatternSystem* bulletPatterns_ = nullptr;
 
     // 被弾Vignetteエフェクト
     float damageVignetteTimer_ = 0.0f;                       ///< Vignetteフェードアウトタイマー
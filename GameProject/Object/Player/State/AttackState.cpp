@@ -3,11 +3,13 @@
 #include "../Player.h"
 #include "Input/InputHandler.h"
 #include "../../../Collision/MeleeAttackCollider.h"
+#include "../../../Collision/CollisionGrid.h"
 #include "../../Boss/Boss.h"
 #include "CollisionManager.h"
 #include "Object3d.h"
 #include "GlobalVariables.h"
 #include <cmath>
+#include <numbers>
 
 #ifdef _DEBUG
 #include "ImGuiManager.h"
@@ -56,6 +58,8 @@ void AttackState::Update(Player* player, float deltaTime)
     comboWindow_ = gv->GetValueFloat("AttackState", "ComboWindow");
     blockRadius_ = gv->GetValueFloat("AttackState", "BlockRadius");
     blockScale_ = gv->GetValueFloat("AttackState", "BlockScale");
+    searchRange_ = gv->GetValueFloat("AttackState", "SearchRange");
+    searchAngle_ = gv->GetValueFloat("AttackState", "SearchAngle");
 
     switch (phase_) {
     case SearchTarget:
@@ -130,6 +134,32 @@ void AttackState::HandleInput(Player* player)
 
 void AttackState::SearchForTarget(Player* player)
 {
+    // グリッドへのクエリは今の位置で調べるので、次の衝突判定を待たずに同じフレームで見つかる
+    CollisionGrid* grid = player->GetCollisionGrid();
+    if (grid) {
+        const Vector3 origin = player->GetTranslate();
+        const float rotY = player->GetRotate().y;
+        const Vector3 forward = { std::sin(rotY), 0.0f, std::cos(rotY) };
+        const float halfAngle = searchAngle_ * std::numbers::pi_v<float> / 180.0f;
+        grid->QueryOverlapCone(origin, forward, halfAngle, searchRange_,
+            CollisionGrid::TypeBit(CollisionTypeId::BOSS), searchResults_);
+
+        // 扇形の中で最も近いボス
+        targetEnemy_ = nullptr;
+        float nearestDistanceSq = 0.0f;
+        for (Collider* collider : searchResults_) {
+            Boss* enemy = static_cast<Boss*>(collider->GetOwner());
+            if (!enemy) continue;
+            const Vector3 diff = collider->GetCenter() - origin;
+            const float distanceSq = diff.Dot(diff);
+            if (!targetEnemy_ || distanceSq < nearestDistanceSq) {
+                targetEnemy_ = enemy;
+                nearestDistanceSq = distanceSq;
+            }
+        }
+        return;
+    }
+
     if (!player->GetMeleeAttackCollider()) return;
 
     targetEnemy_ = player->GetMeleeAttackCollider()->GetDetectedEnemy();
@@ -1,5 +1,8 @@
 #pragma once
 #include "PlayerState.h"
+#include <vector>
+
+class Collider;
 
 /// <summary>
 /// 攻撃状態クラス
@@ -52,9 +55,15 @@ private:
 	float blockSwingAngle_ = 3.14159f;                ///< 振り幅（π = 180度）
 	float blockScale_ = 0.5f;                         ///< ブロックのスケール
 
+	// ターゲット検索（衝突判定グリッドへのクエリ）
+	float searchRange_ = 18.5f;                       ///< 検索する距離
+	float searchAngle_ = 30.0f;                       ///< 正面からの検索角度（度）
+	std::vector<Collider*> searchResults_;            ///< クエリ結果の作業領域
+
 	/// <summary>
 	/// ターゲット検索処理
 	/// 攻撃範囲内の最も近い敵を検索してターゲットに設定する
+	/// 衝突判定グリッドがあれば前方の扇形をその場で調べる（なければ攻撃範囲Colliderの検出結果を使う）
 	/// </summary>
 	/// <param name="player">プレイヤーインスタンス</param>
 	void SearchForTarget(Player* player);
@@ -3,6 +3,9 @@
 #include "../Player.h"
 #include "Input/InputHandler.h"
 #include "GlobalVariables.h"
+#include "../../../Collision/CollisionGrid.h"
+#include "../../Projectile/BulletPatternSystem.h"
+#include "../../Projectile/ProjectileSystem.h"
 #include <algorithm>  // for std::min
 #ifdef _DEBUG
 #include "ImGuiManager.h"
@@ -24,9 +27,17 @@ void ParryState::Update(Player* player, float deltaTime)
 	GlobalVariables* gv = GlobalVariables::GetInstance();
 	parryWindow_ = gv->GetValueFloat("ParryState", "ParryWindow");
 	parryDuration_ = gv->GetValueFloat("ParryState", "ParryDuration");
+	parryRadius_ = gv->GetValueFloat("ParryState", "ParryRadius");
 
 	parryTimer_ += deltaTime;
 
+	// 受付時間内に敵の攻撃が近くにあればパリィ成功（クエリなので当たる前の同じフレームで判定できる）
+	if (IsInParryWindow() && HasThreat(player))
+	{
+		OnParrySuccess(player);
+		return;
+	}
+
 	// パリィ時間が終了したら元の状態に戻る
 	if (parryTimer_ >= parryDuration_)
 	{
@@ -49,6 +60,28 @@ void ParryState::HandleInput(Player* player)
 	// パリィ中は入力を受け付けない
 }
 
+bool ParryState::HasThreat(Player* player)
+{
+	const Vector3& center = player->GetTranslate();
+
+	// 弾・ボスの近接攻撃（グリッドにはクエリ専用で登録）
+	CollisionGrid* grid = player->GetCollisionGrid();
+	const uint32_t threatMask = CollisionGrid::TypeBit(CollisionTypeId::BOSS_ATTACK);
+	if (grid && grid->QueryOverlapSphere(center, parryRadius_, threatMask, threats_) > 0)
+	{
+		return true;
+	}
+
+	// コライダーを持たない弾幕の弾
+	const ProjectileSystem* danmakuBullets = player->GetDanmakuBullets();
+	if (danmakuBullets && danmakuBullets->CountOverlapSphere(center, parryRadius_) > 0)
+	{
+		return true;
+	}
+	BulletPatternSystem* bulletPatterns = player->GetBulletPatterns();
+	return bulletPatterns && bulletPatterns->CountOverlapSphere(center, parryRadius_) > 0;
+}
+
 void ParryState::OnParrySuccess(Player* player)
 {
 	if (IsInParryWindow())
@@ -101,6 +134,7 @@ void ParryState::DrawImGui(Player* player)
 	if (ImGui::TreeNode("Parry Parameters")) {
 		ImGui::SliderFloat("Parry Window", &parryWindow_, 0.05f, 0.5f, "%.3f sec");
 		ImGui::SliderFloat("Parry Duration", &parryDuration_, 0.2f, 2.0f, "%.2f sec");
+		ImGui::SliderFloat("Parry Radius", &parryRadius_, 0.5f, 10.0f, "%.1f");
 
 		// プリセット
 		if (ImGui::Button("Easy")) {
@@ -1,5 +1,8 @@
 #pragma once
 #include "PlayerState.h"
+#include <vector>
+
+class Collider;
 
 /// <summary>
 /// パリィ状態クラス
@@ -36,6 +39,7 @@ public:
 	float GetParryTimer() const { return parryTimer_; }
 	float GetParryWindow() const { return parryWindow_; }
 	float GetParryDuration() const { return parryDuration_; }
+	float GetParryRadius() const { return parryRadius_; }
 	bool IsPerfectParryActive() const { return perfectParryActive_; }
 
 	// DrawImGui用のセッター（デバッグ調整用）
@@ -43,8 +47,17 @@ public:
 	void SetParryDuration(float duration) { parryDuration_ = duration; }
 
 private:
+	/// <summary>
+	/// パリィ半径内に敵の攻撃（弾・近接攻撃・弾幕の弾）があるか
+	/// </summary>
+	/// <param name="player">プレイヤーインスタンス</param>
+	/// <returns>ある場合true</returns>
+	bool HasThreat(Player* player);
+
 	float parryTimer_ = 0.0f;          ///< パリィ経過時間
 	float parryWindow_ = 0.2f;         ///< パーフェクトパリィの受付時間
 	float parryDuration_ = 0.5f;       ///< パリィ全体の長さ
 	bool perfectParryActive_ = false;  ///< パーフェクトパリィ成功フラグ
+	float parryRadius_ = 4.0f;         ///< 敵の攻撃を探す半径
+	std::vector<Collider*> threats_;   ///< クエリ結果の作業領域
 };
\ No newline at end of file
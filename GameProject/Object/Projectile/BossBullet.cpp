@@ -1,21 +1,21 @@
 #include "BossBullet.h"
 #include "../../Collision/BossBulletCollider.h"
+#include "../../Collision/SweptCollision.h"
 #include "../../Object/Player/Player.h"
 #include "../../Common/GameConst.h"
-#include "ModelManager.h"
-#include "Object3d.h"
 #include "CollisionManager.h"
-#include "EmitterManager.h"
 #include "RandomEngine.h"
 #include "GlobalVariables.h"
 
-uint32_t BossBullet::id = 0;
+BossBullet::BossBullet(ProjectileEffects* effects, CollisionGrid* collisionGrid, HitEventQueue* hitEvents)
+    : collisionGrid_(collisionGrid), hitEvents_(hitEvents), effects_(effects) {
+}
 
-BossBullet::BossBullet(EmitterManager* emittermanager) {
-    // GlobalVariablesから値を取得
-    GlobalVariables* gv = GlobalVariables::GetInstance();
+BossBullet::~BossBullet() = default;
 
-    // 弾のパラメータ設定（GlobalVariablesから取得）
+void BossBullet::Initialize(const Vector3& position, const Vector3& velocity) {
+    // 弾のパラメータ設定（GlobalVariablesから取得、プールからの再利用時も最新の値を使う）
+    GlobalVariables* gv = GlobalVariables::GetInstance();
     damage_ = gv->GetValueFloat("BossBullet", "Damage");
     lifeTime_ = gv->GetValueFloat("BossBullet", "Lifetime");
 
@@ -28,56 +28,23 @@ BossBullet::BossBullet(EmitterManager* emittermanager) {
         rng->GetFloat(rotationSpeedMin_, rotationSpeedMax_)
     );
 
-    // エミッターマネージャーの設定
-    emitterManager_ = emittermanager;
-
-    // エフェクトプリセットをロード
-    if (emitterManager_) {
-        bulletEmitterName_ = "boss_bullet" + std::to_string(id);
-        explodeEmitterName_ = "boss_bullet_explode" + std::to_string(id);
-        emitterManager_->LoadPreset("boss_bullet", bulletEmitterName_);
-        emitterManager_->SetEmitterActive(bulletEmitterName_, false);
-        emitterManager_->LoadPreset("boss_bullet_explode", explodeEmitterName_);
-        emitterManager_->SetEmitterActive(explodeEmitterName_, false);
-    }
-
-    id++;
-
-    if (id > kIdResetThreshold) {
-        id = 0; // IDのリセット
-    }
-}
-
-BossBullet::~BossBullet() = default;
-
-void BossBullet::Initialize(const Vector3& position, const Vector3& velocity) {
     // 親クラスの初期化
     Projectile::Initialize(position, velocity);
 
-    // モデルをロード
-    SetModel();
-
-    model_->Update();
-
     // スケールを設定（球体モデルのサイズ調整）
     transform_.scale = Vector3(kInitialScale, kInitialScale, kInitialScale);
 
-    // 弾の色を設定（赤っぽい色）
-    //if (model_) {
-    //    model_->SetMaterialColor(Vector4(1.0f, 0.3f, 0.3f, 1.0f));
-    //    model_->SetTransform(transform_);
-    //}
-
-    if (emitterManager_) {
-        emitterManager_->SetEmitterActive(bulletEmitterName_, true);
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, position);
+    if (effects_) {
+        trailHandle_ = effects_->trail.Acquire(position);
     }
 
+    sweptCollision_ = gv->GetValueBool("BossBullet", "SweptCollision");
+
     // コライダーの設定
     if (!collider_) {
         collider_ = std::make_unique<BossBulletCollider>(this);
     }
-    float colliderRadius = GlobalVariables::GetInstance()->GetValueFloat("BossBullet", "ColliderRadius");
+    float colliderRadius = gv->GetValueFloat("BossBullet", "ColliderRadius");
     collider_->SetTransform(&transform_);
     collider_->SetRadius(colliderRadius);
     collider_->SetOffset(Vector3(0.0f, 0.0f, 0.0f));
@@ -86,23 +53,48 @@ void BossBullet::Initialize(const Vector3& position, const Vector3& velocity) {
     collider_->SetActive(true);
     collider_->Reset();  // 状態をリセット
 
-    // CollisionManagerに登録
-    CollisionManager::GetInstance()->AddCollider(collider_.get());
+    // グリッドがあればそちらへ、なければCollisionManagerに登録
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = collisionGrid_->Insert(collider_.get());
+    }
+    else {
+        CollisionManager::GetInstance()->AddCollider(collider_.get());
+    }
+}
+
+void BossBullet::Release() {
+    // 登録先（グリッドまたはCollisionManager）から削除
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = CollisionGrid::kInvalidHandle;
+    }
+    else if (collider_) {
+        CollisionManager::GetInstance()->RemoveCollider(collider_.get());
+    }
+
+    // 爆発エフェクトを再生し、軌跡を返却する
+    if (effects_) {
+        effects_->explode.Play(transform_.translate, effects_->explodeDuration);
+        effects_->trail.Release(trailHandle_);
+        trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
+    }
 }
 
 void BossBullet::Finalize() {
-    // CollisionManagerから削除
-    if (collider_) {
+    // 登録先（グリッドまたはCollisionManager）から削除
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = CollisionGrid::kInvalidHandle;
+    }
+    else if (collider_) {
         CollisionManager::GetInstance()->RemoveCollider(collider_.get());
     }
 
-    if (emitterManager_) {
-        emitterManager_->CreateTemporaryEmitterFrom(
-            explodeEmitterName_,
-            explodeEmitterName_ + "temp",
-            0.5f);
-        emitterManager_->RemoveEmitter(bulletEmitterName_);
-        emitterManager_->RemoveEmitter(explodeEmitterName_);
+    // エミッター自体はプールの終了処理で削除する
+    if (effects_) {
+        effects_->trail.Release(trailHandle_);
+        trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
     }
 }
 
@@ -117,15 +109,9 @@ void BossBullet::Update(float deltaTime) {
     // 回転アニメーション
     transform_.rotate += rotationSpeed_ * deltaTime;
 
-    // モデルの更新
-    //if (model_) {
-    //    model_->SetTransform(transform_);
-    //}
-
     // 軌跡エフェクト
-    if (emitterManager_) {
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, transform_.translate);
-        emitterManager_->SetEmitterPosition(explodeEmitterName_, transform_.translate);
+    if (effects_) {
+        effects_->trail.SetPosition(trailHandle_, transform_.translate);
     }
 
     // エリア外に出たら非アクティブ化
@@ -137,14 +123,22 @@ void BossBullet::Update(float deltaTime) {
     }
 }
 
-void BossBullet::SetModel() {
-    if (model_) {
-        // モデルをロード
-        model_->SetModel("sphere.gltf");
+bool BossBullet::SweepCollision(Collider* target) {
+    if (!isActive_ || !sweptCollision_ || !collider_ || !target || !target->IsActive()) {
+        return false;
+    }
 
-        if (!model_->GetModel()) {
-            // sphereモデルがない場合は、代替モデルを使用
-            model_->SetModel("white_cube.gltf");
-        }
+    float time = 0.0f;
+    if (!SweptCollision::SweepSphere(previousTranslate_, transform_.translate, collider_->GetRadius(), *target, time)) {
+        return false;
     }
-}
\ No newline at end of file
+
+    // 最初に触れた位置へ戻し、通常の衝突と同じ処理を行う（爆発も当たった位置で再生される）
+    transform_.translate = previousTranslate_ + (transform_.translate - previousTranslate_) * time;
+    collider_->OnCollisionEnter(target);
+    return !isActive_;
+}
+
+bool BossBullet::RegisterHit(const Collider* target) {
+    return !collisionGrid_ || collisionGrid_->RegisterHit(gridHandle_, target);
+}
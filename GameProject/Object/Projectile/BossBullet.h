@@ -1,13 +1,14 @@
 #pragma once
 
 #include "Projectile.h"
+#include "ProjectileEmitterPool.h"
+#include "../../Collision/CollisionGrid.h"
 #include "../../../GameProject/Collision/CollisionTypeIdDef.h"
 #include <memory>
-#include <string>
 
-class EmitterManager;
-class ModelManager;
+class Collider;
 class BossBulletCollider;
+class HitEventQueue;
 
 /// <summary>
 /// ボスの弾クラス
@@ -17,14 +18,16 @@ class BossBullet : public Projectile {
     // 定数
     //=========================================================================================
 private:
-    static constexpr uint32_t kIdResetThreshold = 10000;///< ID リセット閾値
     static constexpr float kInitialScale = 0.0f;        ///< 初期スケール
 
 public:
     /// <summary>
     /// コンストラクタ
     /// </summary>
-    BossBullet(EmitterManager* emittermanager);
+    /// <param name="effects">軌跡・爆発エフェクトのプール（nullptrならエフェクトなし）</param>
+    /// <param name="collisionGrid">コライダーの登録先のグリッド（nullptrならCollisionManagerへ登録）</param>
+    /// <param name="hitEvents">ヒットの書き込み先（nullptrなら当たった時にその場で適用）</param>
+    BossBullet(ProjectileEffects* effects, CollisionGrid* collisionGrid = nullptr, HitEventQueue* hitEvents = nullptr);
 
     /// <summary>
     /// デストラクタ
@@ -39,7 +42,13 @@ public:
     void Initialize(const Vector3& position, const Vector3& velocity) override;
 
     /// <summary>
-    /// 終了処理
+    /// プールへ返却する時の後始末（コライダーの登録解除・爆発エフェクトの再生・軌跡の返却）
+    /// モデル・コライダーは次の生成で使い回すため破棄しない
+    /// </summary>
+    void Release();
+
+    /// <summary>
+    /// 終了処理（コライダーの登録解除と軌跡の返却）
     /// </summary>
     void Finalize();
 
@@ -49,6 +58,27 @@ public:
     /// <param name="deltaTime">前フレームからの経過時間</param>
     void Update(float deltaTime) override;
 
+    /// <summary>
+    /// 前フレームの位置からの移動で相手に当たったかを判定し、当たっていれば当たった位置へ戻して衝突処理を行う
+    /// 速い弾や長いフレーム時間で相手をすり抜けないよう、CheckAllCollisionsの前に呼ぶ
+    /// </summary>
+    /// <param name="target">相手のコライダー（プレイヤー本体）</param>
+    /// <returns>当たった場合true</returns>
+    bool SweepCollision(Collider* target);
+
+    /// <summary>
+    /// 相手へのヒットを記録（同じ相手へ2回目ならfalse）
+    /// グリッドに登録していない場合は記録せず、当たった弾が消えることで多重ヒットを防ぐ
+    /// </summary>
+    /// <param name="target">相手のコライダー</param>
+    /// <returns>ヒットとして扱ってよい場合true</returns>
+    bool RegisterHit(const Collider* target);
+
+    /// <summary>
+    /// ヒットの書き込み先を取得
+    /// </summary>
+    HitEventQueue* GetHitEventQueue() const { return hitEvents_; }
+
     /// <summary>
     /// コリジョンタイプIDを取得
     /// </summary>
@@ -59,10 +89,6 @@ public:
     /// </summary>
     BossBulletCollider* GetCollider() const { return collider_.get(); }
 
-private:
-    // モデルを設定
-    void SetModel();
-
 private:
     // エフェクト用の回転速度
     Vector3 rotationSpeed_;
@@ -73,18 +99,24 @@ private:
     // パーティクル生成間隔
     float particleInterval_ = 0.05f;
 
+    // 連続衝突判定を行うか
+    bool sweptCollision_ = true;
+
     // 専用コライダー
     std::unique_ptr<BossBulletCollider> collider_;
 
-    // エミッタマネージャャーへのポインタ
-    EmitterManager* emitterManager_ = nullptr;
+    // コライダーの登録先のグリッドと登録のハンドル
+    CollisionGrid* collisionGrid_ = nullptr;
+    CollisionGrid::Handle gridHandle_ = CollisionGrid::kInvalidHandle;
+
+    // ヒットの書き込み先
+    HitEventQueue* hitEvents_ = nullptr;
 
-    // エミッターの名前
-    std::string bulletEmitterName_ = "";
-    std::string explodeEmitterName_ = "";
+    // 軌跡・爆発エフェクトのプール
+    ProjectileEffects* effects_ = nullptr;
 
-    // id
-    static uint32_t id;
+    // 貸し出し中の軌跡エミッター
+    ProjectileEmitterPool::Handle trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
 
     // 調整可能パラメータ
     float rotationSpeedMin_ = -10.0f;  ///< 回転速度の最小値
@@ -0,0 +1,37 @@
+#pragma once
+#include "Vector3.h"
+#include <cstdint>
+
+/// <summary>
+/// 弾幕の模様の種類
+/// </summary>
+enum class BulletPatternType : uint8_t {
+    Fan,     // 扇状に同時発射（spreadAngle）
+    Ring,    // 全方位に同時発射
+    Spiral,  // 全方位に1発ずつ遅らせて発射し、模様全体が回転する（interval, angularSpeed）
+    Wave,    // 扇状に同時発射し、弾が左右に揺れる（spreadAngle, waveAmplitude, waveFrequency）
+    Aimed,   // 基準方向へ1発ずつ遅らせて連射（interval, spreadAngle）
+};
+
+/// <summary>
+/// 弾幕の模様の種類の数（JSON・エディタから読んだ値の範囲の確認に使う）
+/// </summary>
+inline constexpr uint32_t kBulletPatternTypeCount = static_cast<uint32_t>(BulletPatternType::Aimed) + 1;
+
+/// <summary>
+/// 弾幕の模様1つ分の生成パラメータ
+/// 弾の位置は生成パラメータと経過時間だけで決まるため、何発の模様でも生成要求はこれ1件で済む
+/// 種類ごとに使わない値は無視する
+/// </summary>
+struct BulletPattern {
+    BulletPatternType type = BulletPatternType::Ring; // 種類
+    Vector3 origin{};                                 // 発射位置
+    float baseAngle = 0.0f;                           // 基準方向（Y軸回転、ラジアン。0で+Z方向）
+    uint32_t bulletCount = 16;                        // 弾数
+    float speed = 10.0f;                              // 弾の速さ
+    float spreadAngle = 0.5f;                         // 扇の全体の角度（ラジアン）
+    float interval = 0.05f;                           // 1発ごとの発射の遅れ（秒）
+    float angularSpeed = 0.0f;                        // 模様全体の回転の速さ（ラジアン/秒）
+    float waveAmplitude = 0.0f;                       // 左右の揺れの幅
+    float waveFrequency = 0.0f;                       // 左右の揺れの周波数（Hz）
+};
@@ -0,0 +1,372 @@
+#include "BulletPatternSystem.h"
+#include "ProjectileInstanceBatch.h"
+#include <algorithm>
+#include <cmath>
+
+// x86/x64ではSSEで4発ずつ計算する（それ以外の環境は同じ計算をスカラーで行う）
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BULLET_PATTERN_USE_SSE 1
+#include <xmmintrin.h>
+#else
+#define BULLET_PATTERN_USE_SSE 0
+#endif
+
+namespace {
+
+    constexpr float kTwoPi = 6.28318530718f;
+
+    /// <summary>
+    /// 線分の判定で0除算を避けるための長さの2乗の下限
+    /// </summary>
+    constexpr float kMinSweepLengthSq = 1.0e-12f;
+
+    /// <summary>
+    /// グループ内で模様に含まれる弾のレーンのマスク（最後のグループだけ途中まで）
+    /// </summary>
+    uint32_t ValidLaneMask(size_t group, size_t count) {
+        size_t first = group * BulletPatternSystem::kLaneWidth;
+        size_t lanes = (std::min)(count - first, BulletPatternSystem::kLaneWidth);
+        return (1u << lanes) - 1u;
+    }
+
+}
+
+void BulletPatternSystem::Initialize(size_t capacity) {
+    const size_t padded = capacity + kLaneWidth;
+    for (std::vector<float>* array : { &dirX_, &dirZ_, &delay_, &evalX_, &evalZ_, &prevX_, &prevZ_ }) {
+        array->assign(padded, 0.0f);
+    }
+    alive_.assign(padded, 0);
+    evalMask_.assign(padded / kLaneWidth + 1, 0);
+
+    // 模様は最低1発なので、容量分あれば生成中に確保し直すことはない
+    records_.clear();
+    records_.reserve(capacity);
+    bulletCount_ = 0;
+
+    stats_ = Stats{};
+    stats_.capacity = capacity;
+}
+
+bool BulletPatternSystem::Spawn(const BulletPattern& pattern, float lifetime, float damage, float radius) {
+    const uint32_t count = pattern.bulletCount;
+    if (count == 0) {
+        return false;
+    }
+    if (bulletCount_ + count > stats_.capacity) {
+        ++stats_.overflowCount;
+        return false;
+    }
+
+    const bool fan = pattern.type == BulletPatternType::Fan || pattern.type == BulletPatternType::Wave
+        || pattern.type == BulletPatternType::Aimed;
+    const bool delayed = pattern.type == BulletPatternType::Spiral || pattern.type == BulletPatternType::Aimed;
+    const float interval = delayed ? (std::max)(pattern.interval, 0.0f) : 0.0f;
+
+    Record record;
+    record.origin = pattern.origin;
+    record.speed = (std::max)(pattern.speed, 0.0f);
+    record.lifetime = lifetime;
+    record.maxDelay = interval * static_cast<float>(count - 1);
+    record.damage = damage;
+    record.radius = radius;
+    record.first = static_cast<uint32_t>(bulletCount_);
+    record.count = count;
+    record.aliveCount = count;
+    if (pattern.type == BulletPatternType::Spiral) {
+        record.angularSpeed = pattern.angularSpeed;
+    }
+    if (pattern.type == BulletPatternType::Wave) {
+        record.waveAmplitude = pattern.waveAmplitude;
+        record.waveAngularSpeed = kTwoPi * pattern.waveFrequency;
+    }
+
+    // 弾ごとの方向と発射の遅れは生成時に一度だけ求める
+    for (uint32_t i = 0; i < count; ++i) {
+        float offset = 0.0f;
+        if (fan) {
+            if (count > 1) {
+                offset = pattern.spreadAngle * (static_cast<float>(i) / static_cast<float>(count - 1) - 0.5f);
+            }
+        }
+        else {
+            offset = kTwoPi * static_cast<float>(i) / static_cast<float>(count);
+        }
+        const float angle = pattern.baseAngle + offset;
+        const size_t j = bulletCount_ + i;
+        dirX_[j] = std::sin(angle);
+        dirZ_[j] = std::cos(angle);
+        delay_[j] = interval * static_cast<float>(i);
+        alive_[j] = 1;
+    }
+    bulletCount_ += count;
+    records_.push_back(record);
+
+    ++stats_.spawnCount;
+    stats_.bulletSpawnCount += count;
+    stats_.activeCount = bulletCount_;
+    stats_.patternCount = records_.size();
+    stats_.highWaterMark = (std::max)(stats_.highWaterMark, bulletCount_);
+    return true;
+}
+
+void BulletPatternSystem::Update(float deltaTime) {
+    stats_.evaluatedCount = 0;
+    stats_.skippedCount = 0;
+
+    // 全弾が消えた模様を取り除き、残りの弾の値を生成順のまま前に詰める
+    size_t writeRecord = 0;
+    size_t writeBullet = 0;
+    for (Record& record : records_) {
+        record.age += deltaTime;
+        if (record.aliveCount == 0 || record.age >= record.maxDelay + record.lifetime) {
+            continue;
+        }
+        if (record.first != writeBullet) {
+            const size_t first = record.first;
+            const size_t last = first + record.count;
+            std::copy(dirX_.begin() + first, dirX_.begin() + last, dirX_.begin() + writeBullet);
+            std::copy(dirZ_.begin() + first, dirZ_.begin() + last, dirZ_.begin() + writeBullet);
+            std::copy(delay_.begin() + first, delay_.begin() + last, delay_.begin() + writeBullet);
+            std::copy(alive_.begin() + first, alive_.begin() + last, alive_.begin() + writeBullet);
+            record.first = static_cast<uint32_t>(writeBullet);
+        }
+        writeBullet += record.count;
+        records_[writeRecord++] = record;
+    }
+    records_.resize(writeRecord);
+    bulletCount_ = writeBullet;
+
+    stats_.activeCount = bulletCount_;
+    stats_.patternCount = records_.size();
+}
+
+uint32_t BulletPatternSystem::CollideSphere(const Vector3& center, float radius, float* outDamage, float sweepTime) {
+    uint32_t hitTotal = 0;
+    float damageTotal = 0.0f;
+    const bool swept = sweepTime > 0.0f;
+
+    for (Record& record : records_) {
+        if (record.aliveCount == 0) {
+            continue;
+        }
+
+        // 弾は発射位置の高さの水平面上を動くので、まず高さと発射位置からの距離の範囲で模様ごと判定する
+        const float reach = radius + record.radius;
+        const float dy = center.y - record.origin.y;
+        const float planarReachSq = reach * reach - dy * dy;
+        float minReach = 0.0f;
+        float maxReach = 0.0f;
+        GetReach(record, minReach, maxReach);
+        if (swept) {
+            minReach = (std::max)(minReach - record.speed * sweepTime, 0.0f);
+        }
+        const float ox = center.x - record.origin.x;
+        const float oz = center.z - record.origin.z;
+        const float distance = std::sqrt(ox * ox + oz * oz);
+        if (planarReachSq < 0.0f || distance + reach < minReach || distance - reach > maxReach) {
+            stats_.skippedCount += record.count;
+            continue;
+        }
+
+        if (swept) {
+            Evaluate(record, (std::max)(record.age - sweepTime, 0.0f), prevX_.data(), prevZ_.data());
+        }
+        const uint8_t* mask = Evaluate(record, record.age, evalX_.data(), evalZ_.data());
+
+        // 当たるのはまれなので、位置をまとめて求めた後の判定は生きているレーンだけスカラーで行う
+        const size_t groupCount = (record.count + kLaneWidth - 1) / kLaneWidth;
+        for (size_t group = 0; group < groupCount; ++group) {
+            for (uint32_t bits = mask[group]; bits != 0; bits &= bits - 1) {
+                uint32_t lane = 0;
+                while (!(bits & (1u << lane))) {
+                    ++lane;
+                }
+                const size_t local = group * kLaneWidth + lane;
+                float dx = evalX_[local] - center.x;
+                float dz = evalZ_[local] - center.z;
+                if (swept) {
+                    const float wx = evalX_[local] - prevX_[local];
+                    const float wz = evalZ_[local] - prevZ_[local];
+                    const float lengthSq = (std::max)(wx * wx + wz * wz, kMinSweepLengthSq);
+                    const float s = std::clamp((dx * wx + dz * wz) / lengthSq, 0.0f, 1.0f);
+                    dx -= wx * s;
+                    dz -= wz * s;
+                }
+                if (dx * dx + dz * dz <= planarReachSq) {
+                    alive_[record.first + local] = 0;
+                    --record.aliveCount;
+                    ++hitTotal;
+                    damageTotal += record.damage;
+                }
+            }
+        }
+    }
+
+    stats_.hitCount += hitTotal;
+    if (outDamage) {
+        *outDamage = damageTotal;
+    }
+    return hitTotal;
+}
+
+uint32_t BulletPatternSystem::CountOverlapSphere(const Vector3& center, float radius) {
+    uint32_t overlapTotal = 0;
+    for (const Record& record : records_) {
+        if (record.aliveCount == 0) {
+            continue;
+        }
+
+        // CollideSphereと同じく、高さと発射位置からの距離の範囲で模様ごと省く
+        const float reach = radius + record.radius;
+        const float dy = center.y - record.origin.y;
+        const float planarReachSq = reach * reach - dy * dy;
+        float minReach = 0.0f;
+        float maxReach = 0.0f;
+        GetReach(record, minReach, maxReach);
+        const float ox = center.x - record.origin.x;
+        const float oz = center.z - record.origin.z;
+        const float distance = std::sqrt(ox * ox + oz * oz);
+        if (planarReachSq < 0.0f || distance + reach < minReach || distance - reach > maxReach) {
+            stats_.skippedCount += record.count;
+            continue;
+        }
+
+        const uint8_t* mask = Evaluate(record, record.age, evalX_.data(), evalZ_.data());
+        const size_t groupCount = (record.count + kLaneWidth - 1) / kLaneWidth;
+        for (size_t group = 0; group < groupCount; ++group) {
+            for (uint32_t lane = 0; lane < kLaneWidth; ++lane) {
+                if (!(mask[group] & (1u << lane))) {
+                    continue;
+                }
+                const size_t local = group * kLaneWidth + lane;
+                const float dx = evalX_[local] - center.x;
+                const float dz = evalZ_[local] - center.z;
+                if (dx * dx + dz * dz <= planarReachSq) {
+                    ++overlapTotal;
+                }
+            }
+        }
+    }
+    return overlapTotal;
+}
+
+void BulletPatternSystem::AddInstances(ProjectileInstanceBatch& batch, const Vector4& color) {
+    for (const Record& record : records_) {
+        if (record.aliveCount == 0) {
+            continue;
+        }
+        float minReach = 0.0f;
+        float maxReach = 0.0f;
+        GetReach(record, minReach, maxReach);
+        if (!batch.IsSphereVisible(record.origin, maxReach + record.radius)) {
+            stats_.skippedCount += record.count;
+            continue;
+        }
+
+        const uint8_t* mask = Evaluate(record, record.age, evalX_.data(), evalZ_.data());
+        const size_t groupCount = (record.count + kLaneWidth - 1) / kLaneWidth;
+        for (size_t group = 0; group < groupCount; ++group) {
+            const uint32_t bits = mask[group];
+            for (uint32_t lane = 0; lane < kLaneWidth; ++lane) {
+                if (bits & (1u << lane)) {
+                    const size_t local = group * kLaneWidth + lane;
+                    batch.Add(Vector3(evalX_[local], record.origin.y, evalZ_[local]), record.radius, color);
+                }
+            }
+        }
+    }
+}
+
+void BulletPatternSystem::Clear() {
+    records_.clear();
+    bulletCount_ = 0;
+    stats_.activeCount = 0;
+    stats_.patternCount = 0;
+}
+
+void BulletPatternSystem::ResetStats() {
+    stats_.highWaterMark = bulletCount_;
+    stats_.spawnCount = 0;
+    stats_.bulletSpawnCount = 0;
+    stats_.overflowCount = 0;
+    stats_.hitCount = 0;
+}
+
+void BulletPatternSystem::GetReach(const Record& record, float& outMin, float& outMax) const {
+    // 最も遅く発射された弾が最も内側、最も早く発射された弾（生存時間で頭打ち）が最も外側にいる
+    // 左右の揺れは進行方向と直交するので、発射位置からの距離を縮めることはない
+    outMin = record.speed * (std::max)(record.age - record.maxDelay, 0.0f);
+    outMax = record.speed * (std::min)(record.age, record.lifetime) + std::abs(record.waveAmplitude);
+}
+
+const uint8_t* BulletPatternSystem::Evaluate(const Record& record, float time, float* outX, float* outZ) {
+    // 回転と揺れは模様全体で共通なので、三角関数はここで1回だけ
+    const float rotation = record.angularSpeed * time;
+    const float c = std::cos(rotation);
+    const float s = std::sin(rotation);
+    const float lateral = record.waveAmplitude * std::sin(record.waveAngularSpeed * time);
+
+    const size_t groupCount = (record.count + kLaneWidth - 1) / kLaneWidth;
+
+#if BULLET_PATTERN_USE_SSE
+    const __m128 vTime = _mm_set1_ps(time);
+    const __m128 vSpeed = _mm_set1_ps(record.speed);
+    const __m128 vLifetime = _mm_set1_ps(record.lifetime);
+    const __m128 vCos = _mm_set1_ps(c);
+    const __m128 vSin = _mm_set1_ps(s);
+    const __m128 vLateral = _mm_set1_ps(lateral);
+    const __m128 vOriginX = _mm_set1_ps(record.origin.x);
+    const __m128 vOriginZ = _mm_set1_ps(record.origin.z);
+    const __m128 zero = _mm_setzero_ps();
+#endif
+
+    for (size_t group = 0; group < groupCount; ++group) {
+        const size_t local = group * kLaneWidth;
+        const size_t i = record.first + local;
+        uint32_t firedMask = 0;
+
+#if BULLET_PATTERN_USE_SSE
+        // τ = 経過時間 - 発射の遅れ、発射前の弾は発射位置に置く
+        __m128 ux = _mm_loadu_ps(&dirX_[i]);
+        __m128 uz = _mm_loadu_ps(&dirZ_[i]);
+        __m128 tau = _mm_sub_ps(vTime, _mm_loadu_ps(&delay_[i]));
+        __m128 distance = _mm_mul_ps(_mm_max_ps(tau, zero), vSpeed);
+
+        // 方向の回転（Y軸回転、0で+Z方向）
+        __m128 dx = _mm_add_ps(_mm_mul_ps(ux, vCos), _mm_mul_ps(uz, vSin));
+        __m128 dz = _mm_sub_ps(_mm_mul_ps(uz, vCos), _mm_mul_ps(ux, vSin));
+
+        // 進行方向へ距離分、右方向（dz, -dx）へ揺れ分
+        __m128 x = _mm_add_ps(vOriginX, _mm_add_ps(_mm_mul_ps(dx, distance), _mm_mul_ps(dz, vLateral)));
+        __m128 z = _mm_add_ps(vOriginZ, _mm_sub_ps(_mm_mul_ps(dz, distance), _mm_mul_ps(dx, vLateral)));
+        _mm_storeu_ps(&outX[local], x);
+        _mm_storeu_ps(&outZ[local], z);
+
+        __m128 fired = _mm_and_ps(_mm_cmpge_ps(tau, zero), _mm_cmplt_ps(tau, vLifetime));
+        firedMask = static_cast<uint32_t>(_mm_movemask_ps(fired));
+#else
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            const size_t j = i + lane;
+            const float tau = time - delay_[j];
+            const float distance = (std::max)(tau, 0.0f) * record.speed;
+            const float dx = dirX_[j] * c + dirZ_[j] * s;
+            const float dz = dirZ_[j] * c - dirX_[j] * s;
+            outX[local + lane] = record.origin.x + dx * distance + dz * lateral;
+            outZ[local + lane] = record.origin.z + dz * distance - dx * lateral;
+            if (tau >= 0.0f && tau < record.lifetime) {
+                firedMask |= 1u << lane;
+            }
+        }
+#endif
+
+        uint32_t aliveMask = 0;
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            aliveMask |= static_cast<uint32_t>(alive_[i + lane]) << lane;
+        }
+        evalMask_[group] = static_cast<uint8_t>(firedMask & aliveMask & ValidLaneMask(group, record.count));
+    }
+
+    stats_.evaluatedCount += record.count;
+    return evalMask_.data();
+}
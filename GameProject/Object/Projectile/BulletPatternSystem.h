@@ -0,0 +1,161 @@
+#pragma once
+#include "BulletPattern.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class ProjectileInstanceBatch;
+
+/// <summary>
+/// 弾幕の模様をまとめて扱う弾システム
+/// 弾を1フレームずつ動かさず、模様ごとに「発射位置・基準方向・速さ・経過時間」と弾ごとの「方向・発射の遅れ」だけを持ち、
+/// 位置が必要になった時（当たり判定・描画）に経過時間から直接計算する
+///   τ = 模様の経過時間 - 弾の発射の遅れ
+///   位置 = 発射位置 + 回転(方向, 回転の速さ * 経過時間) * 速さ * τ + 左右の揺れ
+/// 回転と揺れは模様全体で共通なので、三角関数は模様ごとに1回だけ計算し、弾ごとの計算は積和だけで4発ずつSIMDで行う
+/// 模様の弾が届く範囲（発射位置を中心とする円環）が相手や視界に掛からなければ、模様ごと計算を省く
+/// </summary>
+class BulletPatternSystem {
+public:
+    /// <summary>
+    /// 1回のSIMD演算で処理する弾の数
+    /// </summary>
+    static constexpr size_t kLaneWidth = 4;
+
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;           // 弾の容量
+        size_t activeCount = 0;        // 生きている模様の弾の数（発射前・当たって消えた弾を含む）
+        size_t patternCount = 0;       // 生きている模様の数
+        size_t highWaterMark = 0;      // activeCountの最大
+        size_t evaluatedCount = 0;     // 直近のフレームに位置を計算した弾の数（当たり判定・クエリ・描画の合計）
+        size_t skippedCount = 0;       // 直近のフレームに模様ごと計算を省いた弾の数
+        uint64_t spawnCount = 0;       // 生成した模様の数
+        uint64_t bulletSpawnCount = 0; // 生成した模様の弾の数の合計
+        uint64_t overflowCount = 0;    // 容量を超えて生成できなかった模様の数
+        uint64_t hitCount = 0;         // 当たって消えた弾の数
+    };
+
+    /// <summary>
+    /// 初期化（配列を容量分確保する）
+    /// </summary>
+    /// <param name="capacity">同時に存在できる弾の数</param>
+    void Initialize(size_t capacity);
+
+    /// <summary>
+    /// 模様の生成
+    /// </summary>
+    /// <param name="pattern">模様</param>
+    /// <param name="lifetime">弾1発の生存時間（発射されてから）</param>
+    /// <param name="damage">弾1発のダメージ量</param>
+    /// <param name="radius">弾の当たり判定の半径</param>
+    /// <returns>生成できた場合true（弾数が0または容量を超える場合false）</returns>
+    bool Spawn(const BulletPattern& pattern, float lifetime, float damage, float radius);
+
+    /// <summary>
+    /// 経過時間を進め、全ての弾が消えた模様を削除する（弾ごとの移動は行わない）
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// 球との当たり判定（当たった弾は削除する）
+    /// sweepTimeを指定すると、各弾のその時間前の位置から現在位置までの線分で判定する
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <param name="outDamage">当たった弾のダメージ量の合計（nullptr可）</param>
+    /// <param name="sweepTime">移動をさかのぼって判定する時間（0なら現在位置のみ）</param>
+    /// <returns>当たった弾の数</returns>
+    uint32_t CollideSphere(const Vector3& center, float radius, float* outDamage = nullptr, float sweepTime = 0.0f);
+
+    /// <summary>
+    /// 球と重なっている発射済みの弾の数（弾は削除しない、パリィなどのクエリ用）
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <returns>重なっている弾の数</returns>
+    uint32_t CountOverlapSphere(const Vector3& center, float radius);
+
+    /// <summary>
+    /// 発射済みで生きている弾をインスタンス描画用の配列へ追加（Beginの後に呼ぶ）
+    /// 視界に掛からない模様は位置を計算しない
+    /// </summary>
+    /// <param name="batch">追加先（スケールは当たり判定の半径）</param>
+    /// <param name="color">色</param>
+    void AddInstances(ProjectileInstanceBatch& batch, const Vector4& color);
+
+    /// <summary>
+    /// 全ての模様を削除
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// 模様1つ分（弾ごとの値は[first, first + count)に並ぶ）
+    /// </summary>
+    struct Record {
+        Vector3 origin;                  // 発射位置
+        float speed = 0.0f;              // 弾の速さ
+        float angularSpeed = 0.0f;       // 模様全体の回転の速さ（ラジアン/秒）
+        float waveAmplitude = 0.0f;      // 左右の揺れの幅
+        float waveAngularSpeed = 0.0f;   // 左右の揺れの角速度（ラジアン/秒）
+        float age = 0.0f;                // 経過時間
+        float lifetime = 0.0f;           // 弾1発の生存時間
+        float maxDelay = 0.0f;           // 発射の遅れの最大
+        float damage = 0.0f;             // 弾1発のダメージ量
+        float radius = 0.0f;             // 弾の当たり判定の半径
+        uint32_t first = 0;              // 先頭の弾の番号
+        uint32_t count = 0;              // 弾数
+        uint32_t aliveCount = 0;         // 当たらずに残っている弾の数
+    };
+
+    /// <summary>
+    /// 模様の弾のうち、生きている弾が今いる可能性のある、発射位置からの水平距離の範囲
+    /// </summary>
+    void GetReach(const Record& record, float& outMin, float& outMax) const;
+
+    /// <summary>
+    /// 模様の全ての弾の位置を指定時刻で計算し、evalX_/evalZ_へ模様内の番号順に書き込む
+    /// </summary>
+    /// <param name="record">模様</param>
+    /// <param name="time">模様の経過時間</param>
+    /// <param name="outX">X座標の書き込み先</param>
+    /// <param name="outZ">Z座標の書き込み先</param>
+    /// <returns>発射済み・生存時間内・当たっていない弾の4発ごとのビットマスク（evalMask_）</returns>
+    const uint8_t* Evaluate(const Record& record, float time, float* outX, float* outZ);
+
+    // 模様（生成順）
+    std::vector<Record> records_;
+
+    // 弾ごとの値（要素数は容量にkLaneWidthを足した数、4発まとめて読んでも範囲外にならない）
+    std::vector<float> dirX_, dirZ_;   // 方向（回転前、XZ平面の単位ベクトル）
+    std::vector<float> delay_;         // 発射の遅れ
+    std::vector<uint8_t> alive_;       // 当たっていなければ1
+
+    // 使用中の弾の数
+    size_t bulletCount_ = 0;
+
+    // 位置の計算結果（1つの模様分、当たり判定ではフレーム前の位置も使う）
+    std::vector<float> evalX_, evalZ_;
+    std::vector<float> prevX_, prevZ_;
+    std::vector<uint8_t> evalMask_;
+
+    // 使用状況
+    Stats stats_;
+};
@@ -1,16 +1,18 @@
 #include "PlayerBullet.h"
 #include "../../Collision/PlayerBulletCollider.h"
+#include "../../Collision/SweptCollision.h"
 #include "../../Common/GameConst.h"
-#include "ModelManager.h"
-#include "Object3d.h"
 #include "CollisionManager.h"
-#include "EmitterManager.h"
 #include "GlobalVariables.h"
 
-uint32_t PlayerBullet::id = 0;
+PlayerBullet::PlayerBullet(ProjectileEffects* effects, CollisionGrid* collisionGrid, HitEventQueue* hitEvents)
+    : collisionGrid_(collisionGrid), hitEvents_(hitEvents), effects_(effects) {
+}
+
+PlayerBullet::~PlayerBullet() = default;
 
-PlayerBullet::PlayerBullet(EmitterManager* emitterManager) {
-    // GlobalVariablesから値を取得
+void PlayerBullet::Initialize(const Vector3& position, const Vector3& velocity) {
+    // GlobalVariablesから値を取得（プールからの再利用時も最新の値を使う）
     GlobalVariables* gv = GlobalVariables::GetInstance();
 
     // 弾のパラメータ設定（デフォルト値を使用、GlobalVariablesに未登録の場合に備える）
@@ -25,52 +27,24 @@ PlayerBullet::PlayerBullet(EmitterManager* emitterManager) {
         lifeTime_ = 3.0f;
     }
 
-    // エミッターマネージャーの設定
-    emitterManager_ = emitterManager;
-
-    // エフェクトプリセットをロード
-    if (emitterManager_) {
-        bulletEmitterName_ = "player_bullet" + std::to_string(id);
-        explodeEmitterName_ = "player_bullet_explode" + std::to_string(id);
-        emitterManager_->LoadPreset("player_bullet", bulletEmitterName_);
-        emitterManager_->SetEmitterActive(bulletEmitterName_, false);
-        emitterManager_->LoadPreset("player_bullet_explode", explodeEmitterName_);
-        emitterManager_->SetEmitterActive(explodeEmitterName_, false);
-    }
-
-    id++;
-
-    if (id > kIdResetThreshold) {
-        id = 0; // IDのリセット
-    }
-}
-
-PlayerBullet::~PlayerBullet() = default;
-
-void PlayerBullet::Initialize(const Vector3& position, const Vector3& velocity) {
     // 親クラスの初期化
     Projectile::Initialize(position, velocity);
 
-    // モデルをロード
-    SetModel();
-
-    model_->Update();
-
     // スケールを設定（パーティクル描画のため0に設定）
     transform_.scale = Vector3(kInitialScale, kInitialScale, kInitialScale);
 
     // エミッターを有効化
-    if (emitterManager_) {
-        emitterManager_->SetEmitterActive(bulletEmitterName_, true);
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, position);
+    if (effects_) {
+        trailHandle_ = effects_->trail.Acquire(position);
     }
 
+    sweptCollision_ = gv->GetValueBool("PlayerBullet", "SweptCollision");
+
     // コライダーの設定
     if (!collider_) {
         collider_ = std::make_unique<PlayerBulletCollider>(this);
     }
 
-    GlobalVariables* gv = GlobalVariables::GetInstance();
     float colliderRadius = gv->GetValueFloat("PlayerBullet", "ColliderRadius");
     if (colliderRadius <= 0.0f) {
         colliderRadius = 0.5f; // デフォルト値
@@ -84,24 +58,48 @@ void PlayerBullet::Initialize(const Vector3& position, const Vector3& velocity)
     collider_->SetActive(true);
     collider_->Reset();
 
-    // CollisionManagerに登録
-    CollisionManager::GetInstance()->AddCollider(collider_.get());
+    // グリッドがあればそちらへ、なければCollisionManagerに登録
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = collisionGrid_->Insert(collider_.get());
+    }
+    else {
+        CollisionManager::GetInstance()->AddCollider(collider_.get());
+    }
+}
+
+void PlayerBullet::Release() {
+    // 登録先（グリッドまたはCollisionManager）から削除
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = CollisionGrid::kInvalidHandle;
+    }
+    else if (collider_) {
+        CollisionManager::GetInstance()->RemoveCollider(collider_.get());
+    }
+
+    // 爆発エフェクトを再生し、軌跡を返却する
+    if (effects_) {
+        effects_->explode.Play(transform_.translate, effects_->explodeDuration);
+        effects_->trail.Release(trailHandle_);
+        trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
+    }
 }
 
 void PlayerBullet::Finalize() {
-    // CollisionManagerから削除
-    if (collider_) {
+    // 登録先（グリッドまたはCollisionManager）から削除
+    if (collisionGrid_) {
+        collisionGrid_->Remove(gridHandle_);
+        gridHandle_ = CollisionGrid::kInvalidHandle;
+    }
+    else if (collider_) {
         CollisionManager::GetInstance()->RemoveCollider(collider_.get());
     }
 
-    // 爆発エフェクトを生成
-    if (emitterManager_) {
-        emitterManager_->CreateTemporaryEmitterFrom(
-            explodeEmitterName_,
-            explodeEmitterName_ + "temp",
-            0.5f);
-        emitterManager_->RemoveEmitter(bulletEmitterName_);
-        emitterManager_->RemoveEmitter(explodeEmitterName_);
+    // エミッター自体はプールの終了処理で削除する
+    if (effects_) {
+        effects_->trail.Release(trailHandle_);
+        trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
     }
 }
 
@@ -114,9 +112,8 @@ void PlayerBullet::Update(float deltaTime) {
     Projectile::Update(deltaTime);
 
     // 軌跡エフェクト位置を同期
-    if (emitterManager_) {
-        emitterManager_->SetEmitterPosition(bulletEmitterName_, transform_.translate);
-        emitterManager_->SetEmitterPosition(explodeEmitterName_, transform_.translate);
+    if (effects_) {
+        effects_->trail.SetPosition(trailHandle_, transform_.translate);
     }
 
     // エリア外に出たら非アクティブ化
@@ -128,14 +125,22 @@ void PlayerBullet::Update(float deltaTime) {
     }
 }
 
-void PlayerBullet::SetModel() {
-    if (model_) {
-        // モデルをロード（実際には非表示だが、Object3dの初期化に必要）
-        model_->SetModel("sphere.gltf");
+bool PlayerBullet::SweepCollision(Collider* target) {
+    if (!isActive_ || !sweptCollision_ || !collider_ || !target || !target->IsActive()) {
+        return false;
+    }
 
-        if (!model_->GetModel()) {
-            // sphereモデルがない場合は、代替モデルを使用
-            model_->SetModel("white_cube.gltf");
-        }
+    float time = 0.0f;
+    if (!SweptCollision::SweepSphere(previousTranslate_, transform_.translate, collider_->GetRadius(), *target, time)) {
+        return false;
     }
+
+    // 最初に触れた位置へ戻し、通常の衝突と同じ処理を行う（爆発も当たった位置で再生される）
+    transform_.translate = previousTranslate_ + (transform_.translate - previousTranslate_) * time;
+    collider_->OnCollisionEnter(target);
+    return !isActive_;
+}
+
+bool PlayerBullet::RegisterHit(const Collider* target) {
+    return !collisionGrid_ || collisionGrid_->RegisterHit(gridHandle_, target);
 }
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "Projectile.h"
+#include "ProjectileEmitterPool.h"
+#include "../../Collision/CollisionGrid.h"
 #include "../../../GameProject/Collision/CollisionTypeIdDef.h"
 #include <memory>
-#include <string>
 
-class EmitterManager;
+class Collider;
 class PlayerBulletCollider;
+class HitEventQueue;
 
 /// <summary>
 /// プレイヤーの弾クラス
@@ -17,15 +19,16 @@ class PlayerBullet : public Projectile {
     // 定数
     //=========================================================================================
 private:
-    static constexpr uint32_t kIdResetThreshold = 10000; ///< ID リセット閾値
     static constexpr float kInitialScale = 0.0f;         ///< 初期スケール（パーティクル描画のため0）
 
 public:
     /// <summary>
     /// コンストラクタ
     /// </summary>
-    /// <param name="emitterManager">エミッターマネージャー</param>
-    PlayerBullet(EmitterManager* emitterManager);
+    /// <param name="effects">軌跡・爆発エフェクトのプール（nullptrならエフェクトなし）</param>
+    /// <param name="collisionGrid">コライダーの登録先のグリッド（nullptrならCollisionManagerへ登録）</param>
+    /// <param name="hitEvents">ヒットの書き込み先（nullptrなら当たった時にその場で適用）</param>
+    PlayerBullet(ProjectileEffects* effects, CollisionGrid* collisionGrid = nullptr, HitEventQueue* hitEvents = nullptr);
 
     /// <summary>
     /// デストラクタ
@@ -40,7 +43,13 @@ public:
     void Initialize(const Vector3& position, const Vector3& velocity) override;
 
     /// <summary>
-    /// 終了処理
+    /// プールへ返却する時の後始末（コライダーの登録解除・爆発エフェクトの再生・軌跡の返却）
+    /// モデル・コライダーは次の生成で使い回すため破棄しない
+    /// </summary>
+    void Release();
+
+    /// <summary>
+    /// 終了処理（コライダーの登録解除と軌跡の返却）
     /// </summary>
     void Finalize();
 
@@ -50,6 +59,27 @@ public:
     /// <param name="deltaTime">前フレームからの経過時間</param>
     void Update(float deltaTime) override;
 
+    /// <summary>
+    /// 前フレームの位置からの移動で相手に当たったかを判定し、当たっていれば当たった位置へ戻して衝突処理を行う
+    /// 速い弾や長いフレーム時間で相手をすり抜けないよう、CheckAllCollisionsの前に呼ぶ
+    /// </summary>
+    /// <param name="target">相手のコライダー（ボス本体）</param>
+    /// <returns>当たった場合true</returns>
+    bool SweepCollision(Collider* target);
+
+    /// <summary>
+    /// 相手へのヒットを記録（同じ相手へ2回目ならfalse）
+    /// グリッドに登録していない場合は記録せず、当たった弾が消えることで多重ヒットを防ぐ
+    /// </summary>
+    /// <param name="target">相手のコライダー</param>
+    /// <returns>ヒットとして扱ってよい場合true</returns>
+    bool RegisterHit(const Collider* target);
+
+    /// <summary>
+    /// ヒットの書き込み先を取得
+    /// </summary>
+    HitEventQueue* GetHitEventQueue() const { return hitEvents_; }
+
     /// <summary>
     /// コリジョンタイプIDを取得
     /// </summary>
@@ -61,22 +91,24 @@ public:
     PlayerBulletCollider* GetCollider() const { return collider_.get(); }
 
 private:
-    // モデルを設定
-    void SetModel();
+    // 連続衝突判定を行うか
+    bool sweptCollision_ = true;
 
-private:
     // 専用コライダー
     std::unique_ptr<PlayerBulletCollider> collider_;
 
-    // エミッタマネージャーへのポインタ
-    EmitterManager* emitterManager_ = nullptr;
+    // コライダーの登録先のグリッドと登録のハンドル
+    CollisionGrid* collisionGrid_ = nullptr;
+    CollisionGrid::Handle gridHandle_ = CollisionGrid::kInvalidHandle;
+
+    // ヒットの書き込み先
+    HitEventQueue* hitEvents_ = nullptr;
 
-    // エミッターの名前
-    std::string bulletEmitterName_ = "";
-    std::string explodeEmitterName_ = "";
+    // 軌跡・爆発エフェクトのプール
+    ProjectileEffects* effects_ = nullptr;
 
-    // id（複数弾の識別用）
-    static uint32_t id;
+    // 貸し出し中の軌跡エミッター
+    ProjectileEmitterPool::Handle trailHandle_ = ProjectileEmitterPool::kInvalidHandle;
 
     // 調整可能パラメータ
     float yBoundaryMin_ = -10.0f;  ///< Y座標の下限
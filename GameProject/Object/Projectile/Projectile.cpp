@@ -1,6 +1,4 @@
 #include "Projectile.h"
-#include "Object3d.h"
-#include "Model.h"
 
 Projectile::Projectile() {
 }
@@ -9,19 +7,12 @@ Projectile::~Projectile() {
 }
 
 void Projectile::Initialize(const Vector3& position, const Vector3& velocity) {
-    // 位置と速度を設定
+    // 位置と速度を設定（プールから再利用される場合に備えて回転・スケールも戻す）
+    transform_ = Transform{};
     transform_.translate = position;
+    previousTranslate_ = position;
     velocity_ = velocity;
 
-    // モデルの初期化
-    if (!model_) {
-        model_ = std::make_unique<Object3d>();
-        model_->Initialize();
-    }
-
-    // モデルにTransformを設定
-    model_->SetTransform(transform_);
-
     // タイマーリセット
     elapsedTime_ = 0.0f;
 
@@ -37,23 +28,9 @@ void Projectile::Update(float deltaTime) {
     // 生存時間を更新
     UpdateLifetime(deltaTime);
 
-    // 移動処理
+    // 移動処理（連続衝突判定のために移動前の位置を残す）
+    previousTranslate_ = transform_.translate;
     Move(deltaTime);
-
-    // モデルの更新
-    if (model_) {
-        model_->SetTransform(transform_);
-        model_->Update();
-    }
-}
-
-void Projectile::Draw() {
-    if (!isActive_ || !model_) {
-        return;
-    }
-
-    // モデルを描画
-    model_->Draw();
 }
 
 void Projectile::UpdateLifetime(float deltaTime) {
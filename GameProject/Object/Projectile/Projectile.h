@@ -2,15 +2,12 @@
 
 #include "Transform.h"
 #include "Vector3.h"
-#include <memory>
-
-class Object3d;
-class Model;
 
 /// <summary>
 /// プロジェクタイル（弾）基底クラス
 /// 移動と生存時間の管理のみを担当
 /// 衝突判定は派生クラスで実装
+/// 描画用のモデルは持たず、ProjectileInstanceBatchへ位置とスケールを渡してまとめて描画する
 /// </summary>
 class Projectile {
 public:
@@ -37,11 +34,6 @@ public:
     /// <param name="deltaTime">前フレームからの経過時間</param>
     virtual void Update(float deltaTime);
 
-    /// <summary>
-    /// 描画
-    /// </summary>
-    virtual void Draw();
-
     /// <summary>
     /// アクティブかどうか
     /// </summary>
@@ -83,9 +75,9 @@ public:
     Transform* GetTransformPtr() { return &transform_; }
 
     /// <summary>
-    /// モデルを取得
+    /// 前フレームの位置を取得（連続衝突判定用）
     /// </summary>
-    Object3d* GetModel() const { return model_.get(); }
+    const Vector3& GetPreviousTranslate() const { return previousTranslate_; }
 
 protected:
     /// <summary>
@@ -100,14 +92,14 @@ protected:
 
 protected:
     /// <summary>
-    /// 3Dモデルオブジェクト（描画用）
+    /// 座標変換情報
     /// </summary>
-    std::unique_ptr<Object3d> model_;
+    Transform transform_{};
 
     /// <summary>
-    /// 座標変換情報
+    /// 前フレームの位置（Update内の移動前の位置）
     /// </summary>
-    Transform transform_{};
+    Vector3 previousTranslate_;
 
     /// <summary>
     /// アクティブフラグ
@@ -0,0 +1,130 @@
+#include "ProjectileEmitterPool.h"
+#include "EmitterManager.h"
+#include <algorithm>
+
+void ProjectileEmitterPool::Initialize(EmitterManager* emitterManager, const std::string& presetName, size_t capacity) {
+    Finalize();
+
+    emitterManager_ = emitterManager;
+    presetName_ = presetName;
+    names_.reserve(capacity);
+    freeRing_.resize(capacity);
+    playing_.reserve(capacity);
+    playingTime_.reserve(capacity);
+
+    stats_ = Stats{};
+    stats_.capacity = capacity;
+
+    // 名前の作成とプリセットの読み込みはここで全て済ませ、プレイ中は貸し出しと返却だけにする
+    while (names_.size() < capacity) {
+        freeRing_[(freeHead_ + freeCount_) % freeRing_.size()] = Create();
+        ++freeCount_;
+    }
+}
+
+void ProjectileEmitterPool::Finalize() {
+    if (emitterManager_) {
+        for (const std::string& name : names_) {
+            emitterManager_->RemoveEmitter(name);
+        }
+    }
+    emitterManager_ = nullptr;
+    names_.clear();
+    freeRing_.clear();
+    freeHead_ = 0;
+    freeCount_ = 0;
+    playing_.clear();
+    playingTime_.clear();
+    stats_.createdCount = 0;
+    stats_.inUseCount = 0;
+}
+
+ProjectileEmitterPool::Handle ProjectileEmitterPool::Acquire(const Vector3& position) {
+    Handle handle = Take();
+    if (handle == kInvalidHandle) {
+        return kInvalidHandle;
+    }
+    emitterManager_->SetEmitterPosition(names_[handle], position);
+    emitterManager_->SetEmitterActive(names_[handle], true);
+    return handle;
+}
+
+bool ProjectileEmitterPool::Play(const Vector3& position, float duration) {
+    Handle handle = Acquire(position);
+    if (handle == kInvalidHandle) {
+        return false;
+    }
+    playing_.push_back(handle);
+    playingTime_.push_back(duration);
+    return true;
+}
+
+void ProjectileEmitterPool::Release(Handle handle) {
+    if (handle == kInvalidHandle || handle >= names_.size()) {
+        return;
+    }
+    emitterManager_->SetEmitterActive(names_[handle], false);
+    freeRing_[(freeHead_ + freeCount_) % freeRing_.size()] = handle;
+    ++freeCount_;
+    --stats_.inUseCount;
+}
+
+void ProjectileEmitterPool::SetPosition(Handle handle, const Vector3& position) {
+    if (handle == kInvalidHandle || handle >= names_.size()) {
+        return;
+    }
+    emitterManager_->SetEmitterPosition(names_[handle], position);
+}
+
+void ProjectileEmitterPool::Update(float deltaTime) {
+    size_t write = 0;
+    for (size_t read = 0; read < playing_.size(); ++read) {
+        playingTime_[read] -= deltaTime;
+        if (playingTime_[read] <= 0.0f) {
+            Release(playing_[read]);
+            continue;
+        }
+        playing_[write] = playing_[read];
+        playingTime_[write] = playingTime_[read];
+        ++write;
+    }
+    playing_.resize(write);
+    playingTime_.resize(write);
+}
+
+void ProjectileEmitterPool::ResetStats() {
+    stats_.highWaterMark = stats_.inUseCount;
+    stats_.acquireCount = 0;
+    stats_.exhaustedCount = 0;
+}
+
+ProjectileEmitterPool::Handle ProjectileEmitterPool::Create() {
+    Handle handle = static_cast<Handle>(names_.size());
+    names_.push_back(presetName_ + "_pool" + std::to_string(handle));
+    emitterManager_->LoadPreset(presetName_, names_.back());
+    emitterManager_->SetEmitterActive(names_.back(), false);
+    stats_.createdCount = names_.size();
+    return handle;
+}
+
+ProjectileEmitterPool::Handle ProjectileEmitterPool::Take() {
+    ++stats_.acquireCount;
+    if (!emitterManager_) {
+        return kInvalidHandle;
+    }
+
+    Handle handle = kInvalidHandle;
+    if (freeCount_ > 0) {
+        handle = freeRing_[freeHead_];
+        freeHead_ = (freeHead_ + 1) % freeRing_.size();
+        --freeCount_;
+    }
+    else {
+        ++stats_.exhaustedCount;
+        return kInvalidHandle;
+    }
+
+    ++stats_.inUseCount;
+    stats_.highWaterMark = (std::max)(stats_.highWaterMark, stats_.inUseCount);
+    return handle;
+}
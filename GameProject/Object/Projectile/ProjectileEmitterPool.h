@@ -0,0 +1,159 @@
+#pragma once
+#include "Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class EmitterManager;
+
+/// <summary>
+/// 1つのプリセットから作ったエミッターのプール
+/// エミッターの名前の作成とプリセットの読み込みは初期化時に容量分だけ行い、
+/// 以降は番号（ハンドル）で貸し出し・返却する（プレイ中は文字列を作らず、プリセットも読み込まない）
+/// 返却したエミッターは無効にして残し、次の貸し出しで使い回す
+/// </summary>
+class ProjectileEmitterPool {
+public:
+    /// <summary>
+    /// エミッターのハンドル
+    /// </summary>
+    using Handle = uint32_t;
+
+    /// <summary>
+    /// 無効なハンドル
+    /// </summary>
+    static constexpr Handle kInvalidHandle = UINT32_MAX;
+
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;         // 容量
+        size_t createdCount = 0;     // 作成済みのエミッター数（初期化後は容量と同じ）
+        size_t inUseCount = 0;       // 貸し出し中の数
+        size_t highWaterMark = 0;    // 貸し出し中の数の最大
+        uint64_t acquireCount = 0;   // 貸し出し要求の数
+        uint64_t exhaustedCount = 0; // 空きがなく貸し出せなかった数
+    };
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~ProjectileEmitterPool() { Finalize(); }
+
+    /// <summary>
+    /// 初期化（容量分のエミッターを全て作成する、シーンの読み込み中に呼ぶ）
+    /// </summary>
+    /// <param name="emitterManager">エミッターマネージャー</param>
+    /// <param name="presetName">プリセット名（エミッター名の接頭辞にも使う）</param>
+    /// <param name="capacity">容量</param>
+    void Initialize(EmitterManager* emitterManager, const std::string& presetName, size_t capacity);
+
+    /// <summary>
+    /// 終了処理（作成した全てのエミッターを削除）
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// エミッターを貸し出して有効にする
+    /// </summary>
+    /// <param name="position">位置</param>
+    /// <returns>ハンドル（空きがない場合kInvalidHandle）</returns>
+    Handle Acquire(const Vector3& position);
+
+    /// <summary>
+    /// 一定時間だけ有効にし、時間が来たら自動で返却する（爆発などの単発エフェクト用）
+    /// </summary>
+    /// <param name="position">位置</param>
+    /// <param name="duration">有効にする時間（秒）</param>
+    /// <returns>空きがあり再生できた場合true</returns>
+    bool Play(const Vector3& position, float duration);
+
+    /// <summary>
+    /// エミッターを無効にして返却する
+    /// </summary>
+    /// <param name="handle">ハンドル（kInvalidHandleなら何もしない）</param>
+    void Release(Handle handle);
+
+    /// <summary>
+    /// エミッターの位置の設定
+    /// </summary>
+    /// <param name="handle">ハンドル（kInvalidHandleなら何もしない）</param>
+    /// <param name="position">位置</param>
+    void SetPosition(Handle handle, const Vector3& position);
+
+    /// <summary>
+    /// Playで再生中のエミッターの時間を進め、終わったものを返却する
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// エミッターを1つ作成（名前の作成とプリセットの読み込み）
+    /// </summary>
+    /// <returns>作成したエミッターのハンドル</returns>
+    Handle Create();
+
+    /// <summary>
+    /// 空きを1つ取り出す
+    /// </summary>
+    /// <returns>ハンドル（空きがない場合kInvalidHandle）</returns>
+    Handle Take();
+
+    // エミッターマネージャー
+    EmitterManager* emitterManager_ = nullptr;
+
+    // プリセット名
+    std::string presetName_;
+
+    // エミッター名（ハンドルが添字）
+    std::vector<std::string> names_;
+
+    // 空きのハンドル（リングバッファ、freeHead_から返却順）
+    std::vector<Handle> freeRing_;
+    size_t freeHead_ = 0;
+    size_t freeCount_ = 0;
+
+    // Playで再生中のエミッターと残り時間
+    std::vector<Handle> playing_;
+    std::vector<float> playingTime_;
+
+    // 使用状況
+    Stats stats_;
+};
+
+/// <summary>
+/// 弾1種類分のエフェクト（軌跡と着弾時の爆発）
+/// </summary>
+struct ProjectileEffects {
+    ProjectileEmitterPool trail;    // 軌跡（弾が生きている間貸し出す）
+    ProjectileEmitterPool explode;  // 爆発（消滅時に一定時間だけ再生する）
+    float explodeDuration = 0.5f;   // 爆発の再生時間（秒）
+
+    /// <summary>
+    /// 爆発の再生時間の経過
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime) { explode.Update(deltaTime); }
+
+    /// <summary>
+    /// 終了処理
+    /// </summary>
+    void Finalize() {
+        trail.Finalize();
+        explode.Finalize();
+    }
+};
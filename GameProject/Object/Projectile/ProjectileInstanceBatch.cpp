@@ -0,0 +1,194 @@
+#include "ProjectileInstanceBatch.h"
+#include "ProjectileSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+    /// <summary>
+    /// 0以上の奥行きを、大小関係を保った整数に変換する（正のfloatはビット列の大小と値の大小が一致する）
+    /// </summary>
+    uint32_t DepthBits(float depth) {
+        depth = (std::max)(depth, 0.0f);
+        uint32_t bits = 0;
+        std::memcpy(&bits, &depth, sizeof(bits));
+        return bits;
+    }
+
+    /// <summary>
+    /// 基数ソート1回分のビット数（11bitずつ3回で上位32bitの奥行きを並べる）
+    /// </summary>
+    constexpr uint32_t kRadixBits = 11;
+    constexpr uint32_t kRadixPasses = 3;
+    constexpr size_t kRadixBuckets = size_t{ 1 } << kRadixBits;
+
+    /// <summary>
+    /// 並べ替えキーを上位32bit（奥行き）で安定に並べる（下位32bitの追加順は同じ奥行きの中で保たれる）
+    /// 毎フレーム数千〜数万個を並べるため、比較ソートではなく下位の桁からの基数ソートを使う
+    /// </summary>
+    /// <param name="keys">並べ替えキー</param>
+    /// <param name="scratch">作業用の配列（keysと同じ数に広げる）</param>
+    void RadixSortByDepth(std::vector<uint64_t>& keys, std::vector<uint64_t>& scratch) {
+        scratch.resize(keys.size());
+        uint64_t* src = keys.data();
+        uint64_t* dst = scratch.data();
+        for (uint32_t pass = 0; pass < kRadixPasses; ++pass) {
+            const uint32_t shift = 32 + pass * kRadixBits;
+            size_t offsets[kRadixBuckets] = {};
+            for (size_t i = 0; i < keys.size(); ++i) {
+                ++offsets[(src[i] >> shift) & (kRadixBuckets - 1)];
+            }
+            size_t sum = 0;
+            for (size_t& offset : offsets) {
+                size_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+            for (size_t i = 0; i < keys.size(); ++i) {
+                dst[offsets[(src[i] >> shift) & (kRadixBuckets - 1)]++] = src[i];
+            }
+            std::swap(src, dst);
+        }
+        // 奇数回入れ替えたので結果は作業用の配列側にある
+        keys.swap(scratch);
+    }
+
+}
+
+void ProjectileInstanceBatch::Initialize(const std::string& modelName, size_t capacity) {
+    modelName_ = modelName;
+    staged_.clear();
+    staged_.reserve(capacity);
+    sortKeys_.clear();
+    sortKeys_.reserve(capacity);
+    sortScratch_.clear();
+    sortScratch_.reserve(capacity);
+    for (std::vector<ProjectileInstance>& buffer : buffers_) {
+        buffer.assign(capacity, ProjectileInstance{});
+    }
+    front_ = 0;
+
+    stats_ = Stats{};
+    stats_.capacity = capacity;
+}
+
+void ProjectileInstanceBatch::Begin(const CullView* view) {
+    staged_.clear();
+    sortKeys_.clear();
+    stats_.submittedCount = 0;
+    stats_.culledCount = 0;
+
+    hasView_ = view != nullptr;
+    if (hasView_) {
+        view_ = *view;
+        cosHalfAngle_ = std::cos(view_.halfAngle);
+        sinHalfAngle_ = std::sin(view_.halfAngle);
+    }
+}
+
+void ProjectileInstanceBatch::Add(const Vector3& position, float scale, const Vector4& color) {
+    Stage(position.x, position.y, position.z, scale, color);
+}
+
+void ProjectileInstanceBatch::AddProjectiles(const ProjectileSystem& projectiles, const Vector4& color) {
+    const float* x = projectiles.GetPositionX();
+    const float* y = projectiles.GetPositionY();
+    const float* z = projectiles.GetPositionZ();
+    const float* radius = projectiles.GetRadii();
+    const size_t count = projectiles.GetActiveCount();
+    for (size_t i = 0; i < count; ++i) {
+        Stage(x[i], y[i], z[i], radius[i], color);
+    }
+}
+
+bool ProjectileInstanceBatch::IsSphereVisible(const Vector3& center, float radius) const {
+    float depth = 0.0f;
+    return !hasView_ || InView(center.x, center.y, center.z, radius, depth);
+}
+
+void ProjectileInstanceBatch::End() {
+    const size_t back = 1 - front_;
+    ProjectileInstance* out = buffers_[back].data();
+    const size_t count = staged_.size();
+
+    const bool sorted = hasView_ && sortMode_ != SortMode::None;
+    if (sorted) {
+        RadixSortByDepth(sortKeys_, sortScratch_);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const Staged& src = staged_[sorted ? static_cast<uint32_t>(sortKeys_[i]) : i];
+        float (&m)[4][4] = out[i].world.m;
+        m[0][0] = src.scale; m[0][1] = 0.0f;      m[0][2] = 0.0f;      m[0][3] = 0.0f;
+        m[1][0] = 0.0f;      m[1][1] = src.scale; m[1][2] = 0.0f;      m[1][3] = 0.0f;
+        m[2][0] = 0.0f;      m[2][1] = 0.0f;      m[2][2] = src.scale; m[2][3] = 0.0f;
+        m[3][0] = src.position.x;
+        m[3][1] = src.position.y;
+        m[3][2] = src.position.z;
+        m[3][3] = 1.0f;
+
+        // 一様スケールと平行移動の逆転置は、対角が1/scaleで平行移動が4列目に移る
+        const float inverseScale = 1.0f / src.scale;
+        float (&n)[4][4] = out[i].worldInvTranspose.m;
+        n[0][0] = inverseScale; n[0][1] = 0.0f;         n[0][2] = 0.0f;         n[0][3] = -src.position.x * inverseScale;
+        n[1][0] = 0.0f;         n[1][1] = inverseScale; n[1][2] = 0.0f;         n[1][3] = -src.position.y * inverseScale;
+        n[2][0] = 0.0f;         n[2][1] = 0.0f;         n[2][2] = inverseScale; n[2][3] = -src.position.z * inverseScale;
+        n[3][0] = 0.0f;         n[3][1] = 0.0f;         n[3][2] = 0.0f;         n[3][3] = 1.0f;
+        out[i].color = src.color;
+    }
+
+    front_ = back;
+    stats_.instanceCount = count;
+    stats_.peakInstanceCount = (std::max)(stats_.peakInstanceCount, count);
+    ++stats_.frameCount;
+}
+
+void ProjectileInstanceBatch::ResetStats() {
+    stats_.peakInstanceCount = stats_.instanceCount;
+    stats_.overflowCount = 0;
+    stats_.frameCount = 0;
+}
+
+void ProjectileInstanceBatch::Stage(float x, float y, float z, float scale, const Vector4& color) {
+    ++stats_.submittedCount;
+    if (scale <= 0.0f) {
+        ++stats_.culledCount;
+        return;
+    }
+
+    float depth = 0.0f;
+    if (hasView_ && !InView(x, y, z, scale, depth)) {
+        ++stats_.culledCount;
+        return;
+    }
+
+    if (staged_.size() >= stats_.capacity) {
+        ++stats_.overflowCount;
+        return;
+    }
+
+    if (hasView_ && sortMode_ != SortMode::None) {
+        uint32_t depthKey = DepthBits(depth);
+        if (sortMode_ == SortMode::BackToFront) {
+            depthKey = ~depthKey;
+        }
+        sortKeys_.push_back((static_cast<uint64_t>(depthKey) << 32) | static_cast<uint64_t>(staged_.size()));
+    }
+    staged_.push_back(Staged{ Vector3(x, y, z), scale, color });
+}
+
+bool ProjectileInstanceBatch::InView(float x, float y, float z, float radius, float& outDepth) const {
+    // 視点を頂点とする円錐と球で判定する
+    const float dx = x - view_.position.x;
+    const float dy = y - view_.position.y;
+    const float dz = z - view_.position.z;
+    outDepth = dx * view_.forward.x + dy * view_.forward.y + dz * view_.forward.z;
+    const float distanceSq = dx * dx + dy * dy + dz * dz;
+    const float farLimit = view_.farDistance + radius;
+    if (outDepth < -radius || distanceSq > farLimit * farLimit) {
+        return false;
+    }
+    const float lateral = std::sqrt((std::max)(distanceSq - outDepth * outDepth, 0.0f));
+    return lateral * cosHalfAngle_ - outDepth * sinHalfAngle_ <= radius;
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include "Vector4.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ProjectileSystem;
+
+/// <summary>
+/// インスタンス描画1個分のデータ（192バイト）
+/// Object3dInstanced.VS.hlsl / ShadowMapInstanced.VS.hlslのInstanceData（t5のStructuredBuffer）と同じ並びなので、
+/// 表側の配列はそのままアップロードバッファへコピーできる
+/// </summary>
+struct ProjectileInstance {
+    Matrix4x4 world;              // ワールド行列（スケールと平行移動のみ）
+    Matrix4x4 worldInvTranspose;  // ワールド行列の逆転置（法線の変換用）
+    Vector4 color;                // 色
+    float padding[12] = {};       // シェーダー側の構造体のサイズに合わせる
+};
+static_assert(sizeof(ProjectileInstance) == 192, "ProjectileInstance must match InstanceData in Object3dInstanced.VS.hlsl");
+
+/// <summary>
+/// 同じモデル（sphere.gltf等）を使う弾をまとめて1回のインスタンス描画用の配列へ詰める
+/// Begin → Add/AddProjectiles → End の順に呼び、Endで詰めた配列を表側にする（ダブルバッファ）
+/// 表側の配列は次のEndまで書き換えないので、描画側は1フレーム分そのまま転送に使える
+/// GPUには触れないため、カリング・並べ替え・詰め込みはシミュレーターでも実行できる
+/// </summary>
+class ProjectileInstanceBatch {
+public:
+    /// <summary>
+    /// 並べ替えの方法
+    /// </summary>
+    enum class SortMode {
+        None,         // 追加順
+        FrontToBack,  // 手前から奥（不透明描画用）
+        BackToFront,  // 奥から手前（半透明描画用）
+    };
+
+    /// <summary>
+    /// カリングと並べ替えに使う視点
+    /// </summary>
+    struct CullView {
+        Vector3 position;                     // 視点の位置
+        Vector3 forward{ 0.0f, 0.0f, 1.0f };  // 視線方向（正規化済み）
+        float halfAngle = 1.0f;               // 視錐台を囲む円錐の半角（ラジアン）
+        float farDistance = 200.0f;           // これより遠い弾は描画しない
+    };
+
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;            // 1フレームに詰められる最大数
+        size_t submittedCount = 0;      // 直近のフレームに追加された数
+        size_t culledCount = 0;         // 直近のフレームにカリングされた数（スケール0を含む）
+        size_t instanceCount = 0;       // 表側の配列の数
+        size_t peakInstanceCount = 0;   // 表側の配列の数の最大
+        uint64_t overflowCount = 0;     // 容量を超えて捨てた数の累計
+        uint64_t frameCount = 0;        // Endの呼び出し回数
+    };
+
+    /// <summary>
+    /// 初期化
+    /// </summary>
+    /// <param name="modelName">描画に使うモデル名</param>
+    /// <param name="capacity">1フレームに詰められる最大数</param>
+    void Initialize(const std::string& modelName, size_t capacity);
+
+    /// <summary>
+    /// 並べ替えの方法の設定
+    /// </summary>
+    void SetSortMode(SortMode mode) { sortMode_ = mode; }
+
+    /// <summary>
+    /// フレームの詰め込み開始
+    /// </summary>
+    /// <param name="view">視点（nullptrならスケール0の弾だけを除き、並べ替えもしない）</param>
+    void Begin(const CullView* view = nullptr);
+
+    /// <summary>
+    /// 弾を1発追加
+    /// </summary>
+    /// <param name="position">位置</param>
+    /// <param name="scale">スケール（0以下は描画しない）</param>
+    /// <param name="color">色</param>
+    void Add(const Vector3& position, float scale, const Vector4& color);
+
+    /// <summary>
+    /// SoAの弾システムの生きている弾をまとめて追加（スケールは当たり判定の半径）
+    /// </summary>
+    /// <param name="projectiles">弾システム</param>
+    /// <param name="color">色</param>
+    void AddProjectiles(const ProjectileSystem& projectiles, const Vector4& color);
+
+    /// <summary>
+    /// 球がこのフレームの視点から見えるか（Add前にまとめて判定を省くために使う）
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <returns>見える可能性がある場合true（視点がない場合は常にtrue）</returns>
+    bool IsSphereVisible(const Vector3& center, float radius) const;
+
+    /// <summary>
+    /// 並べ替えて裏側の配列へ詰め、表側と入れ替える
+    /// </summary>
+    void End();
+
+    /// <summary>
+    /// 表側の配列の先頭の取得
+    /// </summary>
+    const ProjectileInstance* GetInstances() const { return buffers_[front_].data(); }
+
+    /// <summary>
+    /// 表側の配列の数の取得
+    /// </summary>
+    size_t GetInstanceCount() const { return stats_.instanceCount; }
+
+    /// <summary>
+    /// 描画に使うモデル名の取得
+    /// </summary>
+    const std::string& GetModelName() const { return modelName_; }
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// 並べ替え前の1発分
+    /// </summary>
+    struct Staged {
+        Vector3 position;
+        float scale = 0.0f;
+        Vector4 color;
+    };
+
+    /// <summary>
+    /// カリングして残ったものを並べ替え前の配列へ追加
+    /// </summary>
+    void Stage(float x, float y, float z, float scale, const Vector4& color);
+
+    /// <summary>
+    /// 視点を頂点とする円錐と遠方の距離で球を判定（hasView_がtrueの時のみ呼ぶ）
+    /// </summary>
+    /// <param name="outDepth">視線方向の奥行き</param>
+    /// <returns>見える可能性がある場合true</returns>
+    bool InView(float x, float y, float z, float radius, float& outDepth) const;
+
+    // 描画に使うモデル名
+    std::string modelName_;
+
+    // 並べ替えの方法
+    SortMode sortMode_ = SortMode::None;
+
+    // このフレームの視点（hasView_がfalseなら使わない）
+    CullView view_;
+    bool hasView_ = false;
+    float cosHalfAngle_ = 0.0f;
+    float sinHalfAngle_ = 0.0f;
+
+    // 並べ替え前の弾と並べ替えキー（上位32bitが奥行き、下位32bitがstaged_の添字）
+    std::vector<Staged> staged_;
+    std::vector<uint64_t> sortKeys_;
+    std::vector<uint64_t> sortScratch_;
+
+    // 詰め込み先（front_が表側）
+    std::vector<ProjectileInstance> buffers_[2];
+    size_t front_ = 0;
+
+    // 使用状況
+    Stats stats_;
+};
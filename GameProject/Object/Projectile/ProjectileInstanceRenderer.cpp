@@ -0,0 +1,90 @@
+#include "ProjectileInstanceRenderer.h"
+#include "ProjectileInstanceBatch.h"
+#include "Object3dBasic.h"
+#include "ShadowRenderer.h"
+#include "SrvManager.h"
+#include "ModelManager.h"
+#include "Model.h"
+#include <algorithm>
+#include <cstring>
+
+void ProjectileInstanceRenderer::Initialize(const ProjectileInstanceBatch* batch) {
+    Finalize();
+    batch_ = batch;
+    capacity_ = batch_->GetStats().capacity;
+    if (capacity_ == 0) {
+        return;
+    }
+
+    // モデルは読み込み済みのものを使う（描画中に読み込まない）
+    ModelManager::GetInstance()->LoadModel(batch_->GetModelName());
+    model_ = ModelManager::GetInstance()->FindModel(batch_->GetModelName());
+
+    // 容量分のアップロードバッファを確保し、終了まで書き込み先として開いたままにする
+    instanceResource_ = Object3dBasic::GetInstance()->GetDX12Basic()->MakeBufferResource(sizeof(ProjectileInstance) * capacity_);
+    instanceResource_->Map(0, nullptr, &mappedInstances_);
+
+    // シェーダーのStructuredBuffer<InstanceData>（t5）から読むSRV
+    SrvManager* srvManager = SrvManager::GetInstance();
+    srvIndex_ = srvManager->Allocate();
+    srvManager->CreateSRVForStructuredBuffer(srvIndex_, instanceResource_.Get(),
+        static_cast<UINT>(capacity_), static_cast<UINT>(sizeof(ProjectileInstance)));
+    hasSrv_ = true;
+}
+
+void ProjectileInstanceRenderer::Finalize() {
+    if (instanceResource_ && mappedInstances_) {
+        instanceResource_->Unmap(0, nullptr);
+    }
+    if (hasSrv_) {
+        SrvManager::GetInstance()->Free(srvIndex_);
+        hasSrv_ = false;
+    }
+    mappedInstances_ = nullptr;
+    instanceResource_.Reset();
+    batch_ = nullptr;
+    model_ = nullptr;
+    capacity_ = 0;
+    uploadedCount_ = 0;
+    drawCallCount_ = 0;
+}
+
+void ProjectileInstanceRenderer::Upload() {
+    drawCallCount_ = 0;
+    uploadedCount_ = 0;
+    if (!batch_ || !mappedInstances_) {
+        return;
+    }
+
+    // 表側の配列はInstanceDataと同じ並びなので、そのまま1回でコピーする
+    uploadedCount_ = (std::min)(batch_->GetInstanceCount(), capacity_);
+    std::memcpy(mappedInstances_, batch_->GetInstances(), sizeof(ProjectileInstance) * uploadedCount_);
+}
+
+void ProjectileInstanceRenderer::DrawShadow() {
+    if (uploadedCount_ == 0 || !model_) {
+        return;
+    }
+
+    // ShadowMapInstanced.VS.hlslのパイプラインに切り替え、全ての弾を1回で描く
+    ShadowRenderer::GetInstance()->SetInstancedRenderSetting();
+    SrvManager::GetInstance()->SetGraphicsRootDescriptorTable(ShadowRenderer::kInstanceDataRootParameterIndex, srvIndex_);
+    model_->DrawInstanced(static_cast<uint32_t>(uploadedCount_));
+    ++drawCallCount_;
+}
+
+void ProjectileInstanceRenderer::Draw() {
+    if (uploadedCount_ == 0 || !model_) {
+        return;
+    }
+
+    // Object3dInstancedのパイプラインに切り替え、全ての弾を1回で描く
+    Object3dBasic* object3dBasic = Object3dBasic::GetInstance();
+    object3dBasic->SetInstancedRenderSetting();
+    SrvManager::GetInstance()->SetGraphicsRootDescriptorTable(Object3dBasic::kInstanceDataRootParameterIndex, srvIndex_);
+    model_->DrawInstanced(static_cast<uint32_t>(uploadedCount_));
+    ++drawCallCount_;
+
+    // 後に描くモデルのために通常の共通設定へ戻す
+    object3dBasic->SetCommonRenderSetting();
+}
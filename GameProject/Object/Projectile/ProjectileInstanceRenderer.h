@@ -0,0 +1,79 @@
+#pragma once
+#include <d3d12.h>
+#include <wrl.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class Model;
+class ProjectileInstanceBatch;
+
+/// <summary>
+/// ProjectileInstanceBatchの表側の配列を、エンジンのインスタンス描画パイプライン
+/// （Object3dInstanced / ShadowMapInstanced、t5のStructuredBuffer<InstanceData>）で1回のドローとして描く
+/// アップロードバッファとSRVは初期化時に容量分だけ確保し、描画中は配列のコピーとドローだけを行う
+/// 描画はエンジンがフレームの最後にGPUの完了を待つ前提で、バッファを1つだけ持つ
+/// </summary>
+class ProjectileInstanceRenderer {
+public:
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~ProjectileInstanceRenderer() { Finalize(); }
+
+    /// <summary>
+    /// 初期化（シーンの読み込み時に1回）
+    /// </summary>
+    /// <param name="batch">描画するインスタンス配列（容量とモデル名を使う、初期化済みであること）</param>
+    void Initialize(const ProjectileInstanceBatch* batch);
+
+    /// <summary>
+    /// 終了処理
+    /// </summary>
+    void Finalize();
+
+    /// <summary>
+    /// 表側の配列をアップロードバッファへコピー（描画の前に1フレーム1回）
+    /// </summary>
+    void Upload();
+
+    /// <summary>
+    /// シャドウマップへの描画（ShadowRendererのBeginShadowPass～EndShadowPassの間で呼ぶ）
+    /// </summary>
+    void DrawShadow();
+
+    /// <summary>
+    /// 描画（Object3dBasic::SetCommonRenderSettingの後で呼ぶ、共通設定はこの中でインスタンス描画用に切り替える）
+    /// </summary>
+    void Draw();
+
+    /// <summary>
+    /// 直近のUploadで転送したインスタンス数
+    /// </summary>
+    size_t GetUploadedCount() const { return uploadedCount_; }
+
+    /// <summary>
+    /// 直近のフレームのドローコール数（弾の数によらず0か1、シャドウパスを含めると最大2）
+    /// </summary>
+    uint32_t GetDrawCallCount() const { return drawCallCount_; }
+
+private:
+    // 描画するインスタンス配列
+    const ProjectileInstanceBatch* batch_ = nullptr;
+
+    // 描画に使うモデル（頂点・インデックス・マテリアル）
+    Model* model_ = nullptr;
+
+    // インスタンスデータのアップロードバッファと書き込み先
+    Microsoft::WRL::ComPtr<ID3D12Resource> instanceResource_;
+    void* mappedInstances_ = nullptr;
+    size_t capacity_ = 0;
+
+    // インスタンスデータのSRV（t5）
+    uint32_t srvIndex_ = 0;
+    bool hasSrv_ = false;
+
+    // 直近のフレームの転送数とドローコール数
+    size_t uploadedCount_ = 0;
+    uint32_t drawCallCount_ = 0;
+};
@@ -0,0 +1,224 @@
+#pragma once
+#include "Vector3.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/// <summary>
+/// 弾の固定容量プール
+/// 弾オブジェクト（モデル・コライダー・エミッター）は一度生成したら破棄せずに使い回す
+/// 弾は初期化時に容量分を全て生成し、生成（Spawn）と返却はどちらもO(1)でヒープ確保やモデルの読み込みは発生しない
+/// 空きがない場合は新しく生成せず、溢れた数として数える
+/// 返却した弾はしばらく再利用されないよう、空きは返却順（FIFO）に取り出す
+/// </summary>
+/// <template name="T">弾の型（Initialize・Update・IsActive・Release・Finalizeを持つProjectile派生クラス）</template>
+template<typename T>
+class ProjectilePool {
+public:
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;         // 容量
+        size_t constructedCount = 0; // 生成済みの数（初期化後は容量と同じ）
+        size_t activeCount = 0;      // 使用中の数
+        size_t highWaterMark = 0;    // 使用中の数の最大
+        uint64_t spawnCount = 0;     // 生成要求の数
+        uint64_t overflowCount = 0;  // 空きがなく生成できなかった数
+    };
+
+    /// <summary>
+    /// デストラクタ
+    /// </summary>
+    ~ProjectilePool() { Finalize(); }
+
+    /// <summary>
+    /// 初期化（容量分の弾を全て生成する、シーンの読み込み中に呼ぶ）
+    /// </summary>
+    /// <param name="capacity">容量</param>
+    /// <param name="factory">弾を1つ生成する関数</param>
+    void Initialize(size_t capacity, std::function<std::unique_ptr<T>()> factory) {
+        Finalize();
+
+        factory_ = std::move(factory);
+        objects_.reserve(capacity);
+        freeRing_.resize(capacity);
+        active_.reserve(capacity);
+        freeHead_ = 0;
+        freeCount_ = 0;
+
+        stats_ = Stats{};
+        stats_.capacity = capacity;
+
+        // モデル・コライダー・エミッターの準備はここで全て済ませ、プレイ中は貸し出しと返却だけにする
+        while (objects_.size() < capacity) {
+            freeRing_[(freeHead_ + freeCount_) % freeRing_.size()] = Construct();
+            ++freeCount_;
+        }
+    }
+
+    /// <summary>
+    /// 終了処理（全ての弾の後始末と破棄）
+    /// </summary>
+    void Finalize() {
+        for (auto& object : objects_) {
+            object->Finalize();
+        }
+        objects_.clear();
+        freeRing_.clear();
+        stats_.constructedCount = 0;
+        active_.clear();
+        freeHead_ = 0;
+        freeCount_ = 0;
+        stats_.activeCount = 0;
+    }
+
+    /// <summary>
+    /// 弾の生成（空きがない場合は生成せずにnullptr）
+    /// </summary>
+    /// <param name="position">初期位置</param>
+    /// <param name="velocity">初期速度</param>
+    /// <returns>生成した弾</returns>
+    T* Spawn(const Vector3& position, const Vector3& velocity) {
+        ++stats_.spawnCount;
+
+        uint32_t index = 0;
+        if (freeCount_ > 0) {
+            index = freeRing_[freeHead_];
+            freeHead_ = (freeHead_ + 1) % freeRing_.size();
+            --freeCount_;
+        }
+        else {
+            ++stats_.overflowCount;
+            return nullptr;
+        }
+
+        T* object = objects_[index].get();
+        object->Initialize(position, velocity);
+        active_.push_back(index);
+
+        stats_.activeCount = active_.size();
+        stats_.highWaterMark = (std::max)(stats_.highWaterMark, stats_.activeCount);
+        return object;
+    }
+
+    /// <summary>
+    /// 使用中の弾の更新と、非アクティブになった弾の返却
+    /// 生きている弾は生成順のまま前に詰める
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime) {
+        size_t write = 0;
+        for (size_t read = 0; read < active_.size(); ++read) {
+            uint32_t index = active_[read];
+            T* object = objects_[index].get();
+            if (object->IsActive()) {
+                object->Update(deltaTime);
+            }
+            if (object->IsActive()) {
+                active_[write++] = index;
+            }
+            else {
+                Release(index);
+            }
+        }
+        active_.resize(write);
+        stats_.activeCount = write;
+    }
+
+    /// <summary>
+    /// 使用中の弾を全て返却
+    /// </summary>
+    void Clear() {
+        for (uint32_t index : active_) {
+            objects_[index]->SetActive(false);
+            Release(index);
+        }
+        active_.clear();
+        stats_.activeCount = 0;
+    }
+
+    /// <summary>
+    /// 使用中の弾を生成順に訪問
+    /// </summary>
+    /// <param name="visitor">訪問関数（const T&amp;を受け取る）</param>
+    template<typename F>
+    void ForEachActive(F&& visitor) const {
+        for (uint32_t index : active_) {
+            visitor(static_cast<const T&>(*objects_[index]));
+        }
+    }
+
+    /// <summary>
+    /// 使用中の弾を生成順に訪問（変更可能）
+    /// </summary>
+    /// <param name="visitor">訪問関数（T&amp;を受け取る）</param>
+    template<typename F>
+    void ForEachActive(F&& visitor) {
+        for (uint32_t index : active_) {
+            visitor(*objects_[index]);
+        }
+    }
+
+    /// <summary>
+    /// 使用中の数の取得
+    /// </summary>
+    /// <returns>使用中の数</returns>
+    size_t GetActiveCount() const { return active_.size(); }
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・生成数のリセット（容量と使用中の数は残す）
+    /// </summary>
+    void ResetStats() {
+        stats_.highWaterMark = stats_.activeCount;
+        stats_.spawnCount = 0;
+        stats_.overflowCount = 0;
+    }
+
+private:
+    /// <summary>
+    /// 弾を1つ生成
+    /// </summary>
+    /// <returns>生成した弾の番号</returns>
+    uint32_t Construct() {
+        objects_.push_back(factory_());
+        stats_.constructedCount = objects_.size();
+        return static_cast<uint32_t>(objects_.size() - 1);
+    }
+
+    /// <summary>
+    /// 弾を後始末して空きへ戻す
+    /// </summary>
+    /// <param name="index">弾の番号</param>
+    void Release(uint32_t index) {
+        objects_[index]->Release();
+        freeRing_[(freeHead_ + freeCount_) % freeRing_.size()] = index;
+        ++freeCount_;
+    }
+
+    // 弾の生成関数
+    std::function<std::unique_ptr<T>()> factory_;
+
+    // 弾（コライダーが座標を参照するため、生成後は移動させない）
+    std::vector<std::unique_ptr<T>> objects_;
+
+    // 空きの番号（リングバッファ、freeHead_から返却順）
+    std::vector<uint32_t> freeRing_;
+    size_t freeHead_ = 0;
+    size_t freeCount_ = 0;
+
+    // 使用中の番号（生成順）
+    std::vector<uint32_t> active_;
+
+    // 使用状況
+    Stats stats_;
+};
@@ -0,0 +1,81 @@
+#include "ProjectileSpawnQueue.h"
+#include <algorithm>
+
+void ProjectileSpawnQueue::Initialize(size_t bulletCapacity, size_t patternCapacity) {
+    bullets_.assign(bulletCapacity, ProjectileSpawnCommand{});
+    patterns_.assign(patternCapacity, BulletPattern{});
+    bulletSize_.store(0, std::memory_order_relaxed);
+    patternSize_.store(0, std::memory_order_relaxed);
+    overflow_.store(0, std::memory_order_relaxed);
+
+    stats_ = Stats{};
+    stats_.bulletCapacity = bulletCapacity;
+    stats_.patternCapacity = patternCapacity;
+}
+
+std::span<ProjectileSpawnCommand> ProjectileSpawnQueue::AllocateBullets(size_t count) {
+    size_t first = 0;
+    const size_t granted = Reserve(bulletSize_, bullets_.size(), count, first);
+    return std::span<ProjectileSpawnCommand>(bullets_.data() + first, granted);
+}
+
+bool ProjectileSpawnQueue::PushBullet(const ProjectileSpawnCommand& command) {
+    size_t index = 0;
+    if (Reserve(bulletSize_, bullets_.size(), 1, index) == 0) {
+        return false;
+    }
+    bullets_[index] = command;
+    return true;
+}
+
+bool ProjectileSpawnQueue::PushPattern(const BulletPattern& pattern) {
+    size_t index = 0;
+    if (Reserve(patternSize_, patterns_.size(), 1, index) == 0) {
+        return false;
+    }
+    patterns_[index] = pattern;
+    return true;
+}
+
+std::span<const ProjectileSpawnCommand> ProjectileSpawnQueue::GetBullets() const {
+    const size_t count = (std::min)(bulletSize_.load(std::memory_order_relaxed), bullets_.size());
+    return std::span<const ProjectileSpawnCommand>(bullets_.data(), count);
+}
+
+std::span<const BulletPattern> ProjectileSpawnQueue::GetPatterns() const {
+    const size_t count = (std::min)(patternSize_.load(std::memory_order_relaxed), patterns_.size());
+    return std::span<const BulletPattern>(patterns_.data(), count);
+}
+
+void ProjectileSpawnQueue::Clear() {
+    const size_t bulletCount = GetBullets().size();
+    const size_t patternCount = GetPatterns().size();
+    stats_.bulletCount += bulletCount;
+    stats_.patternCount += patternCount;
+    stats_.peakBulletCount = (std::max)(stats_.peakBulletCount, bulletCount);
+    stats_.peakPatternCount = (std::max)(stats_.peakPatternCount, patternCount);
+    stats_.overflowCount += overflow_.exchange(0, std::memory_order_relaxed);
+
+    bulletSize_.store(0, std::memory_order_relaxed);
+    patternSize_.store(0, std::memory_order_relaxed);
+}
+
+void ProjectileSpawnQueue::ResetStats() {
+    stats_.peakBulletCount = 0;
+    stats_.peakPatternCount = 0;
+    stats_.bulletCount = 0;
+    stats_.patternCount = 0;
+    stats_.overflowCount = 0;
+}
+
+size_t ProjectileSpawnQueue::Reserve(std::atomic<size_t>& size, size_t capacity, size_t count, size_t& outFirst) {
+    // 書き込み先の予約だけをatomicにし、中身は予約したスレッドだけが書く
+    // 読み出し側とはワーカーの合流（WorkerPoolの待機）で同期する
+    const size_t first = size.fetch_add(count, std::memory_order_relaxed);
+    const size_t granted = first < capacity ? (std::min)(count, capacity - first) : 0;
+    if (granted < count) {
+        overflow_.fetch_add(count - granted, std::memory_order_relaxed);
+    }
+    outFirst = (std::min)(first, capacity);
+    return granted;
+}
@@ -0,0 +1,125 @@
+#pragma once
+#include "BulletPattern.h"
+#include "Vector3.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// <summary>
+/// 弾を撃った側
+/// </summary>
+enum class ProjectileOwner : uint8_t {
+    Boss,    // ボスの弾（プレイヤーに当たる）
+    Player,  // プレイヤーの弾（ボスに当たる）
+};
+
+/// <summary>
+/// 弾1発の生成要求
+/// </summary>
+struct ProjectileSpawnCommand {
+    Vector3 position{};                       // 発射位置
+    Vector3 velocity{};                       // 速度
+    float turnRate = 0.0f;                    // 追尾の旋回速度（ラジアン/秒、0なら直進）
+    ProjectileOwner owner = ProjectileOwner::Boss; // 撃った側
+};
+
+/// <summary>
+/// 弾・弾幕の模様の生成要求をためる固定容量のキュー
+/// ボスのアクション・プレイヤーのステート・弾幕の模様など全ての発射元がここへ書き込み、
+/// GameSceneが1フレームに1回まとめて読み出して弾プール・弾システムへ生成する
+/// 書き込み先はatomicな加算で予約するため、複数のワーカースレッドから同時に書き込める（ロックなし）
+/// 読み出し（GetBullets・GetPatterns・Clear）は全ての書き込みが終わった後にメインスレッドで行う
+/// 容量は初期化時に確保し、Clearしても残すので毎フレームの確保は発生しない（溢れた要求は捨てて数える）
+/// </summary>
+class ProjectileSpawnQueue {
+public:
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t bulletCapacity = 0;     // 1フレームにためられる弾の生成要求の数
+        size_t patternCapacity = 0;    // 1フレームにためられる模様の生成要求の数
+        size_t peakBulletCount = 0;    // 1フレームの弾の生成要求の数の最大
+        size_t peakPatternCount = 0;   // 1フレームの模様の生成要求の数の最大
+        uint64_t bulletCount = 0;      // 受け付けた弾の生成要求の累計
+        uint64_t patternCount = 0;     // 受け付けた模様の生成要求の累計
+        uint64_t overflowCount = 0;    // 容量を超えて捨てた生成要求の累計（弾と模様の合計）
+    };
+
+    /// <summary>
+    /// 初期化（容量分の領域を確保する）
+    /// </summary>
+    /// <param name="bulletCapacity">1フレームにためられる弾の生成要求の数</param>
+    /// <param name="patternCapacity">1フレームにためられる模様の生成要求の数</param>
+    void Initialize(size_t bulletCapacity, size_t patternCapacity);
+
+    /// <summary>
+    /// 弾の生成要求をまとめて書き込む領域を予約（スレッドセーフ）
+    /// 戻り値の領域へ直接書き込めばよく、一時的な配列からのコピーは要らない
+    /// </summary>
+    /// <param name="count">予約する数</param>
+    /// <returns>書き込み先（容量が足りなければcountより短い、空の場合もある）</returns>
+    std::span<ProjectileSpawnCommand> AllocateBullets(size_t count);
+
+    /// <summary>
+    /// 弾の生成要求を1件追加（スレッドセーフ）
+    /// </summary>
+    /// <param name="command">生成要求</param>
+    /// <returns>追加できた場合true</returns>
+    bool PushBullet(const ProjectileSpawnCommand& command);
+
+    /// <summary>
+    /// 弾幕の模様の生成要求を1件追加（スレッドセーフ）
+    /// </summary>
+    /// <param name="pattern">模様</param>
+    /// <returns>追加できた場合true</returns>
+    bool PushPattern(const BulletPattern& pattern);
+
+    /// <summary>
+    /// たまっている弾の生成要求（追加順）
+    /// </summary>
+    std::span<const ProjectileSpawnCommand> GetBullets() const;
+
+    /// <summary>
+    /// たまっている模様の生成要求（追加順）
+    /// </summary>
+    std::span<const BulletPattern> GetPatterns() const;
+
+    /// <summary>
+    /// たまっている生成要求の破棄（領域は残す）
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// [開始位置, 開始位置 + count)を予約し、容量に収まる数を返す（溢れた分は数える）
+    /// </summary>
+    size_t Reserve(std::atomic<size_t>& size, size_t capacity, size_t count, size_t& outFirst);
+
+    // 生成要求（要素数は容量で固定）
+    std::vector<ProjectileSpawnCommand> bullets_;
+    std::vector<BulletPattern> patterns_;
+
+    // 予約済みの数（容量を超えることがあるので、読み出し時は容量で切る）
+    std::atomic<size_t> bulletSize_{ 0 };
+    std::atomic<size_t> patternSize_{ 0 };
+
+    // 容量を超えて捨てた数（Clearで累計へ移す）
+    std::atomic<uint64_t> overflow_{ 0 };
+
+    // 使用状況
+    Stats stats_;
+};
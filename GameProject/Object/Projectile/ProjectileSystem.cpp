@@ -0,0 +1,526 @@
+#include "ProjectileSystem.h"
+#include <algorithm>
+#include <cmath>
+
+// x86/x64ではSSEで4発ずつ処理する（それ以外の環境は同じ計算をスカラーで行う）
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define PROJECTILE_SYSTEM_USE_SSE 1
+#include <xmmintrin.h>
+#else
+#define PROJECTILE_SYSTEM_USE_SSE 0
+#endif
+
+namespace {
+
+    /// <summary>
+    /// 4bitのマスクの立っているビットの数
+    /// </summary>
+    constexpr uint8_t kBitCount[16] = { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+    /// <summary>
+    /// 全レーンが立っているマスク
+    /// </summary>
+    constexpr uint32_t kFullMask = (1u << ProjectileSystem::kLaneWidth) - 1u;
+
+    /// <summary>
+    /// 線分の判定で0除算を避けるための長さの2乗の下限（止まっている弾は現在位置の判定になる）
+    /// </summary>
+    constexpr float kMinSweepLengthSq = 1.0e-12f;
+
+    /// <summary>
+    /// 追尾で正規化するベクトルの長さの2乗の下限（止まっている弾・目標と重なった弾は向きを変えない）
+    /// </summary>
+    constexpr float kMinSteerLengthSq = 1.0e-8f;
+
+    /// <summary>
+    /// 1フレームに回せる角度の上限（真後ろまで）
+    /// </summary>
+    constexpr float kMaxTurnAngle = 3.14159265f;
+
+    /// <summary>
+    /// グループ内で生きている弾のレーンのマスク（最後のグループだけ途中まで）
+    /// </summary>
+    /// <param name="group">グループの番号</param>
+    /// <param name="count">生きている弾の数</param>
+    uint32_t ValidLaneMask(size_t group, size_t count) {
+        size_t first = group * ProjectileSystem::kLaneWidth;
+        size_t lanes = (std::min)(count - first, ProjectileSystem::kLaneWidth);
+        return (1u << lanes) - 1u;
+    }
+
+#if PROJECTILE_SYSTEM_USE_SSE
+    /// <summary>
+    /// マスクが立っているレーンはa、それ以外はb
+    /// </summary>
+    __m128 Select(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+
+    /// <summary>
+    /// 0〜πの角度のsinとcosを4レーン同時に求める
+    /// 半角（0〜π/2）をテイラー展開で求めてから倍角の公式で戻す（誤差は1e-4程度）
+    /// </summary>
+    void SinCos(__m128 angle, __m128& outSin, __m128& outCos) {
+        const __m128 x = _mm_mul_ps(angle, _mm_set1_ps(0.5f));
+        const __m128 x2 = _mm_mul_ps(x, x);
+        // sin x = x (1 - x^2/6 (1 - x^2/20 (1 - x^2/42)))
+        __m128 s = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, _mm_set1_ps(1.0f / 42.0f)));
+        s = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(x2, _mm_set1_ps(1.0f / 20.0f)), s));
+        s = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(x2, _mm_set1_ps(1.0f / 6.0f)), s));
+        s = _mm_mul_ps(x, s);
+        // cos x = 1 - x^2/2 (1 - x^2/12 (1 - x^2/30 (1 - x^2/56)))
+        __m128 c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x2, _mm_set1_ps(1.0f / 56.0f)));
+        c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(x2, _mm_set1_ps(1.0f / 30.0f)), c));
+        c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(x2, _mm_set1_ps(1.0f / 12.0f)), c));
+        c = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(_mm_mul_ps(x2, _mm_set1_ps(0.5f)), c));
+        // sin 2x = 2 sin x cos x, cos 2x = cos^2 x - sin^2 x
+        outSin = _mm_mul_ps(_mm_set1_ps(2.0f), _mm_mul_ps(s, c));
+        outCos = _mm_sub_ps(_mm_mul_ps(c, c), _mm_mul_ps(s, s));
+    }
+#endif
+
+}
+
+void ProjectileSystem::Initialize(size_t capacity) {
+    // 最後のグループも4発分まとめて読み書きできるよう、配列は切り上げた長さで確保する
+    const size_t padded = (capacity + kLaneWidth - 1) / kLaneWidth * kLaneWidth;
+    for (std::vector<float>* array : { &posX_, &posY_, &posZ_, &velX_, &velY_, &velZ_, &age_, &lifetime_, &damage_, &radius_, &turnRate_ }) {
+        array->assign(padded, 0.0f);
+    }
+    flags_.assign(padded, 0);
+    keepMask_.assign(padded / kLaneWidth, 0);
+    count_ = 0;
+
+    stats_ = Stats{};
+    stats_.capacity = capacity;
+}
+
+void ProjectileSystem::SetBounds(const Vector3& min, const Vector3& max) {
+    boundsMin_ = min;
+    boundsMax_ = max;
+}
+
+bool ProjectileSystem::Spawn(const ProjectileSpawnParams& params) {
+    ++stats_.spawnCount;
+    if (count_ >= stats_.capacity) {
+        ++stats_.overflowCount;
+        return false;
+    }
+
+    const size_t i = count_++;
+    posX_[i] = params.position.x;
+    posY_[i] = params.position.y;
+    posZ_[i] = params.position.z;
+    velX_[i] = params.velocity.x;
+    velY_[i] = params.velocity.y;
+    velZ_[i] = params.velocity.z;
+    age_[i] = 0.0f;
+    lifetime_[i] = params.lifetime;
+    damage_[i] = params.damage;
+    radius_[i] = params.radius;
+    turnRate_[i] = (std::max)(params.turnRate, 0.0f);
+    flags_[i] = params.flags;
+
+    stats_.activeCount = count_;
+    stats_.highWaterMark = (std::max)(stats_.highWaterMark, count_);
+    return true;
+}
+
+void ProjectileSystem::Update(float deltaTime) {
+    stats_.homingCount = 0;
+    if (count_ == 0) {
+        return;
+    }
+
+    const size_t groupCount = (count_ + kLaneWidth - 1) / kLaneWidth;
+    bool anyRemoved = false;
+
+#if PROJECTILE_SYSTEM_USE_SSE
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 minX = _mm_set1_ps(boundsMin_.x);
+    const __m128 minY = _mm_set1_ps(boundsMin_.y);
+    const __m128 minZ = _mm_set1_ps(boundsMin_.z);
+    const __m128 maxX = _mm_set1_ps(boundsMax_.x);
+    const __m128 maxY = _mm_set1_ps(boundsMax_.y);
+    const __m128 maxZ = _mm_set1_ps(boundsMax_.z);
+#endif
+
+    for (size_t group = 0; group < groupCount; ++group) {
+        const size_t i = group * kLaneWidth;
+        uint32_t aliveMask = 0;
+        uint32_t insideMask = 0;
+
+        // 追尾（移動の前に速度の向きだけを変える）
+        if (hasHomingTarget_) {
+            stats_.homingCount += Steer(i, ValidLaneMask(group, count_), deltaTime);
+        }
+
+#if PROJECTILE_SYSTEM_USE_SSE
+        // 移動と経過時間
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&posX_[i]), _mm_mul_ps(_mm_loadu_ps(&velX_[i]), dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&posY_[i]), _mm_mul_ps(_mm_loadu_ps(&velY_[i]), dt));
+        __m128 z = _mm_add_ps(_mm_loadu_ps(&posZ_[i]), _mm_mul_ps(_mm_loadu_ps(&velZ_[i]), dt));
+        __m128 age = _mm_add_ps(_mm_loadu_ps(&age_[i]), dt);
+        _mm_storeu_ps(&posX_[i], x);
+        _mm_storeu_ps(&posY_[i], y);
+        _mm_storeu_ps(&posZ_[i], z);
+        _mm_storeu_ps(&age_[i], age);
+
+        // 生存時間と範囲の判定
+        __m128 alive = _mm_cmplt_ps(age, _mm_loadu_ps(&lifetime_[i]));
+        __m128 inside = _mm_and_ps(
+            _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, minX), _mm_cmple_ps(x, maxX)),
+                       _mm_and_ps(_mm_cmpge_ps(y, minY), _mm_cmple_ps(y, maxY))),
+            _mm_and_ps(_mm_cmpge_ps(z, minZ), _mm_cmple_ps(z, maxZ)));
+        aliveMask = static_cast<uint32_t>(_mm_movemask_ps(alive));
+        insideMask = static_cast<uint32_t>(_mm_movemask_ps(inside));
+#else
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            const size_t j = i + lane;
+            posX_[j] += velX_[j] * deltaTime;
+            posY_[j] += velY_[j] * deltaTime;
+            posZ_[j] += velZ_[j] * deltaTime;
+            age_[j] += deltaTime;
+
+            if (age_[j] < lifetime_[j]) {
+                aliveMask |= 1u << lane;
+            }
+            if (posX_[j] >= boundsMin_.x && posX_[j] <= boundsMax_.x &&
+                posY_[j] >= boundsMin_.y && posY_[j] <= boundsMax_.y &&
+                posZ_[j] >= boundsMin_.z && posZ_[j] <= boundsMax_.z) {
+                insideMask |= 1u << lane;
+            }
+        }
+#endif
+
+        const uint32_t valid = ValidLaneMask(group, count_);
+        const uint32_t keep = aliveMask & insideMask & valid;
+        keepMask_[group] = static_cast<uint8_t>(keep);
+        if (keep != valid) {
+            anyRemoved = true;
+            stats_.expiredCount += kBitCount[~aliveMask & valid];
+            stats_.outOfBoundsCount += kBitCount[aliveMask & ~insideMask & valid];
+        }
+    }
+
+    if (anyRemoved) {
+        Compact();
+    }
+}
+
+uint32_t ProjectileSystem::CollideSphere(const Vector3& center, float radius, float* outDamage, float sweepTime) {
+    if (outDamage) {
+        *outDamage = 0.0f;
+    }
+    if (count_ == 0) {
+        return 0;
+    }
+
+    const size_t groupCount = (count_ + kLaneWidth - 1) / kLaneWidth;
+    uint32_t hitTotal = 0;
+    float damageTotal = 0.0f;
+
+#if PROJECTILE_SYSTEM_USE_SSE
+    const __m128 cx = _mm_set1_ps(center.x);
+    const __m128 cy = _mm_set1_ps(center.y);
+    const __m128 cz = _mm_set1_ps(center.z);
+    const __m128 r = _mm_set1_ps(radius);
+    const __m128 sweep = _mm_set1_ps(sweepTime);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minLengthSq = _mm_set1_ps(kMinSweepLengthSq);
+#endif
+    const bool swept = sweepTime > 0.0f;
+
+    for (size_t group = 0; group < groupCount; ++group) {
+        const size_t i = group * kLaneWidth;
+        uint32_t hitMask = 0;
+
+#if PROJECTILE_SYSTEM_USE_SSE
+        // 中心間の距離の2乗と半径の和の2乗を比較
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&posX_[i]), cx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&posY_[i]), cy);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(&posZ_[i]), cz);
+        if (swept) {
+            // 移動してきた線分上で球の中心に最も近い点との差にする
+            __m128 wx = _mm_mul_ps(_mm_loadu_ps(&velX_[i]), sweep);
+            __m128 wy = _mm_mul_ps(_mm_loadu_ps(&velY_[i]), sweep);
+            __m128 wz = _mm_mul_ps(_mm_loadu_ps(&velZ_[i]), sweep);
+            __m128 projection = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, wx), _mm_mul_ps(dy, wy)), _mm_mul_ps(dz, wz));
+            __m128 lengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(wx, wx), _mm_mul_ps(wy, wy)), _mm_mul_ps(wz, wz));
+            __m128 s = _mm_div_ps(projection, _mm_max_ps(lengthSq, minLengthSq));
+            s = _mm_min_ps(_mm_max_ps(s, zero), one);
+            dx = _mm_sub_ps(dx, _mm_mul_ps(wx, s));
+            dy = _mm_sub_ps(dy, _mm_mul_ps(wy, s));
+            dz = _mm_sub_ps(dz, _mm_mul_ps(wz, s));
+        }
+        __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(&radius_[i]), r);
+        hitMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_mul_ps(sum, sum))));
+#else
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            const size_t j = i + lane;
+            float dx = posX_[j] - center.x;
+            float dy = posY_[j] - center.y;
+            float dz = posZ_[j] - center.z;
+            if (swept) {
+                float wx = velX_[j] * sweepTime;
+                float wy = velY_[j] * sweepTime;
+                float wz = velZ_[j] * sweepTime;
+                float lengthSq = (std::max)(wx * wx + wy * wy + wz * wz, kMinSweepLengthSq);
+                float s = std::clamp((dx * wx + dy * wy + dz * wz) / lengthSq, 0.0f, 1.0f);
+                dx -= wx * s;
+                dy -= wy * s;
+                dz -= wz * s;
+            }
+            float sum = radius_[j] + radius;
+            if (dx * dx + dy * dy + dz * dz <= sum * sum) {
+                hitMask |= 1u << lane;
+            }
+        }
+#endif
+
+        const uint32_t valid = ValidLaneMask(group, count_);
+        hitMask &= valid;
+        keepMask_[group] = static_cast<uint8_t>(valid & ~hitMask);
+
+        // 当たるのはまれなので、ダメージの合計は当たったレーンだけスカラーで足す
+        if (hitMask != 0) {
+            hitTotal += kBitCount[hitMask];
+            for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+                if (hitMask & (1u << lane)) {
+                    damageTotal += damage_[i + lane];
+                }
+            }
+        }
+    }
+
+    if (hitTotal > 0) {
+        stats_.hitCount += hitTotal;
+        Compact();
+    }
+    if (outDamage) {
+        *outDamage = damageTotal;
+    }
+    return hitTotal;
+}
+
+uint32_t ProjectileSystem::CountOverlapSphere(const Vector3& center, float radius) const {
+    const size_t groupCount = (count_ + kLaneWidth - 1) / kLaneWidth;
+    uint32_t overlapTotal = 0;
+
+#if PROJECTILE_SYSTEM_USE_SSE
+    const __m128 cx = _mm_set1_ps(center.x);
+    const __m128 cy = _mm_set1_ps(center.y);
+    const __m128 cz = _mm_set1_ps(center.z);
+    const __m128 r = _mm_set1_ps(radius);
+#endif
+
+    for (size_t group = 0; group < groupCount; ++group) {
+        const size_t i = group * kLaneWidth;
+        uint32_t overlapMask = 0;
+
+#if PROJECTILE_SYSTEM_USE_SSE
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&posX_[i]), cx);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&posY_[i]), cy);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(&posZ_[i]), cz);
+        __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(&radius_[i]), r);
+        overlapMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(distSq, _mm_mul_ps(sum, sum))));
+#else
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            const size_t j = i + lane;
+            float dx = posX_[j] - center.x;
+            float dy = posY_[j] - center.y;
+            float dz = posZ_[j] - center.z;
+            float sum = radius_[j] + radius;
+            if (dx * dx + dy * dy + dz * dz <= sum * sum) {
+                overlapMask |= 1u << lane;
+            }
+        }
+#endif
+
+        overlapTotal += kBitCount[overlapMask & ValidLaneMask(group, count_)];
+    }
+    return overlapTotal;
+}
+
+void ProjectileSystem::Clear() {
+    count_ = 0;
+    stats_.activeCount = 0;
+}
+
+void ProjectileSystem::ResetStats() {
+    stats_.highWaterMark = count_;
+    stats_.spawnCount = 0;
+    stats_.overflowCount = 0;
+    stats_.expiredCount = 0;
+    stats_.outOfBoundsCount = 0;
+    stats_.hitCount = 0;
+}
+
+uint32_t ProjectileSystem::Steer(size_t first, uint32_t validMask, float deltaTime) {
+    // 現在の向きdから目標への向きtへ、d・tの張る平面内で最大角度θだけ回す
+    //   θで届くなら t、届かなければ d cosθ + e sinθ（eはtのdに垂直な成分を正規化したもの）
+    // 目標が真後ろでeが求まらない場合は水平面内で右へ回す
+#if PROJECTILE_SYSTEM_USE_SSE
+    const __m128 turnRate = _mm_loadu_ps(&turnRate_[first]);
+    const __m128 zero = _mm_setzero_ps();
+    const uint32_t homingMask = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmpgt_ps(turnRate, zero))) & validMask;
+    if (homingMask == 0) {
+        return 0;
+    }
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minLengthSq = _mm_set1_ps(kMinSteerLengthSq);
+    __m128 vx = _mm_loadu_ps(&velX_[first]);
+    __m128 vy = _mm_loadu_ps(&velY_[first]);
+    __m128 vz = _mm_loadu_ps(&velZ_[first]);
+
+    // 速さと現在の向き
+    const __m128 speedSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_mul_ps(vz, vz));
+    const __m128 speed = _mm_sqrt_ps(speedSq);
+    const __m128 invSpeed = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(speedSq, minLengthSq)));
+    const __m128 dx = _mm_mul_ps(vx, invSpeed);
+    const __m128 dy = _mm_mul_ps(vy, invSpeed);
+    const __m128 dz = _mm_mul_ps(vz, invSpeed);
+
+    // 目標への向き
+    __m128 tx = _mm_sub_ps(_mm_set1_ps(homingTarget_.x), _mm_loadu_ps(&posX_[first]));
+    __m128 ty = _mm_sub_ps(_mm_set1_ps(homingTarget_.y), _mm_loadu_ps(&posY_[first]));
+    __m128 tz = _mm_sub_ps(_mm_set1_ps(homingTarget_.z), _mm_loadu_ps(&posZ_[first]));
+    const __m128 toLengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, tx), _mm_mul_ps(ty, ty)), _mm_mul_ps(tz, tz));
+    const __m128 invToLength = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(toLengthSq, minLengthSq)));
+    tx = _mm_mul_ps(tx, invToLength);
+    ty = _mm_mul_ps(ty, invToLength);
+    tz = _mm_mul_ps(tz, invToLength);
+
+    // このフレームに回せる角度
+    const __m128 angle = _mm_min_ps(_mm_mul_ps(turnRate, _mm_set1_ps(deltaTime)), _mm_set1_ps(kMaxTurnAngle));
+    __m128 sinTurn;
+    __m128 cosTurn;
+    SinCos(angle, sinTurn, cosTurn);
+
+    // tのdに垂直な成分
+    const __m128 cosBetween = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, tx), _mm_mul_ps(dy, ty)), _mm_mul_ps(dz, tz));
+    __m128 ex = _mm_sub_ps(tx, _mm_mul_ps(dx, cosBetween));
+    __m128 ey = _mm_sub_ps(ty, _mm_mul_ps(dy, cosBetween));
+    __m128 ez = _mm_sub_ps(tz, _mm_mul_ps(dz, cosBetween));
+    __m128 eLengthSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey)), _mm_mul_ps(ez, ez));
+    const __m128 behind = _mm_cmplt_ps(eLengthSq, minLengthSq);
+    ex = Select(behind, dz, ex);
+    ey = Select(behind, zero, ey);
+    ez = Select(behind, _mm_sub_ps(zero, dx), ez);
+    eLengthSq = Select(behind, _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz)), eLengthSq);
+    const __m128 invELength = _mm_div_ps(one, _mm_sqrt_ps(_mm_max_ps(eLengthSq, minLengthSq)));
+
+    // 回した向き（届く場合は目標への向き）
+    const __m128 reach = _mm_cmpge_ps(cosBetween, cosTurn);
+    const __m128 sinScale = _mm_mul_ps(sinTurn, invELength);
+    const __m128 nx = Select(reach, tx, _mm_add_ps(_mm_mul_ps(dx, cosTurn), _mm_mul_ps(ex, sinScale)));
+    const __m128 ny = Select(reach, ty, _mm_add_ps(_mm_mul_ps(dy, cosTurn), _mm_mul_ps(ey, sinScale)));
+    const __m128 nz = Select(reach, tz, _mm_add_ps(_mm_mul_ps(dz, cosTurn), _mm_mul_ps(ez, sinScale)));
+
+    // 追尾する弾で、動いていて目標と重なっていないものだけ書き換える
+    const __m128 apply = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(turnRate, zero), _mm_cmpge_ps(speedSq, minLengthSq)),
+        _mm_cmpge_ps(toLengthSq, minLengthSq));
+    _mm_storeu_ps(&velX_[first], Select(apply, _mm_mul_ps(nx, speed), vx));
+    _mm_storeu_ps(&velY_[first], Select(apply, _mm_mul_ps(ny, speed), vy));
+    _mm_storeu_ps(&velZ_[first], Select(apply, _mm_mul_ps(nz, speed), vz));
+
+    return kBitCount[homingMask];
+#else
+    uint32_t steered = 0;
+    for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+        const size_t j = first + lane;
+        if (!(validMask & (1u << lane)) || turnRate_[j] <= 0.0f) {
+            continue;
+        }
+        ++steered;
+
+        const float speedSq = velX_[j] * velX_[j] + velY_[j] * velY_[j] + velZ_[j] * velZ_[j];
+        float tx = homingTarget_.x - posX_[j];
+        float ty = homingTarget_.y - posY_[j];
+        float tz = homingTarget_.z - posZ_[j];
+        const float toLengthSq = tx * tx + ty * ty + tz * tz;
+        if (speedSq < kMinSteerLengthSq || toLengthSq < kMinSteerLengthSq) {
+            continue;
+        }
+
+        const float speed = std::sqrt(speedSq);
+        const float dx = velX_[j] / speed;
+        const float dy = velY_[j] / speed;
+        const float dz = velZ_[j] / speed;
+        const float toLength = std::sqrt(toLengthSq);
+        tx /= toLength;
+        ty /= toLength;
+        tz /= toLength;
+
+        const float angle = (std::min)(turnRate_[j] * deltaTime, kMaxTurnAngle);
+        const float cosTurn = std::cos(angle);
+        const float cosBetween = dx * tx + dy * ty + dz * tz;
+        if (cosBetween >= cosTurn) {
+            velX_[j] = tx * speed;
+            velY_[j] = ty * speed;
+            velZ_[j] = tz * speed;
+            continue;
+        }
+
+        float ex = tx - dx * cosBetween;
+        float ey = ty - dy * cosBetween;
+        float ez = tz - dz * cosBetween;
+        float eLengthSq = ex * ex + ey * ey + ez * ez;
+        if (eLengthSq < kMinSteerLengthSq) {
+            ex = dz;
+            ey = 0.0f;
+            ez = -dx;
+            eLengthSq = dx * dx + dz * dz;
+        }
+        const float sinScale = std::sin(angle) / std::sqrt((std::max)(eLengthSq, kMinSteerLengthSq));
+        velX_[j] = (dx * cosTurn + ex * sinScale) * speed;
+        velY_[j] = (dy * cosTurn + ey * sinScale) * speed;
+        velZ_[j] = (dz * cosTurn + ez * sinScale) * speed;
+    }
+    return steered;
+#endif
+}
+
+void ProjectileSystem::Compact() {
+    const size_t groupCount = (count_ + kLaneWidth - 1) / kLaneWidth;
+    size_t write = 0;
+    for (size_t group = 0; group < groupCount; ++group) {
+        const size_t base = group * kLaneWidth;
+        const uint32_t keep = keepMask_[group];
+
+        // まだ1発も消えていない区間はそのまま
+        if (keep == kFullMask && write == base) {
+            write += kLaneWidth;
+            continue;
+        }
+        for (size_t lane = 0; lane < kLaneWidth; ++lane) {
+            if (keep & (1u << lane)) {
+                MoveElement(base + lane, write++);
+            }
+        }
+    }
+    count_ = write;
+    stats_.activeCount = count_;
+}
+
+void ProjectileSystem::MoveElement(size_t src, size_t dst) {
+    if (src == dst) {
+        return;
+    }
+    posX_[dst] = posX_[src];
+    posY_[dst] = posY_[src];
+    posZ_[dst] = posZ_[src];
+    velX_[dst] = velX_[src];
+    velY_[dst] = velY_[src];
+    velZ_[dst] = velZ_[src];
+    age_[dst] = age_[src];
+    lifetime_[dst] = lifetime_[src];
+    damage_[dst] = damage_[src];
+    radius_[dst] = radius_[src];
+    turnRate_[dst] = turnRate_[src];
+    flags_[dst] = flags_[src];
+}
@@ -0,0 +1,208 @@
+#pragma once
+#include "Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 弾システムへの生成パラメータ
+/// </summary>
+struct ProjectileSpawnParams {
+    Vector3 position{};     // 初期位置
+    Vector3 velocity{};     // 速度
+    float lifetime = 5.0f;  // 生存時間
+    float damage = 10.0f;   // ダメージ量
+    float radius = 1.0f;    // 当たり判定の半径
+    float turnRate = 0.0f;  // 追尾の旋回速度（ラジアン/秒、0なら直進）
+    uint32_t flags = 0;     // 呼び出し側で使う識別用のフラグ（そのまま保持する）
+};
+
+/// <summary>
+/// 弾幕用の大量の弾をまとめて扱う弾システム
+/// 弾ごとのオブジェクト（モデル・コライダー・エミッター）は持たず、位置・速度・経過時間などを
+/// 要素ごとの配列（SoA）で保持して、移動・寿命・範囲外の判定を4発ずつSIMDで行う
+/// 消えた弾は生成順を保ったまま前に詰めるため、生きている弾は常に[0, GetActiveCount())に並ぶ
+/// （描画や当たり判定はこの範囲の配列をそのまま読めばよい）
+/// 旋回速度を持つ弾は、システム共通の追尾目標へ向けて速さを保ったまま1フレームに旋回速度分だけ向きを変える
+/// </summary>
+class ProjectileSystem {
+public:
+    /// <summary>
+    /// 1回のSIMD演算で処理する弾の数（配列の長さはこの倍数に切り上げる）
+    /// </summary>
+    static constexpr size_t kLaneWidth = 4;
+
+    /// <summary>
+    /// 使用状況
+    /// </summary>
+    struct Stats {
+        size_t capacity = 0;           // 容量
+        size_t activeCount = 0;        // 生きている弾の数
+        size_t highWaterMark = 0;      // 生きている弾の数の最大
+        uint64_t spawnCount = 0;       // 生成要求の数
+        uint64_t overflowCount = 0;    // 容量を超えて生成できなかった数
+        uint64_t expiredCount = 0;     // 生存時間切れで消えた数
+        uint64_t outOfBoundsCount = 0; // 範囲外に出て消えた数
+        uint64_t hitCount = 0;         // 当たって消えた数
+        size_t homingCount = 0;        // 直近の更新で追尾した弾の数
+    };
+
+    /// <summary>
+    /// 初期化（配列を容量分確保する）
+    /// </summary>
+    /// <param name="capacity">容量</param>
+    void Initialize(size_t capacity);
+
+    /// <summary>
+    /// 弾が生存できる範囲の設定（範囲外に出た弾は次の更新で消える）
+    /// </summary>
+    /// <param name="min">最小座標</param>
+    /// <param name="max">最大座標</param>
+    void SetBounds(const Vector3& min, const Vector3& max);
+
+    /// <summary>
+    /// 追尾目標の設定（旋回速度を持つ全ての弾が同じ目標を追う）
+    /// </summary>
+    /// <param name="target">目標の位置</param>
+    void SetHomingTarget(const Vector3& target) { homingTarget_ = target; hasHomingTarget_ = true; }
+
+    /// <summary>
+    /// 追尾目標の解除（旋回速度を持つ弾も直進する）
+    /// </summary>
+    void ClearHomingTarget() { hasHomingTarget_ = false; }
+
+    /// <summary>
+    /// 弾の生成
+    /// </summary>
+    /// <param name="params">生成パラメータ</param>
+    /// <returns>生成できた場合true（容量を超えた場合false）</returns>
+    bool Spawn(const ProjectileSpawnParams& params);
+
+    /// <summary>
+    /// 全ての弾の追尾・移動と、生存時間切れ・範囲外の弾の削除
+    /// </summary>
+    /// <param name="deltaTime">前フレームからの経過時間</param>
+    void Update(float deltaTime);
+
+    /// <summary>
+    /// 球との当たり判定（当たった弾は削除する）
+    /// sweepTimeを指定すると、各弾が直前のその時間に通った線分（位置 - 速度 * sweepTime から現在位置まで）で判定する
+    /// Updateの後にその経過時間を渡せば、速い弾や長いフレーム時間でも球をすり抜けない
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <param name="outDamage">当たった弾のダメージ量の合計（nullptr可）</param>
+    /// <param name="sweepTime">移動をさかのぼって判定する時間（0なら現在位置のみ）</param>
+    /// <returns>当たった弾の数</returns>
+    uint32_t CollideSphere(const Vector3& center, float radius, float* outDamage = nullptr, float sweepTime = 0.0f);
+
+    /// <summary>
+    /// 球と重なっている弾の数（弾は削除しない、パリィなどのクエリ用）
+    /// </summary>
+    /// <param name="center">球の中心</param>
+    /// <param name="radius">球の半径</param>
+    /// <returns>重なっている弾の数</returns>
+    uint32_t CountOverlapSphere(const Vector3& center, float radius) const;
+
+    /// <summary>
+    /// 全ての弾を削除
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// 生きている弾の数の取得
+    /// </summary>
+    /// <returns>生きている弾の数</returns>
+    size_t GetActiveCount() const { return count_; }
+
+    /// <summary>
+    /// 弾の位置の取得
+    /// </summary>
+    /// <param name="index">弾の番号（GetActiveCount()未満）</param>
+    /// <returns>位置</returns>
+    Vector3 GetPosition(size_t index) const { return Vector3(posX_[index], posY_[index], posZ_[index]); }
+
+    /// <summary>
+    /// 弾の速度の取得
+    /// </summary>
+    /// <param name="index">弾の番号（GetActiveCount()未満）</param>
+    /// <returns>速度</returns>
+    Vector3 GetVelocity(size_t index) const { return Vector3(velX_[index], velY_[index], velZ_[index]); }
+
+    /// <summary>
+    /// 弾の当たり判定の半径の取得
+    /// </summary>
+    /// <param name="index">弾の番号（GetActiveCount()未満）</param>
+    /// <returns>半径</returns>
+    float GetRadius(size_t index) const { return radius_[index]; }
+
+    /// <summary>
+    /// 弾のフラグの取得
+    /// </summary>
+    /// <param name="index">弾の番号（GetActiveCount()未満）</param>
+    /// <returns>生成時に指定したフラグ</returns>
+    uint32_t GetFlags(size_t index) const { return flags_[index]; }
+
+    /// <summary>
+    /// 位置・半径の配列の取得（描画データの作成用、要素数はGetActiveCount()）
+    /// </summary>
+    const float* GetPositionX() const { return posX_.data(); }
+    const float* GetPositionY() const { return posY_.data(); }
+    const float* GetPositionZ() const { return posZ_.data(); }
+    const float* GetRadii() const { return radius_.data(); }
+
+    /// <summary>
+    /// 使用状況の取得
+    /// </summary>
+    /// <returns>使用状況</returns>
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 使用状況の最大値・累計のリセット（容量と生きている弾の数は残す）
+    /// </summary>
+    void ResetStats();
+
+private:
+    /// <summary>
+    /// 先頭firstからkLaneWidth発のうち、旋回速度を持つ弾の速度を追尾目標へ向けて回す
+    /// </summary>
+    /// <returns>向きを変えた弾の数</returns>
+    uint32_t Steer(size_t first, uint32_t validMask, float deltaTime);
+
+    /// <summary>
+    /// keepMask_で残さない弾を取り除き、残りを生成順のまま前に詰める
+    /// </summary>
+    void Compact();
+
+    /// <summary>
+    /// 弾1発分の値をsrcからdstへ移す
+    /// </summary>
+    void MoveElement(size_t src, size_t dst);
+
+    // 弾ごとの値（要素数は容量をkLaneWidthの倍数に切り上げた数）
+    std::vector<float> posX_, posY_, posZ_;
+    std::vector<float> velX_, velY_, velZ_;
+    std::vector<float> age_;
+    std::vector<float> lifetime_;
+    std::vector<float> damage_;
+    std::vector<float> radius_;
+    std::vector<float> turnRate_;
+    std::vector<uint32_t> flags_;
+
+    // 更新・当たり判定で残す弾（kLaneWidth発ごとのビットマスク、ビットが立っていれば残す）
+    std::vector<uint8_t> keepMask_;
+
+    // 生きている弾の数
+    size_t count_ = 0;
+
+    // 弾が生存できる範囲
+    Vector3 boundsMin_{ -1.0e30f, -1.0e30f, -1.0e30f };
+    Vector3 boundsMax_{ 1.0e30f, 1.0e30f, 1.0e30f };
+
+    // 追尾目標
+    Vector3 homingTarget_{};
+    bool hasHomingTarget_ = false;
+
+    // 使用状況
+    Stats stats_;
+};
@@ -0,0 +1,281 @@
+#include "SimBatchRunner.h"
+#include "GlobalVariables.h"
+#include "../Common/GameGlobalVariables.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <variant>
+
+namespace {
+
+    /// <summary>
+    /// 昇順に並んだ値のパーセンタイル（最近傍）
+    /// </summary>
+    float Percentile(const std::vector<float>& sorted, float ratio) {
+        if (sorted.empty()) {
+            return 0.0f;
+        }
+        size_t index = static_cast<size_t>(ratio * static_cast<float>(sorted.size() - 1) + 0.5f);
+        return sorted[(std::min)(index, sorted.size() - 1)];
+    }
+
+    /// <summary>
+    /// 平均
+    /// </summary>
+    float Mean(const std::vector<float>& values) {
+        if (values.empty()) {
+            return 0.0f;
+        }
+        double sum = 0.0;
+        for (float v : values) {
+            sum += v;
+        }
+        return static_cast<float>(sum / static_cast<double>(values.size()));
+    }
+
+}
+
+void SimBatchRunner::LoadGlobalVariables(const std::vector<std::string>& overrides) {
+    GlobalVariables* globalVariables = GlobalVariables::GetInstance();
+    globalVariables->Clear();
+    GameGlobalVariables::RegisterDefaults(globalVariables);
+    globalVariables->LoadFiles();
+    for (const std::string& assignment : overrides) {
+        if (!ApplyOverride(assignment)) {
+            std::cerr << "[Sim] override ignored: " << assignment << '\n';
+        }
+    }
+}
+
+SimBatchRunner::Report SimBatchRunner::Run(const Settings& settings) {
+    //==================== 調整値の読み込み（メインスレッドで1回だけ） ====================
+    LoadGlobalVariables(settings.overrides);
+    const auto snapshot = GlobalVariables::GetInstance()->GetAllGroups();
+
+    //==================== 並列実行 ====================
+    Report report;
+    report.fightCount = settings.fightCount;
+    report.threadCount = settings.threadCount != 0 ? settings.threadCount : (std::max)(1u, std::thread::hardware_concurrency());
+    report.threadCount = (std::min)(report.threadCount, (std::max)(1u, settings.fightCount));
+    report.fights.resize(settings.fightCount);
+
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    // 戦闘は番号で取り出し、結果は番号の位置へ書くため、スレッド数や実行順に関係なく同じ並びになる
+    std::atomic<uint32_t> nextFight{ 0 };
+    auto worker = [&]() {
+        // スレッドごとのGlobalVariablesへ同じ調整値を複製
+        GlobalVariables::GetInstance()->SetAllGroups(snapshot);
+
+        SimFightSettings fightSettings = settings.fight;
+        for (;;) {
+            uint32_t index = nextFight.fetch_add(1, std::memory_order_relaxed);
+            if (index >= settings.fightCount) {
+                break;
+            }
+            fightSettings.seed = settings.baseSeed + index;
+            report.fights[index] = SimFight::Run(fightSettings);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(report.threadCount - 1);
+    for (uint32_t i = 1; i < report.threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    report.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+
+    Aggregate(report);
+    return report;
+}
+
+void SimBatchRunner::Aggregate(Report& report) {
+    std::vector<float> ttk;
+    std::vector<float> damage;
+    uint32_t phase2Count = 0;
+    uint64_t bossBullets = 0;
+
+    for (const SimFightResult& fight : report.fights) {
+        if (fight.playerWon) {
+            ++report.wins;
+            ttk.push_back(fight.duration);
+        }
+        else if (fight.timedOut) {
+            ++report.timeouts;
+        }
+        else {
+            ++report.losses;
+        }
+        if (fight.phase2Time >= 0.0f) {
+            ++phase2Count;
+        }
+        damage.push_back(fight.damageTaken);
+        report.simulatedSeconds += fight.duration;
+        report.totalFrames += fight.frames;
+        bossBullets += fight.bossBulletCount;
+        report.peakProjectiles = (std::max)(report.peakProjectiles, fight.peakProjectiles);
+        report.poolOverflows += fight.poolOverflows;
+
+        // 全戦闘で同じツリーを使うため、ノードの並びは共通
+        if (report.nodes.size() < fight.nodes.size()) {
+            report.nodes.resize(fight.nodes.size());
+        }
+        for (size_t i = 0; i < fight.nodes.size(); ++i) {
+            SimNodeUsage& total = report.nodes[i];
+            const SimNodeUsage& usage = fight.nodes[i];
+            total.name = usage.name;
+            total.callCount += usage.callCount;
+            total.successCount += usage.successCount;
+            total.failureCount += usage.failureCount;
+            total.runningCount += usage.runningCount;
+            total.inclusiveNs += usage.inclusiveNs;
+        }
+    }
+
+    std::sort(ttk.begin(), ttk.end());
+    std::sort(damage.begin(), damage.end());
+    report.ttkMean = Mean(ttk);
+    report.ttkMedian = Percentile(ttk, 0.5f);
+    report.ttkP90 = Percentile(ttk, 0.9f);
+    report.damageMean = Mean(damage);
+    report.damageP90 = Percentile(damage, 0.9f);
+    if (!report.fights.empty()) {
+        const double fightCount = static_cast<double>(report.fights.size());
+        report.phase2Rate = static_cast<float>(phase2Count / fightCount);
+        report.bulletsPerFight = static_cast<double>(bossBullets) / fightCount;
+    }
+}
+
+void SimBatchRunner::PrintReport(const Report& report, std::ostream& out) {
+    const double fights = (std::max)(1u, report.fightCount);
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "fights %u  threads %u  wall %.2fs  sim %.0fs  (%.0f sim-s/s)\n",
+        report.fightCount, report.threadCount, report.wallSeconds, report.simulatedSeconds,
+        report.wallSeconds > 0.0 ? report.simulatedSeconds / report.wallSeconds : 0.0);
+    out << line;
+    std::snprintf(line, sizeof(line), "win rate %.1f%%  (win %u / lose %u / timeout %u)  phase2 reached %.1f%%\n",
+        100.0 * report.wins / fights, report.wins, report.losses, report.timeouts, 100.0f * report.phase2Rate);
+    out << line;
+    std::snprintf(line, sizeof(line), "time to kill  mean %.1fs  median %.1fs  p90 %.1fs\n",
+        report.ttkMean, report.ttkMedian, report.ttkP90);
+    out << line;
+    std::snprintf(line, sizeof(line), "damage taken  mean %.1f  p90 %.1f\n", report.damageMean, report.damageP90);
+    out << line;
+    std::snprintf(line, sizeof(line), "boss bullets/fight %.1f  peak projectiles %zu  pool overflows %llu\n",
+        report.bulletsPerFight, report.peakProjectiles, static_cast<unsigned long long>(report.poolOverflows));
+    out << line;
+
+    if (report.nodes.empty()) {
+        return;
+    }
+
+    // ルートの包括時間＝ツリー全体のTick時間
+    const double rootNs = report.nodes.front().inclusiveNs;
+    const uint64_t rootCalls = report.nodes.front().callCount;
+    if (rootCalls > 0) {
+        std::snprintf(line, sizeof(line), "AI tick  %.0f ns avg  (%.2f%% of wall time)\n",
+            rootNs / static_cast<double>(rootCalls),
+            report.wallSeconds > 0.0 ? 100.0 * rootNs * 1.0e-9 / (report.wallSeconds * report.threadCount) : 0.0);
+        out << line;
+    }
+
+    out << "\n";
+    std::snprintf(line, sizeof(line), "%-4s %-32s %12s %9s %9s %9s %9s\n",
+        "id", "node", "calls/fight", "success", "failure", "running", "avg ns");
+    out << line;
+    for (size_t i = 0; i < report.nodes.size(); ++i) {
+        const SimNodeUsage& node = report.nodes[i];
+        const double calls = (std::max)(1.0, static_cast<double>(node.callCount));
+        std::snprintf(line, sizeof(line), "%-4zu %-32.32s %12.1f %8.1f%% %8.1f%% %8.1f%% %9.0f\n",
+            i, node.name.c_str(),
+            static_cast<double>(node.callCount) / fights,
+            100.0 * node.successCount / calls,
+            100.0 * node.failureCount / calls,
+            100.0 * node.runningCount / calls,
+            node.inclusiveNs / calls);
+        out << line;
+    }
+}
+
+bool SimBatchRunner::ExportFightsCSV(const Report& report, const std::string& filepath) {
+    std::ofstream file(filepath, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file << "seed,result,duration,damage_taken,boss_hp_left,phase2_time,frames,boss_bullets,player_bullets,peak_projectiles,peak_emitters,collision_tests,wall_ms\n";
+    for (const SimFightResult& fight : report.fights) {
+        const char* result = fight.playerWon ? "win" : (fight.timedOut ? "timeout" : "lose");
+        file << fight.seed << ',' << result << ',' << fight.duration << ',' << fight.damageTaken << ','
+            << fight.bossHpLeft << ',' << fight.phase2Time << ',' << fight.frames << ','
+            << fight.bossBulletCount << ',' << fight.playerBulletCount << ','
+            << fight.peakProjectiles << ',' << fight.peakEmitters << ','
+            << fight.collisionTests << ',' << fight.wallSeconds * 1.0e3 << '\n';
+    }
+    return file.good();
+}
+
+bool SimBatchRunner::ApplyOverride(const std::string& assignment) {
+    const size_t dot = assignment.find('.');
+    const size_t equal = assignment.find('=', dot == std::string::npos ? 0 : dot);
+    if (dot == std::string::npos || equal == std::string::npos) {
+        return false;
+    }
+    const std::string group = assignment.substr(0, dot);
+    const std::string key = assignment.substr(dot + 1, equal - dot - 1);
+    const std::string value = assignment.substr(equal + 1);
+
+    GlobalVariables* globalVariables = GlobalVariables::GetInstance();
+    const auto& groups = globalVariables->GetAllGroups();
+    auto groupIt = groups.find(group);
+    if (groupIt == groups.end()) {
+        return false;
+    }
+    auto itemIt = groupIt->second.find(key);
+    if (itemIt == groupIt->second.end()) {
+        return false;
+    }
+
+    // 既存の項目と同じ型で上書きする
+    return std::visit([&](const auto& current) -> bool {
+        using T = std::decay_t<decltype(current)>;
+        try {
+            if constexpr (std::is_same_v<T, int32_t>) {
+                globalVariables->SetValue(group, key, static_cast<int32_t>(std::stoi(value)));
+            }
+            else if constexpr (std::is_same_v<T, float>) {
+                globalVariables->SetValue(group, key, std::stof(value));
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                globalVariables->SetValue(group, key, value == "1" || value == "true");
+            }
+            else if constexpr (std::is_same_v<T, Vector3>) {
+                Vector3 v{};
+                if (std::sscanf(value.c_str(), "%f,%f,%f", &v.x, &v.y, &v.z) != 3) {
+                    return false;
+                }
+                globalVariables->SetValue(group, key, v);
+            }
+            else {
+                globalVariables->SetValue(group, key, value);
+            }
+        }
+        catch (const std::exception&) {
+            return false;
+        }
+        return true;
+    }, itemIt->second);
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include "SimFight.h"
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// シード違いの戦闘を全コアで並列に実行し、勝率・撃破時間・被ダメージ・ノード使用状況を集計する
+/// BossTree.json や GlobalVariables の調整値を、DX12ビルドを起動せずに評価するためのもの
+/// </summary>
+class SimBatchRunner {
+public:
+    /// <summary>
+    /// バッチの設定
+    /// </summary>
+    struct Settings {
+        uint32_t fightCount = 1000;          // 戦闘数
+        uint32_t baseSeed = 1;               // 1戦目のシード（以降は+1ずつ）
+        uint32_t threadCount = 0;            // ワーカースレッド数（0ならハードウェアスレッド数）
+        SimFightSettings fight;              // 各戦闘の設定（seedは上書きされる）
+        std::vector<std::string> overrides;  // 調整値の上書き（"Group.Key=value"）
+    };
+
+    /// <summary>
+    /// 集計結果
+    /// </summary>
+    struct Report {
+        uint32_t fightCount = 0;
+        uint32_t threadCount = 0;
+        uint32_t wins = 0;                  // プレイヤーの勝利数
+        uint32_t losses = 0;                // プレイヤーの敗北数
+        uint32_t timeouts = 0;              // 打ち切り数
+        float ttkMean = 0.0f;               // 撃破時間の平均（勝った戦闘のみ、秒）
+        float ttkMedian = 0.0f;             // 撃破時間の中央値
+        float ttkP90 = 0.0f;                // 撃破時間の90パーセンタイル
+        float damageMean = 0.0f;            // 被ダメージの平均
+        float damageP90 = 0.0f;             // 被ダメージの90パーセンタイル
+        float phase2Rate = 0.0f;            // フェーズ2に到達した割合
+        double simulatedSeconds = 0.0;      // シミュレーション時間の合計
+        double wallSeconds = 0.0;           // バッチ全体の実時間
+        uint64_t totalFrames = 0;           // 総フレーム数
+        double bulletsPerFight = 0.0;       // 1戦あたりのボスの弾数
+        size_t peakProjectiles = 0;         // 全戦闘での同時弾数の最大
+        uint64_t poolOverflows = 0;         // 弾プールの容量不足の合計
+        std::vector<SimNodeUsage> nodes;    // ノードごとの使用状況（全戦闘の合計）
+        std::vector<SimFightResult> fights; // 戦闘ごとの結果（シード順）
+    };
+
+    /// <summary>
+    /// 呼び出しスレッドのGlobalVariablesへ調整値を読み込み、上書きを適用する
+    /// </summary>
+    /// <param name="overrides">調整値の上書き（"Group.Key=value"）</param>
+    static void LoadGlobalVariables(const std::vector<std::string>& overrides);
+
+    /// <summary>
+    /// 調整値を読み込み、全戦闘を実行して集計する
+    /// </summary>
+    /// <param name="settings">設定</param>
+    /// <returns>集計結果</returns>
+    static Report Run(const Settings& settings);
+
+    /// <summary>
+    /// 集計結果を表形式で出力
+    /// </summary>
+    static void PrintReport(const Report& report, std::ostream& out);
+
+    /// <summary>
+    /// 戦闘ごとの結果をCSV形式で出力
+    /// </summary>
+    /// <returns>成功したらtrue</returns>
+    static bool ExportFightsCSV(const Report& report, const std::string& filepath);
+
+private:
+    /// <summary>
+    /// 呼び出しスレッドのGlobalVariablesへ上書きを1件適用
+    /// 既存の項目の型に合わせて値を解釈する
+    /// </summary>
+    /// <param name="assignment">"Group.Key=value"</param>
+    /// <returns>適用できたらtrue</returns>
+    static bool ApplyOverride(const std::string& assignment);
+
+    /// <summary>
+    /// 結果を集計
+    /// </summary>
+    static void Aggregate(Report& report);
+};
@@ -0,0 +1,462 @@
+#include "SimBulletStress.h"
+#include "../Object/Projectile/BossBullet.h"
+#include "../Object/Projectile/BulletPatternSystem.h"
+#include "../Object/Projectile/ProjectileInstanceBatch.h"
+#include "../Object/Projectile/ProjectilePool.h"
+#include "../Object/Projectile/ProjectileSystem.h"
+#include "../Collision/CollisionGrid.h"
+#include "../Collision/CollisionTypeIdDef.h"
+#include "../Collision/NarrowphaseBatch.h"
+#include "../Common/GameConst.h"
+#include "CollisionManager.h"
+#include "EmitterManager.h"
+#include "GlobalVariables.h"
+#include "OBBCollider.h"
+#include "RandomEngine.h"
+#include "SphereCollider.h"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    /// <summary>
+    /// 弾の発射位置
+    /// </summary>
+    const Vector3 kOrigin(0.0f, 1.0f, 0.0f);
+
+    /// <summary>
+    /// 当たり判定の相手（プレイヤー役）の位置
+    /// </summary>
+    const Vector3 kTargetPosition(15.0f, 1.0f, 0.0f);
+
+    /// <summary>
+    /// 描画用の配列へ詰める時の色
+    /// </summary>
+    const Vector4 kBulletColor(1.0f, 0.3f, 0.3f, 1.0f);
+
+    /// <summary>
+    /// 最初に指定数まで増やすのにかけるフレーム数（全弾が同じフレームに消えないよう分散させる）
+    /// </summary>
+    constexpr uint32_t kRampFrames = 60;
+
+    /// <summary>
+    /// 模様で実行する時の1つの円の弾数
+    /// </summary>
+    constexpr uint32_t kPatternRingSize = 200;
+
+    /// <summary>
+    /// CollisionGridのセルの一辺の長さ（GameSceneと同じ）
+    /// </summary>
+    constexpr float kCollisionGridCellSize = 8.0f;
+
+    /// <summary>
+    /// 衝突判定を行うタイプの組み合わせ（プレイヤー役と弾のみ）
+    /// </summary>
+    constexpr CollisionLayerMatrix kCollisionLayers = {
+        { CollisionTypeId::PLAYER, CollisionTypeId::BOSS_ATTACK },
+    };
+
+    /// <summary>
+    /// 生成番号から弾の速度を決める（黄金角で全方位に散らす）
+    /// </summary>
+    Vector3 SpawnVelocity(uint64_t serial) {
+        float angle = static_cast<float>(serial % 100000) * 2.39996323f;
+        float speed = 6.0f + static_cast<float>(serial % 8);
+        float vy = (static_cast<float>(serial % 5) - 2.0f) * 0.5f;
+        return Vector3(std::cos(angle) * speed, vy, std::sin(angle) * speed);
+    }
+
+    /// <summary>
+    /// このフレームに補充する弾の数
+    /// </summary>
+    size_t SpawnBudget(const SimBulletStress::Settings& settings, size_t active) {
+        size_t perFrame = (settings.bulletCount + kRampFrames - 1) / kRampFrames;
+        return active < settings.bulletCount ? (std::min)(perFrame, settings.bulletCount - active) : 0;
+    }
+
+    /// <summary>
+    /// 描画用の配列の準備（ゲームと同じく手前から並べ、ステージ全体を見下ろす視点でカリングする）
+    /// </summary>
+    void InitializeInstanceBatch(ProjectileInstanceBatch& batch, size_t capacity, ProjectileInstanceBatch::CullView& view) {
+        batch.Initialize("sphere.gltf", capacity);
+        batch.SetSortMode(ProjectileInstanceBatch::SortMode::FrontToBack);
+        const float pitch = 0.6f;
+        view.position = Vector3(0.0f, 40.0f, -90.0f);
+        view.forward = Vector3(0.0f, -std::sin(pitch), std::cos(pitch));
+    }
+
+    /// <summary>
+    /// 経過時間を秒で加算
+    /// </summary>
+    void AddElapsed(double& seconds, Clock::time_point start) {
+        seconds += std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+}
+
+SimBulletStress::Report SimBulletStress::Run(const Settings& settings) {
+    Report report;
+    report.settings = settings;
+    report.objects = RunObjects(settings, false);
+    report.grid = RunObjects(settings, true);
+    report.soa = RunSoA(settings);
+    report.pattern = RunPatterns(settings);
+    report.narrowphase = RunNarrowphase(settings);
+    return report;
+}
+
+SimBulletStress::RunResult SimBulletStress::RunObjects(const Settings& settings, bool useGrid) {
+    RunResult result;
+    RandomEngine::GetInstance()->Seed(settings.seed);
+
+    CollisionManager* collisionManager = CollisionManager::GetInstance();
+    collisionManager->Initialize();
+    for (const CollisionLayerMatrix::TypePair& pair : kCollisionLayers.GetPairs()) {
+        collisionManager->SetCollisionMask(pair.typeA, pair.typeB, true);
+    }
+
+    // プレイヤー役のコライダー（所有者がないのでダメージ処理は行われない）
+    Transform targetTransform{};
+    targetTransform.translate = kTargetPosition;
+    float bodySize = GlobalVariables::GetInstance()->GetValueFloat("Player", "BodyColliderSize");
+    OBBCollider target;
+    target.SetTransform(&targetTransform);
+    target.SetSize(Vector3(bodySize, bodySize, bodySize));
+    target.SetTypeID(static_cast<uint32_t>(CollisionTypeId::PLAYER));
+
+    CollisionGrid grid;
+    if (useGrid) {
+        grid.Initialize(
+            Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+            Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax),
+            kCollisionGridCellSize);
+        grid.SetLayerMatrix(kCollisionLayers);
+        grid.Insert(&target);
+    }
+    else {
+        collisionManager->AddCollider(&target);
+    }
+
+    EmitterManager emitterManager;
+    ProjectileEffects effects;
+    effects.trail.Initialize(&emitterManager, "boss_bullet", settings.bulletCount);
+    effects.explode.Initialize(&emitterManager, "boss_bullet_explode", settings.bulletCount);
+    ProjectilePool<BossBullet> bullets;
+    bullets.Initialize(settings.bulletCount,
+        [&]() { return std::make_unique<BossBullet>(&effects, useGrid ? &grid : nullptr); });
+
+    // 両方の実装で同じ数を詰めるよう、プール上の弾も当たり判定の半径で描く
+    const float radius = GlobalVariables::GetInstance()->GetValueFloat("BossBullet", "ColliderRadius");
+    ProjectileInstanceBatch batch;
+    ProjectileInstanceBatch::CullView view;
+    InitializeInstanceBatch(batch, settings.bulletCount, view);
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+        size_t budget = SpawnBudget(settings, bullets.GetActiveCount());
+        for (size_t i = 0; i < budget; ++i) {
+            bullets.Spawn(kOrigin, SpawnVelocity(result.spawned++));
+            ++result.spawnRequests;
+        }
+
+        auto start = Clock::now();
+        bullets.Update(settings.deltaTime);
+        effects.Update(settings.deltaTime);
+        AddElapsed(result.updateSeconds, start);
+
+        start = Clock::now();
+        if (useGrid) {
+            grid.CheckAllCollisions();
+        }
+        else {
+            collisionManager->CheckAllCollisions();
+        }
+        AddElapsed(result.collideSeconds, start);
+
+        start = Clock::now();
+        batch.Begin(&view);
+        bullets.ForEachActive([&](const BossBullet& bullet) {
+            batch.Add(bullet.GetTransform().translate, radius, kBulletColor);
+        });
+        batch.End();
+        AddElapsed(result.packSeconds, start);
+        result.packedInstances += batch.GetInstanceCount();
+
+        result.bulletFrames += bullets.GetActiveCount();
+        result.peakActive = (std::max)(result.peakActive, bullets.GetActiveCount());
+    }
+
+    result.pairTests = useGrid ? grid.GetStats().totalTestedPairs : collisionManager->GetStats().pairTests;
+    bullets.Finalize();
+    effects.Finalize();
+    collisionManager->Reset();
+    return result;
+}
+
+SimBulletStress::RunResult SimBulletStress::RunSoA(const Settings& settings) {
+    RunResult result;
+
+    GlobalVariables* gv = GlobalVariables::GetInstance();
+    ProjectileSpawnParams params;
+    params.position = kOrigin;
+    params.lifetime = gv->GetValueFloat("BossBullet", "Lifetime");
+    params.damage = gv->GetValueFloat("BossBullet", "Damage");
+    params.radius = gv->GetValueFloat("BossBullet", "ColliderRadius");
+    params.turnRate = settings.homingTurnRate;
+    const float targetRadius = gv->GetValueFloat("Player", "BodyColliderSize") * 0.5f;
+
+    ProjectileSystem bullets;
+    bullets.Initialize(settings.bulletCount);
+    ProjectileInstanceBatch batch;
+    ProjectileInstanceBatch::CullView view;
+    InitializeInstanceBatch(batch, settings.bulletCount, view);
+    bullets.SetBounds(
+        Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+        Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax));
+    bullets.SetHomingTarget(kTargetPosition);
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+        size_t budget = SpawnBudget(settings, bullets.GetActiveCount());
+        for (size_t i = 0; i < budget; ++i) {
+            params.velocity = SpawnVelocity(result.spawned++);
+            bullets.Spawn(params);
+            ++result.spawnRequests;
+        }
+
+        auto start = Clock::now();
+        bullets.Update(settings.deltaTime);
+        AddElapsed(result.updateSeconds, start);
+
+        start = Clock::now();
+        bullets.CollideSphere(kTargetPosition, targetRadius);
+        AddElapsed(result.collideSeconds, start);
+
+        start = Clock::now();
+        batch.Begin(&view);
+        batch.AddProjectiles(bullets, kBulletColor);
+        batch.End();
+        AddElapsed(result.packSeconds, start);
+        result.packedInstances += batch.GetInstanceCount();
+
+        result.bulletFrames += bullets.GetActiveCount();
+        result.peakActive = (std::max)(result.peakActive, bullets.GetActiveCount());
+    }
+    return result;
+}
+
+SimBulletStress::RunResult SimBulletStress::RunPatterns(const Settings& settings) {
+    RunResult result;
+
+    GlobalVariables* gv = GlobalVariables::GetInstance();
+    const float lifetime = gv->GetValueFloat("BossBullet", "Lifetime");
+    const float damage = gv->GetValueFloat("BossBullet", "Damage");
+    const float radius = gv->GetValueFloat("BossBullet", "ColliderRadius");
+    const float targetRadius = gv->GetValueFloat("Player", "BodyColliderSize") * 0.5f;
+
+    // 補充は円単位なので、最後の1つがはみ出す分だけ容量に余裕を持たせる
+    BulletPatternSystem patterns;
+    patterns.Initialize(settings.bulletCount + kPatternRingSize);
+    ProjectileInstanceBatch batch;
+    ProjectileInstanceBatch::CullView view;
+    InitializeInstanceBatch(batch, settings.bulletCount + kPatternRingSize, view);
+
+    BulletPattern ring;
+    ring.type = BulletPatternType::Ring;
+    ring.origin = kOrigin;
+    ring.bulletCount = kPatternRingSize;
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+        // 1発ずつの生成と同じ数だけ、向きと速さをずらした円で補充する
+        size_t budget = SpawnBudget(settings, patterns.GetStats().activeCount);
+        for (size_t spawned = 0; spawned < budget; spawned += kPatternRingSize) {
+            ring.baseAngle = static_cast<float>(result.spawnRequests % 100000) * 2.39996323f;
+            ring.speed = 6.0f + static_cast<float>(result.spawnRequests % 8);
+            ++result.spawnRequests;
+            if (patterns.Spawn(ring, lifetime, damage, radius)) {
+                result.spawned += kPatternRingSize;
+            }
+        }
+
+        auto start = Clock::now();
+        patterns.Update(settings.deltaTime);
+        AddElapsed(result.updateSeconds, start);
+
+        start = Clock::now();
+        patterns.CollideSphere(kTargetPosition, targetRadius);
+        AddElapsed(result.collideSeconds, start);
+
+        start = Clock::now();
+        batch.Begin(&view);
+        patterns.AddInstances(batch, kBulletColor);
+        batch.End();
+        AddElapsed(result.packSeconds, start);
+        result.packedInstances += batch.GetInstanceCount();
+
+        const BulletPatternSystem::Stats& stats = patterns.GetStats();
+        result.evaluatedBullets += stats.evaluatedCount;
+        result.bulletFrames += stats.activeCount;
+        result.peakActive = (std::max)(result.peakActive, stats.activeCount);
+    }
+    return result;
+}
+
+SimBulletStress::NarrowphaseResult SimBulletStress::RunNarrowphase(const Settings& settings) {
+    NarrowphaseResult result;
+    RandomEngine* rng = RandomEngine::GetInstance();
+    rng->Seed(settings.seed);
+
+    // プレイヤー役の本体（斜めに傾けて3軸とも使う）
+    const float bodySize = GlobalVariables::GetInstance()->GetValueFloat("Player", "BodyColliderSize");
+    const float yaw = 0.6f;
+    const float pitch = 0.3f;
+    NarrowphaseBatch::OBBShape box;
+    box.center = kTargetPosition;
+    box.axes[0] = Vector3(std::cos(yaw), 0.0f, -std::sin(yaw));
+    box.axes[1] = Vector3(std::sin(yaw) * std::sin(pitch), std::cos(pitch), std::cos(yaw) * std::sin(pitch));
+    box.axes[2] = Vector3(std::sin(yaw) * std::cos(pitch), -std::sin(pitch), std::cos(yaw) * std::cos(pitch));
+    for (float& half : box.halfExtents) {
+        half = bodySize * 0.5f;
+    }
+
+    // 本体の周りに球を散らし、毎フレーム少しずつ動かす（境界付近の判定も含むように本体の数倍の範囲に置く）
+    const size_t count = settings.bulletCount;
+    const float spread = bodySize * 2.0f;
+    std::vector<Transform> transforms(count);
+    std::vector<std::unique_ptr<SphereCollider>> colliders(count);
+    std::vector<Vector3> drift(count);
+    std::vector<float> x(count);
+    std::vector<float> y(count);
+    std::vector<float> z(count);
+    std::vector<float> radius(count);
+    for (size_t i = 0; i < count; ++i) {
+        transforms[i].translate = kTargetPosition + Vector3(
+            rng->GetFloat(-spread, spread), rng->GetFloat(-spread, spread), rng->GetFloat(-spread, spread));
+        drift[i] = Vector3(rng->GetFloat(-1.0f, 1.0f), rng->GetFloat(-1.0f, 1.0f), rng->GetFloat(-1.0f, 1.0f));
+        colliders[i] = std::make_unique<SphereCollider>();
+        colliders[i]->SetTransform(&transforms[i]);
+        colliders[i]->SetRadius(rng->GetFloat(0.1f, 1.0f));
+        radius[i] = colliders[i]->GetRadius();
+    }
+
+    const size_t wordCount = NarrowphaseBatch::GetMaskWordCount(count);
+    std::vector<uint32_t> colliderMask(wordCount);
+    std::vector<uint32_t> scalarMask(wordCount);
+    std::vector<uint32_t> batchMask(wordCount);
+    const NarrowphaseBatch::SphereArrays spheres{ x.data(), y.data(), z.data(), radius.data(), count };
+
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+        for (size_t i = 0; i < count; ++i) {
+            Vector3& position = transforms[i].translate;
+            position = position + drift[i] * settings.deltaTime;
+            if (std::abs(position.x - kTargetPosition.x) > spread || std::abs(position.y - kTargetPosition.y) > spread
+                || std::abs(position.z - kTargetPosition.z) > spread) {
+                drift[i] = drift[i] * -1.0f;
+            }
+            x[i] = position.x;
+            y[i] = position.y;
+            z[i] = position.z;
+        }
+
+        // コライダー1つずつ（グリッドの1組ずつの判定と同じく、中心・半径は仮想関数で取得する）
+        auto start = Clock::now();
+        std::fill(colliderMask.begin(), colliderMask.end(), 0u);
+        for (size_t i = 0; i < count; ++i) {
+            const SphereCollider& collider = *colliders[i];
+            if (NarrowphaseBatch::SphereOBB(box, collider.GetCenter(), collider.GetRadius())) {
+                colliderMask[i / 32] |= 1u << (i % 32);
+            }
+        }
+        AddElapsed(result.colliderSeconds, start);
+
+        start = Clock::now();
+        NarrowphaseBatch::SphereOBBScalar(box, spheres, scalarMask.data());
+        AddElapsed(result.scalarSeconds, start);
+
+        start = Clock::now();
+        result.hits += NarrowphaseBatch::SphereOBB(box, spheres, batchMask.data());
+        AddElapsed(result.batchSeconds, start);
+
+        for (size_t word = 0; word < wordCount; ++word) {
+            const uint32_t differ = (colliderMask[word] ^ scalarMask[word]) | (scalarMask[word] ^ batchMask[word]);
+            result.mismatches += static_cast<uint64_t>(std::popcount(differ));
+        }
+        result.sphereTests += count;
+    }
+    return result;
+}
+
+void SimBulletStress::PrintReport(const Report& report, std::ostream& out) {
+    const double frames = static_cast<double>(report.settings.frameCount);
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "bullets %u  frames %u\n", report.settings.bulletCount, report.settings.frameCount);
+    out << line;
+    if (report.settings.homingTurnRate > 0.0f) {
+        std::snprintf(line, sizeof(line), "soa bullets home on the target at %.2f rad/s\n", report.settings.homingTurnRate);
+        out << line;
+    }
+
+    auto printRun = [&](const char* label, const RunResult& run) {
+        const double bulletFrames = static_cast<double>((std::max)(run.bulletFrames, uint64_t{ 1 }));
+        std::snprintf(line, sizeof(line),
+            "%-8s update %.3f ms/frame (%.1f ns/bullet)  collide %.3f ms/frame (%.1f ns/bullet)  peak %zu  spawned %llu (%llu requests)\n",
+            label,
+            run.updateSeconds * 1.0e3 / frames, run.updateSeconds * 1.0e9 / bulletFrames,
+            run.collideSeconds * 1.0e3 / frames, run.collideSeconds * 1.0e9 / bulletFrames,
+            run.peakActive, static_cast<unsigned long long>(run.spawned), static_cast<unsigned long long>(run.spawnRequests));
+        out << line;
+    };
+    printRun("objects", report.objects);
+    printRun("grid", report.grid);
+    printRun("soa", report.soa);
+    printRun("pattern", report.pattern);
+
+    // 描画用の配列への詰め込みは、カリング前の弾1万発あたりと、実際に詰めた1インスタンスあたりで示す
+    auto printPack = [&](const char* label, const RunResult& run) {
+        const double bulletFrames = static_cast<double>((std::max)(run.bulletFrames, uint64_t{ 1 }));
+        const double packed = static_cast<double>((std::max)(run.packedInstances, uint64_t{ 1 }));
+        std::snprintf(line, sizeof(line),
+            "%-8s pack %.3f ms/frame (%.3f ms per 10k bullets, %.1f ns/instance)  packed %.1f%%\n",
+            label,
+            run.packSeconds * 1.0e3 / frames, run.packSeconds * 1.0e3 * 10000.0 / bulletFrames,
+            run.packSeconds * 1.0e9 / packed, 100.0 * static_cast<double>(run.packedInstances) / bulletFrames);
+        out << line;
+    };
+    printPack("objects", report.objects);
+    printPack("grid", report.grid);
+    printPack("soa", report.soa);
+    printPack("pattern", report.pattern);
+
+    // 総当たりとグリッドで形状を判定した組み合わせの数
+    std::snprintf(line, sizeof(line), "pair tests per frame  objects %.1f  grid %.1f\n",
+        static_cast<double>(report.objects.pairTests) / frames, static_cast<double>(report.grid.pairTests) / frames);
+    out << line;
+
+    // 模様は当たり判定・描画に必要な分だけ位置を計算する（当たり判定と描画の両方で計算した弾は2回数える）
+    std::snprintf(line, sizeof(line), "pattern  evaluated %.1f%% of bullet-frames\n",
+        100.0 * static_cast<double>(report.pattern.evaluatedBullets)
+            / static_cast<double>((std::max)(report.pattern.bulletFrames, uint64_t{ 1 })));
+    out << line;
+
+    // 球とOBBの形状判定（1球あたり）と、3通りの結果の食い違い
+    const NarrowphaseResult& narrow = report.narrowphase;
+    const double sphereTests = static_cast<double>((std::max)(narrow.sphereTests, uint64_t{ 1 }));
+    std::snprintf(line, sizeof(line),
+        "sphere-obb  collider %.2f ns  scalar %.2f ns  batch %.2f ns per sphere  hits %.1f%%  mismatches %llu\n",
+        narrow.colliderSeconds * 1.0e9 / sphereTests, narrow.scalarSeconds * 1.0e9 / sphereTests,
+        narrow.batchSeconds * 1.0e9 / sphereTests, 100.0 * static_cast<double>(narrow.hits) / sphereTests,
+        static_cast<unsigned long long>(narrow.mismatches));
+    out << line;
+
+    std::snprintf(line, sizeof(line), "speedup update %.1fx  collide %.1fx\n",
+        report.soa.updateSeconds > 0.0 ? report.objects.updateSeconds / report.soa.updateSeconds : 0.0,
+        report.soa.collideSeconds > 0.0 ? report.objects.collideSeconds / report.soa.collideSeconds : 0.0);
+    out << line;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+
+/// <summary>
+/// 大量の弾を同時に飛ばし、1発ごとのオブジェクト（ProjectilePool&lt;BossBullet&gt;、CollisionManagerとCollisionGridの両方）と
+/// SoAの弾システム（ProjectileSystem）、弾幕の模様（BulletPatternSystem）の1フレームあたりのコストを比較する
+/// 同じ生成スケジュール（生きている弾が指定数になるまで毎フレーム補充）で両方を実行し、
+/// 移動・削除、プレイヤー1体との当たり判定、インスタンス描画用の配列への詰め込みの時間をそれぞれ計測する
+/// あわせて球とOBBの形状判定を、コライダー1つずつ・配列のスカラー・配列のSSEの3通りで計測し、結果が一致するか確かめる
+/// </summary>
+class SimBulletStress {
+public:
+    /// <summary>
+    /// 設定
+    /// </summary>
+    struct Settings {
+        uint32_t bulletCount = 10000;      // 維持する弾の数
+        uint32_t frameCount = 600;         // 実行フレーム数
+        uint32_t seed = 1;                 // 乱数シード
+        float deltaTime = 1.0f / 60.0f;    // 固定フレーム時間
+        float homingTurnRate = 0.0f;       // SoAの弾をプレイヤー役へ追尾させる旋回速度（ラジアン/秒、0なら直進）
+    };
+
+    /// <summary>
+    /// 1つの実装の計測結果
+    /// </summary>
+    struct RunResult {
+        double updateSeconds = 0.0;        // 移動・削除にかかった実時間（秒）
+        double collideSeconds = 0.0;       // 当たり判定にかかった実時間（秒）
+        double packSeconds = 0.0;          // 描画用の配列への詰め込み（カリング・並べ替えを含む）にかかった実時間（秒）
+        uint64_t packedInstances = 0;      // 各フレームに詰めた数の合計
+        uint64_t bulletFrames = 0;         // 各フレームの生きている弾の数の合計
+        uint64_t spawned = 0;              // 生成した弾の数
+        uint64_t spawnRequests = 0;        // 生成要求の数（模様は1つで1件）
+        uint64_t evaluatedBullets = 0;     // 位置を計算した弾の数の合計（模様のみ）
+        uint64_t pairTests = 0;            // 形状を判定した組み合わせの数の合計（オブジェクトのみ）
+        size_t peakActive = 0;             // 生きている弾の数の最大
+    };
+
+    /// <summary>
+    /// 球とOBBの形状判定の計測結果
+    /// </summary>
+    struct NarrowphaseResult {
+        double colliderSeconds = 0.0;      // コライダー1つずつ（中心・半径を仮想関数で取得）判定した実時間（秒）
+        double scalarSeconds = 0.0;        // 配列をスカラーでまとめて判定した実時間（秒）
+        double batchSeconds = 0.0;         // 配列をSSEでまとめて判定した実時間（秒）
+        uint64_t sphereTests = 0;          // 判定した球の数の合計
+        uint64_t hits = 0;                 // 重なっていた球の数の合計
+        uint64_t mismatches = 0;           // 3通りの結果が食い違った球の数の合計（0でなければ不具合）
+    };
+
+    /// <summary>
+    /// 比較結果
+    /// </summary>
+    struct Report {
+        Settings settings;
+        RunResult objects;                 // 1発ごとのオブジェクト（CollisionManagerで総当たり）
+        RunResult grid;                    // 1発ごとのオブジェクト（CollisionGridで判定）
+        RunResult soa;                     // SoAの弾システム
+        RunResult pattern;                 // 弾幕の模様（全方位の円を1件ずつ生成）
+        NarrowphaseResult narrowphase;     // 球とOBBの形状判定
+    };
+
+    /// <summary>
+    /// 両方の実装で実行して比較する
+    /// 呼び出しスレッドのGlobalVariablesに調整値が読み込まれている必要がある
+    /// </summary>
+    /// <param name="settings">設定</param>
+    /// <returns>比較結果</returns>
+    static Report Run(const Settings& settings);
+
+    /// <summary>
+    /// 比較結果の出力
+    /// </summary>
+    static void PrintReport(const Report& report, std::ostream& out);
+
+private:
+    /// <summary>
+    /// 1発ごとのオブジェクトで実行
+    /// </summary>
+    /// <param name="settings">設定</param>
+    /// <param name="useGrid">コライダーをCollisionGridへ登録して判定するか</param>
+    static RunResult RunObjects(const Settings& settings, bool useGrid);
+
+    /// <summary>
+    /// SoAの弾システムで実行
+    /// </summary>
+    static RunResult RunSoA(const Settings& settings);
+
+    /// <summary>
+    /// 弾幕の模様で実行
+    /// </summary>
+    static RunResult RunPatterns(const Settings& settings);
+
+    /// <summary>
+    /// OBB1つの周りに弾の数だけ球を置き、球とOBBの形状判定を3通りで実行
+    /// </summary>
+    static NarrowphaseResult RunNarrowphase(const Settings& settings);
+};
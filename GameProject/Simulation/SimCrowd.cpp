@@ -0,0 +1,207 @@
+#include "SimCrowd.h"
+#include "../Object/Player/Player.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Boss/BossBehaviorTree/BossAIScheduler.h"
+#include "../Object/Projectile/ProjectileSpawnQueue.h"
+#include "../Collision/CollisionLayerMatrix.h"
+#include "../Collision/CollisionTypeIdDef.h"
+#include "CollisionManager.h"
+#include "EmitterManager.h"
+#include "FrameTimer.h"
+#include "RandomEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <numbers>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    /// <summary>
+    /// ボスを並べる円の半径
+    /// </summary>
+    constexpr float kRingRadius = 30.0f;
+
+    /// <summary>
+    /// フェーズ2に切り替えるボスの開始HP（フェーズ2の閾値以下）
+    /// </summary>
+    constexpr float kPhase2StartHp = 90.0f;
+
+    /// <summary>
+    /// ボス1体あたりの1フレームの弾・模様の生成要求の容量
+    /// </summary>
+    constexpr size_t kSpawnQueueBulletsPerBoss = 16;
+    constexpr size_t kSpawnQueuePatternsPerBoss = 1;
+
+    /// <summary>
+    /// 衝突判定を行うタイプの組み合わせ
+    /// </summary>
+    constexpr CollisionLayerMatrix kCollisionLayers = {
+        { CollisionTypeId::PLAYER, CollisionTypeId::BOSS_ATTACK },
+    };
+
+    /// <summary>
+    /// FNV-1aでハッシュに値を加える
+    /// </summary>
+    template<typename T>
+    void HashValue(uint64_t& hash, const T& value) {
+        unsigned char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        for (unsigned char byte : bytes) {
+            hash ^= byte;
+            hash *= 1099511628211ull;
+        }
+    }
+
+    /// <summary>
+    /// ベクトルをハッシュに加える
+    /// </summary>
+    void HashVector(uint64_t& hash, const Vector3& v) {
+        HashValue(hash, v.x);
+        HashValue(hash, v.y);
+        HashValue(hash, v.z);
+    }
+
+}
+
+SimCrowd::Report SimCrowd::Run(const Settings& settings) {
+    Report report;
+    report.settings = settings;
+    uint32_t threadCount = settings.threadCount != 0 ? settings.threadCount : (std::max)(1u, std::thread::hardware_concurrency());
+
+    report.serial = RunOnce(settings, 1);
+    report.parallel = RunOnce(settings, threadCount);
+    report.deterministic =
+        report.serial.hash == report.parallel.hash &&
+        report.serial.bulletRequests == report.parallel.bulletRequests;
+    return report;
+}
+
+SimCrowd::RunResult SimCrowd::RunOnce(const Settings& settings, uint32_t threadCount) {
+    RunResult result;
+
+    //==================== スレッド内のエンジン状態を初期化 ====================
+    FrameTimer::GetInstance()->SetDeltaTime(settings.deltaTime);
+    RandomEngine::GetInstance()->Seed(settings.seed);
+
+    CollisionManager* collisionManager = CollisionManager::GetInstance();
+    collisionManager->Initialize();
+    for (const CollisionLayerMatrix::TypePair& pair : kCollisionLayers.GetPairs()) {
+        collisionManager->SetCollisionMask(pair.typeA, pair.typeB, true);
+    }
+
+    EmitterManager emitterManager;
+    emitterManager.LoadPreset("boss_attack_sign", "boss_melee_attack_sign");
+    emitterManager.SetEmitterActive("boss_melee_attack_sign", false);
+
+    //==================== オブジェクトの生成 ====================
+    // プレイヤーは中央で動かない的にする
+    auto player = std::make_unique<Player>();
+    player->Initialize();
+
+    // 全てのボスで1つの生成キューを共有する（コマンドはボスの順に適用されるので、並列でも中身の順は変わらない）
+    ProjectileSpawnQueue spawnQueue;
+    spawnQueue.Initialize(settings.bossCount * kSpawnQueueBulletsPerBoss, settings.bossCount * kSpawnQueuePatternsPerBoss);
+
+    std::vector<std::unique_ptr<Boss>> bosses;
+    std::vector<Boss*> bossPointers;
+    bosses.reserve(settings.bossCount);
+    bossPointers.reserve(settings.bossCount);
+    for (uint32_t i = 0; i < settings.bossCount; ++i) {
+        auto boss = std::make_unique<Boss>();
+        boss->Initialize();
+        boss->SetPlayer(player.get());
+        boss->SetEmitterManager(&emitterManager);
+        boss->SetSpawnQueue(&spawnQueue);
+        boss->SetIsPause(false);
+
+        // 円周上に並べる
+        Transform transform = boss->GetTransform();
+        float angle = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / static_cast<float>(settings.bossCount);
+        transform.translate.x = std::cos(angle) * kRingRadius;
+        transform.translate.z = std::sin(angle) * kRingRadius;
+        boss->SetTransform(transform);
+
+        // 半数はフェーズ2から始める（閾値を下回った状態で被弾するとフェーズが切り替わる）
+        if (i % 2 == 1) {
+            boss->SetHp(kPhase2StartHp);
+            boss->UpdateBeforeAI();
+            boss->OnHit(0.0f);
+        }
+
+        bossPointers.push_back(boss.get());
+        bosses.push_back(std::move(boss));
+    }
+
+    //==================== メインループ ====================
+    BossAIScheduler scheduler(threadCount);
+    result.threadCount = scheduler.GetThreadCount();
+
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t frame = 0; frame < settings.frameCount; ++frame) {
+        const auto start = std::chrono::steady_clock::now();
+        scheduler.Update(bossPointers, settings.deltaTime);
+        result.aiSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (Boss* boss : bossPointers) {
+            HashVector(hash, boss->GetTransform().translate);
+            HashVector(hash, boss->GetTransform().rotate);
+        }
+        for (const ProjectileSpawnCommand& command : spawnQueue.GetBullets()) {
+            HashVector(hash, command.position);
+            HashVector(hash, command.velocity);
+            ++result.bulletRequests;
+        }
+        for (const BulletPattern& pattern : spawnQueue.GetPatterns()) {
+            HashVector(hash, pattern.origin);
+            ++result.bulletRequests;
+        }
+        spawnQueue.Clear();
+
+        emitterManager.Update();
+        collisionManager->CheckAllCollisions();
+    }
+    result.hash = hash;
+
+    for (Boss* boss : bossPointers) {
+        if (boss->GetPhase() == 2) {
+            ++result.phase2Bosses;
+        }
+    }
+
+    //==================== 後始末 ====================
+    for (auto& boss : bosses) {
+        boss->Finalize();
+    }
+    player->Finalize();
+    collisionManager->Reset();
+    return result;
+}
+
+void SimCrowd::PrintReport(const Report& report, std::ostream& out) {
+    const double agentTicks = static_cast<double>(report.settings.bossCount) * report.settings.frameCount;
+    char line[256];
+
+    std::snprintf(line, sizeof(line), "crowd  bosses %u  frames %u  (phase2 %u)\n",
+        report.settings.bossCount, report.settings.frameCount, report.serial.phase2Bosses);
+    out << line;
+
+    for (const RunResult* run : { &report.serial, &report.parallel }) {
+        std::snprintf(line, sizeof(line), "threads %2u  AI %.3fs  %.0f agent-ticks/s  bullets %llu  hash %016llx\n",
+            run->threadCount, run->aiSeconds,
+            run->aiSeconds > 0.0 ? agentTicks / run->aiSeconds : 0.0,
+            static_cast<unsigned long long>(run->bulletRequests),
+            static_cast<unsigned long long>(run->hash));
+        out << line;
+    }
+
+    std::snprintf(line, sizeof(line), "speedup %.2fx  deterministic %s\n",
+        report.parallel.aiSeconds > 0.0 ? report.serial.aiSeconds / report.parallel.aiSeconds : 0.0,
+        report.deterministic ? "yes" : "NO");
+    out << line;
+}
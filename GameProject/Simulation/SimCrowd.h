@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <iosfwd>
+
+/// <summary>
+/// 多数のボスを1体のプレイヤーに向けて同時に動かし、BossAISchedulerの並列更新を検証する
+/// 同じシードで1スレッドと指定スレッド数の2回を実行し、毎フレームのボスの状態のハッシュが一致するかと
+/// AI更新のスループットを比較する（弾の移動や衝突判定は行わず、AIの更新だけを計測する）
+/// </summary>
+class SimCrowd {
+public:
+    /// <summary>
+    /// 設定
+    /// </summary>
+    struct Settings {
+        uint32_t bossCount = 256;          // ボスの数
+        uint32_t frameCount = 600;         // 実行フレーム数
+        uint32_t threadCount = 0;          // 比較するスレッド数（0ならハードウェアスレッド数）
+        uint32_t seed = 1;                 // 乱数シード
+        float deltaTime = 1.0f / 60.0f;    // 固定フレーム時間
+    };
+
+    /// <summary>
+    /// 1回分の実行結果
+    /// </summary>
+    struct RunResult {
+        uint32_t threadCount = 0;          // スレッド数
+        uint64_t hash = 0;                 // 全フレームのボスの状態のハッシュ
+        uint64_t bulletRequests = 0;       // 弾の生成要求の数
+        uint32_t phase2Bosses = 0;         // フェーズ2のボスの数
+        double aiSeconds = 0.0;            // AI更新にかかった実時間（秒）
+    };
+
+    /// <summary>
+    /// 比較結果
+    /// </summary>
+    struct Report {
+        Settings settings;
+        RunResult serial;                  // 1スレッド
+        RunResult parallel;                // 指定スレッド数
+        bool deterministic = false;        // 2回の結果が一致したか
+    };
+
+    /// <summary>
+    /// 1スレッドと指定スレッド数で実行して比較する
+    /// 呼び出しスレッドのGlobalVariablesに調整値が読み込まれている必要がある
+    /// </summary>
+    /// <param name="settings">設定</param>
+    /// <returns>比較結果</returns>
+    static Report Run(const Settings& settings);
+
+    /// <summary>
+    /// 比較結果の出力
+    /// </summary>
+    static void PrintReport(const Report& report, std::ostream& out);
+
+private:
+    /// <summary>
+    /// 指定スレッド数で1回実行
+    /// </summary>
+    static RunResult RunOnce(const Settings& settings, uint32_t threadCount);
+};
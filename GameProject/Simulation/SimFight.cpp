@@ -0,0 +1,285 @@
+#include "SimFight.h"
+#include "../Object/Player/Player.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Boss/BossBehaviorTree/BossBehaviorTree.h"
+#include "../Object/Projectile/BossBullet.h"
+#include "../Object/Projectile/BulletPatternSystem.h"
+#include "../Object/Projectile/PlayerBullet.h"
+#include "../Object/Projectile/ProjectilePool.h"
+#include "../Object/Projectile/ProjectileSpawnQueue.h"
+#include "../Object/Projectile/ProjectileSystem.h"
+#include "../Collision/BossMeleeAttackCollider.h"
+#include "../Collision/CollisionGrid.h"
+#include "../Collision/CollisionTypeIdDef.h"
+#include "../Collision/HitEventQueue.h"
+#include "../Collision/MeleeAttackCollider.h"
+#include "../Common/GameConst.h"
+#include "../Input/InputHandler.h"
+#include "Camera.h"
+#include "CollisionManager.h"
+#include "EmitterManager.h"
+#include "FrameTimer.h"
+#include "OBBCollider.h"
+#include "GlobalVariables.h"
+#include "Input.h"
+#include "PostEffectManager.h"
+#include "RandomEngine.h"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace {
+
+    /// <summary>
+    /// フェーズ2の戦闘エリアの半径（GameScene::battleAreaSize_と同じ）
+    /// </summary>
+    constexpr float kBattleAreaSize = 20.0f;
+
+    /// <summary>
+    /// 弾プール・エミッタープールの容量（GameSceneと同じ）
+    /// </summary>
+    constexpr size_t kBossBulletPoolCapacity = 256;
+    constexpr size_t kPlayerBulletPoolCapacity = 64;
+    constexpr size_t kBossExplodeEmitterCapacity = 64;
+    constexpr size_t kPlayerExplodeEmitterCapacity = 32;
+    constexpr size_t kDanmakuBulletCapacity = 10240;
+    constexpr size_t kPatternBulletCapacity = 8192;
+    constexpr size_t kSpawnQueueBulletCapacity = 1024;
+    constexpr size_t kSpawnQueuePatternCapacity = 64;
+    constexpr size_t kHitEventCapacity = kBossBulletPoolCapacity + kPlayerBulletPoolCapacity + 4;
+    constexpr float kCollisionGridCellSize = 8.0f;
+    constexpr CollisionLayerMatrix kCollisionLayers = {
+        { CollisionTypeId::PLAYER_ATTACK, CollisionTypeId::BOSS },
+        { CollisionTypeId::PLAYER, CollisionTypeId::BOSS_ATTACK },
+    };
+
+}
+
+SimFightResult SimFight::Run(const SimFightSettings& settings) {
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    SimFightResult result;
+    result.seed = settings.seed;
+
+    //==================== スレッド内のエンジン状態を初期化 ====================
+    FrameTimer::GetInstance()->SetDeltaTime(settings.deltaTime);
+    RandomEngine::GetInstance()->Seed(settings.seed);
+    PostEffectManager::GetInstance()->ClearChain();
+    Input* input = Input::GetInstance();
+    input->Clear();
+
+    CollisionManager* collisionManager = CollisionManager::GetInstance();
+    collisionManager->Initialize();
+    for (const CollisionLayerMatrix::TypePair& pair : kCollisionLayers.GetPairs()) {
+        collisionManager->SetCollisionMask(pair.typeA, pair.typeB, true);
+    }
+
+    // 弾と本体の判定はグリッドで行う（GameScene::Initializeと同じ）
+    CollisionGrid collisionGrid;
+    collisionGrid.Initialize(
+        Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+        Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax),
+        kCollisionGridCellSize);
+    collisionGrid.SetLayerMatrix(kCollisionLayers);
+
+    //==================== オブジェクトの生成（GameScene::Initializeと同じ順） ====================
+    EmitterManager emitterManager;
+    emitterManager.LoadPreset("boss_attack_sign", "boss_melee_attack_sign");
+    emitterManager.SetEmitterActive("boss_melee_attack_sign", false);
+
+    // 照準・移動の基準（ゲームのトップダウンカメラと同じく正面向き）
+    Camera camera;
+
+    InputHandler inputHandler;
+    inputHandler.Initialize();
+
+    ProjectileSpawnQueue spawnQueue;
+    spawnQueue.Initialize(kSpawnQueueBulletCapacity, kSpawnQueuePatternCapacity);
+
+    auto player = std::make_unique<Player>();
+    player->Initialize();
+    player->SetCamera(&camera);
+    player->SetInputHandler(&inputHandler);
+
+    auto boss = std::make_unique<Boss>();
+    boss->Initialize();
+    boss->SetPlayer(player.get());
+    boss->SetEmitterManager(&emitterManager);
+    player->SetBoss(boss.get());
+    boss->SetSpawnQueue(&spawnQueue);
+    player->SetSpawnQueue(&spawnQueue);
+
+    // ヒットは判定の後にまとめて適用する（GameSceneと同じ）
+    HitEventQueue hitEvents;
+    hitEvents.Initialize(kHitEventCapacity);
+    player->GetMeleeAttackCollider()->SetHitEventQueue(&hitEvents);
+    boss->GetMeleeAttackCollider()->SetHitEventQueue(&hitEvents);
+    collisionGrid.Insert(player->GetCollider());
+    player->SetCollisionGrid(&collisionGrid);
+    collisionGrid.Insert(boss->GetCollider());
+    collisionGrid.InsertQueryOnly(boss->GetMeleeAttackCollider());
+
+    // 開始演出は無いので最初から動かす
+    boss->SetIsPause(false);
+
+    BossBehaviorTree* behaviorTree = boss->GetBehaviorTree();
+    if (behaviorTree && settings.profileTree) {
+        behaviorTree->SetProfiling(true);
+    }
+
+    SimPlayerBot bot(settings.seed, settings.bot);
+    ProjectileEffects bossBulletEffects;
+    ProjectileEffects playerBulletEffects;
+    bossBulletEffects.trail.Initialize(&emitterManager, "boss_bullet", kBossBulletPoolCapacity);
+    bossBulletEffects.explode.Initialize(&emitterManager, "boss_bullet_explode", kBossExplodeEmitterCapacity);
+    playerBulletEffects.trail.Initialize(&emitterManager, "player_bullet", kPlayerBulletPoolCapacity);
+    playerBulletEffects.explode.Initialize(&emitterManager, "player_bullet_explode", kPlayerExplodeEmitterCapacity);
+    ProjectilePool<BossBullet> bossBullets;
+    ProjectilePool<PlayerBullet> playerBullets;
+    bossBullets.Initialize(kBossBulletPoolCapacity,
+        [&]() { return std::make_unique<BossBullet>(&bossBulletEffects, &collisionGrid, &hitEvents); });
+    playerBullets.Initialize(kPlayerBulletPoolCapacity,
+        [&]() { return std::make_unique<PlayerBullet>(&playerBulletEffects, &collisionGrid, &hitEvents); });
+    ProjectileSystem danmakuBullets;
+    danmakuBullets.Initialize(kDanmakuBulletCapacity);
+    danmakuBullets.SetBounds(
+        Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+        Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax));
+    BulletPatternSystem bulletPatterns;
+    bulletPatterns.Initialize(kPatternBulletCapacity);
+    player->SetDanmakuSystems(&danmakuBullets, &bulletPatterns);
+
+    // 弾幕用の弾システムを使う場合のパラメータ（GameScene::SpawnProjectilesと同じ）
+    GlobalVariables* gv = GlobalVariables::GetInstance();
+    const bool batchedBossBullets = gv->GetValueBool("BossBullet", "Batched");
+    ProjectileSpawnParams danmakuParams;
+    danmakuParams.lifetime = gv->GetValueFloat("BossBullet", "Lifetime");
+    danmakuParams.damage = gv->GetValueFloat("BossBullet", "Damage");
+    danmakuParams.radius = gv->GetValueFloat("BossBullet", "ColliderRadius");
+    const float playerRadius = gv->GetValueFloat("Player", "BodyColliderSize") * 0.5f;
+    const bool sweptDanmaku = gv->GetValueBool("BossBullet", "SweptCollision");
+
+    const float startHp = player->GetHp();
+    const uint64_t maxFrames = static_cast<uint64_t>(settings.maxDuration / settings.deltaTime);
+
+    //==================== メインループ ====================
+    for (; result.frames < maxFrames; ++result.frames) {
+        if (boss->IsDead() || player->IsDead()) {
+            break;
+        }
+
+        // 入力（ボット → InputHandler）
+        input->Update();
+        bot.Update(*player, *boss, bossBullets, danmakuBullets, input, settings.deltaTime);
+        inputHandler.Update();
+
+        // フェーズに応じた移動制限（GameScene::UpdateCameraModeと同じ）
+        if (boss->GetPhase() == 2) {
+            player->SetMode(true);
+            player->SetDynamicBoundsFromCenter(boss->GetTransform().translate, kBattleAreaSize, kBattleAreaSize);
+            if (result.phase2Time < 0.0f) {
+                result.phase2Time = static_cast<float>(result.frames) * settings.deltaTime;
+            }
+        }
+        else {
+            player->SetMode(false);
+            player->ClearDynamicBounds();
+        }
+
+        player->Update();
+        boss->Update(settings.deltaTime);
+
+        // 弾の生成
+        for (const BulletPattern& pattern : spawnQueue.GetPatterns()) {
+            if (bulletPatterns.Spawn(pattern, danmakuParams.lifetime, danmakuParams.damage, danmakuParams.radius)) {
+                result.bossBulletCount += pattern.bulletCount;
+            }
+        }
+        for (const ProjectileSpawnCommand& command : spawnQueue.GetBullets()) {
+            if (command.owner == ProjectileOwner::Player) {
+                playerBullets.Spawn(command.position, command.velocity);
+                ++result.playerBulletCount;
+                continue;
+            }
+            if (batchedBossBullets || command.turnRate > 0.0f) {
+                danmakuParams.position = command.position;
+                danmakuParams.velocity = command.velocity;
+                danmakuParams.turnRate = command.turnRate;
+                danmakuBullets.Spawn(danmakuParams);
+            }
+            else {
+                bossBullets.Spawn(command.position, command.velocity);
+            }
+            ++result.bossBulletCount;
+        }
+        spawnQueue.Clear();
+
+        bossBullets.Update(settings.deltaTime);
+        playerBullets.Update(settings.deltaTime);
+        bossBulletEffects.Update(settings.deltaTime);
+        playerBulletEffects.Update(settings.deltaTime);
+        bossBullets.ForEachActive([&](BossBullet& bullet) { bullet.SweepCollision(player->GetCollider()); });
+        playerBullets.ForEachActive([&](PlayerBullet& bullet) { bullet.SweepCollision(boss->GetCollider()); });
+        danmakuBullets.SetHomingTarget(player->GetTranslate());
+        danmakuBullets.Update(settings.deltaTime);
+        HitEvent danmakuHit;
+        danmakuHit.victim = player->GetCollider();
+        danmakuHit.point = player->GetTranslate();
+        danmakuHit.source = HitSource::Danmaku;
+        const float sweepTime = sweptDanmaku ? settings.deltaTime : 0.0f;
+        if (danmakuBullets.CollideSphere(player->GetTranslate(), playerRadius, &danmakuHit.damage, sweepTime) > 0) {
+            hitEvents.Push(danmakuHit);
+        }
+        bulletPatterns.Update(settings.deltaTime);
+        if (bulletPatterns.CollideSphere(player->GetTranslate(), playerRadius, &danmakuHit.damage, sweepTime) > 0) {
+            hitEvents.Push(danmakuHit);
+        }
+        result.peakProjectiles = (std::max)(result.peakProjectiles,
+            bossBullets.GetActiveCount() + playerBullets.GetActiveCount() + danmakuBullets.GetActiveCount()
+            + bulletPatterns.GetStats().activeCount);
+
+        emitterManager.Update();
+        collisionGrid.CheckAllCollisions();
+        collisionManager->CheckAllCollisions();
+        hitEvents.Resolve();
+    }
+
+    //==================== 結果 ====================
+    result.playerWon = boss->IsDead();
+    result.timedOut = !boss->IsDead() && !player->IsDead();
+    result.duration = static_cast<float>(result.frames) * settings.deltaTime;
+    result.damageTaken = startHp - player->GetHp();
+    result.bossHpLeft = boss->GetHp();
+    result.peakEmitters = emitterManager.GetStats().peakEmitterCount;
+    result.collisionTests = collisionManager->GetStats().pairTests + collisionGrid.GetStats().totalTestedPairs;
+
+    if (const BTProfiler* profiler = behaviorTree ? behaviorTree->GetProfiler() : nullptr) {
+        result.nodes.resize(profiler->GetNodeCount());
+        for (size_t i = 0; i < result.nodes.size(); ++i) {
+            const BTProfiler::NodeStats& stats = profiler->GetStats(static_cast<uint16_t>(i));
+            SimNodeUsage& usage = result.nodes[i];
+            usage.name = profiler->GetNodeName(static_cast<uint16_t>(i));
+            usage.callCount = stats.callCount;
+            usage.successCount = stats.successCount;
+            usage.failureCount = stats.failureCount;
+            usage.runningCount = stats.runningCount;
+            usage.inclusiveNs = profiler->TicksToNanoseconds(stats.inclusiveTicks);
+        }
+    }
+
+    result.poolOverflows = bossBullets.GetStats().overflowCount + playerBullets.GetStats().overflowCount
+        + danmakuBullets.GetStats().overflowCount + bulletPatterns.GetStats().overflowCount;
+
+    // コライダーを外してから破棄する（GameScene::Finalizeと同じ）
+    bossBullets.Finalize();
+    playerBullets.Finalize();
+    bossBulletEffects.Finalize();
+    playerBulletEffects.Finalize();
+    boss->Finalize();
+    player->Finalize();
+    collisionManager->Reset();
+
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    return result;
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "SimPlayerBot.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// <summary>
+/// 1戦分のシミュレーション設定
+/// </summary>
+struct SimFightSettings {
+    uint32_t seed = 1;                 // 乱数シード（ボスAI・弾・ボットの全てに使う）
+    float deltaTime = 1.0f / 60.0f;    // 固定フレーム時間（プレイヤー移動はフレーム単位なのでゲームと同じ60Hz）
+    float maxDuration = 300.0f;        // 打ち切り時間（秒）
+    bool profileTree = true;           // ノードごとの使用回数・コストを集計するか
+    SimPlayerBot::Settings bot;        // ボットの傾向
+};
+
+/// <summary>
+/// ビヘイビアツリーのノード1つ分の使用状況
+/// </summary>
+struct SimNodeUsage {
+    std::string name;            // ノード名
+    uint64_t callCount = 0;      // 実行回数
+    uint64_t successCount = 0;   // 成功回数
+    uint64_t failureCount = 0;   // 失敗回数
+    uint64_t runningCount = 0;   // 実行中回数
+    double inclusiveNs = 0.0;    // 包括時間の合計（ナノ秒）
+};
+
+/// <summary>
+/// 1戦分の結果
+/// </summary>
+struct SimFightResult {
+    uint32_t seed = 0;
+    bool playerWon = false;          // ボスを倒した
+    bool timedOut = false;           // 打ち切り
+    float duration = 0.0f;           // 決着（または打ち切り）までのシミュレーション時間（秒）
+    float damageTaken = 0.0f;        // プレイヤーが受けたダメージ
+    float bossHpLeft = 0.0f;         // 終了時のボスHP
+    float phase2Time = -1.0f;        // フェーズ2に入った時刻（入らなければ負）
+    uint64_t frames = 0;             // 実行フレーム数
+    uint32_t bossBulletCount = 0;    // ボスが撃った弾数
+    uint32_t playerBulletCount = 0;  // プレイヤーが撃った弾数
+    size_t peakProjectiles = 0;      // 同時に存在した弾の最大数
+    size_t peakEmitters = 0;         // 同時に存在したエミッターの最大数
+    uint64_t poolOverflows = 0;      // 弾プールの容量不足で生成できなかった弾の数
+    uint64_t collisionTests = 0;     // 形状判定を行った組み合わせ数
+    double wallSeconds = 0.0;        // 実行にかかった実時間（秒）
+    std::vector<SimNodeUsage> nodes; // ノードごとの使用状況（コンパイル済みツリーのノード順）
+};
+
+/// <summary>
+/// ボス戦1回分のヘッドレスシミュレーション
+/// GameSceneの更新順（入力 → プレイヤー → ボス → 弾生成 → 弾更新 → 衝突判定）を描画なしで再現する
+/// エンジンのシングルトンはスレッドごとに独立しているため、別スレッドで同時に実行できる
+/// </summary>
+class SimFight {
+public:
+    /// <summary>
+    /// 1戦を決着まで実行
+    /// 呼び出しスレッドのGlobalVariablesに調整値が読み込まれている必要がある
+    /// </summary>
+    /// <param name="settings">設定</param>
+    /// <returns>結果</returns>
+    static SimFightResult Run(const SimFightSettings& settings);
+};
@@ -0,0 +1,143 @@
+#include "SimBatchRunner.h"
+#include "SimBulletStress.h"
+#include "SimCrowd.h"
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#ifndef SIM_DEFAULT_ROOT
+#define SIM_DEFAULT_ROOT "."
+#endif
+
+namespace {
+
+    /// <summary>
+    /// 使い方の表示
+    /// </summary>
+    void PrintUsage() {
+        std::cout <<
+            "usage: BossFightSim [options]\n"
+            "  --fights N        number of fights (default 1000)\n"
+            "  --seed S          seed of the first fight (default 1)\n"
+            "  --threads T       worker threads (default: all hardware threads)\n"
+            "  --max-time SEC    simulated time limit per fight (default 300)\n"
+            "  --root DIR        directory containing resources/ (default: GameProject)\n"
+            "  --set G.K=V       override a GlobalVariables item (repeatable)\n"
+            "  --csv PATH        write per-fight results as CSV\n"
+            "  --no-profile      disable per-node profiling\n"
+            "  --crowd N         tick N bosses at once with 1 and T threads instead of fights\n"
+            "  --crowd-frames F  frames to run in crowd mode (default 600)\n"
+            "  --bullets N       keep N bullets alive and compare per-object and SoA projectiles\n"
+            "                    (also checks the batched sphere-OBB kernel against the scalar path)\n"
+            "  --bullet-frames F frames to run in bullet mode (default 600)\n"
+            "  --bullet-homing R make SoA bullets home on the target at R rad/s in bullet mode\n";
+    }
+
+}
+
+int main(int argc, char** argv) {
+    SimBatchRunner::Settings settings;
+    std::string root = SIM_DEFAULT_ROOT;
+    std::string csvPath;
+    SimCrowd::Settings crowdSettings;
+    bool crowdMode = false;
+    SimBulletStress::Settings bulletSettings;
+    bool bulletMode = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        auto next = [&]() -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "missing value for " << arg << '\n';
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--fights") {
+            settings.fightCount = static_cast<uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--seed") {
+            settings.baseSeed = static_cast<uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--threads") {
+            settings.threadCount = static_cast<uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--max-time") {
+            settings.fight.maxDuration = std::stof(next());
+        }
+        else if (arg == "--root") {
+            root = next();
+        }
+        else if (arg == "--set") {
+            settings.overrides.emplace_back(next());
+        }
+        else if (arg == "--csv") {
+            csvPath = next();
+        }
+        else if (arg == "--no-profile") {
+            settings.fight.profileTree = false;
+        }
+        else if (arg == "--crowd") {
+            crowdSettings.bossCount = static_cast<uint32_t>(std::stoul(next()));
+            crowdMode = true;
+        }
+        else if (arg == "--crowd-frames") {
+            crowdSettings.frameCount = static_cast<uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--bullets") {
+            bulletSettings.bulletCount = static_cast<uint32_t>(std::stoul(next()));
+            bulletMode = true;
+        }
+        else if (arg == "--bullet-frames") {
+            bulletSettings.frameCount = static_cast<uint32_t>(std::stoul(next()));
+        }
+        else if (arg == "--bullet-homing") {
+            bulletSettings.homingTurnRate = std::stof(next());
+        }
+        else {
+            PrintUsage();
+            return arg == "--help" || arg == "-h" ? 0 : 2;
+        }
+    }
+
+    // 出力先は起動時のディレクトリ基準、リソースはゲームと同じく resources/ からの相対パスで読み込む
+    if (!csvPath.empty()) {
+        csvPath = std::filesystem::absolute(csvPath).string();
+    }
+    std::error_code ec;
+    std::filesystem::current_path(root, ec);
+    if (ec) {
+        std::cerr << "cannot enter " << root << ": " << ec.message() << '\n';
+        return 1;
+    }
+
+    // 群衆モード：AIの並列更新の検証
+    if (crowdMode) {
+        crowdSettings.threadCount = settings.threadCount;
+        crowdSettings.seed = settings.baseSeed;
+        SimBatchRunner::LoadGlobalVariables(settings.overrides);
+        SimCrowd::Report crowdReport = SimCrowd::Run(crowdSettings);
+        SimCrowd::PrintReport(crowdReport, std::cout);
+        return crowdReport.deterministic ? 0 : 1;
+    }
+
+    // 弾の負荷モード：1発ごとのオブジェクトとSoAの弾システムの比較
+    if (bulletMode) {
+        bulletSettings.seed = settings.baseSeed;
+        SimBatchRunner::LoadGlobalVariables(settings.overrides);
+        SimBulletStress::Report bulletReport = SimBulletStress::Run(bulletSettings);
+        SimBulletStress::PrintReport(bulletReport, std::cout);
+        return bulletReport.narrowphase.mismatches == 0 ? 0 : 1;
+    }
+
+    SimBatchRunner::Report report = SimBatchRunner::Run(settings);
+    SimBatchRunner::PrintReport(report, std::cout);
+
+    if (!csvPath.empty() && !SimBatchRunner::ExportFightsCSV(report, csvPath)) {
+        std::cerr << "failed to write " << csvPath << '\n';
+        return 1;
+    }
+    return 0;
+}
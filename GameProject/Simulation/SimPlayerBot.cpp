@@ -0,0 +1,134 @@
+#include "SimPlayerBot.h"
+#include "Input.h"
+#include "GlobalVariables.h"
+#include "../Object/Player/Player.h"
+#include "../Object/Boss/Boss.h"
+#include "../Object/Projectile/BossBullet.h"
+#include "../Collision/BossMeleeAttackCollider.h"
+#include "../Collision/BossBulletCollider.h"
+#include <algorithm>
+#include <cmath>
+
+SimPlayerBot::SimPlayerBot(uint32_t seed, const Settings& settings)
+    : settings_(settings)
+    , random_(seed ^ 0x9e3779b9u) {
+}
+
+void SimPlayerBot::Update(const Player& player, const Boss& boss,
+    const ProjectilePool<BossBullet>& bossBullets, const ProjectileSystem& danmakuBullets,
+    Input* input, float deltaTime) {
+    input->SetLeftStick({});
+    input->SetRightStick({});
+    input->SetKey(DIK_SPACE, false);
+
+    dashCooldownTimer_ = (std::max)(dashCooldownTimer_ - deltaTime, 0.0f);
+
+    Vector3 playerPos = player.GetTranslate();
+    Vector3 toBoss = boss.GetTranslate() - playerPos;
+    toBoss.y = 0.0f;
+    float distance = toBoss.Length();
+    Vector2 towardBoss = (distance > 0.01f) ? Vector2(toBoss.x, toBoss.z) / distance : Vector2(0.0f, 1.0f);
+
+    //==================== 回避 ====================
+    float playerRadius = GlobalVariables::GetInstance()->GetValueFloat("Player", "BodyColliderSize") * 0.5f;
+
+    Vector2 escape;
+    bool threatened = FindBulletThreat(playerPos, playerRadius, bossBullets, danmakuBullets, escape);
+
+    // 近接攻撃の予兆中に近くにいれば離れる
+    const BossMeleeAttackCollider* bossMelee = boss.GetMeleeAttackCollider();
+    bool meleeThreat = (boss.IsMeleeAttackBlockVisible() || (bossMelee && bossMelee->IsActive()))
+        && distance < settings_.bossMeleeThreatRange;
+    if (!threatened && meleeThreat) {
+        threatened = true;
+        escape = -towardBoss;
+    }
+
+    if (threatened) {
+        if (threatTimer_ < 0.0f) {
+            // 新しい脅威：回避するかどうかをここで一度だけ決める
+            threatTimer_ = 0.0f;
+            willDodge_ = Roll(settings_.dodgeChance);
+        }
+        threatTimer_ += deltaTime;
+    }
+    else {
+        threatTimer_ = -1.0f;
+    }
+
+    if (threatened && willDodge_ && threatTimer_ >= settings_.reactionTime && dashCooldownTimer_ <= 0.0f) {
+        input->SetLeftStick(escape);
+        input->SetKey(DIK_SPACE, true);
+        input->SetKey(DIK_Z, false);
+        attackPressed_ = false;
+        dashCooldownTimer_ = settings_.dashCooldown;
+        threatTimer_ = -1.0f;
+        return;
+    }
+
+    //==================== 攻撃 ====================
+    if (distance <= settings_.meleeRange) {
+        // 攻撃はトリガー入力なので1フレームおきに押してコンボをつなぐ
+        attackPressed_ = !attackPressed_;
+        input->SetKey(DIK_Z, attackPressed_);
+        input->SetLeftStick(towardBoss);
+        return;
+    }
+
+    input->SetKey(DIK_Z, false);
+    attackPressed_ = false;
+
+    // 近づきながら、射撃できる間は撃つ
+    input->SetLeftStick(towardBoss);
+    if (player.CanShoot() && distance <= settings_.shootRange) {
+        input->SetRightStick(towardBoss);
+    }
+}
+
+bool SimPlayerBot::FindBulletThreat(const Vector3& playerPos, float playerRadius,
+    const ProjectilePool<BossBullet>& bossBullets, const ProjectileSystem& danmakuBullets, Vector2& outEscape) {
+    float closestTime = settings_.threatLookAhead;
+    bool found = false;
+
+    auto consider = [&](const Vector3& position, const Vector3& velocity, float radius) {
+        Vector3 relative = playerPos - position;
+        relative.y = 0.0f;
+        Vector3 planarVelocity(velocity.x, 0.0f, velocity.z);
+
+        // 最接近時刻と最接近距離
+        float speedSq = planarVelocity.Dot(planarVelocity);
+        if (speedSq < 1.0e-6f) {
+            return;
+        }
+        float time = relative.Dot(planarVelocity) / speedSq;
+        if (time < 0.0f || time > closestTime) {
+            return;
+        }
+
+        Vector3 miss = relative - planarVelocity * time;
+        float hitRadius = playerRadius + radius + settings_.threatMargin;
+        if (miss.Length() > hitRadius) {
+            return;
+        }
+
+        // 弾の進行方向と垂直、かつ今ずれている側へ逃げる
+        Vector2 side(-planarVelocity.z, planarVelocity.x);
+        side = side.Normalize();
+        if (side.x * miss.x + side.y * miss.z < 0.0f) {
+            side = -side;
+        }
+        outEscape = side;
+        closestTime = time;
+        found = true;
+    };
+
+    bossBullets.ForEachActive([&](const BossBullet& bullet) {
+        if (bullet.IsActive()) {
+            consider(bullet.GetTransform().translate, bullet.GetVelocity(), bullet.GetCollider()->GetRadius());
+        }
+    });
+    for (size_t i = 0; i < danmakuBullets.GetActiveCount(); ++i) {
+        consider(danmakuBullets.GetPosition(i), danmakuBullets.GetVelocity(i), danmakuBullets.GetRadius(i));
+    }
+    return found;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector3.h"
+#include "../Object/Projectile/ProjectilePool.h"
+#include "../Object/Projectile/ProjectileSystem.h"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+class Player;
+class Boss;
+class BossBullet;
+class Input;
+
+/// <summary>
+/// シミュレーション用のプレイヤー操作ボット
+/// 入力（Input）にスティックとキーを書き込むだけで、移動・攻撃・回避はゲーム本体の
+/// InputHandler → PlayerStateMachine をそのまま通す
+/// 判断に使う乱数は戦闘のシードから作るため、同じシードなら同じ操作になる
+/// </summary>
+class SimPlayerBot {
+public:
+    /// <summary>
+    /// 操作の傾向
+    /// </summary>
+    struct Settings {
+        float meleeRange = 14.0f;        // 近接攻撃を始める距離
+        float shootRange = 60.0f;        // フェーズ1で射撃を始める距離
+        float dodgeChance = 0.7f;        // 弾に気づいたときに回避する確率
+        float reactionTime = 0.12f;      // 脅威を認識してから回避するまでの時間（秒）
+        float dashCooldown = 0.35f;      // 連続回避の最短間隔（秒）
+        float threatLookAhead = 0.45f;   // 弾の軌道を先読みする時間（秒）
+        float threatMargin = 2.5f;       // 当たり判定に加える回避の余裕
+        float bossMeleeThreatRange = 12.0f; // ボスの近接攻撃から逃げ始める距離
+    };
+
+    SimPlayerBot(uint32_t seed, const Settings& settings);
+
+    /// <summary>
+    /// 状況を見て今フレームの入力を書き込む
+    /// </summary>
+    /// <param name="player">操作するプレイヤー</param>
+    /// <param name="boss">相手のボス</param>
+    /// <param name="bossBullets">飛んでいるボスの弾</param>
+    /// <param name="danmakuBullets">飛んでいる弾幕用の弾</param>
+    /// <param name="input">書き込み先</param>
+    /// <param name="deltaTime">フレーム時間</param>
+    void Update(const Player& player, const Boss& boss,
+        const ProjectilePool<BossBullet>& bossBullets, const ProjectileSystem& danmakuBullets,
+        Input* input, float deltaTime);
+
+private:
+    /// <summary>
+    /// 最も危険な弾から離れる方向を求める
+    /// </summary>
+    /// <returns>脅威があればtrue</returns>
+    bool FindBulletThreat(const Vector3& playerPos, float playerRadius,
+        const ProjectilePool<BossBullet>& bossBullets, const ProjectileSystem& danmakuBullets, Vector2& outEscape);
+
+    /// <summary>
+    /// 確率判定
+    /// </summary>
+    bool Roll(float chance) { return std::uniform_real_distribution<float>(0.0f, 1.0f)(random_) < chance; }
+
+    Settings settings_;
+    std::mt19937 random_;
+
+    float threatTimer_ = -1.0f;   // 脅威を認識してからの時間（負なら脅威なし）
+    bool willDodge_ = false;      // 今回の脅威を回避するか
+    float dashCooldownTimer_ = 0.0f;
+    bool attackPressed_ = false;  // 前フレームに攻撃キーを押したか（トリガー入力のため交互に押す）
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include "Vector3.h"
+
+/// <summary>
+/// カメラ（ヘッドレスシミュレーション用の代替実装）
+/// 移動・照準の基準になる向きだけを持つ
+/// </summary>
+class Camera {
+public:
+    void SetTranslate(const Vector3& translate) { translate_ = translate; }
+    const Vector3& GetTranslate() const { return translate_; }
+    void SetRotate(const Vector3& rotate) { rotate_ = rotate; }
+    const Vector3& GetRotate() const { return rotate_; }
+    float GetRotateY() const { return rotate_.y; }
+
+private:
+    Vector3 translate_;
+    Vector3 rotate_;
+};
@@ -0,0 +1,13 @@
+#include "../../CameraSystem/CameraManager.h"
+
+// ゲーム側はCameraManagerを相対パスで参照しているためヘッダーは差し替えず、
+// シミュレーションで呼ばれるメンバーだけをここで定義する（カメラシェイクは結果に影響しないので何もしない）
+
+CameraManager* CameraManager::GetInstance() {
+    static CameraManager instance;
+    return &instance;
+}
+
+void CameraManager::StartShake(float intensity) {
+    (void)intensity;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Transform.h"
+#include "Vector3.h"
+#include <cstdint>
+
+/// <summary>
+/// コライダーの基底（ヘッドレスシミュレーション用の代替実装）
+/// エンジンと同じ設定項目とコールバックを持つ
+/// </summary>
+class Collider {
+public:
+    /// <summary>
+    /// 形状（判定関数の選択に使う）
+    /// </summary>
+    enum class Shape : uint8_t {
+        Sphere,
+        OBB,
+    };
+
+    virtual ~Collider() = default;
+
+    virtual void OnCollisionEnter(Collider* other) { (void)other; }
+    virtual void OnCollisionStay(Collider* other) { (void)other; }
+    virtual void OnCollisionExit(Collider* other) { (void)other; }
+
+    /// <summary>
+    /// ワールド座標での中心
+    /// </summary>
+    virtual Vector3 GetCenter() const {
+        return transform_ ? transform_->translate + offset_ : offset_;
+    }
+
+    Shape GetShape() const { return shape_; }
+
+    void SetTypeID(uint32_t typeID) { typeID_ = typeID; }
+    uint32_t GetTypeID() const { return typeID_; }
+
+    void SetOwner(void* owner) { owner_ = owner; }
+    void* GetOwner() const { return owner_; }
+
+    void SetActive(bool isActive) { isActive_ = isActive; }
+    bool IsActive() const { return isActive_; }
+
+    void SetTransform(Transform* transform) { transform_ = transform; }
+    Transform* GetTransform() const { return transform_; }
+
+    void SetOffset(const Vector3& offset) { offset_ = offset; }
+    const Vector3& GetOffset() const { return offset_; }
+
+protected:
+    explicit Collider(Shape shape) : shape_(shape) {}
+
+    Transform* transform_ = nullptr;
+    Vector3 offset_;
+
+private:
+    Shape shape_;
+    uint32_t typeID_ = 0;
+    void* owner_ = nullptr;
+    bool isActive_ = true;
+};
@@ -0,0 +1,197 @@
+#include "CollisionManager.h"
+#include "OBBCollider.h"
+#include "SphereCollider.h"
+#include <algorithm>
+#include <cmath>
+
+CollisionManager* CollisionManager::GetInstance() {
+    thread_local CollisionManager instance;
+    return &instance;
+}
+
+void CollisionManager::Initialize() {
+    Reset();
+    for (auto& mask : masks_) {
+        mask.reset();
+    }
+    stats_ = {};
+}
+
+void CollisionManager::Reset() {
+    colliders_.clear();
+    previousPairs_.clear();
+    previousSet_.clear();
+    currentPairs_.clear();
+    currentSet_.clear();
+}
+
+void CollisionManager::AddCollider(Collider* collider) {
+    if (collider && std::find(colliders_.begin(), colliders_.end(), collider) == colliders_.end()) {
+        colliders_.push_back(collider);
+    }
+}
+
+void CollisionManager::RemoveCollider(Collider* collider) {
+    std::erase(colliders_, collider);
+
+    // 破棄されるコライダーへExitは通知しない
+    auto involves = [collider](const Pair& pair) { return pair.first == collider || pair.second == collider; };
+    std::erase_if(previousPairs_, involves);
+    std::erase_if(previousSet_, involves);
+}
+
+void CollisionManager::SetCollisionMask(uint32_t typeA, uint32_t typeB, bool enable) {
+    if (typeA >= kMaxTypeCount || typeB >= kMaxTypeCount) {
+        return;
+    }
+    masks_[typeA].set(typeB, enable);
+    masks_[typeB].set(typeA, enable);
+}
+
+void CollisionManager::CheckAllCollisions() {
+    currentPairs_.clear();
+    currentSet_.clear();
+
+    // 通知中に弾が無効化されるなどしても走査が崩れないよう、要素数を固定して回す
+    const size_t count = colliders_.size();
+    for (size_t i = 0; i < count; ++i) {
+        Collider* a = colliders_[i];
+        if (!a->IsActive()) {
+            continue;
+        }
+        for (size_t j = i + 1; j < count; ++j) {
+            Collider* b = colliders_[j];
+            if (!b->IsActive() || !IsMaskEnabled(a->GetTypeID(), b->GetTypeID())) {
+                continue;
+            }
+
+            ++stats_.pairTests;
+            if (!Intersects(*a, *b)) {
+                continue;
+            }
+
+            Pair pair{ a, b };
+            currentPairs_.push_back(pair);
+            currentSet_.insert(pair);
+        }
+    }
+
+    // 新規はEnter、継続はStay
+    for (const Pair& pair : currentPairs_) {
+        if (previousSet_.contains(pair)) {
+            pair.first->OnCollisionStay(pair.second);
+            pair.second->OnCollisionStay(pair.first);
+        }
+        else {
+            ++stats_.enterCount;
+            pair.first->OnCollisionEnter(pair.second);
+            pair.second->OnCollisionEnter(pair.first);
+        }
+    }
+
+    // 離れた組み合わせ（無効化されたものを含む）はExit
+    for (const Pair& pair : previousPairs_) {
+        if (!currentSet_.contains(pair)) {
+            pair.first->OnCollisionExit(pair.second);
+            pair.second->OnCollisionExit(pair.first);
+        }
+    }
+
+    std::swap(previousPairs_, currentPairs_);
+    std::swap(previousSet_, currentSet_);
+}
+
+bool CollisionManager::Intersects(const Collider& a, const Collider& b) {
+    using Shape = Collider::Shape;
+    if (a.GetShape() == Shape::Sphere && b.GetShape() == Shape::Sphere) {
+        return SphereSphere(static_cast<const SphereCollider&>(a), static_cast<const SphereCollider&>(b));
+    }
+    if (a.GetShape() == Shape::Sphere) {
+        return SphereOBB(static_cast<const SphereCollider&>(a), static_cast<const OBBCollider&>(b));
+    }
+    if (b.GetShape() == Shape::Sphere) {
+        return SphereOBB(static_cast<const SphereCollider&>(b), static_cast<const OBBCollider&>(a));
+    }
+    return OBBOBB(static_cast<const OBBCollider&>(a), static_cast<const OBBCollider&>(b));
+}
+
+bool CollisionManager::SphereSphere(const SphereCollider& a, const SphereCollider& b) {
+    Vector3 diff = b.GetCenter() - a.GetCenter();
+    float radius = a.GetRadius() + b.GetRadius();
+    return diff.Dot(diff) <= radius * radius;
+}
+
+bool CollisionManager::SphereOBB(const SphereCollider& sphere, const OBBCollider& obb) {
+    // OBBのローカル空間で最近接点を求める
+    Vector3 diff = sphere.GetCenter() - obb.GetCenter();
+    Vector3 halfSize = obb.GetSize() * 0.5f;
+    const float halfExtents[3] = { halfSize.x, halfSize.y, halfSize.z };
+
+    float distanceSq = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        float d = diff.Dot(obb.GetAxis(i));
+        float excess = std::abs(d) - halfExtents[i];
+        if (excess > 0.0f) {
+            distanceSq += excess * excess;
+        }
+    }
+    return distanceSq <= sphere.GetRadius() * sphere.GetRadius();
+}
+
+bool CollisionManager::OBBOBB(const OBBCollider& a, const OBBCollider& b) {
+    // 分離軸判定（面法線6本＋辺の外積9本）
+    constexpr float kEpsilon = 1.0e-6f;
+
+    const Vector3 axesA[3] = { a.GetAxis(0), a.GetAxis(1), a.GetAxis(2) };
+    const Vector3 axesB[3] = { b.GetAxis(0), b.GetAxis(1), b.GetAxis(2) };
+    const Vector3 halfA = a.GetSize() * 0.5f;
+    const Vector3 halfB = b.GetSize() * 0.5f;
+    const float extentA[3] = { halfA.x, halfA.y, halfA.z };
+    const float extentB[3] = { halfB.x, halfB.y, halfB.z };
+
+    float rotation[3][3];
+    float absRotation[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            rotation[i][j] = axesA[i].Dot(axesB[j]);
+            absRotation[i][j] = std::abs(rotation[i][j]) + kEpsilon;
+        }
+    }
+
+    Vector3 diff = b.GetCenter() - a.GetCenter();
+    const float t[3] = { diff.Dot(axesA[0]), diff.Dot(axesA[1]), diff.Dot(axesA[2]) };
+
+    // Aの軸
+    for (int i = 0; i < 3; ++i) {
+        float rb = extentB[0] * absRotation[i][0] + extentB[1] * absRotation[i][1] + extentB[2] * absRotation[i][2];
+        if (std::abs(t[i]) > extentA[i] + rb) {
+            return false;
+        }
+    }
+
+    // Bの軸
+    for (int j = 0; j < 3; ++j) {
+        float ra = extentA[0] * absRotation[0][j] + extentA[1] * absRotation[1][j] + extentA[2] * absRotation[2][j];
+        float distance = t[0] * rotation[0][j] + t[1] * rotation[1][j] + t[2] * rotation[2][j];
+        if (std::abs(distance) > ra + extentB[j]) {
+            return false;
+        }
+    }
+
+    // 辺同士の外積
+    for (int i = 0; i < 3; ++i) {
+        int i1 = (i + 1) % 3;
+        int i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j) {
+            int j1 = (j + 1) % 3;
+            int j2 = (j + 2) % 3;
+            float ra = extentA[i1] * absRotation[i2][j] + extentA[i2] * absRotation[i1][j];
+            float rb = extentB[j1] * absRotation[i][j2] + extentB[j2] * absRotation[i][j1];
+            float distance = t[i2] * rotation[i1][j] - t[i1] * rotation[i2][j];
+            if (std::abs(distance) > ra + rb) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
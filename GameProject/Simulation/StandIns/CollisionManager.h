@@ -0,0 +1,99 @@
+#pragma once
+#include "Collider.h"
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+class OBBCollider;
+class SphereCollider;
+
+/// <summary>
+/// 衝突判定管理（ヘッドレスシミュレーション用の代替実装）
+/// 球・OBBの重なりを総当たりで判定し、エンジンと同じEnter/Stay/Exitを通知する
+/// 判定はSetCollisionMaskで許可したタイプの組み合わせのみ行う
+/// 通知順は登録順で決まるため、同じシードの戦闘は同じ結果になる
+/// スレッドごとに独立したインスタンスを持つ
+/// </summary>
+class CollisionManager {
+public:
+    /// <summary>
+    /// 統計
+    /// </summary>
+    struct Stats {
+        uint64_t pairTests = 0;  // 形状判定を行った組み合わせ数
+        uint64_t enterCount = 0; // Enter通知数
+    };
+
+    static CollisionManager* GetInstance();
+
+    /// <summary>
+    /// 初期化（コライダー・衝突状態・マスクを全て破棄）
+    /// </summary>
+    void Initialize();
+
+    /// <summary>
+    /// コライダーと衝突状態の破棄（マスクは維持）
+    /// </summary>
+    void Reset();
+
+    void AddCollider(Collider* collider);
+    void RemoveCollider(Collider* collider);
+
+    /// <summary>
+    /// タイプの組み合わせごとの判定可否を設定
+    /// </summary>
+    void SetCollisionMask(uint32_t typeA, uint32_t typeB, bool enable);
+
+    /// <summary>
+    /// 全コライダーの判定と通知
+    /// </summary>
+    void CheckAllCollisions();
+
+    size_t GetColliderCount() const { return colliders_.size(); }
+    const Stats& GetStats() const { return stats_; }
+
+    /// <summary>
+    /// 2つのコライダーが重なっているか
+    /// </summary>
+    static bool Intersects(const Collider& a, const Collider& b);
+
+private:
+    static constexpr size_t kMaxTypeCount = 32;
+
+    using Pair = std::pair<Collider*, Collider*>;
+
+    /// <summary>
+    /// 組み合わせのハッシュ
+    /// </summary>
+    struct PairHash {
+        size_t operator()(const Pair& pair) const {
+            size_t a = reinterpret_cast<size_t>(pair.first);
+            size_t b = reinterpret_cast<size_t>(pair.second);
+            return a ^ (b + 0x9e3779b97f4a7c15ull + (a << 6) + (a >> 2));
+        }
+    };
+
+    bool IsMaskEnabled(uint32_t typeA, uint32_t typeB) const {
+        return typeA < kMaxTypeCount && typeB < kMaxTypeCount && masks_[typeA].test(typeB);
+    }
+
+    static bool SphereSphere(const SphereCollider& a, const SphereCollider& b);
+    static bool SphereOBB(const SphereCollider& sphere, const OBBCollider& obb);
+    static bool OBBOBB(const OBBCollider& a, const OBBCollider& b);
+
+    std::vector<Collider*> colliders_;
+    std::array<std::bitset<kMaxTypeCount>, kMaxTypeCount> masks_{};
+
+    // 前フレームに重なっていた組み合わせ（検出順の配列と検索用の集合）
+    std::vector<Pair> previousPairs_;
+    std::unordered_set<Pair, PairHash> previousSet_;
+
+    // 今フレームの作業領域
+    std::vector<Pair> currentPairs_;
+    std::unordered_set<Pair, PairHash> currentSet_;
+
+    Stats stats_;
+};
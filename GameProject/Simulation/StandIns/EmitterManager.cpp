@@ -0,0 +1,62 @@
+#include "EmitterManager.h"
+#include "FrameTimer.h"
+#include <algorithm>
+
+EmitterManager::Emitter& EmitterManager::Add(const std::string& emitterName) {
+    Emitter& emitter = emitters_[emitterName];
+    emitter = Emitter{};
+    ++stats_.createdCount;
+    stats_.peakEmitterCount = (std::max)(stats_.peakEmitterCount, emitters_.size());
+    return emitter;
+}
+
+void EmitterManager::LoadPreset(const std::string& presetName, const std::string& emitterName) {
+    (void)presetName;
+    Add(emitterName);
+}
+
+void EmitterManager::SetEmitterActive(const std::string& emitterName, bool isActive) {
+    auto it = emitters_.find(emitterName);
+    if (it != emitters_.end() && it->second.isActive != isActive) {
+        it->second.isActive = isActive;
+        ++stats_.toggleCount;
+    }
+}
+
+void EmitterManager::SetEmitterPosition(const std::string& emitterName, const Vector3& position) {
+    auto it = emitters_.find(emitterName);
+    if (it != emitters_.end()) {
+        it->second.position = position;
+    }
+}
+
+void EmitterManager::CreateTemporaryEmitterFrom(const std::string& sourceName, const std::string& newName, float duration) {
+    auto it = emitters_.find(sourceName);
+    if (it == emitters_.end()) {
+        return;
+    }
+    Vector3 position = it->second.position;
+
+    Emitter& emitter = Add(newName);
+    emitter.position = position;
+    emitter.remainingTime = duration;
+}
+
+void EmitterManager::RemoveEmitter(const std::string& emitterName) {
+    emitters_.erase(emitterName);
+}
+
+void EmitterManager::Update() {
+    float deltaTime = FrameTimer::GetInstance()->GetDeltaTime();
+    for (auto it = emitters_.begin(); it != emitters_.end();) {
+        Emitter& emitter = it->second;
+        if (emitter.remainingTime >= 0.0f) {
+            emitter.remainingTime -= deltaTime;
+            if (emitter.remainingTime <= 0.0f) {
+                it = emitters_.erase(it);
+                continue;
+            }
+        }
+        ++it;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Vector3.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/// <summary>
+/// エミッター管理（ヘッドレスシミュレーション用の代替実装）
+/// パーティクルを生成せず、エミッターの生成・破棄と有効状態だけを追跡する
+/// 弾ごとのエミッター数やVFX切り替え回数を戦闘の統計として取り出せる
+/// </summary>
+class EmitterManager {
+public:
+    /// <summary>
+    /// エミッターの状態
+    /// </summary>
+    struct Emitter {
+        Vector3 position;
+        bool isActive = true;
+        float remainingTime = -1.0f; // 一時エミッターの残り時間（負なら無期限）
+    };
+
+    /// <summary>
+    /// 統計
+    /// </summary>
+    struct Stats {
+        uint64_t createdCount = 0;   // 生成したエミッター数
+        uint64_t toggleCount = 0;    // 有効/無効の切り替え回数
+        size_t peakEmitterCount = 0; // 同時に存在したエミッター数の最大
+    };
+
+    void LoadPreset(const std::string& presetName, const std::string& emitterName);
+    void LoadScenePreset(const std::string& presetName) { (void)presetName; }
+    void SetEmitterActive(const std::string& emitterName, bool isActive);
+    void SetEmitterPosition(const std::string& emitterName, const Vector3& position);
+    void SetEmitterCount(const std::string& emitterName, uint32_t count) { (void)emitterName; (void)count; }
+    void SetEmitterRadius(const std::string& emitterName, float radius) { (void)emitterName; (void)radius; }
+    void CreateTemporaryEmitterFrom(const std::string& sourceName, const std::string& newName, float duration);
+    void RemoveEmitter(const std::string& emitterName);
+
+    /// <summary>
+    /// 一時エミッターの寿命を進める
+    /// </summary>
+    void Update();
+
+    size_t GetEmitterCount() const { return emitters_.size(); }
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    /// <summary>
+    /// エミッターの追加
+    /// </summary>
+    Emitter& Add(const std::string& emitterName);
+
+    std::unordered_map<std::string, Emitter> emitters_;
+    Stats stats_;
+};
@@ -0,0 +1,20 @@
+#pragma once
+
+/// <summary>
+/// フレームタイマー（ヘッドレスシミュレーション用の代替実装）
+/// 実時間ではなく、シミュレーションが設定した固定ステップを返す
+/// スレッドごとに独立したインスタンスを持つ
+/// </summary>
+class FrameTimer {
+public:
+    static FrameTimer* GetInstance() {
+        thread_local FrameTimer instance;
+        return &instance;
+    }
+
+    float GetDeltaTime() const { return deltaTime_; }
+    void SetDeltaTime(float deltaTime) { deltaTime_ = deltaTime; }
+
+private:
+    float deltaTime_ = 1.0f / 60.0f;
+};
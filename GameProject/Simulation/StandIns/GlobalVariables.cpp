@@ -0,0 +1,124 @@
+#include "GlobalVariables.h"
+#include <filesystem>
+#include <fstream>
+#include <json.hpp>
+
+GlobalVariables* GlobalVariables::GetInstance() {
+    thread_local GlobalVariables instance;
+    return &instance;
+}
+
+void GlobalVariables::CreateGroup(const std::string& groupName) {
+    datas_[groupName];
+}
+
+const GlobalVariables::Item* GlobalVariables::Find(std::string_view groupName, std::string_view key) const {
+    auto groupIt = datas_.find(groupName);
+    if (groupIt == datas_.end()) {
+        return nullptr;
+    }
+    auto itemIt = groupIt->second.find(key);
+    if (itemIt == groupIt->second.end()) {
+        return nullptr;
+    }
+    return &itemIt->second;
+}
+
+int32_t GlobalVariables::GetValueInt(std::string_view groupName, std::string_view key) const {
+    const Item* item = Find(groupName, key);
+    if (!item) {
+        return 0;
+    }
+    if (const float* value = std::get_if<float>(item)) {
+        return static_cast<int32_t>(*value);
+    }
+    const int32_t* value = std::get_if<int32_t>(item);
+    return value ? *value : 0;
+}
+
+float GlobalVariables::GetValueFloat(std::string_view groupName, std::string_view key) const {
+    const Item* item = Find(groupName, key);
+    if (!item) {
+        return 0.0f;
+    }
+    // JSONに整数として保存された値も受け付ける
+    if (const int32_t* value = std::get_if<int32_t>(item)) {
+        return static_cast<float>(*value);
+    }
+    const float* value = std::get_if<float>(item);
+    return value ? *value : 0.0f;
+}
+
+Vector3 GlobalVariables::GetValueVector3(std::string_view groupName, std::string_view key) const {
+    const Item* item = Find(groupName, key);
+    const Vector3* value = item ? std::get_if<Vector3>(item) : nullptr;
+    return value ? *value : Vector3{};
+}
+
+bool GlobalVariables::GetValueBool(std::string_view groupName, std::string_view key) const {
+    const Item* item = Find(groupName, key);
+    const bool* value = item ? std::get_if<bool>(item) : nullptr;
+    return value ? *value : false;
+}
+
+std::string GlobalVariables::GetValueString(std::string_view groupName, std::string_view key) const {
+    const Item* item = Find(groupName, key);
+    const std::string* value = item ? std::get_if<std::string>(item) : nullptr;
+    return value ? *value : std::string{};
+}
+
+void GlobalVariables::LoadFiles() {
+    LoadFiles(kDirectoryPath);
+}
+
+void GlobalVariables::LoadFiles(const std::string& directoryPath) {
+    std::error_code ec;
+    if (!std::filesystem::exists(directoryPath, ec)) {
+        return;
+    }
+
+    for (const auto& entry : std::filesystem::directory_iterator(directoryPath, ec)) {
+        if (entry.path().extension() == ".json") {
+            LoadFile(entry.path().string());
+        }
+    }
+}
+
+bool GlobalVariables::LoadFile(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    nlohmann::json root = nlohmann::json::parse(file, nullptr, false);
+    if (root.is_discarded() || !root.is_object()) {
+        return false;
+    }
+
+    for (auto groupIt = root.begin(); groupIt != root.end(); ++groupIt) {
+        if (!groupIt->is_object()) {
+            continue;
+        }
+        Group& group = datas_[groupIt.key()];
+
+        for (auto itemIt = groupIt->begin(); itemIt != groupIt->end(); ++itemIt) {
+            const nlohmann::json& value = *itemIt;
+            if (value.is_number_integer()) {
+                group[itemIt.key()] = Item(value.get<int32_t>());
+            }
+            else if (value.is_number_float()) {
+                group[itemIt.key()] = Item(value.get<float>());
+            }
+            else if (value.is_boolean()) {
+                group[itemIt.key()] = Item(value.get<bool>());
+            }
+            else if (value.is_string()) {
+                group[itemIt.key()] = Item(value.get<std::string>());
+            }
+            else if (value.is_array() && value.size() == 3) {
+                group[itemIt.key()] = Item(Vector3{ value[0].get<float>(), value[1].get<float>(), value[2].get<float>() });
+            }
+        }
+    }
+    return true;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Vector3.h"
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+
+/// <summary>
+/// 調整項目の管理（ヘッドレスシミュレーション用の代替実装）
+/// エンジンと同じグループ／キー構造とJSONファイル形式を扱う
+/// ImGuiでの編集と保存は行わない
+/// スレッドごとに独立したインスタンスを持つため、並列実行中の各戦闘で別の値を試せる
+/// </summary>
+class GlobalVariables {
+public:
+    /// <summary>
+    /// 項目の値
+    /// </summary>
+    using Item = std::variant<int32_t, float, Vector3, bool, std::string>;
+
+    /// <summary>
+    /// グループ（キー → 値）
+    /// </summary>
+    using Group = std::map<std::string, Item, std::less<>>;
+
+    /// <summary>
+    /// 既定の読み込み先
+    /// </summary>
+    static constexpr const char* kDirectoryPath = "resources/Json/GlobalVariables/";
+
+    static GlobalVariables* GetInstance();
+
+    /// <summary>
+    /// グループの作成（既にあれば何もしない）
+    /// </summary>
+    void CreateGroup(const std::string& groupName);
+
+    /// <summary>
+    /// 項目の追加（既にあれば値を変更しない）
+    /// </summary>
+    template<typename T>
+    void AddItem(const std::string& groupName, const std::string& key, T value) {
+        Group& group = datas_[groupName];
+        if (group.find(key) == group.end()) {
+            group[key] = Item(std::move(value));
+        }
+    }
+
+    /// <summary>
+    /// 値の設定（無ければ追加）
+    /// </summary>
+    template<typename T>
+    void SetValue(const std::string& groupName, const std::string& key, T value) {
+        datas_[groupName][key] = Item(std::move(value));
+    }
+
+    int32_t GetValueInt(std::string_view groupName, std::string_view key) const;
+    float GetValueFloat(std::string_view groupName, std::string_view key) const;
+    Vector3 GetValueVector3(std::string_view groupName, std::string_view key) const;
+    bool GetValueBool(std::string_view groupName, std::string_view key) const;
+    std::string GetValueString(std::string_view groupName, std::string_view key) const;
+
+    /// <summary>
+    /// 既定のディレクトリにある全グループのJSONを読み込む
+    /// </summary>
+    void LoadFiles();
+
+    /// <summary>
+    /// 指定ディレクトリにある全グループのJSONを読み込む
+    /// </summary>
+    /// <param name="directoryPath">ディレクトリ</param>
+    void LoadFiles(const std::string& directoryPath);
+
+    /// <summary>
+    /// JSONファイル1つを読み込む（ファイル内の全グループを上書き）
+    /// </summary>
+    /// <param name="filePath">ファイルパス</param>
+    /// <returns>成功したらtrue</returns>
+    bool LoadFile(const std::string& filePath);
+
+    /// <summary>
+    /// 全グループの破棄
+    /// </summary>
+    void Clear() { datas_.clear(); }
+
+    /// <summary>
+    /// 全グループの取得
+    /// </summary>
+    const std::map<std::string, Group, std::less<>>& GetAllGroups() const { return datas_; }
+
+    /// <summary>
+    /// 全グループの置き換え（スレッド間で同じ設定を共有する用）
+    /// </summary>
+    void SetAllGroups(const std::map<std::string, Group, std::less<>>& datas) { datas_ = datas; }
+
+private:
+    /// <summary>
+    /// 項目の検索
+    /// </summary>
+    const Item* Find(std::string_view groupName, std::string_view key) const;
+
+    std::map<std::string, Group, std::less<>> datas_;
+};
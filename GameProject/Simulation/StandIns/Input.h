@@ -0,0 +1,88 @@
+#pragma once
+#include "Vector2.h"
+#include "dinput.h"
+#include "Xinput.h"
+#include <array>
+
+/// <summary>
+/// ゲームパッドのボタン名
+/// </summary>
+struct XButtonIds {
+    WORD A = XINPUT_GAMEPAD_A;
+    WORD B = XINPUT_GAMEPAD_B;
+    WORD X = XINPUT_GAMEPAD_X;
+    WORD Y = XINPUT_GAMEPAD_Y;
+    WORD Start = XINPUT_GAMEPAD_START;
+    WORD Back = XINPUT_GAMEPAD_BACK;
+};
+
+inline constexpr XButtonIds XButtons{};
+
+/// <summary>
+/// 入力（ヘッドレスシミュレーション用の代替実装）
+/// デバイスを読まず、シミュレーション側が書き込んだ状態をそのまま返す
+/// Updateで前フレームの状態を保存するため、Trigger系の判定はエンジンと同じ挙動になる
+/// スレッドごとに独立したインスタンスを持つ
+/// </summary>
+class Input {
+public:
+    static Input* GetInstance() {
+        thread_local Input instance;
+        return &instance;
+    }
+
+    /// <summary>
+    /// 前フレームの状態を保存（フレームの先頭で呼ぶ）
+    /// </summary>
+    void Update() {
+        prevKeys_ = keys_;
+        prevButtons_ = buttons_;
+    }
+
+    /// <summary>
+    /// 全入力の解除
+    /// </summary>
+    void Clear() {
+        keys_.fill(false);
+        prevKeys_.fill(false);
+        buttons_ = 0;
+        prevButtons_ = 0;
+        leftStick_ = {};
+        rightStick_ = {};
+    }
+
+    //==================== 読み出し（エンジンと同じAPI） ====================
+
+    bool PushKey(BYTE keyNumber) const { return keys_[keyNumber]; }
+    bool TriggerKey(BYTE keyNumber) const { return keys_[keyNumber] && !prevKeys_[keyNumber]; }
+
+    bool IsConnect() const { return isConnected_; }
+    bool PushButton(WORD button) const { return (buttons_ & button) != 0; }
+    bool TriggerButton(WORD button) const { return (buttons_ & button) != 0 && (prevButtons_ & button) == 0; }
+
+    Vector2 GetLeftStick() const { return leftStick_; }
+    Vector2 GetRightStick() const { return rightStick_; }
+    bool LStickInDeadZone() const { return leftStick_.Length() < kStickDeadZone; }
+    bool RStickInDeadZone() const { return rightStick_.Length() < kStickDeadZone; }
+
+    void SetVibration(float leftMotor, float rightMotor, float duration) { (void)leftMotor; (void)rightMotor; (void)duration; }
+
+    //==================== 書き込み（シミュレーション用） ====================
+
+    void SetKey(BYTE keyNumber, bool pressed) { keys_[keyNumber] = pressed; }
+    void SetButton(WORD button, bool pressed) { buttons_ = pressed ? (buttons_ | button) : (buttons_ & ~button); }
+    void SetConnected(bool connected) { isConnected_ = connected; }
+    void SetLeftStick(const Vector2& stick) { leftStick_ = stick; }
+    void SetRightStick(const Vector2& stick) { rightStick_ = stick; }
+
+private:
+    static constexpr float kStickDeadZone = 0.2f;
+
+    std::array<bool, 256> keys_{};
+    std::array<bool, 256> prevKeys_{};
+    WORD buttons_ = 0;
+    WORD prevButtons_ = 0;
+    bool isConnected_ = true;
+    Vector2 leftStick_;
+    Vector2 rightStick_;
+};
@@ -0,0 +1,36 @@
+#pragma once
+#include "Matrix4x4.h"
+#include "Vector3.h"
+#include <cmath>
+
+/// <summary>
+/// 行列関数（ゲーム側で使用している分のみ）
+/// </summary>
+namespace Mat4x4 {
+
+    /// <summary>
+    /// Y軸回転行列の作成
+    /// </summary>
+    inline Matrix4x4 MakeRotateY(float radian) {
+        Matrix4x4 result;
+        float c = std::cos(radian);
+        float s = std::sin(radian);
+        result.m[0][0] = c;
+        result.m[0][2] = -s;
+        result.m[2][0] = s;
+        result.m[2][2] = c;
+        return result;
+    }
+
+    /// <summary>
+    /// 方向ベクトルの変換（平行移動を含まない）
+    /// </summary>
+    inline Vector3 TransformNormal(const Matrix4x4& matrix, const Vector3& v) {
+        return {
+            v.x * matrix.m[0][0] + v.y * matrix.m[1][0] + v.z * matrix.m[2][0],
+            v.x * matrix.m[0][1] + v.y * matrix.m[1][1] + v.z * matrix.m[2][1],
+            v.x * matrix.m[0][2] + v.y * matrix.m[1][2] + v.z * matrix.m[2][2],
+        };
+    }
+
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+/// <summary>
+/// 4x4行列（行ベクトル形式、ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+struct Matrix4x4 {
+    float m[4][4] = {
+        { 1.0f, 0.0f, 0.0f, 0.0f },
+        { 0.0f, 1.0f, 0.0f, 0.0f },
+        { 0.0f, 0.0f, 1.0f, 0.0f },
+        { 0.0f, 0.0f, 0.0f, 1.0f },
+    };
+};
@@ -0,0 +1,15 @@
+#pragma once
+#include <string>
+
+/// <summary>
+/// モデル（ヘッドレスシミュレーション用の代替実装、名前のみ保持）
+/// </summary>
+class Model {
+public:
+    explicit Model(std::string name) : name_(std::move(name)) {}
+
+    const std::string& GetName() const { return name_; }
+
+private:
+    std::string name_;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include "Model.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+/// <summary>
+/// モデル管理（ヘッドレスシミュレーション用の代替実装）
+/// ファイルを読み込まず、名前ごとに空のModelを1つだけ生成する
+/// </summary>
+class ModelManager {
+public:
+    static ModelManager* GetInstance() {
+        thread_local ModelManager instance;
+        return &instance;
+    }
+
+    void LoadModel(const std::string& filePath) { FindModel(filePath); }
+
+    Model* FindModel(const std::string& filePath) {
+        auto it = models_.find(filePath);
+        if (it == models_.end()) {
+            it = models_.emplace(filePath, std::make_unique<Model>(filePath)).first;
+        }
+        return it->second.get();
+    }
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Model>> models_;
+};
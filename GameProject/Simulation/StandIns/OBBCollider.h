@@ -0,0 +1,35 @@
+#pragma once
+#include "Collider.h"
+#include "Mat4x4Func.h"
+#include "Matrix4x4.h"
+
+/// <summary>
+/// OBBコライダー（ヘッドレスシミュレーション用の代替実装）
+/// サイズは各軸の全長、オフセットは向きで回転させてから中心に加える
+/// </summary>
+class OBBCollider : public Collider {
+public:
+    OBBCollider() : Collider(Shape::OBB) {}
+
+    void SetSize(const Vector3& size) { size_ = size; }
+    const Vector3& GetSize() const { return size_; }
+
+    void SetOrientation(const Matrix4x4& orientation) { orientation_ = orientation; }
+    const Matrix4x4& GetOrientation() const { return orientation_; }
+
+    /// <summary>
+    /// ローカル軸の取得（行列の行）
+    /// </summary>
+    Vector3 GetAxis(int index) const {
+        return { orientation_.m[index][0], orientation_.m[index][1], orientation_.m[index][2] };
+    }
+
+    Vector3 GetCenter() const override {
+        Vector3 offset = Mat4x4::TransformNormal(orientation_, offset_);
+        return transform_ ? transform_->translate + offset : offset;
+    }
+
+private:
+    Vector3 size_{ 1.0f, 1.0f, 1.0f };
+    Matrix4x4 orientation_;
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include "ModelManager.h"
+#include "Transform.h"
+#include "Vector4.h"
+#include <string>
+
+/// <summary>
+/// 3Dオブジェクト（ヘッドレスシミュレーション用の代替実装）
+/// 描画は行わず、トランスフォームと色だけを保持する
+/// </summary>
+class Object3d {
+public:
+    void Initialize() {}
+    void Update() {}
+    void Draw() {}
+    void DrawImGui() {}
+
+    void SetModel(const std::string& filePath) { model_ = ModelManager::GetInstance()->FindModel(filePath); }
+    Model* GetModel() const { return model_; }
+
+    void SetTransform(const Transform& transform) { transform_ = transform; }
+    const Transform& GetTransform() const { return transform_; }
+
+    void SetMaterialColor(const Vector4& color) { color_ = color; }
+    const Vector4& GetMaterialColor() const { return color_; }
+
+private:
+    Model* model_ = nullptr;
+    Transform transform_{};
+    Vector4 color_{ 1.0f, 1.0f, 1.0f, 1.0f };
+};
@@ -0,0 +1,26 @@
+#pragma once
+#include <string>
+#include <unordered_set>
+
+/// <summary>
+/// ポストエフェクト管理（ヘッドレスシミュレーション用の代替実装）
+/// チェーンの構成だけを保持し、パラメータは捨てる
+/// </summary>
+class PostEffectManager {
+public:
+    static PostEffectManager* GetInstance() {
+        thread_local PostEffectManager instance;
+        return &instance;
+    }
+
+    template<typename T>
+    void SetEffectParam(const std::string& name, const T& param) { (void)name; (void)param; }
+
+    void AddEffectToChain(const std::string& name) { chain_.insert(name); }
+    void RemoveEffectFromChain(const std::string& name) { chain_.erase(name); }
+    bool IsEffectInChain(const std::string& name) const { return chain_.contains(name); }
+    void ClearChain() { chain_.clear(); }
+
+private:
+    std::unordered_set<std::string> chain_;
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include "Vector3.h"
+
+/// <summary>
+/// ビネットのパラメータ（ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+struct VignetteParam {
+    float power = 0.0f;
+    float range = 0.0f;
+    Vector3 color;
+};
@@ -0,0 +1,34 @@
+#pragma once
+#include "Vector3.h"
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <random>
+
+/// <summary>
+/// 乱数エンジン（ヘッドレスシミュレーション用の代替実装）
+/// スレッドごとに独立し、戦闘ごとにシードを設定して再現可能にする
+/// </summary>
+class RandomEngine {
+public:
+    static RandomEngine* GetInstance() {
+        thread_local RandomEngine instance;
+        return &instance;
+    }
+
+    void Seed(uint32_t seed) { engine_.seed(seed); }
+
+    int GetInt(int min, int max) { return std::uniform_int_distribution<int>(min, max)(engine_); }
+    float GetFloat(float min, float max) { return std::uniform_real_distribution<float>(min, max)(engine_); }
+
+    /// <summary>
+    /// XZ平面上のランダムな単位ベクトル
+    /// </summary>
+    Vector3 GetRandomDirectionXZ() {
+        float angle = GetFloat(0.0f, 2.0f * std::numbers::pi_v<float>);
+        return { std::cos(angle), 0.0f, std::sin(angle) };
+    }
+
+private:
+    std::mt19937 engine_{ 5489u };
+};
@@ -0,0 +1,16 @@
+#pragma once
+#include "Collider.h"
+
+/// <summary>
+/// 球コライダー（ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+class SphereCollider : public Collider {
+public:
+    SphereCollider() : Collider(Shape::Sphere) {}
+
+    void SetRadius(float radius) { radius_ = radius; }
+    float GetRadius() const { return radius_; }
+
+private:
+    float radius_ = 1.0f;
+};
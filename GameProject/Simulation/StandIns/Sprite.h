@@ -0,0 +1,28 @@
+#pragma once
+#include "Vector2.h"
+#include "Vector4.h"
+#include "WinApp.h"
+#include <string>
+
+/// <summary>
+/// スプライト（ヘッドレスシミュレーション用の代替実装、描画は行わない）
+/// </summary>
+class Sprite {
+public:
+    void Initialize(const std::string& texturePath) { (void)texturePath; }
+    void Update() {}
+    void Draw() {}
+
+    void SetPos(const Vector2& pos) { pos_ = pos; }
+    const Vector2& GetPos() const { return pos_; }
+    void SetSize(const Vector2& size) { size_ = size; }
+    const Vector2& GetSize() const { return size_; }
+    void SetAnchorPoint(const Vector2& anchorPoint) { anchorPoint_ = anchorPoint; }
+    void SetColor(const Vector4& color) { color_ = color; }
+
+private:
+    Vector2 pos_;
+    Vector2 size_;
+    Vector2 anchorPoint_;
+    Vector4 color_{ 1.0f, 1.0f, 1.0f, 1.0f };
+};
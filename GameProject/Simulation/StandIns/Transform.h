@@ -0,0 +1,11 @@
+#pragma once
+#include "Vector3.h"
+
+/// <summary>
+/// SRTトランスフォーム（ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+struct Transform {
+    Vector3 scale{ 1.0f, 1.0f, 1.0f };
+    Vector3 rotate;
+    Vector3 translate;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include "Vector3.h"
+#include <numbers>
+
+/// <summary>
+/// ベクトル関数（ゲーム側で使用している分のみ）
+/// </summary>
+namespace Vec3 {
+
+    /// <summary>
+    /// 角度の最短経路での補間
+    /// </summary>
+    inline float LerpShortAngle(float a, float b, float t) {
+        constexpr float kTwoPi = 2.0f * std::numbers::pi_v<float>;
+        float diff = std::fmod(b - a, kTwoPi);
+        if (diff > std::numbers::pi_v<float>) {
+            diff -= kTwoPi;
+        }
+        else if (diff < -std::numbers::pi_v<float>) {
+            diff += kTwoPi;
+        }
+        return a + diff * t;
+    }
+
+}
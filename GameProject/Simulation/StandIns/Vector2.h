@@ -0,0 +1,36 @@
+#pragma once
+#include <cmath>
+
+/// <summary>
+/// 2次元ベクトル（ヘッドレスシミュレーション用の代替実装）
+/// エンジンのVector2と同じ名前・演算子を提供する
+/// </summary>
+struct Vector2 {
+    float x = 0.0f;
+    float y = 0.0f;
+
+    Vector2() = default;
+    Vector2(float x, float y) : x(x), y(y) {}
+
+    Vector2 operator+(const Vector2& other) const { return { x + other.x, y + other.y }; }
+    Vector2 operator-(const Vector2& other) const { return { x - other.x, y - other.y }; }
+    Vector2 operator*(float scalar) const { return { x * scalar, y * scalar }; }
+    Vector2 operator/(float scalar) const { return { x / scalar, y / scalar }; }
+    Vector2 operator-() const { return { -x, -y }; }
+    Vector2& operator+=(const Vector2& other) { x += other.x; y += other.y; return *this; }
+    Vector2& operator-=(const Vector2& other) { x -= other.x; y -= other.y; return *this; }
+    Vector2& operator*=(float scalar) { x *= scalar; y *= scalar; return *this; }
+
+    /// <summary>
+    /// 長さの取得
+    /// </summary>
+    float Length() const { return std::sqrt(x * x + y * y); }
+
+    /// <summary>
+    /// 正規化（長さ0ならそのまま返す）
+    /// </summary>
+    Vector2 Normalize() const {
+        float length = Length();
+        return (length > 0.0f) ? *this / length : *this;
+    }
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <cmath>
+
+/// <summary>
+/// 3次元ベクトル（ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+struct Vector3 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+
+    Vector3() = default;
+    Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    Vector3 operator+(const Vector3& other) const { return { x + other.x, y + other.y, z + other.z }; }
+    Vector3 operator-(const Vector3& other) const { return { x - other.x, y - other.y, z - other.z }; }
+    Vector3 operator*(const Vector3& other) const { return { x * other.x, y * other.y, z * other.z }; }
+    Vector3 operator*(float scalar) const { return { x * scalar, y * scalar, z * scalar }; }
+    Vector3 operator/(float scalar) const { return { x / scalar, y / scalar, z / scalar }; }
+    Vector3 operator-() const { return { -x, -y, -z }; }
+    Vector3& operator+=(const Vector3& other) { x += other.x; y += other.y; z += other.z; return *this; }
+    Vector3& operator-=(const Vector3& other) { x -= other.x; y -= other.y; z -= other.z; return *this; }
+    Vector3& operator*=(float scalar) { x *= scalar; y *= scalar; z *= scalar; return *this; }
+    Vector3& operator/=(float scalar) { x /= scalar; y /= scalar; z /= scalar; return *this; }
+    bool operator==(const Vector3& other) const { return x == other.x && y == other.y && z == other.z; }
+    bool operator!=(const Vector3& other) const { return !(*this == other); }
+
+    /// <summary>
+    /// 長さの取得
+    /// </summary>
+    float Length() const { return std::sqrt(x * x + y * y + z * z); }
+
+    /// <summary>
+    /// 正規化（長さ0ならそのまま返す）
+    /// </summary>
+    Vector3 Normalize() const {
+        float length = Length();
+        return (length > 0.0f) ? *this / length : *this;
+    }
+
+    /// <summary>
+    /// 内積
+    /// </summary>
+    float Dot(const Vector3& other) const { return x * other.x + y * other.y + z * other.z; }
+
+    /// <summary>
+    /// 線形補間
+    /// </summary>
+    static Vector3 Lerp(const Vector3& a, const Vector3& b, float t) { return a + (b - a) * t; }
+};
+
+inline Vector3 operator*(float scalar, const Vector3& v) { return v * scalar; }
@@ -0,0 +1,14 @@
+#pragma once
+
+/// <summary>
+/// 4次元ベクトル（ヘッドレスシミュレーション用の代替実装）
+/// </summary>
+struct Vector4 {
+    float x = 0.0f;
+    float y = 0.0f;
+    float z = 0.0f;
+    float w = 0.0f;
+
+    Vector4() = default;
+    Vector4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+};
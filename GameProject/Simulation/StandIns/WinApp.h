@@ -0,0 +1,10 @@
+#pragma once
+
+/// <summary>
+/// ウィンドウ（ヘッドレスシミュレーション用の代替実装、クライアント領域のサイズのみ）
+/// </summary>
+class WinApp {
+public:
+    static constexpr int clientWidth = 1280;
+    static constexpr int clientHeight = 720;
+};
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+// XInputのボタンマスク（ヘッドレスシミュレーション用）
+using WORD = uint16_t;
+
+#define XINPUT_GAMEPAD_START 0x0010
+#define XINPUT_GAMEPAD_BACK  0x0020
+#define XINPUT_GAMEPAD_A     0x1000
+#define XINPUT_GAMEPAD_B     0x2000
+#define XINPUT_GAMEPAD_X     0x4000
+#define XINPUT_GAMEPAD_Y     0x8000
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+
+// DirectInputのキーコード（ヘッドレスシミュレーション用、ゲーム側で使用している分のみ）
+using BYTE = uint8_t;
+
+#define DIK_ESCAPE 0x01
+#define DIK_W      0x11
+#define DIK_P      0x19
+#define DIK_A      0x1E
+#define DIK_S      0x1F
+#define DIK_D      0x20
+#define DIK_F      0x21
+#define DIK_Z      0x2C
+#define DIK_SPACE  0x39
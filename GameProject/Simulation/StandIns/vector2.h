@@ -0,0 +1,3 @@
+#pragma once
+// 大文字小文字を区別するファイルシステム向け（ゲーム側は両方の綴りで参照している）
+#include "Vector2.h"
@@ -2,6 +2,7 @@
 #include "GameScene.h"
 #include "ModelManager.h"
 #include "Object3dBasic.h"
+#include "Camera.h"
 #include "SpriteBasic.h"
 #include "Sprite.h"
 #include "Input.h"
@@ -14,11 +15,16 @@
 #include "Model.h"
 #include "ShadowRenderer.h"
 #include "CollisionManager.h"
+#include "OBBCollider.h"
 #include "GlobalVariables.h"
 #include "Vec3Func.h"
 
 // Game includes
+#include "../Collision/BossMeleeAttackCollider.h"
+#include "../Collision/CollisionGrid.h"
 #include "../Collision/CollisionTypeIdDef.h"
+#include "../Collision/MeleeAttackCollider.h"
+#include "../Common/GameConst.h"
 #include "CameraSystem/CameraManager.h"
 #include "CameraSystem/Controller/ThirdPersonController.h"
 #include "CameraSystem/Controller/TopDownController.h"
@@ -30,12 +36,23 @@
 #include <algorithm>
 #include <cmath>
 
+namespace {
+
+    /// <summary>
+    /// 弾の描画色
+    /// </summary>
+    const Vector4 kBossBulletColor(1.0f, 0.3f, 0.3f, 1.0f);
+    const Vector4 kPlayerBulletColor(0.4f, 0.8f, 1.0f, 1.0f);
+
+}
+
 // Debug includes
 #ifdef _DEBUG
 #include"ImGui.h"
 #include "DebugCamera.h"
 #include "DebugUIManager.h"
 #include "CameraSystem/CameraDebugUI.h"
+#include "../BehaviorTree/Benchmark/BTBenchmark.h"
 #endif
 
 void GameScene::Initialize()
@@ -81,6 +98,14 @@ void GameScene::Initialize()
                 FrameTimer::GetInstance()->GetDeltaTime());
         });
 
+    // ベンチマークUI登録
+    DebugUIManager::GetInstance()->RegisterGameObject("Benchmark",
+        []() { BTBenchmark::DrawImGui(); });
+
+    // 弾プールの使用状況
+    DebugUIManager::GetInstance()->RegisterGameObject("Projectiles",
+        [this]() { DrawProjectilePoolImGui(); });
+
     DebugUIManager::GetInstance()->SetEmitterManager(emitterManager_.get());
 #endif
     /// ================================== ///
@@ -147,6 +172,40 @@ void GameScene::Initialize()
     // プレイヤーにボスの参照を設定
     player_->SetBoss(boss_.get());
 
+    // 弾の生成要求は全て1つのキューへ書き込ませ、更新後にまとめて生成する
+    spawnQueue_.Initialize(kSpawnQueueBulletCapacity, kSpawnQueuePatternCapacity);
+    boss_->SetSpawnQueue(&spawnQueue_);
+    player_->SetSpawnQueue(&spawnQueue_);
+
+    // 衝突判定のコールバックはヒットを書き込むだけにし、全ての判定の後にまとめて適用する
+    hitEvents_.Initialize(kHitEventCapacity);
+    player_->GetMeleeAttackCollider()->SetHitEventQueue(&hitEvents_);
+    boss_->GetMeleeAttackCollider()->SetHitEventQueue(&hitEvents_);
+
+    //-----------弾プールの初期化----------------//
+    // 弾とエミッターは容量分をここで全て生成し、戦闘中は生成せずに使い回す
+    // 軌跡は生きている弾の数、爆発は同時に再生する数だけエミッターを用意する
+    bossBulletEffects_.trail.Initialize(emitterManager_.get(), "boss_bullet", kBossBulletPoolCapacity);
+    bossBulletEffects_.explode.Initialize(emitterManager_.get(), "boss_bullet_explode", kBossExplodeEmitterCapacity);
+    playerBulletEffects_.trail.Initialize(emitterManager_.get(), "player_bullet", kPlayerBulletPoolCapacity);
+    playerBulletEffects_.explode.Initialize(emitterManager_.get(), "player_bullet_explode", kPlayerExplodeEmitterCapacity);
+    bossBullets_.Initialize(kBossBulletPoolCapacity,
+        [this]() { return std::make_unique<BossBullet>(&bossBulletEffects_, &collisionGrid_, &hitEvents_); });
+    playerBullets_.Initialize(kPlayerBulletPoolCapacity,
+        [this]() { return std::make_unique<PlayerBullet>(&playerBulletEffects_, &collisionGrid_, &hitEvents_); });
+
+    // 弾幕用の弾はモデルやコライダーを持たず、配列上でまとめて更新する
+    danmakuBullets_.Initialize(kDanmakuBulletCapacity);
+    danmakuBullets_.SetBounds(
+        Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+        Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax));
+    bulletPatterns_.Initialize(kPatternBulletCapacity);
+
+    // 弾の描画は種類を問わず1つの配列へ詰める（不透明なので手前から描く）
+    bulletInstances_.Initialize("sphere.gltf", kBulletInstanceCapacity);
+    bulletInstances_.SetSortMode(ProjectileInstanceBatch::SortMode::FrontToBack);
+    bulletRenderer_.Initialize(&bulletInstances_);
+
     /// ----------------------カメラシステムの初期化------------------------------------------------- ///
     // カメラマネージャーの初期化
     cameraManager_ = CameraManager::GetInstance();
@@ -175,18 +234,23 @@ void GameScene::Initialize()
     cameraManager_->RegisterController("Animation", std::move(animController));
 
     /// ----------------------衝突判定の初期化--------------------------------------------------- ///
-    // 衝突マスクの設定（どのタイプ同士が衝突判定を行うか）
-    collisionManager->SetCollisionMask(
-        static_cast<uint32_t>(CollisionTypeId::PLAYER_ATTACK),
-        static_cast<uint32_t>(CollisionTypeId::BOSS),
-        true
-    );
-
-    collisionManager->SetCollisionMask(
-        static_cast<uint32_t>(CollisionTypeId::PLAYER),
-        static_cast<uint32_t>(CollisionTypeId::BOSS_ATTACK),
-        true
-    );
+    // 衝突マスクの設定（どのタイプ同士が衝突判定を行うかはkCollisionLayersで宣言）
+    for (const CollisionLayerMatrix::TypePair& pair : kCollisionLayers.GetPairs()) {
+        collisionManager->SetCollisionMask(pair.typeA, pair.typeB, true);
+    }
+
+    // 弾は数が多いのでCollisionManagerには入れず、相手の本体と一緒にグリッドで判定する
+    collisionGrid_.Initialize(
+        Vector3(GameConst::kStageXMin, GameConst::kProjectileYMin, GameConst::kStageZMin),
+        Vector3(GameConst::kStageXMax, GameConst::kProjectileYMax, GameConst::kStageZMax),
+        kCollisionGridCellSize);
+    collisionGrid_.SetLayerMatrix(kCollisionLayers);
+    collisionGrid_.Insert(player_->GetCollider());
+    player_->SetCollisionGrid(&collisionGrid_);
+    collisionGrid_.Insert(boss_->GetCollider());
+    // ボスの近接攻撃はCollisionManagerで判定し、グリッドにはパリィのクエリ用にだけ登録する
+    collisionGrid_.InsertQueryOnly(boss_->GetMeleeAttackCollider());
+    player_->SetDanmakuSystems(&danmakuBullets_, &bulletPatterns_);
 
     /// ----------------------エミッターマネージャーの初期化--------------------------------------------- ///
     // シーンのエミッターをまとめて読み込む
@@ -242,6 +306,16 @@ void GameScene::Finalize()
     if (boss_) {
         boss_->Finalize();
     }
+    bossBullets_.Finalize();
+    playerBullets_.Finalize();
+    bossBulletEffects_.Finalize();
+    playerBulletEffects_.Finalize();
+    danmakuBullets_.Clear();
+    bulletPatterns_.Clear();
+    bulletRenderer_.Finalize();
+    spawnQueue_.Clear();
+    hitEvents_.Clear();
+    collisionGrid_.Clear();
 
     // CameraManagerのクリーンアップ
     if (cameraManager_) {
@@ -296,11 +370,8 @@ void GameScene::Update()
     toTitleSprite_->Update();
     cameraManager_->Update(FrameTimer::GetInstance()->GetDeltaTime());
 
-    // ボスからの弾生成リクエストを処理
-    CreateBossBullet();
-
-    // プレイヤーからの弾生成リクエストを処理
-    CreatePlayerBullet();
+    // ボス・プレイヤーからの弾生成リクエストをまとめて処理
+    SpawnProjectiles();
 
     // プロジェクタイルの更新
     float deltaTime = FrameTimer::GetInstance()->GetDeltaTime();
@@ -327,8 +398,12 @@ void GameScene::Update()
     // ゲームクリアアニメーションの更新
     UpdateClearAnim();
 
-    // 衝突判定の実行
+    // 衝突判定の実行（弾と本体はグリッド、それ以外はCollisionManager）
+    collisionGrid_.CheckAllCollisions();
     CollisionManager::GetInstance()->CheckAllCollisions();
+
+    // このフレームのヒット（弾・近接攻撃・弾幕）のダメージ・シェイクをまとめて適用
+    hitEvents_.Resolve();
 }
 
 void GameScene::Draw()
@@ -340,12 +415,16 @@ void GameScene::Draw()
     //-------------------SkyBoxの描画-------------------//
     skyBox_->Draw();
 
+    // 弾のインスタンスをシャドウと通常の描画で共有するバッファへ転送
+    bulletRenderer_.Upload();
+
     //------------------シャドウマップの描画------------------//
     if (ShadowRenderer::GetInstance()->IsEnabled()) {
         ShadowRenderer::GetInstance()->BeginShadowPass();
         ground_->Draw();
         player_->Draw();
         boss_->Draw();
+        bulletRenderer_.DrawShadow();
         ShadowRenderer::GetInstance()->EndShadowPass();
     }
 
@@ -362,6 +441,7 @@ void GameScene::Draw()
     ground_->Draw();
     player_->Draw();
     boss_->Draw();
+    bulletRenderer_.Draw();
 
     //------------------前景Spriteの描画------------------//
     // スプライト共通描画設定
@@ -558,41 +638,68 @@ void GameScene::UpdateInput()
 
 void GameScene::UpdateProjectiles(float deltaTime)
 {
-    // ボスの弾の更新
-    for (auto& bullet : bossBullets_) {
-        if (bullet && bullet->IsActive()) {
-            bullet->Update(deltaTime);
-        }
-    }
-
-    // 非アクティブなボスの弾を削除
-    std::erase_if(bossBullets_,
-        [](const std::unique_ptr<BossBullet>& bullet) {
-            if (bullet && !bullet->IsActive()) {
-                // Finalize()で自動的にコライダーが削除される
-                bullet->Finalize();
-                return true;
-            }
-            return false;
-        });
+    // 弾の更新（非アクティブになった弾はRelease()でコライダーが外れ、プールへ戻る）
+    bossBullets_.Update(deltaTime);
+    playerBullets_.Update(deltaTime);
+    bossBulletEffects_.Update(deltaTime);
+    playerBulletEffects_.Update(deltaTime);
+
+    // 移動の途中で本体に触れた弾をここで当てる（CheckAllCollisionsは現在位置しか見ないため、速い弾がすり抜ける）
+    Collider* playerBody = player_->GetCollider();
+    Collider* bossBody = boss_->GetCollider();
+    bossBullets_.ForEachActive([&](BossBullet& bullet) { bullet.SweepCollision(playerBody); });
+    playerBullets_.ForEachActive([&](PlayerBullet& bullet) { bullet.SweepCollision(bossBody); });
+
+    UpdateDanmakuBullets(deltaTime);
+    BuildBulletInstances();
+}
 
-    // プレイヤーの弾の更新
-    for (auto& bullet : playerBullets_) {
-        if (bullet && bullet->IsActive()) {
-            bullet->Update(deltaTime);
-        }
+void GameScene::UpdateDanmakuBullets(float deltaTime)
+{
+    // 追尾弾は全てプレイヤーを狙う（目標は弾システム全体で共有）
+    danmakuBullets_.SetHomingTarget(player_->GetTranslate());
+    danmakuBullets_.Update(deltaTime);
+    bulletPatterns_.Update(deltaTime);
+
+    // プレイヤーとの当たり判定（本体のOBBに内接する球で判定し、当たった弾はまとめて1件のヒットにする）
+    GlobalVariables* gv = GlobalVariables::GetInstance();
+    float bodySize = gv->GetValueFloat("Player", "BodyColliderSize");
+    float sweepTime = gv->GetValueBool("BossBullet", "SweptCollision") ? deltaTime : 0.0f;
+    HitEvent hit;
+    hit.victim = player_->GetCollider();
+    hit.point = player_->GetTranslate();
+    hit.source = HitSource::Danmaku;
+    if (danmakuBullets_.CollideSphere(player_->GetTranslate(), bodySize * 0.5f, &hit.damage, sweepTime) > 0) {
+        hitEvents_.Push(hit);
+    }
+    if (bulletPatterns_.CollideSphere(player_->GetTranslate(), bodySize * 0.5f, &hit.damage, sweepTime) > 0) {
+        hitEvents_.Push(hit);
     }
+}
 
-    // 非アクティブなプレイヤーの弾を削除
-    std::erase_if(playerBullets_,
-        [](const std::unique_ptr<PlayerBullet>& bullet) {
-            if (bullet && !bullet->IsActive()) {
-                // Finalize()で自動的にコライダーが削除される
-                bullet->Finalize();
-                return true;
-            }
-            return false;
-        });
+void GameScene::BuildBulletInstances()
+{
+    // カメラの回転（X:ピッチ、Y:ヨー）から視線方向を求める
+    const Camera* camera = *Object3dBasic::GetInstance()->GetCamera();
+    const Vector3& rotate = camera->GetRotate();
+    ProjectileInstanceBatch::CullView view;
+    view.position = camera->GetTranslate();
+    view.forward = Vector3(
+        std::sin(rotate.y) * std::cos(rotate.x),
+        -std::sin(rotate.x),
+        std::cos(rotate.y) * std::cos(rotate.x));
+
+    // プール上の弾は軌跡のパーティクルで見せているため、スケール0（kInitialScale）のものはここで除かれる
+    bulletInstances_.Begin(&view);
+    bossBullets_.ForEachActive([&](const BossBullet& bullet) {
+        bulletInstances_.Add(bullet.GetTransform().translate, bullet.GetTransform().scale.x, kBossBulletColor);
+    });
+    playerBullets_.ForEachActive([&](const PlayerBullet& bullet) {
+        bulletInstances_.Add(bullet.GetTransform().translate, bullet.GetTransform().scale.x, kPlayerBulletColor);
+    });
+    bulletInstances_.AddProjectiles(danmakuBullets_, kBossBulletColor);
+    bulletPatterns_.AddInstances(bulletInstances_, kBossBulletColor);
+    bulletInstances_.End();
 }
 
 void GameScene::UpdateBossBorder()
@@ -638,22 +745,142 @@ void GameScene::UpdateBossBorder()
     }
 }
 
-void GameScene::CreateBossBullet()
+void GameScene::SpawnProjectiles()
 {
-    for (const auto& request : boss_->ConsumePendingBullets()) {
-        auto bullet = std::make_unique<BossBullet>(emitterManager_.get());
-        bullet->Initialize(request.position, request.velocity);
-        bossBullets_.push_back(std::move(bullet));
+    GlobalVariables* gv = GlobalVariables::GetInstance();
+    const float lifetime = gv->GetValueFloat("BossBullet", "Lifetime");
+    const float damage = gv->GetValueFloat("BossBullet", "Damage");
+    const float radius = gv->GetValueFloat("BossBullet", "ColliderRadius");
+
+    // 弾幕の模様は弾数によらず1件ずつ登録する（弾の見た目と当たり判定はSoAの弾と同じ値を使う）
+    for (const BulletPattern& pattern : spawnQueue_.GetPatterns()) {
+        bulletPatterns_.Spawn(pattern, lifetime, damage, radius);
     }
+
+    // ボスの弾は弾幕用の弾システムへ生成（軌跡エフェクトと個別のコライダーは持たない）
+    // 追尾弾はまとめて向きを変えるため、BossBullet.Batchedによらず常に弾システムへ送る
+    const bool batched = gv->GetValueBool("BossBullet", "Batched");
+    ProjectileSpawnParams params;
+    params.lifetime = lifetime;
+    params.damage = damage;
+    params.radius = radius;
+    for (const ProjectileSpawnCommand& command : spawnQueue_.GetBullets()) {
+        if (command.owner == ProjectileOwner::Player) {
+            playerBullets_.Spawn(command.position, command.velocity);
+            continue;
+        }
+        if (!batched && command.turnRate <= 0.0f) {
+            bossBullets_.Spawn(command.position, command.velocity);
+            continue;
+        }
+        params.position = command.position;
+        params.velocity = command.velocity;
+        params.turnRate = command.turnRate;
+        danmakuBullets_.Spawn(params);
+    }
+
+    spawnQueue_.Clear();
 }
 
-void GameScene::CreatePlayerBullet()
+void GameScene::DrawProjectilePoolImGui()
 {
-    for (const auto& request : player_->ConsumePendingBullets()) {
-        auto bullet = std::make_unique<PlayerBullet>(emitterManager_.get());
-        bullet->Initialize(request.position, request.velocity);
-        playerBullets_.push_back(std::move(bullet));
+#ifdef _DEBUG
+    auto drawStats = [](const char* label, const auto& stats) {
+        ImGui::SeparatorText(label);
+        ImGui::Text("Active: %zu / %zu  (high-water %zu, constructed %zu)",
+            stats.activeCount, stats.capacity, stats.highWaterMark, stats.constructedCount);
+        ImGui::ProgressBar(stats.capacity > 0 ? static_cast<float>(stats.activeCount) / static_cast<float>(stats.capacity) : 0.0f,
+            ImVec2(-1.0f, 0.0f), "");
+        if (stats.overflowCount > 0) {
+            ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Overflow: %llu / %llu spawns",
+                static_cast<unsigned long long>(stats.overflowCount), static_cast<unsigned long long>(stats.spawnCount));
+        }
+        else {
+            ImGui::Text("Overflow: 0 / %llu spawns", static_cast<unsigned long long>(stats.spawnCount));
+        }
+    };
+    drawStats("Boss Bullets", bossBullets_.GetStats());
+    drawStats("Player Bullets", playerBullets_.GetStats());
+
+    ImGui::SeparatorText("Bullet Emitters");
+    auto drawEmitterStats = [](const char* label, const ProjectileEmitterPool::Stats& stats) {
+        ImGui::Text("%-16s in use %zu / %zu  (created %zu, high-water %zu, exhausted %llu)", label,
+            stats.inUseCount, stats.capacity, stats.createdCount, stats.highWaterMark,
+            static_cast<unsigned long long>(stats.exhaustedCount));
+    };
+    drawEmitterStats("Boss trail", bossBulletEffects_.trail.GetStats());
+    drawEmitterStats("Boss explode", bossBulletEffects_.explode.GetStats());
+    drawEmitterStats("Player trail", playerBulletEffects_.trail.GetStats());
+    drawEmitterStats("Player explode", playerBulletEffects_.explode.GetStats());
+
+    const ProjectileSystem::Stats& danmaku = danmakuBullets_.GetStats();
+    ImGui::SeparatorText("Danmaku (SoA)");
+    ImGui::Text("Active: %zu / %zu  (high-water %zu, homing %zu)", danmaku.activeCount, danmaku.capacity,
+        danmaku.highWaterMark, danmaku.homingCount);
+    ImGui::Text("Spawned %llu  Overflow %llu", static_cast<unsigned long long>(danmaku.spawnCount),
+        static_cast<unsigned long long>(danmaku.overflowCount));
+    ImGui::Text("Expired %llu  Out of bounds %llu  Hit %llu", static_cast<unsigned long long>(danmaku.expiredCount),
+        static_cast<unsigned long long>(danmaku.outOfBoundsCount), static_cast<unsigned long long>(danmaku.hitCount));
+
+    const BulletPatternSystem::Stats& patterns = bulletPatterns_.GetStats();
+    ImGui::SeparatorText("Bullet Patterns");
+    ImGui::Text("Patterns %zu  Bullets %zu / %zu  (high-water %zu)", patterns.patternCount, patterns.activeCount,
+        patterns.capacity, patterns.highWaterMark);
+    ImGui::Text("Evaluated %zu  Skipped %zu", patterns.evaluatedCount, patterns.skippedCount);
+    ImGui::Text("Spawned %llu (%llu bullets)  Overflow %llu  Hit %llu", static_cast<unsigned long long>(patterns.spawnCount),
+        static_cast<unsigned long long>(patterns.bulletSpawnCount), static_cast<unsigned long long>(patterns.overflowCount),
+        static_cast<unsigned long long>(patterns.hitCount));
+
+    const ProjectileSpawnQueue::Stats& queue = spawnQueue_.GetStats();
+    ImGui::SeparatorText("Spawn Queue");
+    ImGui::Text("Peak per frame: bullets %zu / %zu  patterns %zu / %zu", queue.peakBulletCount, queue.bulletCapacity,
+        queue.peakPatternCount, queue.patternCapacity);
+    ImGui::Text("Queued %llu bullets  %llu patterns  Overflow %llu", static_cast<unsigned long long>(queue.bulletCount),
+        static_cast<unsigned long long>(queue.patternCount), static_cast<unsigned long long>(queue.overflowCount));
+
+    const HitEventQueue::Stats& hits = hitEvents_.GetStats();
+    ImGui::SeparatorText("Hit Events");
+    ImGui::Text("Resolved %zu  Peak %zu / %zu", hits.resolvedCount, hits.peakCount, hits.capacity);
+    ImGui::Text("Total %llu  Overflow %llu", static_cast<unsigned long long>(hits.totalCount),
+        static_cast<unsigned long long>(hits.overflowCount));
+
+    const CollisionGrid::Stats& grid = collisionGrid_.GetStats();
+    ImGui::SeparatorText("Collision Grid");
+    ImGui::Text("Colliders %zu  Cells %zu  Moved %zu", grid.colliderCount, grid.cellCount, grid.movedCount);
+    ImGui::Text("Pairs: tested %zu / brute force %zu  hit %zu", grid.testedPairs, grid.bruteForcePairs, grid.hitPairs);
+    ImGui::Text("Batched sphere-OBB: %zu pairs in %zu calls", grid.batchedPairs, grid.batchCalls);
+    ImGui::Text("Total tested %llu  hit %llu", static_cast<unsigned long long>(grid.totalTestedPairs),
+        static_cast<unsigned long long>(grid.totalHitPairs));
+    ImGui::Text("Queries %llu  candidates %llu", static_cast<unsigned long long>(grid.totalQueries),
+        static_cast<unsigned long long>(grid.totalQueryCandidates));
+    const ContactCache::Stats& contacts = collisionGrid_.GetContactStats();
+    ImGui::Text("Contacts %zu  Enter %zu  Stay %zu  Exit %zu", contacts.contactCount, contacts.enterCount,
+        contacts.stayCount, contacts.exitCount);
+    ImGui::Text("Hits %llu  Suppressed %llu  Total enter %llu", static_cast<unsigned long long>(contacts.hitCount),
+        static_cast<unsigned long long>(contacts.suppressedCount), static_cast<unsigned long long>(contacts.totalEnterCount));
+
+    const ProjectileInstanceBatch::Stats& instances = bulletInstances_.GetStats();
+    ImGui::SeparatorText("Bullet Instances");
+    ImGui::Text("Packed: %zu / %zu  (peak %zu)", instances.instanceCount, instances.capacity, instances.peakInstanceCount);
+    ImGui::Text("Submitted %zu  Culled %zu  Overflow %llu", instances.submittedCount, instances.culledCount,
+        static_cast<unsigned long long>(instances.overflowCount));
+    ImGui::Text("Uploaded %zu  Draw calls %u", bulletRenderer_.GetUploadedCount(), bulletRenderer_.GetDrawCallCount());
+
+    if (ImGui::Button("Reset Pool Stats")) {
+        bossBullets_.ResetStats();
+        playerBullets_.ResetStats();
+        bossBulletEffects_.trail.ResetStats();
+        bossBulletEffects_.explode.ResetStats();
+        playerBulletEffects_.trail.ResetStats();
+        playerBulletEffects_.explode.ResetStats();
+        danmakuBullets_.ResetStats();
+        bulletPatterns_.ResetStats();
+        spawnQueue_.ResetStats();
+        hitEvents_.ResetStats();
+        collisionGrid_.ResetStats();
+        bulletInstances_.ResetStats();
     }
+#endif
 }
 
 void GameScene::UpdateDashEmitter(float deltaTime)
@@ -5,8 +5,16 @@
 #include "Object/Boss/Boss.h"
 #include "Object/Player/Player.h"
 #include "Input/InputHandler.h"
+#include "../Collision/CollisionGrid.h"
+#include "../Collision/HitEventQueue.h"
 #include "../Object/Projectile/BossBullet.h"
+#include "../Object/Projectile/BulletPatternSystem.h"
 #include "../Object/Projectile/PlayerBullet.h"
+#include "../Object/Projectile/ProjectileInstanceBatch.h"
+#include "../Object/Projectile/ProjectileInstanceRenderer.h"
+#include "../Object/Projectile/ProjectilePool.h"
+#include "../Object/Projectile/ProjectileSpawnQueue.h"
+#include "../Object/Projectile/ProjectileSystem.h"
 
 #include <memory>
 #include <vector>
@@ -29,6 +37,25 @@ class PlayerBullet;
 /// </summary>
 class GameScene : public BaseScene
 {
+private: // 定数
+    static constexpr size_t kBossBulletPoolCapacity = 256;      // ボスの弾のプール容量
+    static constexpr size_t kPlayerBulletPoolCapacity = 64;     // プレイヤーの弾のプール容量
+    static constexpr size_t kBossExplodeEmitterCapacity = 64;   // ボスの弾の爆発エミッター数（0.5秒間に消える弾の数まで）
+    static constexpr size_t kPlayerExplodeEmitterCapacity = 32; // プレイヤーの弾の爆発エミッター数
+    static constexpr size_t kDanmakuBulletCapacity = 10240;     // 弾幕用の弾システムの容量
+    static constexpr size_t kPatternBulletCapacity = 8192;      // 弾幕の模様の弾の容量
+    static constexpr size_t kSpawnQueueBulletCapacity = 1024;   // 1フレームにためられる弾の生成要求の数
+    static constexpr size_t kSpawnQueuePatternCapacity = 64;    // 1フレームにためられる弾幕の模様の生成要求の数
+    static constexpr float kCollisionGridCellSize = 8.0f;       // 弾の当たり判定のグリッドのセルの一辺の長さ
+    static constexpr CollisionLayerMatrix kCollisionLayers = {  // 衝突判定を行うタイプの組み合わせ
+        { CollisionTypeId::PLAYER_ATTACK, CollisionTypeId::BOSS },
+        { CollisionTypeId::PLAYER, CollisionTypeId::BOSS_ATTACK },
+    };
+    static constexpr size_t kHitEventCapacity =                 // 1フレームにためられるヒットの数（全ての弾・近接攻撃2つ・弾幕2つが同時に当たっても溢れない数）
+        kBossBulletPoolCapacity + kPlayerBulletPoolCapacity + 4;
+    static constexpr size_t kBulletInstanceCapacity =           // 弾のインスタンス描画の最大数（全ての弾の合計）
+        kBossBulletPoolCapacity + kPlayerBulletPoolCapacity + kDanmakuBulletCapacity + kPatternBulletCapacity;
+
 public: // メンバ関数
     /// <summary>
     /// 初期化
@@ -97,14 +124,24 @@ public: // メンバ関数
     void UpdateBossBorder();
 
     /// <summary>
-    /// ボスの弾の生成処理
+    /// 生成キューにたまった弾・弾幕の模様をまとめて生成し、キューを空にする
+    /// </summary>
+    void SpawnProjectiles();
+
+    /// <summary>
+    /// 弾幕用の弾の更新（プレイヤーとの当たり判定を含む）
     /// </summary>
-    void CreateBossBullet();
+    void UpdateDanmakuBullets(float deltaTime);
 
     /// <summary>
-    /// プレイヤーの弾の生成処理
+    /// 生きている全ての弾をインスタンス描画用の配列へ詰める
     /// </summary>
-    void CreatePlayerBullet();
+    void BuildBulletInstances();
+
+    /// <summary>
+    /// 弾プールの使用状況のImGui表示
+    /// </summary>
+    void DrawProjectilePoolImGui();
 
 private: // メンバ変数
 
@@ -116,9 +153,26 @@ private: // メンバ変数
 
     std::unique_ptr<Boss> boss_;                                // ボスキャラクター
 
-    std::vector<std::unique_ptr<BossBullet>> bossBullets_;      // ボスの弾のコンテナ
+    CollisionGrid collisionGrid_;                               // 弾とプレイヤー・ボスの本体の当たり判定（弾より先に破棄されないよう前に置く）
+
+    HitEventQueue hitEvents_;                                   // 衝突判定で起きたヒット（判定の後にまとめてダメージなどを適用する）
+
+    ProjectileEffects bossBulletEffects_;                       // ボスの弾の軌跡・爆発エミッターのプール
+
+    ProjectileEffects playerBulletEffects_;                     // プレイヤーの弾の軌跡・爆発エミッターのプール
+
+    ProjectilePool<BossBullet> bossBullets_;                    // ボスの弾のプール
+
+    ProjectilePool<PlayerBullet> playerBullets_;                // プレイヤーの弾のプール
+
+    ProjectileSpawnQueue spawnQueue_;                           // ボス・プレイヤーの弾と弾幕の模様の生成要求
+
+    ProjectileSystem danmakuBullets_;                           // 弾幕用の弾（SoA、BossBullet.Batchedと追尾弾で使用）
+    BulletPatternSystem bulletPatterns_;                        // 弾幕の模様（BTBossBarrageで使用）
+
+    ProjectileInstanceBatch bulletInstances_;                   // 弾のインスタンス描画用の配列（sphere.gltf）
 
-    std::vector<std::unique_ptr<PlayerBullet>> playerBullets_;  // プレイヤーの弾のコンテナ
+    ProjectileInstanceRenderer bulletRenderer_;                 // 弾のインスタンス描画（表側の配列を1回のドローで描く）
 
     std::unique_ptr<InputHandler> inputHandler_;                // 入力ハンドラー
 